@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: MPL-2.0
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2014-2025 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file openseachest_async_writer.h
+// \brief This file defines a writer that appends buffers to a file from a background thread.
+
+#pragma once
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+#include "common_types.h"
+#include "secure_file.h"
+
+    typedef struct s_asyncFileWriter asyncFileWriter;
+
+    //-----------------------------------------------------------------------------
+    //
+    //  create_Async_File_Writer()
+    //
+    //! \brief   Description:  Creates a writer that appends buffers to an open file from a background thread so the
+    //! caller can fill the next buffer (usually from the device) while the previous one is written. The writer owns a
+    //! fixed set of reusable aligned buffers, so memory use does not depend on how much data is written.
+    //! If a thread cannot be started, buffers are written synchronously when queued.
+    //
+    //  Entry:
+    //!   \param[in] file = open file to append to. The writer does not close it.
+    //!   \param[in] bufferCount = number of buffers to rotate through. 2 or 3 is enough to keep the device busy.
+    //!   \param[in] bufferSize = size of each buffer in bytes
+    //!   \param[in] alignment = alignment for the buffers, usually device->os_info.minimumAlignment
+    //!
+    //  Exit:
+    //!   \return pointer to the writer, or M_NULLPTR if memory could not be allocated
+    //
+    //-----------------------------------------------------------------------------
+    asyncFileWriter* create_Async_File_Writer(secureFileInfo* file,
+                                              uint32_t        bufferCount,
+                                              size_t          bufferSize,
+                                              size_t          alignment);
+
+    // Returns the next free buffer, waiting for the writer if all of them are queued.
+    // Returns M_NULLPTR once a write has failed so the caller can stop reading.
+    uint8_t* get_Async_Write_Buffer(asyncFileWriter* writer);
+
+    // Hands the buffer last returned by get_Async_Write_Buffer to the writer. length may be less than the buffer size.
+    eSecureFileError queue_Async_Write_Buffer(asyncFileWriter* writer, const uint8_t* buffer, size_t length);
+
+    // Waits for all queued buffers to be written and flushes the file without stopping the writer, so the caller knows
+    // everything queued so far is in the file. Returns the first error seen by any write or the flush.
+    eSecureFileError sync_Async_File_Writer(asyncFileWriter* writer);
+
+    // Waits for all queued buffers to be written, flushes the file and frees the writer and its buffers.
+    // Returns the first error seen by any write or the flush.
+    eSecureFileError finish_Async_File_Writer(asyncFileWriter** writer);
+
+#if defined(__cplusplus)
+}
+#endif
@@ -0,0 +1,123 @@
+// SPDX-License-Identifier: MPL-2.0
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2014-2025 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file openseachest_farm.h
+// \brief This file defines a table driven decoder of the ATA FARM log.
+
+#pragma once
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+#include "common_public.h"
+#include "common_types.h"
+
+#include "openseachest_health.h"
+#include "openseachest_json.h"
+
+    // Table driven decoder of the ATA FARM log (log address A6h). Every field of the log is 8 bytes with bit 63 set
+    // when it is supported and bit 62 set when it is valid. Page N of the log starts at N times the page size given
+    // in the header page.
+    typedef enum eFARMOutputFormatEnum
+    {
+        FARM_OUTPUT_TEXT,
+        FARM_OUTPUT_CSV,
+        FARM_OUTPUT_JSON
+    } eFARMOutputFormat;
+
+#define FARM_FIELD_NAME_LENGTH 48
+#define FARM_HEAD_ELEMENTS     UINT16_C(0) // one element per head supported, as reported in the log header
+#define FARM_MAX_ELEMENTS      UINT16_C(256)
+#define FARM_NO_ELEMENT        UINT16_MAX
+
+    typedef struct s_farmField
+    {
+        char              name[FARM_FIELD_NAME_LENGTH]; // letters, digits and underscores
+        uint16_t          page;
+        uint16_t          field;    // index of the 8 byte field in the page
+        uint16_t          elements; // 1, FARM_HEAD_ELEMENTS or the size of an array such as one value per actuator
+        eHealthMetricType type;
+    } farmField;
+
+    typedef struct s_farmFieldTable
+    {
+        farmField* fields;
+        uint32_t   count;
+        uint32_t   capacity;
+    } farmFieldTable;
+
+    // Fills table with the built in drive wide fields, then adds the fields of fileName when it is not M_NULLPTR.
+    // The file has one field per line as name,page,field,count,type where count is 1, heads or an array size and
+    // type is counter or gauge. Blank lines and lines starting with # are skipped. A field named like one already in
+    // the table replaces it.
+    // Returns SUCCESS, BAD_PARAMETER, INSECURE_PATH, FILE_OPEN_ERROR, FAILURE, MEMORY_FAILURE or VALIDATION_FAILURE
+    // with the line number in errorLine.
+    eReturnValues init_FARM_Field_Table(farmFieldTable* table, const char* fileName, uint32_t* errorLine);
+
+    void free_FARM_Field_Table(farmFieldTable* table);
+
+    typedef struct s_farmValue
+    {
+        uint32_t field;   // index in the field table
+        uint16_t element; // head or array index, FARM_NO_ELEMENT for a single value
+        uint64_t value;
+    } farmValue;
+
+    typedef struct s_farmDecode
+    {
+        uint64_t   majorRevision;
+        uint64_t   minorRevision;
+        uint16_t   headsSupported;
+        farmValue* values; // supported and valid fields only, in table order
+        uint32_t   count;
+    } farmDecode;
+
+    // Returns SUCCESS, BAD_PARAMETER, MEMORY_FAILURE or VALIDATION_FAILURE when log is not a FARM log
+    eReturnValues decode_FARM_Log(const uint8_t*        log,
+                                  uint32_t              logSize,
+                                  const farmFieldTable* table,
+                                  farmDecode*           decoded);
+
+    // Decodes a FARM log saved with --farm in openSeaChest_Logs. Also returns INSECURE_PATH, FILE_OPEN_ERROR or
+    // FAILURE.
+    eReturnValues read_FARM_Log_File(const char* fileName, const farmFieldTable* table, farmDecode* decoded);
+
+    // Reads and decodes the FARM log of an ATA drive. Returns NOT_SUPPORTED for other drives.
+    eReturnValues read_FARM_Log_Device(tDevice* device, const farmFieldTable* table, farmDecode* decoded);
+
+    void free_FARM_Decode(farmDecode* decoded);
+
+    // Prints one row per value, labeled with source. When baseline is not M_NULLPTR, each row also has the baseline
+    // value, the difference and, for counters, the rate per power on hour between the two pulls. header prints the
+    // CSV column names, so several drives can be written as one CSV.
+    void print_FARM_Decode(const farmFieldTable* table,
+                           const farmDecode*     decoded,
+                           const farmDecode*     baseline,
+                           const char*           source,
+                           eFARMOutputFormat     format,
+                           bool                  header);
+
+    void write_JSON_FARM_Decode(jsonStream*           json,
+                                const char*           key,
+                                const farmFieldTable* table,
+                                const farmDecode*     decoded,
+                                const farmDecode*     baseline,
+                                const char*           source);
+
+    // Reads the FARM log of the device and writes it as a section with a status, like the other JSON sections
+    eReturnValues write_JSON_FARM_Log(jsonStream* json, const char* key, tDevice* device, const farmFieldTable* table);
+
+#if defined(__cplusplus)
+}
+#endif
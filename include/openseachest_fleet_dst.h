@@ -0,0 +1,105 @@
+// SPDX-License-Identifier: MPL-2.0
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2014-2025 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file openseachest_fleet_dst.h
+// \brief This file defines running device self-tests on many drives at once.
+
+#pragma once
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+#include "common_public.h"
+#include "common_types.h"
+
+    // State of one drive in a fleet self-test
+    typedef enum eFleetDSTStateEnum
+    {
+        FLEET_DST_STATE_WAITING,  // not started yet
+        FLEET_DST_STATE_RUNNING,  // self-test in progress
+        FLEET_DST_STATE_CLEANING, // repairing the LBA the last self-test failed on
+        FLEET_DST_STATE_PASSED,
+        FLEET_DST_STATE_FAILED,
+        FLEET_DST_STATE_ABORTED, // took longer than allowed and was aborted
+        FLEET_DST_STATE_NOT_SUPPORTED
+    } eFleetDSTState;
+
+    typedef struct s_fleetDSTDrive
+    {
+        tDevice*       device;
+        eFleetDSTState state;
+        eReturnValues  result;          // SUCCESS, NOT_SUPPORTED, IN_PROGRESS, ABORTED or FAILURE once finished
+        uint8_t        status;          // last self-test execution status
+        uint32_t       percentComplete; // of the self-test currently running
+        uint32_t       passes;          // number of self-tests started
+        uint64_t       errorLimit;      // logical blocks that may be repaired before giving up. 0 = no limit
+        uint64_t       repairedLBAs;    // logical blocks repaired during the clean-up phase
+        uint64_t       lastErrorLBA;    // LBA the last self-test failed on. UINT64_MAX if none
+        uint64_t       started;         // seconds after the fleet started that the current self-test was started
+        uint64_t       finished;        // seconds after the fleet started that the drive finished
+        uint64_t       timeLimit;       // seconds the current self-test may run before it is aborted. 0 = no limit
+        uint64_t       nextPoll;        // seconds after the fleet started that the drive is polled next
+        uint32_t       pollInterval;
+        uint32_t       wheelNext; // next drive in the same timer wheel slot
+    } fleetDSTDrive;
+
+    // Drives to run a fleet self-test on. Zero initialize before adding drives.
+    typedef struct s_fleetDST
+    {
+        fleetDSTDrive* drives;
+        uint32_t       count;
+        uint32_t       capacity;
+    } fleetDST;
+
+    // Adds a drive to the fleet. The device must stay open until run_Fleet_DST returns.
+    // errorLimit is the number of logical blocks the clean-up phase may repair on this drive, 0 for no limit.
+    // Returns SUCCESS, BAD_PARAMETER or MEMORY_FAILURE.
+    eReturnValues add_Fleet_DST_Drive(fleetDST* fleet, tDevice* device, uint64_t errorLimit);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  run_Fleet_DST()
+    //
+    //! \brief   Description:  Runs a short or long self-test on every drive in the fleet at the same time. All
+    //! self-tests are started first, then each drive is polled on its own interval from a shared one second timer
+    //! wheel, so one process keeps track of any number of drives without waiting on any single one of them. When clean
+    //! is set, a drive whose self-test fails on an LBA has that physical sector reassigned (or rewritten if it cannot
+    //! be reassigned) and the self-test is started again on that drive while the others keep running. This repeats
+    //! until the self-test passes, the same LBA fails twice, or the error limit for that drive is reached.
+    //! A table with the state of every drive is printed whenever a drive changes state, at least once a minute, and
+    //! when all drives have finished.
+    //
+    //  Entry:
+    //!   \param[in,out] fleet = drives to test. The result of each drive is stored in its entry.
+    //!   \param[in] longTest = run the long (extended) self-test instead of the short self-test
+    //!   \param[in] clean = repair the LBAs that self-tests fail on and run the self-test again
+    //!   \param[in] ignoreMaxTime = do not abort self-tests that take longer than expected
+    //!   \param[in] toolVerbosity = quiet suppresses the progress table
+    //!
+    //  Exit:
+    //!   \return SUCCESS if every drive passed, NOT_SUPPORTED if no drive supports the self-test, BAD_PARAMETER,
+    //!   MEMORY_FAILURE, ABORTED if any self-test was aborted, otherwise FAILURE.
+    //
+    //-----------------------------------------------------------------------------
+    eReturnValues run_Fleet_DST(fleetDST*        fleet,
+                                bool             longTest,
+                                bool             clean,
+                                bool             ignoreMaxTime,
+                                eVerbosityLevels toolVerbosity);
+
+    void free_Fleet_DST(fleetDST* fleet);
+
+#if defined(__cplusplus)
+}
+#endif
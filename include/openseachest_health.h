@@ -0,0 +1,209 @@
+// SPDX-License-Identifier: MPL-2.0
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2014-2025 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file openseachest_health.h
+// \brief This file defines reading health samples from a drive and the per drive health history store.
+
+#pragma once
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+#include "common_public.h"
+#include "common_types.h"
+#include "secure_file.h"
+
+    // Where a health metric was read from. Together with page and index this identifies the metric between samples.
+    typedef enum eHealthMetricSourceEnum
+    {
+        HEALTH_METRIC_ATA_SMART_RAW,        // index = attribute ID, raw value
+        HEALTH_METRIC_ATA_SMART_NORMALIZED, // index = attribute ID, current normalized value
+        HEALTH_METRIC_ATA_DEVICE_STATISTIC, // page = device statistics page, index = byte offset in the page
+        HEALTH_METRIC_NVME_HEALTH,          // index = byte offset in the SMART / health information log
+        HEALTH_METRIC_SCSI_LOG_PARAMETER,   // page = log page, index = parameter code
+        HEALTH_METRIC_SATA_PHY_EVENT        // index = phy event counter identifier
+    } eHealthMetricSource;
+
+    typedef enum eHealthMetricTypeEnum
+    {
+        HEALTH_METRIC_COUNTER, // only goes up, so a rate can be computed from two samples
+        HEALTH_METRIC_GAUGE
+    } eHealthMetricType;
+
+    typedef struct s_healthMetric
+    {
+        eHealthMetricSource source;
+        eHealthMetricType   type;
+        uint16_t            page;
+        uint16_t            index;
+        uint64_t            value;
+    } healthMetric;
+
+    // One reading of the SMART attributes, device statistics or health log pages of a device. Zero initialize before
+    // the first read and pass the same structure to every read of the same device: the pages the device supports are
+    // found on the first read, so later reads only send the commands that return data. Metrics are in the same order
+    // every time as long as the device reports the same pages.
+    typedef struct s_healthSample
+    {
+        uint64_t      timestamp; // seconds since the epoch when the sample was read
+        healthMetric* metrics;
+        uint32_t      count;
+        uint32_t      capacity;
+        bool          probed;
+        bool          smartAttributes;       // ATA SMART READ DATA returned attributes
+        uint32_t      deviceStatisticsPages; // ATA device statistics log pages read for each sample. 0 if none
+        uint8_t       scsiLogPages[8];       // SCSI log pages read for each sample
+        uint8_t       scsiLogPageCount;
+    } healthSample;
+
+    // Reads the SMART attributes and device statistics (ATA), the SMART / health information log (NVMe) or the error
+    // counter, temperature and solid state media log pages (SCSI) directly, replacing the metrics in sample.
+    // Returns SUCCESS when at least one metric was read, NOT_SUPPORTED when the device has none of these pages,
+    // MEMORY_FAILURE or FAILURE.
+    eReturnValues read_Health_Sample(tDevice* device, healthSample* sample);
+
+    // Name of the metric family, such as "ata_smart_attribute_raw" or "nvme_media_errors". Only lower case letters,
+    // digits and underscores are used so the name can be used as-is in CSV, JSON or metrics exporters.
+    const char* get_Health_Metric_Name(const healthMetric* metric);
+
+    // Finds the metric in sample with the same source, page and index as metric. hint is checked first, so passing the
+    // position of the metric in the previous sample makes a lookup in an unchanged page list a single compare.
+    // Returns M_NULLPTR when it is not in the sample.
+    const healthMetric* find_Health_Metric(const healthSample* sample, const healthMetric* metric, uint32_t hint);
+
+    void free_Health_Sample(healthSample* sample);
+
+    // The decoders below are shared with the readers of saved log pulls. Each adds the metrics it finds to sample and
+    // returns SUCCESS or MEMORY_FAILURE.
+#define HEALTH_ATA_DEVICE_STATISTICS_MAX_PAGE UINT32_C(7) // the vendor specific page is not decoded
+
+    uint64_t get_Health_Little_Endian_Value(const uint8_t* data, uint8_t length);
+
+    eReturnValues add_Health_Metric(healthSample*       sample,
+                                    eHealthMetricSource source,
+                                    eHealthMetricType   type,
+                                    uint16_t            page,
+                                    uint16_t            index,
+                                    uint64_t            value);
+
+    // log holds pages 0 through pages - 1 of the device statistics log. Pages that are not supported are skipped.
+    eReturnValues add_ATA_Device_Statistics_Metrics(healthSample* sample, const uint8_t* log, uint32_t pages);
+
+    // log is the 512 byte SMART / health information log
+    eReturnValues add_NVMe_Health_Metrics(healthSample* sample, const uint8_t* log);
+
+    // Adds the counters and binary values of up to 8 bytes in a log page. ASCII parameters are skipped.
+    eReturnValues add_SCSI_Log_Page_Metrics(healthSample* sample, const uint8_t* page, uint32_t length);
+
+    // Health store: a compact history of health samples, one file per drive named <serial number>.oshs.
+    // All values are little endian. The file starts with a 128 byte header:
+    //   0  "OSCHHIST"        8 byte signature
+    //   8  version           uint16, 2
+    //   10 header size       uint16, 128
+    //   12 reserved          uint32
+    //   16 serial number     32 bytes, zero padded
+    //   48 model number      48 bytes, zero padded
+    //   96 firmware revision 16 bytes, zero padded
+    //   112 world wide name  uint64, 0 if not reported
+    //   120 created          uint64, seconds since the epoch
+    // Records follow the header. Each record is a 12 byte header (uint8 type, uint8 reserved, uint16 count,
+    // uint32 payload length, uint32 CRC-32 of the first 8 header bytes and the payload) and a payload:
+    //   type 1, columns: count 8 byte column descriptors (uint8 source, uint8 type, uint16 page, uint16 index,
+    //           uint16 reserved) using the eHealthMetricSource and eHealthMetricType values. The columns apply to
+    //           every samples record up to the next columns record.
+    //   type 2, samples: count samples, each the timestamp followed by the value of each column in column order.
+    //           Every value is an unsigned LEB128 varint holding the zigzag encoded difference from the same value
+    //           of the previous sample. The previous values are 0 after a columns record.
+    // Counters that barely move between samples take one byte per sample. Records are only ever appended, one
+    // sample per samples record. Readers stop at the first record that runs past the end of the file or fails its
+    // CRC, and opening the store to append truncates the file there.
+#define HEALTH_STORE_VERSION UINT16_C(2)
+
+    typedef struct s_healthStore
+    {
+        secureFileInfo* file;
+        healthMetric*   columns; // only source, type, page and index are used
+        uint32_t        columnCount;
+        uint64_t        endOffset;  // where the next record is written
+        uint64_t*       lastValues; // timestamp then the value of each column of the last sample
+        uint8_t*        encoded;    // payload of the next samples record
+        size_t          encodedSize;
+    } healthStore;
+
+    //-----------------------------------------------------------------------------
+    //
+    //  open_Health_Store(tDevice* device, const char* directory, healthStore* store)
+    //
+    //! \brief   Description:  Opens the health store file of the device in directory, creating it if it does not
+    //!                         exist. An existing file is checked to be a health store of the same serial number and
+    //!                         the values of its last sample are loaded so new samples continue its delta encoding.
+    //!                         Anything after the last valid record, such as a record cut short by an interrupted
+    //!                         write, is truncated.
+    //
+    //  Entry:
+    //!   \param[in] device = device the samples are read from. The serial number names the file
+    //!   \param[in] directory = directory for the file. M_NULLPTR or empty for the current directory
+    //!   \param[out] store = store to open. Close it with close_Health_Store
+    //!
+    //  Exit:
+    //!   \return SUCCESS, BAD_PARAMETER, INSECURE_PATH, FILE_OPEN_ERROR, VALIDATION_FAILURE if the file is not a
+    //!   health store of this device, ERROR_WRITING_FILE or MEMORY_FAILURE
+    //
+    //-----------------------------------------------------------------------------
+    eReturnValues open_Health_Store(tDevice* device, const char* directory, healthStore* store);
+
+    // Appends a sample to the store. A columns record is written first when the metrics differ from the last sample.
+    // Returns SUCCESS, BAD_PARAMETER, MEMORY_FAILURE or ERROR_WRITING_FILE.
+    eReturnValues append_Health_Store_Sample(healthStore* store, const healthSample* sample);
+
+    void close_Health_Store(healthStore* store);
+
+    // Reads one health sample from the device and appends it to its health store in directory.
+    // Returns the error of read_Health_Sample, open_Health_Store or append_Health_Store_Sample.
+    eReturnValues save_Health_Store_Sample(tDevice* device, const char* directory);
+
+    // Every value of one metric in a health store file
+    typedef struct s_healthSeries
+    {
+        healthMetric metric; // value is the last value
+        uint64_t*    times;
+        uint64_t*    values;
+        uint32_t     count;
+        uint32_t     capacity;
+    } healthSeries;
+
+    typedef struct s_healthStoreContents
+    {
+        char          serialNumber[33];
+        char          modelNumber[49];
+        char          firmwareRevision[17];
+        uint64_t      worldWideName;
+        uint64_t      created;
+        uint32_t      sampleCount; // number of samples, including ones that did not have every metric
+        healthSeries* series;      // in the order the metrics first appear in the file
+        uint32_t      seriesCount;
+        uint32_t      seriesCapacity;
+    } healthStoreContents;
+
+    // Reads a health store file into one series per metric.
+    // Returns SUCCESS, BAD_PARAMETER, INSECURE_PATH, FILE_OPEN_ERROR, VALIDATION_FAILURE if the file is not a health
+    // store or is corrupt, or MEMORY_FAILURE. Records from the first one that is cut short or fails its CRC onward are
+    // ignored.
+    eReturnValues read_Health_Store(const char* fileName, healthStoreContents* contents);
+
+    void free_Health_Store_Contents(healthStoreContents* contents);
+
+#if defined(__cplusplus)
+}
+#endif
@@ -0,0 +1,104 @@
+// SPDX-License-Identifier: MPL-2.0
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2014-2025 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file openseachest_json.h
+// \brief This file defines a streaming JSON writer and the JSON sections written by the tools.
+
+#pragma once
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+#include "common_public.h"
+#include "common_types.h"
+#include "secure_file.h"
+
+#include "openseachest_health.h"
+
+    // Streaming JSON writer. Values are written as they are produced instead of building a document in memory
+    // first, so the memory used does not depend on the number of drives. Output is buffered and written to stdout,
+    // or to file when one is given. Keys are ignored inside arrays and required inside objects.
+#define JSON_STREAM_MAX_DEPTH UINT8_C(16)
+
+    typedef struct s_jsonStream
+    {
+        secureFileInfo* file; // M_NULLPTR for stdout
+        char*           buffer;
+        size_t          used;
+        uint8_t         depth;
+        bool            needComma[JSON_STREAM_MAX_DEPTH];
+        bool            inArray[JSON_STREAM_MAX_DEPTH];
+        eReturnValues   ret; // first error. Writes after an error are dropped
+    } jsonStream;
+
+    eReturnValues open_JSON_Stream(jsonStream* json, secureFileInfo* file);
+
+    // Writes anything still buffered and frees the buffer. Returns the first error of the stream.
+    eReturnValues close_JSON_Stream(jsonStream* json);
+
+    void begin_JSON_Object(jsonStream* json, const char* key);
+
+    void end_JSON_Object(jsonStream* json);
+
+    void begin_JSON_Array(jsonStream* json, const char* key);
+
+    void end_JSON_Array(jsonStream* json);
+
+    // Escapes quotes, backslashes and control characters. Bytes above 0x7F are written as \u00XX so the output is
+    // valid UTF-8 whatever the device reports.
+    void write_JSON_String(jsonStream* json, const char* key, const char* value);
+
+    void write_JSON_Unsigned(jsonStream* json, const char* key, uint64_t value);
+
+    void write_JSON_Signed(jsonStream* json, const char* key, int64_t value);
+
+    void write_JSON_Double(jsonStream* json, const char* key, double value);
+
+    void write_JSON_Bool(jsonStream* json, const char* key, bool value);
+
+    void write_JSON_Null(jsonStream* json, const char* key);
+
+    // Handle, vendor, model, serial number, firmware revision, WWN, drive and interface type, and capacity from the
+    // device structure. No commands are sent.
+    void write_JSON_Drive_Identity(jsonStream* json, const char* key, tDevice* device);
+
+    // "counter" or "gauge"
+    const char* get_JSON_Metric_Type(const healthMetric* metric);
+
+    // The sections below write an object under key with a "status" member ("success", "not supported" or
+    // "failed") followed by the data when it could be read, and return that status. write_JSON_Status writes that
+    // member for sections written elsewhere.
+    void write_JSON_Status(jsonStream* json, eReturnValues status);
+
+    // Writes the metrics of sample from the sources in sourceMask (HEALTH_METRIC_SOURCE_BIT of each source):
+    // "smartAttributes" with the raw and normalized value of each attribute, "deviceStatistics", "nvmeHealth" and
+    // "logParameters". The sample is only read when it is empty, so the sections of one device can share a sample.
+#define HEALTH_METRIC_SOURCE_BIT(source) (UINT32_C(1) << (source))
+    eReturnValues write_JSON_Health_Sample(jsonStream*   json,
+                                           const char*   key,
+                                           tDevice*      device,
+                                           healthSample* sample,
+                                           uint32_t      sourceMask);
+
+    eReturnValues write_JSON_DST_Log(jsonStream* json, const char* key, tDevice* device);
+
+    // Idle and standby power condition timers from the ATA power conditions log
+    eReturnValues write_JSON_EPC_Settings(jsonStream* json, const char* key, tDevice* device);
+
+    // Log addresses and page counts (ATA), log pages and subpages (SCSI) or log identifiers (NVMe) the device reports
+    eReturnValues write_JSON_Supported_Logs(jsonStream* json, const char* key, tDevice* device);
+
+#if defined(__cplusplus)
+}
+#endif
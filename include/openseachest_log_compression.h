@@ -0,0 +1,58 @@
+// SPDX-License-Identifier: MPL-2.0
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2014-2025 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file openseachest_log_compression.h
+// \brief This file defines background LZ4 compression of pulled log files.
+
+#pragma once
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+#include "common_types.h"
+
+    // Compresses pulled log files on a worker thread so it overlaps with pulling the next log. Each file is written to
+    // <file>.lz4, a standard LZ4 frame of independent 256KiB blocks that "lz4 -d" can read, followed by an LZ4
+    // skippable frame with an index of block offsets so a single block can be read without decompressing the rest of
+    // the file. Every compressed file is decoded again and checked against a CRC32 of the original before it is kept.
+    // The layout is described above compress_Log_File in openseachest_log_compression.c.
+#define LOG_COMPRESSION_EXTENSION ".lz4"
+
+    typedef struct s_logCompressor logCompressor;
+
+    // Returns M_NULLPTR if memory cannot be allocated. Without a thread, files are compressed as they are queued.
+    // Originals are kept unless removeOriginals is true, and are only removed once the compressed copy is verified.
+    logCompressor* create_Log_Compressor(bool removeOriginals);
+
+    // The log pulls do not report the names of the files they write, so the output directory is listed before a
+    // device's logs are pulled and again afterwards. Only files that did not exist before and whose names start with
+    // the device's serial number are queued, so files this run did not write are never compressed or removed.
+    typedef struct s_pulledLogFiles pulledLogFiles;
+
+    // Lists directory (not recursive) before the device's logs are pulled into it. M_NULLPTR or an empty directory
+    // means the current directory. Returns M_NULLPTR if compressor is M_NULLPTR, the directory cannot be listed or
+    // memory cannot be allocated. Directories cannot be listed in UEFI.
+    pulledLogFiles* start_Pulled_Log_Files(logCompressor* compressor, const char* directory);
+
+    // Queues the files pulled for the device since start_Pulled_Log_Files and frees files. Compressed files, partial
+    // telemetry pulls and their index/record files and CSV manifests are left alone. A file is only queued once.
+    void queue_Pulled_Log_Files(logCompressor* compressor, pulledLogFiles** files, const char* serialNumber);
+
+    // Waits for all queued files to be compressed and frees the compressor.
+    // Returns the number of files that could not be compressed or verified. Those are left as they were.
+    uint32_t finish_Log_Compressor(logCompressor** compressor, uint64_t* inputBytes, uint64_t* outputBytes);
+
+#if defined(__cplusplus)
+}
+#endif
@@ -0,0 +1,78 @@
+// SPDX-License-Identifier: MPL-2.0
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2014-2025 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file openseachest_log_diff.h
+// \brief This file defines comparing two saved pulls of the same log.
+
+#pragma once
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+#include "common_types.h"
+
+#include "openseachest_health.h"
+#include "openseachest_json.h"
+
+    // The layouts a saved log pull can be compared with. All but the NVMe SMART / health log can be identified from
+    // the content of the file. That log has no signature or checksum, so it has to be named explicitly.
+    typedef enum eLogSnapshotFormatEnum
+    {
+        LOG_SNAPSHOT_UNKNOWN, // identify the format from the content
+        LOG_SNAPSHOT_SCSI_LOG_PAGE,         // one log page with its 4 byte header, as returned by LOG SENSE
+        LOG_SNAPSHOT_ATA_DEVICE_STATISTICS, // the device statistics log starting from page 0
+        LOG_SNAPSHOT_SATA_PHY_EVENTS,       // the 512 byte SATA phy event counters log
+        LOG_SNAPSHOT_NVME_HEALTH            // the 512 byte SMART / health information log
+    } eLogSnapshotFormat;
+
+    typedef struct s_logSnapshot
+    {
+        eLogSnapshotFormat format;
+        uint8_t            page;    // SCSI only
+        uint8_t            subpage; // SCSI only
+        healthSample       sample;
+        bool               hasPowerOnHours;
+        uint64_t           powerOnHours;
+    } logSnapshot;
+
+    // Reads a log saved to a binary file by a pull and decodes its values. format is LOG_SNAPSHOT_UNKNOWN to identify
+    // the layout from the content, or the layout the file must have. Returns INSECURE_PATH, FILE_OPEN_ERROR or
+    // VALIDATION_FAILURE when the file cannot be positively identified as that layout.
+    eReturnValues read_Log_Snapshot(const char* fileName, eLogSnapshotFormat format, logSnapshot* snapshot);
+
+    void free_Log_Snapshot(logSnapshot* snapshot);
+
+    // True when both snapshots are pulls of the same log, so they can be compared
+    bool is_Same_Log_Snapshot(const logSnapshot* baseline, const logSnapshot* current);
+
+    // Prints the values that changed from baseline to current with the difference and, for counters, the rate per
+    // hour. hours is the time between the pulls. When it is 0 the difference in power on hours is used if the logs
+    // have them, otherwise no rates are shown.
+    void print_Log_Diff(const logSnapshot* baseline,
+                        const logSnapshot* current,
+                        uint32_t           hours,
+                        const char*        baselineName,
+                        const char*        currentName);
+
+    void write_JSON_Log_Diff(jsonStream*        json,
+                             const char*        key,
+                             const logSnapshot* baseline,
+                             const logSnapshot* current,
+                             uint32_t           hours,
+                             const char*        baselineName,
+                             const char*        currentName);
+
+#if defined(__cplusplus)
+}
+#endif
@@ -0,0 +1,73 @@
+// SPDX-License-Identifier: MPL-2.0
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2014-2025 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file openseachest_prometheus.h
+// \brief This file defines the Prometheus textfile exporter for health samples.
+
+#pragma once
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+#include "common_public.h"
+#include "common_types.h"
+
+#include "openseachest_health.h"
+
+    typedef struct s_healthExportDrive
+    {
+        char*        labels;  // device, serial, model, firmware and WWN labels, already escaped for the output
+        healthSample sample;
+        bool         sampled; // false when none of the health pages could be read
+    } healthExportDrive;
+
+    // Health samples of every drive for a metrics exporter. Zero initialize before the first drive is added.
+    typedef struct s_healthExport
+    {
+        healthExportDrive* drives;
+        uint32_t           count;
+        uint32_t           capacity;
+    } healthExport;
+
+    // Reads a health sample from the device and adds it to exporter. The labels are copied from the device so it can
+    // be closed afterwards. A drive whose pages cannot be read is still added so it is reported as not sampled.
+    // Returns the result of read_Health_Sample, BAD_PARAMETER or MEMORY_FAILURE.
+    eReturnValues add_Health_Export_Drive(healthExport* exporter, tDevice* device);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  write_Prometheus_Health_File(const healthExport* exporter, const char* fileName)
+    //
+    //! \brief   Description:  Writes the samples of every drive in exporter in the Prometheus text exposition format
+    //!                         used by the node_exporter textfile collector. Each metric family is written once with
+    //!                         its HELP and TYPE lines followed by the values of every drive, labeled by device
+    //!                         handle, serial number, model number, firmware revision and world wide name.
+    //!                         Counter families end in _total. The file is written as <fileName>.tmp and renamed over
+    //!                         fileName so a collector never reads a partial file.
+    //
+    //  Entry:
+    //!   \param[in] exporter = drives to write
+    //!   \param[in] fileName = file to replace. Should end in .prom for the textfile collector
+    //!
+    //  Exit:
+    //!   \return SUCCESS, BAD_PARAMETER, INSECURE_PATH, FILE_OPEN_ERROR, ERROR_WRITING_FILE or MEMORY_FAILURE
+    //
+    //-----------------------------------------------------------------------------
+    eReturnValues write_Prometheus_Health_File(const healthExport* exporter, const char* fileName);
+
+    void free_Health_Export(healthExport* exporter);
+
+#if defined(__cplusplus)
+}
+#endif
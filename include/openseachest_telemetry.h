@@ -0,0 +1,64 @@
+// SPDX-License-Identifier: MPL-2.0
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2014-2025 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file openseachest_telemetry.h
+// \brief This file defines streamed telemetry log pulls.
+
+#pragma once
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+#include "common_public.h"
+#include "common_types.h"
+
+    //-----------------------------------------------------------------------------
+    //
+    //  pull_Telemetry_Log_Streamed()
+    //
+    //! \brief   Description:  Pulls the ATA device internal status or NVMe telemetry log to a file under filePath one
+    //! transfer at a time. Each transfer is written by an asyncFileWriter while the next one is read from the device,
+    //! so memory use stays at a few transfers regardless of the size of the data area. SCSI devices are passed to the
+    //! library's pull_Telemetry_Log.
+    //! The log is pulled into <serial>_<log>.partial with a <serial>_<log>.partial.idx index of the blocks known to be
+    //! written. If a pull fails part way, running it again resumes from the last recorded block as long as the header
+    //! on the device still matches the partial file. Once complete, the partial file is renamed to the usual
+    //! serial number/date/time name and a <serial>_<log>.lastpull record of the header is kept.
+    //
+    //  Entry:
+    //!   \param[in] device = file descriptor
+    //!   \param[in] currentOrSaved = true for the current/host initiated log, false for the saved/controller initiated
+    //!   log
+    //!   \param[in] dataArea = last data area to pull (1 - 3 on ATA, 1 - 4 on NVMe)
+    //!   \param[in] filePath = directory to save the log in. M_NULLPTR for the current directory
+    //!   \param[in] transferSizeBytes = bytes per command. 0 uses a default size.
+    //!   \param[in] skipIfUnchanged = for the saved/controller initiated log, do not pull it again when the data
+    //!   generation number and size match the .lastpull record and that log file is still present
+    //!   \param[out] skipped = set to true when the pull was skipped because the log was unchanged. May be M_NULLPTR.
+    //!
+    //  Exit:
+    //!   \return SUCCESS, NOT_SUPPORTED, INSECURE_PATH, FILE_OPEN_ERROR, MEMORY_FAILURE, ERROR_WRITING_FILE or FAILURE
+    //
+    //-----------------------------------------------------------------------------
+    eReturnValues pull_Telemetry_Log_Streamed(tDevice*    device,
+                                              bool        currentOrSaved,
+                                              uint8_t     dataArea,
+                                              const char* filePath,
+                                              uint32_t    transferSizeBytes,
+                                              bool        skipIfUnchanged,
+                                              bool*       skipped);
+
+#if defined(__cplusplus)
+}
+#endif
@@ -369,6 +369,24 @@ extern "C"
 #define SHOW_FARM_LONG_OPT_STRING        "showFARM"
 #define SHOW_FARM_LONG_OPT               {SHOW_FARM_LONG_OPT_STRING, no_argument, &SHOW_FARM_FLAG, goTrue}
 
+// FARM decoder (saved ATA FARM logs, field tables, comparing two pulls)
+#define DECODE_FARM_FLAG                 decodeFARMFile
+#define DECODE_FARM_VAR                  const char* DECODE_FARM_FLAG = M_NULLPTR;
+#define DECODE_FARM_LONG_OPT_STRING      "decodeFARM"
+#define DECODE_FARM_LONG_OPT             {DECODE_FARM_LONG_OPT_STRING, required_argument, M_NULLPTR, 0}
+#define FARM_BASELINE_FLAG               farmBaselineFile
+#define FARM_BASELINE_VAR                const char* FARM_BASELINE_FLAG = M_NULLPTR;
+#define FARM_BASELINE_LONG_OPT_STRING    "farmBaseline"
+#define FARM_BASELINE_LONG_OPT           {FARM_BASELINE_LONG_OPT_STRING, required_argument, M_NULLPTR, 0}
+#define FARM_FIELD_TABLE_FLAG            farmFieldTableFile
+#define FARM_FIELD_TABLE_VAR             const char* FARM_FIELD_TABLE_FLAG = M_NULLPTR;
+#define FARM_FIELD_TABLE_LONG_OPT_STRING "farmFieldTable"
+#define FARM_FIELD_TABLE_LONG_OPT        {FARM_FIELD_TABLE_LONG_OPT_STRING, required_argument, M_NULLPTR, 0}
+#define FARM_FORMAT_FLAG                 farmOutputFormat
+#define FARM_FORMAT_VAR                  eFARMOutputFormat FARM_FORMAT_FLAG = FARM_OUTPUT_TEXT;
+#define FARM_FORMAT_LONG_OPT_STRING      "farmFormat"
+#define FARM_FORMAT_LONG_OPT             {FARM_FORMAT_LONG_OPT_STRING, required_argument, M_NULLPTR, 0}
+
 #define NVME_HEALTH_FLAG                 showNVMeHealthData
 #define NVME_HEALTH_VAR                  getOptBool NVME_HEALTH_FLAG = goFalse;
 #define NVME_HEALTH_LONG_OPT_STRING      "showNvmeHealth"
@@ -397,6 +415,11 @@ extern "C"
 #define DST_AND_CLEAN_LONG_OPT_STRING "dstAndClean"
 #define DST_AND_CLEAN_LONG_OPT        {DST_AND_CLEAN_LONG_OPT_STRING, no_argument, &DST_AND_CLEAN_FLAG, goTrue}
 
+#define FLEET_DST_FLAG                runFleetDST
+#define FLEET_DST_VAR                 getOptBool FLEET_DST_FLAG = goFalse;
+#define FLEET_DST_LONG_OPT_STRING     "fleetDST"
+#define FLEET_DST_LONG_OPT            {FLEET_DST_LONG_OPT_STRING, no_argument, &FLEET_DST_FLAG, goTrue}
+
 // Power related options
 #define CHECK_POWER_FLAG                    checkPower
 #define CHECK_POWER_VAR                     getOptBool CHECK_POWER_FLAG = goFalse;
@@ -1472,6 +1495,33 @@ extern "C"
 #define PUIS_FEATURE_LONG_OPT_STRING "puisFeature"
 #define PUIS_FEATURE_LONG_OPT        {PUIS_FEATURE_LONG_OPT_STRING, required_argument, M_NULLPTR, 0}
 
+// spin up the selected drives in waves limited by a concurrency and/or a 12v current budget
+#define STAGGERED_SPINUP_FLAG                 staggeredSpinup
+#define STAGGERED_SPINUP_VAR                  getOptBool STAGGERED_SPINUP_FLAG = goFalse;
+#define STAGGERED_SPINUP_LONG_OPT_STRING      "staggeredSpinup"
+#define STAGGERED_SPINUP_LONG_OPT                                                                                      \
+    {STAGGERED_SPINUP_LONG_OPT_STRING, no_argument, &STAGGERED_SPINUP_FLAG, goTrue}
+#define SPINUP_CONCURRENCY_FLAG               spinupConcurrency
+#define SPINUP_CONCURRENCY_VAR                uint32_t SPINUP_CONCURRENCY_FLAG = UINT32_C(0); /*0 = default*/
+#define SPINUP_CONCURRENCY_LONG_OPT_STRING    "spinupConcurrency"
+#define SPINUP_CONCURRENCY_LONG_OPT           {SPINUP_CONCURRENCY_LONG_OPT_STRING, required_argument, M_NULLPTR, 0}
+#define SPINUP_CURRENT_BUDGET_FLAG            spinupCurrentBudget
+#define SPINUP_CURRENT_BUDGET_VAR             uint32_t SPINUP_CURRENT_BUDGET_FLAG = UINT32_C(0); /*mA, 0 = none*/
+#define SPINUP_CURRENT_BUDGET_LONG_OPT_STRING "spinupCurrentBudget"
+#define SPINUP_CURRENT_BUDGET_LONG_OPT        {SPINUP_CURRENT_BUDGET_LONG_OPT_STRING, required_argument, M_NULLPTR, 0}
+#define SPINUP_PROFILE_FLAG                   spinupProfileFile
+#define SPINUP_PROFILE_VAR                    const char* SPINUP_PROFILE_FLAG = M_NULLPTR;
+#define SPINUP_PROFILE_LONG_OPT_STRING        "spinupProfile"
+#define SPINUP_PROFILE_LONG_OPT               {SPINUP_PROFILE_LONG_OPT_STRING, required_argument, M_NULLPTR, 0}
+#define STAGGERED_SPINUP_LONG_OPTS                                                                                     \
+    STAGGERED_SPINUP_LONG_OPT, SPINUP_CONCURRENCY_LONG_OPT, SPINUP_CURRENT_BUDGET_LONG_OPT, SPINUP_PROFILE_LONG_OPT
+
+// measure how long the first command takes after putting the drive in each power condition
+#define WAKE_LATENCY_FLAG            wakeLatencyIterations
+#define WAKE_LATENCY_VAR             uint32_t WAKE_LATENCY_FLAG = UINT32_C(0); /*0 = not requested*/
+#define WAKE_LATENCY_LONG_OPT_STRING "wakeLatency"
+#define WAKE_LATENCY_LONG_OPT        {WAKE_LATENCY_LONG_OPT_STRING, required_argument, M_NULLPTR, 0}
+
 // Show EPC Settings
 #define SHOW_EPC_SETTINGS_FLAG            showEPC
 #define SHOW_EPC_SETTINGS_VAR             getOptBool SHOW_EPC_SETTINGS_FLAG = goFalse;
@@ -1574,6 +1624,38 @@ extern "C"
 #define DEVICE_STATISTICS_LONG_OPT_STRING "deviceStatistics"
 #define DEVICE_STATISTICS_LONG_OPT        {DEVICE_STATISTICS_LONG_OPT_STRING, no_argument, &DEVICE_STATISTICS_FLAG, goTrue}
 
+// health watch (sample SMART attributes/device statistics on an interval)
+#define WATCH_FLAG                        watchInterval
+#define WATCH_VAR                         uint32_t WATCH_FLAG = UINT32_C(0); /*seconds between samples, 0 = off*/
+#define WATCH_LONG_OPT_STRING             "watch"
+#define WATCH_LONG_OPT                    {WATCH_LONG_OPT_STRING, required_argument, M_NULLPTR, 0}
+#define WATCH_FILE_FLAG                   watchFileName
+#define WATCH_FILE_VAR                    const char* WATCH_FILE_FLAG = M_NULLPTR;
+#define WATCH_FILE_LONG_OPT_STRING        "watchFile"
+#define WATCH_FILE_LONG_OPT               {WATCH_FILE_LONG_OPT_STRING, required_argument, M_NULLPTR, 0}
+
+// health store (compact per-drive history of health samples)
+#define HEALTH_STORE_FLAG                 healthStoreDirectory
+#define HEALTH_STORE_VAR                  const char* HEALTH_STORE_FLAG = M_NULLPTR;
+#define HEALTH_STORE_LONG_OPT_STRING      "healthStore"
+#define HEALTH_STORE_LONG_OPT             {HEALTH_STORE_LONG_OPT_STRING, required_argument, M_NULLPTR, 0}
+#define READ_HEALTH_STORE_FLAG            readHealthStoreFile
+#define READ_HEALTH_STORE_VAR             const char* READ_HEALTH_STORE_FLAG = M_NULLPTR;
+#define READ_HEALTH_STORE_LONG_OPT_STRING "readHealthStore"
+#define READ_HEALTH_STORE_LONG_OPT        {READ_HEALTH_STORE_LONG_OPT_STRING, required_argument, M_NULLPTR, 0}
+
+// Prometheus textfile exporter output
+#define PROMETHEUS_FILE_FLAG              prometheusFileName
+#define PROMETHEUS_FILE_VAR               const char* PROMETHEUS_FILE_FLAG = M_NULLPTR;
+#define PROMETHEUS_FILE_LONG_OPT_STRING   "prometheusFile"
+#define PROMETHEUS_FILE_LONG_OPT          {PROMETHEUS_FILE_LONG_OPT_STRING, required_argument, M_NULLPTR, 0}
+
+// JSON output for the informational options
+#define JSON_OUTPUT_FLAG                  jsonOutput
+#define JSON_OUTPUT_VAR                   getOptBool JSON_OUTPUT_FLAG = goFalse;
+#define JSON_OUTPUT_LONG_OPT_STRING       "jsonOutput"
+#define JSON_OUTPUT_LONG_OPT              {JSON_OUTPUT_LONG_OPT_STRING, no_argument, &JSON_OUTPUT_FLAG, goTrue}
+
 #define CDL_FEATURE_IDENTIFIER            cdlFeature
 #define CDL_FEATURE_VAR                   eCDLFeatureSet CDL_FEATURE_IDENTIFIER = CDL_FEATURE_UNKNOWN;
 #define CDL_FEATURE_LONG_OPT_STRING       "CDLfeature"
@@ -1623,6 +1705,55 @@ extern "C"
 #define REPORT_ZONES_LONG_OPT_STRING "reportZones"
 #define REPORT_ZONES_LONG_OPT        {REPORT_ZONES_LONG_OPT_STRING, required_argument, M_NULLPTR, 0}
 
+#define ZONE_SUMMARY_FLAG          zoneSummary
+#define ZONE_SUMMARY_SNAPSHOT_FLAG zoneSummarySnapshot
+#define ZONE_SUMMARY_VARS                                                                                              \
+    bool        ZONE_SUMMARY_FLAG          = false;                                                                    \
+    const char* ZONE_SUMMARY_SNAPSHOT_FLAG = M_NULLPTR;
+#define ZONE_SUMMARY_LONG_OPT_STRING "zoneSummary"
+#define ZONE_SUMMARY_LONG_OPT        {ZONE_SUMMARY_LONG_OPT_STRING, optional_argument, M_NULLPTR, 0}
+
+#define ZONE_COUNT_FLAG             zoneCount
+#define ZONE_COUNT_VAR              uint32_t ZONE_COUNT_FLAG = UINT32_C(0);
+#define ZONE_COUNT_LONG_OPT_STRING  "zoneCount"
+#define ZONE_COUNT_LONG_OPT         {ZONE_COUNT_LONG_OPT_STRING, required_argument, M_NULLPTR, 0}
+
+#define ZONE_LIST_FLAG              zoneListFile
+#define ZONE_LIST_VAR               const char* ZONE_LIST_FLAG = M_NULLPTR;
+#define ZONE_LIST_LONG_OPT_STRING   "zoneList"
+#define ZONE_LIST_LONG_OPT          {ZONE_LIST_LONG_OPT_STRING, required_argument, M_NULLPTR, 0}
+
+#define ZONE_FILTER_FLAG            zoneFilter
+#define ZONE_FILTER_MODE_FLAG       zoneFilterMode
+#define ZONE_FILTER_VARS                                                                                               \
+    bool ZONE_FILTER_FLAG      = false;                                                                                \
+    int  ZONE_FILTER_MODE_FLAG = 0; /*This will be cast to a proper enum type later...*/
+#define ZONE_FILTER_LONG_OPT_STRING "zoneFilter"
+#define ZONE_FILTER_LONG_OPT        {ZONE_FILTER_LONG_OPT_STRING, required_argument, M_NULLPTR, 0}
+
+#define ZONE_BATCH_FLAG             zoneBatch
+#define ZONE_BATCH_VAR              getOptBool ZONE_BATCH_FLAG = goFalse;
+#define ZONE_BATCH_LONG_OPT_STRING  "zoneBatch"
+#define ZONE_BATCH_LONG_OPT         {ZONE_BATCH_LONG_OPT_STRING, no_argument, &ZONE_BATCH_FLAG, goTrue}
+
+#define ZONE_WRITE_BENCHMARK_FLAG                zoneWriteBenchmark
+#define ZONE_WRITE_BENCHMARK_ZONES               zoneWriteBenchmarkZones
+#define ZONE_WRITE_BENCHMARK_TRANSFER            zoneWriteBenchmarkTransfer
+#define ZONE_WRITE_BENCHMARK_LIMIT               zoneWriteBenchmarkLimit
+#define ZONE_WRITE_BENCHMARK_VARS                                                                                      \
+    bool     ZONE_WRITE_BENCHMARK_FLAG     = false;                                                                    \
+    uint32_t ZONE_WRITE_BENCHMARK_ZONES    = UINT32_C(4);                                                              \
+    uint32_t ZONE_WRITE_BENCHMARK_TRANSFER = UINT32_C(131072);                                                         \
+    uint64_t ZONE_WRITE_BENCHMARK_LIMIT    = UINT64_C(268435456);
+#define ZONE_WRITE_BENCHMARK_LONG_OPT_STRING     "zoneWriteBenchmark"
+#define ZONE_WRITE_BENCHMARK_LONG_OPT            {ZONE_WRITE_BENCHMARK_LONG_OPT_STRING, optional_argument, M_NULLPTR, 0}
+#define ZONE_WRITE_TRANSFER_SIZE_LONG_OPT_STRING "zoneWriteTransferSize"
+#define ZONE_WRITE_TRANSFER_SIZE_LONG_OPT                                                                              \
+    {ZONE_WRITE_TRANSFER_SIZE_LONG_OPT_STRING, required_argument, M_NULLPTR, 0}
+// bytes written to each zone by --zoneWriteBenchmark, 0 fills each zone
+#define ZONE_WRITE_LIMIT_LONG_OPT_STRING         "zoneWriteLimit"
+#define ZONE_WRITE_LIMIT_LONG_OPT                {ZONE_WRITE_LIMIT_LONG_OPT_STRING, required_argument, M_NULLPTR, 0}
+
 #define CLOSE_ZONE_FLAG              zoneClose
 #define FINISH_ZONE_FLAG             zoneFinish
 #define OPEN_ZONE_FLAG               zoneOpen
@@ -1856,16 +1987,25 @@ extern "C"
 #define SCSI_DEFECTS_GROWN_LIST      scsiGrownDefects
 #define SCSI_DEFECTS_DESCRIPTOR_MODE scsiDefectsAddressType
 #define SCSI_DEFECTS_DESC_MODE_VAR   int SCSI_DEFECTS_DESCRIPTOR_MODE = 5; // physical CHS as default
+#define SCSI_DEFECTS_FILE            scsiDefectsFile
+#define SCSI_DEFECTS_FILE_FORMAT     scsiDefectsFileFormat
 #define SCSI_DEFECTS_VARS                                                                                              \
-    bool SCSI_DEFECTS_FLAG         = false;                                                                            \
-    bool SCSI_DEFECTS_PRIMARY_LIST = false;                                                                            \
-    bool SCSI_DEFECTS_GROWN_LIST   = false;                                                                            \
+    bool                    SCSI_DEFECTS_FLAG         = false;                                                         \
+    bool                    SCSI_DEFECTS_PRIMARY_LIST = false;                                                         \
+    bool                    SCSI_DEFECTS_GROWN_LIST   = false;                                                         \
+    const char*             SCSI_DEFECTS_FILE         = M_NULLPTR;                                                     \
+    eSCSIDefectStreamFormat SCSI_DEFECTS_FILE_FORMAT  = SCSI_DEFECT_STREAM_CSV;                                        \
     SCSI_DEFECTS_DESC_MODE_VAR
 #define SCSI_DEFECTS_DESCRIPTOR_MODE_LONG_OPT_STRING "defectFormat"
 #define SCSI_DEFECTS_LONG_OPT_STRING                 "showSCSIDefects"
+#define SCSI_DEFECTS_FILE_LONG_OPT_STRING            "defectFile"
+#define SCSI_DEFECTS_FILE_FORMAT_LONG_OPT_STRING     "defectFileFormat"
 #define SCSI_DEFECTS_LONG_OPT                        {SCSI_DEFECTS_LONG_OPT_STRING, required_argument, M_NULLPTR, 0}
 #define SCSI_DEFECTS_MODE_LONG_OPTS                  {SCSI_DEFECTS_DESCRIPTOR_MODE_LONG_OPT_STRING, required_argument, M_NULLPTR, 0}
-#define SCSI_DEFECTS_LONG_OPTS                       SCSI_DEFECTS_LONG_OPT, SCSI_DEFECTS_MODE_LONG_OPTS
+#define SCSI_DEFECTS_FILE_LONG_OPT                   {SCSI_DEFECTS_FILE_LONG_OPT_STRING, required_argument, M_NULLPTR, 0}
+#define SCSI_DEFECTS_FILE_FORMAT_LONG_OPT            {SCSI_DEFECTS_FILE_FORMAT_LONG_OPT_STRING, required_argument, M_NULLPTR, 0}
+#define SCSI_DEFECTS_LONG_OPTS                                                                                         \
+    SCSI_DEFECTS_LONG_OPT, SCSI_DEFECTS_MODE_LONG_OPTS, SCSI_DEFECTS_FILE_LONG_OPT, SCSI_DEFECTS_FILE_FORMAT_LONG_OPT
 
 // Reallocate Blocks Options
 #define SCSI_REALLOCATE_BLOCKS_LIST        scsiReallocateBlocksList
@@ -1941,6 +2081,53 @@ extern "C"
 #define INFROMATIONAL_EXCEPTIONS_LONG_OPT                                                                              \
     {INFORMATIONAL_EXCEPTIONS_LONG_OPT_STRING, no_argument, &INFORMATIONAL_EXCEPTIONS_FLAG, goTrue}
 
+// Pull the file based logs from all selected devices at the same time
+#define PARALLEL_LOGS_FLAG           parallelLogCollection
+#define PARALLEL_LOGS_PER_CONTROLLER parallelLogsPerController
+#define PARALLEL_LOGS_VARS                                                                                             \
+    bool     PARALLEL_LOGS_FLAG           = false;                                                                     \
+    uint32_t PARALLEL_LOGS_PER_CONTROLLER = UINT32_C(4);
+#define PARALLEL_LOGS_LONG_OPT_STRING "parallelLogs"
+#define PARALLEL_LOGS_LONG_OPT        {PARALLEL_LOGS_LONG_OPT_STRING, optional_argument, M_NULLPTR, 0}
+
+// Do not pull the saved telemetry log again if it has not changed since the last pull to the same output path
+#define SKIP_UNCHANGED_LOGS_FLAG            skipUnchangedLogs
+#define SKIP_UNCHANGED_LOGS_VAR             getOptBool SKIP_UNCHANGED_LOGS_FLAG = goFalse;
+#define SKIP_UNCHANGED_LOGS_LONG_OPT_STRING "skipUnchangedLogs"
+#define SKIP_UNCHANGED_LOGS_LONG_OPT                                                                                   \
+    {SKIP_UNCHANGED_LOGS_LONG_OPT_STRING, no_argument, &SKIP_UNCHANGED_LOGS_FLAG, goTrue}
+
+// Compress the logs written to the output path as they are pulled
+#define COMPRESS_LOGS_FLAG            compressLogs
+#define COMPRESS_LOGS_VAR             getOptBool COMPRESS_LOGS_FLAG = goFalse;
+#define COMPRESS_LOGS_LONG_OPT_STRING "compressLogs"
+#define COMPRESS_LOGS_LONG_OPT        {COMPRESS_LOGS_LONG_OPT_STRING, no_argument, &COMPRESS_LOGS_FLAG, goTrue}
+
+// Remove each original log once its compressed copy has been read back and verified
+#define COMPRESS_LOGS_REMOVE_ORIGINAL_FLAG            compressLogsRemoveOriginal
+#define COMPRESS_LOGS_REMOVE_ORIGINAL_VAR             getOptBool COMPRESS_LOGS_REMOVE_ORIGINAL_FLAG = goFalse;
+#define COMPRESS_LOGS_REMOVE_ORIGINAL_LONG_OPT_STRING "compressLogsRemoveOriginal"
+#define COMPRESS_LOGS_REMOVE_ORIGINAL_LONG_OPT                                                                         \
+    {COMPRESS_LOGS_REMOVE_ORIGINAL_LONG_OPT_STRING, no_argument, &COMPRESS_LOGS_REMOVE_ORIGINAL_FLAG, goTrue}
+
+// Compare two saved pulls of the same log and show the values that changed
+#define LOG_DIFF_FLAG                     logDiffFile
+#define LOG_DIFF_VAR                      const char* LOG_DIFF_FLAG = M_NULLPTR;
+#define LOG_DIFF_LONG_OPT_STRING          "logDiff"
+#define LOG_DIFF_LONG_OPT                 {LOG_DIFF_LONG_OPT_STRING, required_argument, M_NULLPTR, 0}
+#define LOG_DIFF_BASELINE_FLAG            logDiffBaselineFile
+#define LOG_DIFF_BASELINE_VAR             const char* LOG_DIFF_BASELINE_FLAG = M_NULLPTR;
+#define LOG_DIFF_BASELINE_LONG_OPT_STRING "logDiffBaseline"
+#define LOG_DIFF_BASELINE_LONG_OPT        {LOG_DIFF_BASELINE_LONG_OPT_STRING, required_argument, M_NULLPTR, 0}
+#define LOG_DIFF_HOURS_FLAG               logDiffHours
+#define LOG_DIFF_HOURS_VAR                uint32_t LOG_DIFF_HOURS_FLAG = UINT32_C(0);
+#define LOG_DIFF_HOURS_LONG_OPT_STRING    "logDiffHours"
+#define LOG_DIFF_HOURS_LONG_OPT           {LOG_DIFF_HOURS_LONG_OPT_STRING, required_argument, M_NULLPTR, 0}
+#define LOG_DIFF_FORMAT_FLAG              logDiffFormat
+#define LOG_DIFF_FORMAT_VAR               int LOG_DIFF_FORMAT_FLAG = 0; /*cast to eLogSnapshotFormat later*/
+#define LOG_DIFF_FORMAT_LONG_OPT_STRING   "logDiffFormat"
+#define LOG_DIFF_FORMAT_LONG_OPT          {LOG_DIFF_FORMAT_LONG_OPT_STRING, required_argument, M_NULLPTR, 0}
+
 // Show SMART Error Log
 #define SHOW_SMART_ERROR_LOG_FLAG showSMARTErrorLog
 #define SHOW_SMART_ERROR_LOG_MODE                                                                                      \
@@ -2189,6 +2376,16 @@ extern "C"
 #define PULL_POWER_TELEMETRY_DATA_LONG_OPT                                                                             \
     {PULL_POWER_TELEMETRY_DATA_LONG_OPT_STRING, no_argument, &PULL_POWER_TELEMETRY_DATA_FLAG, goTrue}
 
+// request power measurements back to back for a number of seconds and keep every sample
+#define POWER_SAMPLING_FLAG              powerSamplingSeconds
+#define POWER_SAMPLING_VAR               uint32_t POWER_SAMPLING_FLAG = UINT32_C(0); /*0 = off*/
+#define POWER_SAMPLING_LONG_OPT_STRING   "powerSampling"
+#define POWER_SAMPLING_LONG_OPT          {POWER_SAMPLING_LONG_OPT_STRING, required_argument, M_NULLPTR, 0}
+#define POWER_SAMPLE_DIR_FLAG            powerSampleDirectory
+#define POWER_SAMPLE_DIR_VAR             const char* POWER_SAMPLE_DIR_FLAG = M_NULLPTR;
+#define POWER_SAMPLE_DIR_LONG_OPT_STRING "powerSampleDir"
+#define POWER_SAMPLE_DIR_LONG_OPT        {POWER_SAMPLE_DIR_LONG_OPT_STRING, required_argument, M_NULLPTR, 0}
+
 // Seagate SATA quick format - This may have different requirements to support. Not supported on all Seagate products.
 #define SEAGATE_SATA_QUICK_FORMAT                 sataQuickFormat
 #define SEAGATE_SATA_QUICK_FORMAT_VARS            getOptBool SEAGATE_SATA_QUICK_FORMAT = goFalse;
@@ -2598,6 +2795,14 @@ extern "C"
 #define RAW_INPUT_FILE_OFFSET_LONG_OPT_STRING "inputOffset"
 #define RAW_INPUT_FILE_OFFSET_LONG_OPT        {RAW_INPUT_FILE_OFFSET_LONG_OPT_STRING, required_argument, M_NULLPTR, 0}
 
+#define RAW_HEX_DUMP_BENCHMARK_FLAG            rawHexDumpBenchmark
+#define RAW_HEX_DUMP_BENCHMARK_MIB             rawHexDumpBenchmarkMiB
+#define RAW_HEX_DUMP_BENCHMARK_VARS                                                                                    \
+    bool     RAW_HEX_DUMP_BENCHMARK_FLAG = false;                                                                      \
+    uint32_t RAW_HEX_DUMP_BENCHMARK_MIB  = UINT32_C(16);
+#define RAW_HEX_DUMP_BENCHMARK_LONG_OPT_STRING "hexDumpBenchmark"
+#define RAW_HEX_DUMP_BENCHMARK_LONG_OPT        {RAW_HEX_DUMP_BENCHMARK_LONG_OPT_STRING, optional_argument, M_NULLPTR, 0}
+
 // check Pending List count
 #define CHECK_PENDING_LIST_COUNT_FLAG         checkPendingListCount
 #define CHECK_PENDING_LIST_COUNT_VALUE        pendlingListCountToCheck
@@ -2628,6 +2833,17 @@ extern "C"
 #define SHOW_PENDING_LIST_LONG_OPT_STRING    "showPendingList"
 #define SHOW_PENDING_LIST_LONG_OPT           {SHOW_PENDING_LIST_LONG_OPT_STRING, no_argument, &SHOW_PENDING_LIST, goTrue}
 
+// repair pending list
+#define REPAIR_PENDING_LIST_FLAG             repairPendingList
+#define REPAIR_PENDING_LIST_MODE_FLAG        repairPendingListMode
+#define REPAIR_PENDING_LIST_LIMIT_FLAG       repairPendingListErrorLimitGiven
+#define REPAIR_PENDING_LIST_VARS                                                                                       \
+    bool REPAIR_PENDING_LIST_FLAG       = false;                                                                       \
+    int  REPAIR_PENDING_LIST_MODE_FLAG  = 0; /*This will be cast to a proper enum type later...*/                      \
+    bool REPAIR_PENDING_LIST_LIMIT_FLAG = false; /*only limit failures when --errorLimit is given*/
+#define REPAIR_PENDING_LIST_LONG_OPT_STRING  "repairPendingList"
+#define REPAIR_PENDING_LIST_LONG_OPT         {REPAIR_PENDING_LIST_LONG_OPT_STRING, optional_argument, M_NULLPTR, 0}
+
 #define CREATE_UNCORRECTABLE_FLAG            createUncorrectable
 #define CREATE_UNCORRECTABLE_VAR             bool CREATE_UNCORRECTABLE_FLAG = false;
 #define CREATE_UNCORRECTABLE_LBA_FLAG        uncorrectableLBA
@@ -2646,6 +2862,17 @@ extern "C"
 #define RANDOM_UNCORRECTABLES_LONG_OPT_STRING "randomUncorrectables"
 #define RANDOM_UNCORRECTABLES_LONG_OPT        {RANDOM_UNCORRECTABLES_LONG_OPT_STRING, required_argument, M_NULLPTR, 0}
 
+#define UNCORRECTABLE_LIST_FLAG               uncorrectableListFile
+#define UNCORRECTABLE_LIST_VAR                const char* UNCORRECTABLE_LIST_FLAG = M_NULLPTR;
+#define UNCORRECTABLE_LIST_LONG_OPT_STRING    "uncorrectableList"
+#define UNCORRECTABLE_LIST_LONG_OPT           {UNCORRECTABLE_LIST_LONG_OPT_STRING, required_argument, M_NULLPTR, 0}
+
+#define RANDOM_UNCORRECTABLE_RANGES_FLAG            randomUncorrectableRangeCount
+#define RANDOM_UNCORRECTABLE_RANGES_VAR             uint32_t RANDOM_UNCORRECTABLE_RANGES_FLAG = UINT32_C(0);
+#define RANDOM_UNCORRECTABLE_RANGES_LONG_OPT_STRING "randomUncorrectableRanges"
+#define RANDOM_UNCORRECTABLE_RANGES_LONG_OPT                                                                           \
+    {RANDOM_UNCORRECTABLE_RANGES_LONG_OPT_STRING, required_argument, M_NULLPTR, 0}
+
 #define FLAG_UNCORRECTABLES_FLAG              flagUncorrectable
 #define FLAG_UNCORRECTABLES_VAR               getOptBool FLAG_UNCORRECTABLES_FLAG = goFalse;
 #define FLAG_UNCORRECTABLE_LONG_OPT_STRING    "flaggedUncorrectable"
@@ -3214,6 +3441,14 @@ extern "C"
 
     void print_Show_FARM_Help(bool shortHelp);
 
+    void print_Decode_FARM_Help(bool shortHelp);
+
+    void print_FARM_Baseline_Help(bool shortHelp);
+
+    void print_FARM_Field_Table_Help(bool shortHelp);
+
+    void print_FARM_Format_Help(bool shortHelp);
+
     //-----------------------------------------------------------------------------
     //
     //  print_Abort_DST_Help()
@@ -3723,6 +3958,8 @@ extern "C"
 
     void print_DST_And_Clean_Help(bool shortHelp);
 
+    void print_Fleet_DST_Help(bool shortHelp);
+
     void print_Generic_Test_Mode_Help(bool shortHelp);
 
     void print_Show_Supported_Erase_Modes_Help(bool shortHelp);
@@ -3791,6 +4028,16 @@ extern "C"
 
     void print_PUIS_Feature_Help(bool shortHelp);
 
+    void print_Staggered_Spinup_Help(bool shortHelp);
+
+    void print_Spinup_Concurrency_Help(bool shortHelp);
+
+    void print_Spinup_Current_Budget_Help(bool shortHelp);
+
+    void print_Spinup_Profile_Help(bool shortHelp);
+
+    void print_Wake_Latency_Help(bool shortHelp);
+
     void print_Show_EPC_Settings_Help(bool shortHelp);
 
     void print_SMART_Feature_Help(bool shortHelp);
@@ -3823,6 +4070,37 @@ extern "C"
 
     void print_Device_Statistics_Help(bool shortHelp);
 
+    void print_Watch_Help(bool shortHelp);
+
+    void print_Watch_File_Help(bool shortHelp);
+
+    void print_Health_Store_Help(bool shortHelp);
+
+    void print_Read_Health_Store_Help(bool shortHelp);
+
+    void print_Prometheus_File_Help(bool shortHelp);
+
+    void print_JSON_Output_Help(bool shortHelp, const char* supportedOptions);
+
+    // An option that only has human readable output, and whether it was given
+    typedef struct s_textOnlyOption
+    {
+        bool        given;
+        const char* name; // as typed on the command line, e.g. "--llInfo"
+    } textOnlyOption;
+
+    // Returns false after printing an error naming the first given option, since its report would be written into
+    // the JSON document. supportedOptions lists the options that have a JSON section.
+    bool check_JSON_Output_Options(const textOnlyOption* options, size_t count, const char* supportedOptions);
+
+    // Sends everything printed to stdout from here on to stderr, so stdout only carries what is written to
+    // get_Data_Output_Stream (a JSON document or CSV rows) and messages keep the verbosity the tool was run with.
+    // stdout is always the console in UEFI, so nothing is moved there.
+    void move_Messages_To_Stderr(void);
+
+    // stdout as it was before move_Messages_To_Stderr was called
+    FILE* get_Data_Output_Stream(void);
+
     void print_Reinitialize_Device_Statistics_Help(bool shortHelp);
 
     void print_Reinitialize_SATA_Phy_Events_Help(bool shortHelp);
@@ -3843,6 +4121,22 @@ extern "C"
 
     void print_Zone_ID_Help(bool shortHelp);
 
+    void print_Zone_Summary_Help(bool shortHelp);
+
+    void print_Zone_Count_Help(bool shortHelp);
+
+    void print_Zone_List_Help(bool shortHelp);
+
+    void print_Zone_Filter_Help(bool shortHelp);
+
+    void print_Zone_Batch_Help(bool shortHelp);
+
+    void print_Zone_Write_Benchmark_Help(bool shortHelp);
+
+    void print_Zone_Write_Transfer_Size_Help(bool shortHelp);
+
+    void print_Zone_Write_Limit_Help(bool shortHelp);
+
     void print_FWDL_Segment_Size_Help(bool shortHelp);
 
     void print_FWDL_Ignore_Final_Segment_Help(bool shortHelp);
@@ -3934,6 +4228,10 @@ extern "C"
 
     void print_SCSI_Defects_Format_Help(bool shortHelp);
 
+    void print_SCSI_Defects_File_Help(bool shortHelp);
+
+    void print_SCSI_Defects_File_Format_Help(bool shortHelp);
+
     void print_Reallocate_LBAs_Help(bool shortHelp);
 
     void print_Log_Transfer_Length_Help(bool shortHelp);
@@ -3955,6 +4253,22 @@ extern "C"
     //-----------------------------------------------------------------------------
     void print_Pull_Device_Statistics_Log_Help(bool shortHelp);
 
+    void print_Parallel_Logs_Help(bool shortHelp);
+
+    void print_Skip_Unchanged_Logs_Help(bool shortHelp);
+
+    void print_Compress_Logs_Help(bool shortHelp);
+
+    void print_Compress_Logs_Remove_Original_Help(bool shortHelp);
+
+    void print_Log_Diff_Help(bool shortHelp);
+
+    void print_Log_Diff_Baseline_Help(bool shortHelp);
+
+    void print_Log_Diff_Hours_Help(bool shortHelp);
+
+    void print_Log_Diff_Format_Help(bool shortHelp);
+
     //-----------------------------------------------------------------------------
     //
     //  print_Pull_Informational_Exceptions_Log_Help()
@@ -4113,6 +4427,10 @@ extern "C"
 
     void print_Pull_Power_Telemetry_Help(bool shortHelp);
 
+    void print_Power_Sampling_Help(bool shortHelp);
+
+    void print_Power_Sample_Dir_Help(bool shortHelp);
+
     void print_Get_Telemetry_Help(bool shortHelp);
 
     void print_Telemetry_Data_Set_Help(bool shortHelp);
@@ -4235,12 +4553,35 @@ extern "C"
 
     void print_Raw_Input_File_Offset_Help(bool shortHelp);
 
+    void print_Raw_Hex_Dump_Benchmark_Help(bool shortHelp);
+
+    //-----------------------------------------------------------------------------
+    //
+    //  print_Data_Buffer_Fast()
+    //
+    //! \brief   Description:  Prints a data buffer as a hex dump in the same layout as print_Data_Buffer, but formats
+    //! whole lines from a lookup table into a large block and writes the block to stdout at once. Intended for dumping
+    //! large buffers (log pages, multi-MB reads) where per-byte printf calls dominate the time spent.
+    //
+    //  Entry:
+    //!   \param[in] dataBuffer = pointer to the data to print
+    //!   \param[in] bufferLen = number of bytes in dataBuffer to print
+    //!   \param[in] showPrint = set to true to show the printable ASCII column next to the hex bytes
+    //!
+    //  Exit:
+    //!   \return number of characters written to stdout
+    //
+    //-----------------------------------------------------------------------------
+    uint64_t print_Data_Buffer_Fast(const uint8_t* dataBuffer, uint32_t bufferLen, bool showPrint);
+
     void print_Check_Pending_List_Help(bool shortHelp);
 
     void print_Check_Grown_List_Help(bool shortHelp);
 
     void print_Show_Pending_List_Help(bool shortHelp);
 
+    void print_Repair_Pending_List_Help(bool shortHelp);
+
     //-----------------------------------------------------------------------------
     //
     //  print_Create_Uncorrectable_Help()
@@ -4288,6 +4629,10 @@ extern "C"
     //-----------------------------------------------------------------------------
     void print_Random_Uncorrectable_Help(bool shortHelp);
 
+    void print_Uncorrectable_List_Help(bool shortHelp);
+
+    void print_Random_Uncorrectable_Ranges_Help(bool shortHelp);
+
     //-----------------------------------------------------------------------------
     //
     //  print_Disable_Read_Uncorrectables_Help()
@@ -4348,6 +4693,121 @@ extern "C"
 
     void get_Scan_Flags(deviceScanFlags* scanFlags, const char* optarg);
 
+    // Adds up the sizes of the regular files directly inside path (not recursive).
+    // Returns false if the directory cannot be read or listing directories is not supported on this system.
+    bool get_Directory_File_Bytes(const char* path, uint64_t* totalBytes);
+
+    // Sorted set of LBA ranges used to record bad or pending LBAs as ranges instead of one entry per LBA. Ranges that
+    // overlap or touch are merged as they are added, so a bad patch of thousands of sectors is a single entry.
+    // Lookups and finding where a range goes are binary searches. Ranges are kept in an array in LBA order, so adding
+    // in increasing LBA order (as a scan does) only appends or extends the last range.
+    // Zero initialize the structure before use and iterate intervals[0] - intervals[count - 1] in LBA order.
+    typedef struct s_lbaInterval
+    {
+        uint64_t start;
+        uint64_t length;
+    } lbaInterval;
+
+    typedef struct s_lbaIntervalSet
+    {
+        lbaInterval* intervals;
+        uint32_t     count;
+        uint32_t     capacity;
+        uint64_t     totalLBAs; // number of LBAs covered by all ranges, for comparing against an error limit
+    } lbaIntervalSet;
+
+    // Adds start through start + length - 1, merging it with any ranges it overlaps or touches.
+    // Returns SUCCESS, BAD_PARAMETER or MEMORY_FAILURE. The set is unchanged on failure.
+    eReturnValues add_LBA_Interval(lbaIntervalSet* set, uint64_t start, uint64_t length);
+
+    // Removes start through start + length - 1 from the set, splitting a range if needed.
+    // Returns SUCCESS, BAD_PARAMETER or MEMORY_FAILURE. The set is unchanged on failure.
+    eReturnValues remove_LBA_Interval(lbaIntervalSet* set, uint64_t start, uint64_t length);
+
+    // Returns true if lba is in the set. index is set to the range holding lba, or to the first range after lba when
+    // it is not in the set. index may be M_NULLPTR.
+    bool find_LBA_Interval(const lbaIntervalSet* set, uint64_t lba, uint32_t* index);
+
+    void free_LBA_Interval_Set(lbaIntervalSet* set);
+
+    // Output formats for stream_SCSI_Defect_List. The screen format is used when no file name is given.
+    typedef enum eSCSIDefectStreamFormatEnum
+    {
+        SCSI_DEFECT_STREAM_SCREEN,
+        SCSI_DEFECT_STREAM_CSV,
+        SCSI_DEFECT_STREAM_BINARY
+    } eSCSIDefectStreamFormat;
+
+    //-----------------------------------------------------------------------------
+    //
+    //  stream_SCSI_Defect_List()
+    //
+    //! \brief   Description:  Reads the primary and/or grown defect list with READ DEFECT DATA (12) one fixed size
+    //! buffer at a time, using the address descriptor index to page through the list. Each page is written to the
+    //! screen or to the file before the next one is read, so memory use does not depend on the size of the list and an
+    //! interrupted run leaves every entry read so far in the output.
+    //! The CSV file has one row per defect. The binary file is the 8 byte READ DEFECT DATA (12) header from the first
+    //! page followed by the raw address descriptors, so it has the same layout as a single full length response. The
+    //! defect list length in that header is the length of the full list, so a truncated file can be detected.
+    //
+    //  Entry:
+    //!   \param[in] device = file descriptor
+    //!   \param[in] defectListFormat = address descriptor format to request (0 - 5)
+    //!   \param[in] grownList = request the grown defect list
+    //!   \param[in] primaryList = request the primary defect list
+    //!   \param[in] outputFormat = screen, CSV or binary
+    //!   \param[in] fileName = file to write CSV or binary output to. Ignored for screen output.
+    //!   \param[out] defectCount = number of defects written. May be M_NULLPTR.
+    //!
+    //  Exit:
+    //!   \return SUCCESS, NOT_SUPPORTED, BAD_PARAMETER, INSECURE_PATH, FILE_OPEN_ERROR, MEMORY_FAILURE,
+    //!   ERROR_WRITING_FILE or FAILURE. NOT_SUPPORTED is returned when the first READ DEFECT DATA (12) fails or the
+    //!   device returns a different descriptor format than requested, so callers can fall back to the library's
+    //!   get_SCSI_Defect_List.
+    //
+    //-----------------------------------------------------------------------------
+    eReturnValues stream_SCSI_Defect_List(tDevice*                device,
+                                          uint8_t                 defectListFormat,
+                                          bool                    grownList,
+                                          bool                    primaryList,
+                                          eSCSIDefectStreamFormat outputFormat,
+                                          const char*             fileName,
+                                          uint64_t*               defectCount);
+
+    // Sets the console colors when stdout is a terminal. Escape sequences are not written to files or pipes.
+    void set_Console_Output_Colors(eConsoleColors foreground, eConsoleColors background);
+
+    // Splits the next comma separated column off of a line of a table file and trims the spaces around it. cursor is
+    // moved past the column and set to M_NULLPTR after the last one. Returns M_NULLPTR when there are no more columns.
+    char* next_Table_File_Column(char** cursor);
+
+    // Spin up current and time of one drive model, used to schedule spin ups within a power budget
+    typedef struct s_spinupProfile
+    {
+        char     modelPrefix[MODEL_NUM_LEN + 1]; // empty for the built in defaults
+        uint32_t milliamps;                      // 12v current drawn while the spindle starts
+        uint32_t seconds;                        // time until the drive is ready
+    } spinupProfile;
+
+    typedef struct s_spinupProfileTable
+    {
+        spinupProfile* profiles;
+        uint32_t       count;
+        uint32_t       capacity;
+    } spinupProfileTable;
+
+    // Reads the profiles in fileName, one per line as model prefix,milliamps,seconds. Blank lines and lines starting
+    // with # are skipped. A fileName of M_NULLPTR leaves the table empty so only the built in defaults are used.
+    // Returns SUCCESS, BAD_PARAMETER, INSECURE_PATH, FILE_OPEN_ERROR, FAILURE, MEMORY_FAILURE or VALIDATION_FAILURE
+    // with the line number in errorLine.
+    eReturnValues init_Spinup_Profile_Table(spinupProfileTable* table, const char* fileName, uint32_t* errorLine);
+
+    void free_Spinup_Profile_Table(spinupProfileTable* table);
+
+    // Returns the profile with the longest model prefix matching the model number of the device. Without a match,
+    // hard drives get a typical 3.5" profile and other devices a profile with no current and no spin up time.
+    spinupProfile get_Spinup_Profile(const spinupProfileTable* table, tDevice* device);
+
 #if defined(__cplusplus)
 }
 #endif
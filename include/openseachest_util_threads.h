@@ -0,0 +1,56 @@
+// SPDX-License-Identifier: MPL-2.0
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2014-2025 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file openseachest_util_threads.h
+// \brief This file defines the thread, lock and signal wrappers used by the tools to run work in the background.
+
+#pragma once
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+#include "common_types.h"
+
+    // Minimal worker thread support for the tools. Where threads are not available (UEFI) start_Util_Thread returns
+    // M_NULLPTR and the caller is expected to run the work inline instead. Locks and signals accept M_NULLPTR and do
+    // nothing in that case so single threaded fallbacks can use the same code path.
+    typedef struct s_utilThread utilThread;
+    typedef struct s_utilLock   utilLock;
+    typedef struct s_utilSignal utilSignal;
+    typedef void (*utilThreadFunction)(void* param);
+
+    utilThread* start_Util_Thread(utilThreadFunction function, void* param);
+
+    void join_Util_Thread(utilThread** thread);
+
+    utilLock* create_Util_Lock(void);
+
+    void lock_Util_Lock(utilLock* lock);
+
+    void unlock_Util_Lock(utilLock* lock);
+
+    void destroy_Util_Lock(utilLock** lock);
+
+    utilSignal* create_Util_Signal(void);
+
+    // lock must be held by the caller. It is released while waiting and held again on return.
+    void wait_Util_Signal(utilSignal* signal, utilLock* lock);
+
+    void broadcast_Util_Signal(utilSignal* signal);
+
+    void destroy_Util_Signal(utilSignal** signal);
+
+#if defined(__cplusplus)
+}
+#endif
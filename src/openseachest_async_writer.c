@@ -0,0 +1,240 @@
+// SPDX-License-Identifier: MPL-2.0
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2014-2025 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file openseachest_async_writer.c
+// \brief This file implements a writer that appends buffers to a file from a background thread.
+
+#include "common_types.h"
+#include "io_utils.h"
+#include "memory_safety.h"
+#include "string_utils.h"
+#include "time_utils.h"
+#include "type_conversion.h"
+
+#include "openseachest_async_writer.h"
+#include "openseachest_util_threads.h"
+
+// Buffers are handed out and written in the same rotating order, so the ring only needs to track how many are queued.
+// A buffer stays counted as queued while the writer thread is writing it so it is not handed out again too early.
+struct s_asyncFileWriter
+{
+    secureFileInfo*  file;
+    uint8_t**        buffers;
+    size_t*          lengths;
+    size_t           bufferSize;
+    uint32_t         bufferCount;
+    uint32_t         nextFill;
+    uint32_t         nextWrite;
+    uint32_t         queued;
+    bool             finishing;
+    eSecureFileError error;
+    utilLock*        lock;
+    utilSignal*      signal;
+    utilThread*      thread;
+};
+
+static eSecureFileError write_Async_Buffer_To_File(asyncFileWriter* writer, const uint8_t* buffer, size_t length)
+{
+    if (length == SIZE_T_C(0))
+    {
+        return SEC_FILE_SUCCESS;
+    }
+    return secure_Write_File(writer->file, buffer, writer->bufferSize, sizeof(uint8_t), length, M_NULLPTR);
+}
+
+static void async_File_Writer_Thread(void* param)
+{
+    asyncFileWriter* writer = C_CAST(asyncFileWriter*, param);
+    lock_Util_Lock(writer->lock);
+    while (true)
+    {
+        while (writer->queued == UINT32_C(0) && !writer->finishing)
+        {
+            wait_Util_Signal(writer->signal, writer->lock);
+        }
+        if (writer->queued == UINT32_C(0))
+        {
+            break;
+        }
+        uint32_t index = writer->nextWrite;
+        bool     skip  = writer->error != SEC_FILE_SUCCESS;
+        unlock_Util_Lock(writer->lock);
+        eSecureFileError result = SEC_FILE_SUCCESS;
+        if (!skip)
+        {
+            result = write_Async_Buffer_To_File(writer, writer->buffers[index], writer->lengths[index]);
+        }
+        lock_Util_Lock(writer->lock);
+        if (result != SEC_FILE_SUCCESS && writer->error == SEC_FILE_SUCCESS)
+        {
+            writer->error = result;
+        }
+        writer->nextWrite = (writer->nextWrite + UINT32_C(1)) % writer->bufferCount;
+        writer->queued -= UINT32_C(1);
+        broadcast_Util_Signal(writer->signal);
+    }
+    unlock_Util_Lock(writer->lock);
+}
+
+static void free_Async_File_Writer(asyncFileWriter** writer)
+{
+    if (writer != M_NULLPTR && *writer != M_NULLPTR)
+    {
+        if ((*writer)->buffers != M_NULLPTR)
+        {
+            for (uint32_t iter = UINT32_C(0); iter < (*writer)->bufferCount; ++iter)
+            {
+                safe_free_aligned_core(C_CAST(void**, &(*writer)->buffers[iter]));
+            }
+        }
+        safe_free(&(*writer)->buffers);
+        safe_free(&(*writer)->lengths);
+        destroy_Util_Signal(&(*writer)->signal);
+        destroy_Util_Lock(&(*writer)->lock);
+        safe_free(writer);
+    }
+}
+
+asyncFileWriter* create_Async_File_Writer(secureFileInfo* file,
+                                          uint32_t        bufferCount,
+                                          size_t          bufferSize,
+                                          size_t          alignment)
+{
+    asyncFileWriter* writer = M_NULLPTR;
+    if (file == M_NULLPTR || bufferCount == UINT32_C(0) || bufferSize == SIZE_T_C(0))
+    {
+        return M_NULLPTR;
+    }
+    writer = C_CAST(asyncFileWriter*, safe_calloc(1, sizeof(asyncFileWriter)));
+    if (writer == M_NULLPTR)
+    {
+        return M_NULLPTR;
+    }
+    writer->file        = file;
+    writer->bufferSize  = bufferSize;
+    writer->bufferCount = bufferCount;
+    writer->error       = SEC_FILE_SUCCESS;
+    writer->buffers     = C_CAST(uint8_t**, safe_calloc(bufferCount, sizeof(uint8_t*)));
+    writer->lengths     = C_CAST(size_t*, safe_calloc(bufferCount, sizeof(size_t)));
+    if (writer->buffers == M_NULLPTR || writer->lengths == M_NULLPTR)
+    {
+        free_Async_File_Writer(&writer);
+        return M_NULLPTR;
+    }
+    for (uint32_t iter = UINT32_C(0); iter < bufferCount; ++iter)
+    {
+        writer->buffers[iter] = C_CAST(uint8_t*, safe_calloc_aligned(bufferSize, sizeof(uint8_t), alignment));
+        if (writer->buffers[iter] == M_NULLPTR)
+        {
+            free_Async_File_Writer(&writer);
+            return M_NULLPTR;
+        }
+    }
+    writer->lock   = create_Util_Lock();
+    writer->signal = create_Util_Signal();
+    if (writer->lock != M_NULLPTR && writer->signal != M_NULLPTR)
+    {
+        writer->thread = start_Util_Thread(async_File_Writer_Thread, writer);
+    }
+    // without a thread every queued buffer is written before queue_Async_Write_Buffer returns
+    return writer;
+}
+
+uint8_t* get_Async_Write_Buffer(asyncFileWriter* writer)
+{
+    uint8_t* buffer = M_NULLPTR;
+    if (writer != M_NULLPTR)
+    {
+        lock_Util_Lock(writer->lock);
+        while (writer->thread != M_NULLPTR && writer->queued == writer->bufferCount &&
+               writer->error == SEC_FILE_SUCCESS)
+        {
+            wait_Util_Signal(writer->signal, writer->lock);
+        }
+        if (writer->error == SEC_FILE_SUCCESS)
+        {
+            buffer = writer->buffers[writer->nextFill];
+        }
+        unlock_Util_Lock(writer->lock);
+    }
+    return buffer;
+}
+
+eSecureFileError queue_Async_Write_Buffer(asyncFileWriter* writer, const uint8_t* buffer, size_t length)
+{
+    eSecureFileError result = SEC_FILE_INVALID_FILE;
+    if (writer == M_NULLPTR || buffer != writer->buffers[writer->nextFill] || length > writer->bufferSize)
+    {
+        return result;
+    }
+    if (writer->thread == M_NULLPTR)
+    {
+        result = write_Async_Buffer_To_File(writer, buffer, length);
+        if (result != SEC_FILE_SUCCESS && writer->error == SEC_FILE_SUCCESS)
+        {
+            writer->error = result;
+        }
+        return writer->error;
+    }
+    lock_Util_Lock(writer->lock);
+    writer->lengths[writer->nextFill] = length;
+    writer->nextFill                  = (writer->nextFill + UINT32_C(1)) % writer->bufferCount;
+    writer->queued += UINT32_C(1);
+    result = writer->error;
+    broadcast_Util_Signal(writer->signal);
+    unlock_Util_Lock(writer->lock);
+    return result;
+}
+
+eSecureFileError finish_Async_File_Writer(asyncFileWriter** writer)
+{
+    eSecureFileError result = SEC_FILE_INVALID_FILE;
+    if (writer != M_NULLPTR && *writer != M_NULLPTR)
+    {
+        if ((*writer)->thread != M_NULLPTR)
+        {
+            lock_Util_Lock((*writer)->lock);
+            (*writer)->finishing = true;
+            broadcast_Util_Signal((*writer)->signal);
+            unlock_Util_Lock((*writer)->lock);
+            join_Util_Thread(&(*writer)->thread);
+        }
+        result                       = (*writer)->error;
+        eSecureFileError flushResult = secure_Flush_File((*writer)->file);
+        if (result == SEC_FILE_SUCCESS)
+        {
+            result = flushResult;
+        }
+        free_Async_File_Writer(writer);
+    }
+    return result;
+}
+
+eSecureFileError sync_Async_File_Writer(asyncFileWriter* writer)
+{
+    eSecureFileError result = SEC_FILE_INVALID_FILE;
+    if (writer != M_NULLPTR)
+    {
+        lock_Util_Lock(writer->lock);
+        while (writer->thread != M_NULLPTR && writer->queued > UINT32_C(0))
+        {
+            wait_Util_Signal(writer->signal, writer->lock);
+        }
+        result = writer->error;
+        unlock_Util_Lock(writer->lock);
+        if (result == SEC_FILE_SUCCESS)
+        {
+            result = secure_Flush_File(writer->file);
+        }
+    }
+    return result;
+}
@@ -0,0 +1,715 @@
+// SPDX-License-Identifier: MPL-2.0
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2014-2025 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file openseachest_farm.c
+// \brief This file implements a table driven decoder of the ATA FARM log.
+
+#include "common_types.h"
+#include "io_utils.h"
+#include "memory_safety.h"
+#include "string_utils.h"
+#include "time_utils.h"
+#include "type_conversion.h"
+
+#include "openseachest_farm.h"
+#include "openseachest_util_options.h"
+
+#include "ata_helper_func.h"
+
+#define FARM_ATA_LOG_ADDRESS      UINT8_C(0xA6)
+#define FARM_LOG_BLOCK_SIZE       UINT32_C(512)
+#define FARM_LOG_TRANSFER_BLOCKS  UINT32_C(64)
+#define FARM_FIELD_SIZE           UINT32_C(8)
+#define FARM_HEADER_FIELDS        UINT32_C(9)
+#define FARM_SIGNATURE            UINT64_C(0x4641524D4552)
+#define FARM_SIGNATURE_MASK       UINT64_C(0xFFFFFFFFFFFF)
+#define FARM_VALUE_MASK           UINT64_C(0x00FFFFFFFFFFFFFF)
+#define FARM_MAJOR_REVISION_FIELD UINT32_C(1)
+#define FARM_MINOR_REVISION_FIELD UINT32_C(2)
+#define FARM_PAGE_SIZE_FIELD      UINT32_C(5)
+#define FARM_HEADS_FIELD          UINT32_C(6)
+#define FARM_MAX_LOG_FILE_SIZE    UINT32_C(16777216)
+#define FARM_MAX_TABLE_FILE_SIZE  UINT32_C(1048576)
+#define FARM_POWER_ON_HOURS       "power_on_hours"
+#define FARM_VALUE_NAME_LENGTH    SIZE_T_C(64)
+
+// Drive wide fields of the general drive information, workload, error and environment pages of the ATA FARM log.
+// The per head and per actuator arrays of the reliability page moved between revisions, so they are added for a
+// given product with a field table file.
+static const farmField farmDefaultFields[] = {
+    {"heads",                           UINT16_C(1), UINT16_C(11), UINT16_C(1), HEALTH_METRIC_GAUGE  },
+    {"power_on_hours",                  UINT16_C(1), UINT16_C(19), UINT16_C(1), HEALTH_METRIC_COUNTER},
+    {"spindle_power_on_hours",          UINT16_C(1), UINT16_C(20), UINT16_C(1), HEALTH_METRIC_COUNTER},
+    {"head_flight_hours",               UINT16_C(1), UINT16_C(21), UINT16_C(1), HEALTH_METRIC_COUNTER},
+    {"head_load_events",                UINT16_C(1), UINT16_C(22), UINT16_C(1), HEALTH_METRIC_COUNTER},
+    {"power_cycle_count",               UINT16_C(1), UINT16_C(23), UINT16_C(1), HEALTH_METRIC_COUNTER},
+    {"hardware_reset_count",            UINT16_C(1), UINT16_C(24), UINT16_C(1), HEALTH_METRIC_COUNTER},
+    {"spin_up_time_ms",                 UINT16_C(1), UINT16_C(25), UINT16_C(1), HEALTH_METRIC_GAUGE  },
+    {"read_commands",                   UINT16_C(2), UINT16_C(3),  UINT16_C(1), HEALTH_METRIC_COUNTER},
+    {"write_commands",                  UINT16_C(2), UINT16_C(4),  UINT16_C(1), HEALTH_METRIC_COUNTER},
+    {"random_read_commands",            UINT16_C(2), UINT16_C(5),  UINT16_C(1), HEALTH_METRIC_COUNTER},
+    {"random_write_commands",           UINT16_C(2), UINT16_C(6),  UINT16_C(1), HEALTH_METRIC_COUNTER},
+    {"other_commands",                  UINT16_C(2), UINT16_C(7),  UINT16_C(1), HEALTH_METRIC_COUNTER},
+    {"logical_sectors_written",         UINT16_C(2), UINT16_C(8),  UINT16_C(1), HEALTH_METRIC_COUNTER},
+    {"logical_sectors_read",            UINT16_C(2), UINT16_C(9),  UINT16_C(1), HEALTH_METRIC_COUNTER},
+    {"unrecoverable_read_errors",       UINT16_C(3), UINT16_C(2),  UINT16_C(1), HEALTH_METRIC_COUNTER},
+    {"unrecoverable_write_errors",      UINT16_C(3), UINT16_C(3),  UINT16_C(1), HEALTH_METRIC_COUNTER},
+    {"reallocated_sectors",             UINT16_C(3), UINT16_C(4),  UINT16_C(1), HEALTH_METRIC_COUNTER},
+    {"read_recovery_attempts",          UINT16_C(3), UINT16_C(5),  UINT16_C(1), HEALTH_METRIC_COUNTER},
+    {"mechanical_start_failures",       UINT16_C(3), UINT16_C(6),  UINT16_C(1), HEALTH_METRIC_COUNTER},
+    {"reallocation_candidate_sectors",  UINT16_C(3), UINT16_C(7),  UINT16_C(1), HEALTH_METRIC_GAUGE  },
+    {"asr_events",                      UINT16_C(3), UINT16_C(8),  UINT16_C(1), HEALTH_METRIC_COUNTER},
+    {"interface_crc_errors",            UINT16_C(3), UINT16_C(9),  UINT16_C(1), HEALTH_METRIC_COUNTER},
+    {"current_temperature_c",           UINT16_C(4), UINT16_C(2),  UINT16_C(1), HEALTH_METRIC_GAUGE  },
+    {"highest_temperature_c",           UINT16_C(4), UINT16_C(3),  UINT16_C(1), HEALTH_METRIC_GAUGE  },
+    {"lowest_temperature_c",            UINT16_C(4), UINT16_C(4),  UINT16_C(1), HEALTH_METRIC_GAUGE  },
+};
+
+// A field with the same name as one already in the table replaces it, so a table file can correct a built in field
+static eReturnValues add_FARM_Field(farmFieldTable* table, const farmField* field)
+{
+    for (uint32_t fieldIter = UINT32_C(0); fieldIter < table->count; ++fieldIter)
+    {
+        if (strcmp(table->fields[fieldIter].name, field->name) == 0)
+        {
+            safe_memcpy(&table->fields[fieldIter], sizeof(farmField), field, sizeof(farmField));
+            return SUCCESS;
+        }
+    }
+    if (table->count == table->capacity)
+    {
+        uint32_t   newCapacity = table->capacity == UINT32_C(0) ? UINT32_C(64) : table->capacity * 2;
+        farmField* newFields   = C_CAST(farmField*,
+                                        safe_realloc(table->fields, C_CAST(size_t, newCapacity) * sizeof(farmField)));
+        if (newFields == M_NULLPTR)
+        {
+            return MEMORY_FAILURE;
+        }
+        table->fields   = newFields;
+        table->capacity = newCapacity;
+    }
+    safe_memcpy(&table->fields[table->count], sizeof(farmField), field, sizeof(farmField));
+    ++table->count;
+    return SUCCESS;
+}
+
+static bool get_FARM_Table_Number(const char* column, uint32_t maximum, uint16_t* number)
+{
+    char*         end   = M_NULLPTR;
+    unsigned long value = 0UL;
+    if (column == M_NULLPTR || !safe_isdigit(column[0]) ||
+        0 != safe_strtoul(&value, column, &end, BASE_10_DECIMAL) || *end != '\0' || value > maximum)
+    {
+        return false;
+    }
+    *number = C_CAST(uint16_t, value);
+    return true;
+}
+
+// name,page,field,count,type where count is 1, heads or the number of elements of an array (e.g. one per actuator)
+static bool parse_FARM_Table_Line(char* line, farmField* field)
+{
+    char*  cursor = line;
+    char*  name   = next_Table_File_Column(&cursor);
+    char*  page   = next_Table_File_Column(&cursor);
+    char*  index  = next_Table_File_Column(&cursor);
+    char*  count  = next_Table_File_Column(&cursor);
+    char*  type   = next_Table_File_Column(&cursor);
+    size_t length = safe_strlen(name);
+    if (type == M_NULLPTR || cursor != M_NULLPTR || length == SIZE_T_C(0) || length >= FARM_FIELD_NAME_LENGTH)
+    {
+        return false;
+    }
+    // names are used as-is as CSV values and JSON members
+    for (size_t iter = SIZE_T_C(0); iter < length; ++iter)
+    {
+        if (!safe_isalnum(name[iter]) && name[iter] != '_')
+        {
+            return false;
+        }
+    }
+    safe_memset(field, sizeof(farmField), 0, sizeof(farmField));
+    snprintf_err_handle(field->name, FARM_FIELD_NAME_LENGTH, "%s", name);
+    if (!get_FARM_Table_Number(page, UINT16_MAX, &field->page) ||
+        !get_FARM_Table_Number(index, UINT16_MAX, &field->field))
+    {
+        return false;
+    }
+    if (strcmp(count, "heads") == 0)
+    {
+        field->elements = FARM_HEAD_ELEMENTS;
+    }
+    else if (!get_FARM_Table_Number(count, FARM_MAX_ELEMENTS, &field->elements) || field->elements == UINT16_C(0))
+    {
+        return false;
+    }
+    if (strcmp(type, "counter") == 0)
+    {
+        field->type = HEALTH_METRIC_COUNTER;
+    }
+    else if (strcmp(type, "gauge") == 0)
+    {
+        field->type = HEALTH_METRIC_GAUGE;
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+static eReturnValues load_FARM_Field_Table(const char* fileName, farmFieldTable* table, uint32_t* errorLine)
+{
+    eReturnValues   ret       = SUCCESS;
+    char*           text      = M_NULLPTR;
+    char*           line      = M_NULLPTR;
+    uint32_t        lineCount = UINT32_C(0);
+    size_t          readCount = SIZE_T_C(0);
+    secureFileInfo* file      = secure_Open_File(fileName, "rb", M_NULLPTR, M_NULLPTR, M_NULLPTR);
+    if (file == M_NULLPTR || file->error != SEC_FILE_SUCCESS)
+    {
+        ret = (file != M_NULLPTR && file->error == SEC_FILE_INSECURE_PATH) ? INSECURE_PATH : FILE_OPEN_ERROR;
+        free_Secure_File_Info(&file);
+        return ret;
+    }
+    if (file->fileSize > FARM_MAX_TABLE_FILE_SIZE)
+    {
+        ret = VALIDATION_FAILURE;
+    }
+    else if (M_NULLPTR == (text = C_CAST(char*, safe_calloc(file->fileSize + SIZE_T_C(1), sizeof(char)))))
+    {
+        ret = MEMORY_FAILURE;
+    }
+    else if (file->fileSize > SIZE_T_C(0) &&
+             SEC_FILE_SUCCESS != secure_Read_File(file, text, file->fileSize, sizeof(char), file->fileSize, &readCount))
+    {
+        ret = FAILURE;
+    }
+    line = text;
+    while (ret == SUCCESS && line != M_NULLPTR && *line != '\0')
+    {
+        char*     next = strchr(line, '\n');
+        farmField field;
+        if (next != M_NULLPTR)
+        {
+            *next++ = '\0';
+        }
+        ++lineCount;
+        while (*line == ' ' || *line == '\t')
+        {
+            ++line;
+        }
+        if (*line != '\0' && *line != '\r' && *line != '#')
+        {
+            if (!parse_FARM_Table_Line(line, &field))
+            {
+                ret = VALIDATION_FAILURE;
+                if (errorLine != M_NULLPTR)
+                {
+                    *errorLine = lineCount;
+                }
+            }
+            else
+            {
+                ret = add_FARM_Field(table, &field);
+            }
+        }
+        line = next;
+    }
+    safe_free(&text);
+    secure_Close_File(file);
+    free_Secure_File_Info(&file);
+    return ret;
+}
+
+eReturnValues init_FARM_Field_Table(farmFieldTable* table, const char* fileName, uint32_t* errorLine)
+{
+    eReturnValues ret = SUCCESS;
+    if (table == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    safe_memset(table, sizeof(farmFieldTable), 0, sizeof(farmFieldTable));
+    for (size_t fieldIter = SIZE_T_C(0);
+         ret == SUCCESS && fieldIter < sizeof(farmDefaultFields) / sizeof(farmDefaultFields[0]); ++fieldIter)
+    {
+        ret = add_FARM_Field(table, &farmDefaultFields[fieldIter]);
+    }
+    if (ret == SUCCESS && fileName != M_NULLPTR)
+    {
+        ret = load_FARM_Field_Table(fileName, table, errorLine);
+    }
+    if (ret != SUCCESS)
+    {
+        free_FARM_Field_Table(table);
+    }
+    return ret;
+}
+
+void free_FARM_Field_Table(farmFieldTable* table)
+{
+    if (table != M_NULLPTR)
+    {
+        safe_free(&table->fields);
+        table->count    = UINT32_C(0);
+        table->capacity = UINT32_C(0);
+    }
+}
+
+static uint32_t get_FARM_Field_Elements(const farmField* field, uint16_t headsSupported)
+{
+    return field->elements == FARM_HEAD_ELEMENTS ? headsSupported : field->elements;
+}
+
+eReturnValues decode_FARM_Log(const uint8_t*        log,
+                              uint32_t              logSize,
+                              const farmFieldTable* table,
+                              farmDecode*           decoded)
+{
+    uint64_t pageSize   = UINT64_C(0);
+    uint32_t valueCount = UINT32_C(0);
+    if (log == M_NULLPTR || table == M_NULLPTR || decoded == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    safe_memset(decoded, sizeof(farmDecode), 0, sizeof(farmDecode));
+    if (logSize < FARM_HEADER_FIELDS * FARM_FIELD_SIZE ||
+        (get_Health_Little_Endian_Value(log, UINT8_C(8)) & FARM_SIGNATURE_MASK) != FARM_SIGNATURE)
+    {
+        return VALIDATION_FAILURE;
+    }
+    decoded->majorRevision =
+        get_Health_Little_Endian_Value(&log[FARM_MAJOR_REVISION_FIELD * FARM_FIELD_SIZE], UINT8_C(8)) & FARM_VALUE_MASK;
+    decoded->minorRevision =
+        get_Health_Little_Endian_Value(&log[FARM_MINOR_REVISION_FIELD * FARM_FIELD_SIZE], UINT8_C(8)) & FARM_VALUE_MASK;
+    decoded->headsSupported = C_CAST(
+        uint16_t, M_Min(get_Health_Little_Endian_Value(&log[FARM_HEADS_FIELD * FARM_FIELD_SIZE], UINT8_C(8)) &
+                            FARM_VALUE_MASK,
+                        FARM_MAX_ELEMENTS));
+    pageSize = get_Health_Little_Endian_Value(&log[FARM_PAGE_SIZE_FIELD * FARM_FIELD_SIZE], UINT8_C(8)) &
+               FARM_VALUE_MASK;
+    if (pageSize < FARM_HEADER_FIELDS * FARM_FIELD_SIZE || pageSize > logSize)
+    {
+        return VALIDATION_FAILURE;
+    }
+    for (uint32_t fieldIter = UINT32_C(0); fieldIter < table->count; ++fieldIter)
+    {
+        valueCount += get_FARM_Field_Elements(&table->fields[fieldIter], decoded->headsSupported);
+    }
+    decoded->values = C_CAST(farmValue*, safe_calloc(M_Max(valueCount, UINT32_C(1)), sizeof(farmValue)));
+    if (decoded->values == M_NULLPTR)
+    {
+        return MEMORY_FAILURE;
+    }
+    // Values are kept in table order, then element order, so two decodes with the same table can be merged
+    for (uint32_t fieldIter = UINT32_C(0); fieldIter < table->count; ++fieldIter)
+    {
+        const farmField* field    = &table->fields[fieldIter];
+        uint32_t         elements = get_FARM_Field_Elements(field, decoded->headsSupported);
+        for (uint32_t element = UINT32_C(0); element < elements; ++element)
+        {
+            uint64_t fieldOffset = (C_CAST(uint64_t, field->field) + element) * FARM_FIELD_SIZE;
+            uint64_t offset      = C_CAST(uint64_t, field->page) * pageSize + fieldOffset;
+            uint64_t qword       = UINT64_C(0);
+            if (fieldOffset + FARM_FIELD_SIZE > pageSize || offset + FARM_FIELD_SIZE > logSize)
+            {
+                break;
+            }
+            qword = get_Health_Little_Endian_Value(&log[offset], UINT8_C(8));
+            // bit 63 = supported, bit 62 = valid
+            if ((qword & BIT63) && (qword & BIT62))
+            {
+                farmValue* value = &decoded->values[decoded->count];
+                value->field     = fieldIter;
+                value->element   = field->elements == UINT16_C(1) ? FARM_NO_ELEMENT : C_CAST(uint16_t, element);
+                value->value     = qword & FARM_VALUE_MASK;
+                ++decoded->count;
+            }
+        }
+    }
+    return SUCCESS;
+}
+
+eReturnValues read_FARM_Log_File(const char* fileName, const farmFieldTable* table, farmDecode* decoded)
+{
+    eReturnValues   ret       = SUCCESS;
+    uint8_t*        log       = M_NULLPTR;
+    size_t          readCount = SIZE_T_C(0);
+    secureFileInfo* file      = M_NULLPTR;
+    if (fileName == M_NULLPTR || table == M_NULLPTR || decoded == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    safe_memset(decoded, sizeof(farmDecode), 0, sizeof(farmDecode));
+    file = secure_Open_File(fileName, "rb", M_NULLPTR, M_NULLPTR, M_NULLPTR);
+    if (file == M_NULLPTR || file->error != SEC_FILE_SUCCESS)
+    {
+        ret = (file != M_NULLPTR && file->error == SEC_FILE_INSECURE_PATH) ? INSECURE_PATH : FILE_OPEN_ERROR;
+        free_Secure_File_Info(&file);
+        return ret;
+    }
+    if (file->fileSize < FARM_HEADER_FIELDS * FARM_FIELD_SIZE || file->fileSize > FARM_MAX_LOG_FILE_SIZE)
+    {
+        ret = VALIDATION_FAILURE;
+    }
+    else if (M_NULLPTR == (log = C_CAST(uint8_t*, safe_calloc(file->fileSize, sizeof(uint8_t)))))
+    {
+        ret = MEMORY_FAILURE;
+    }
+    else if (SEC_FILE_SUCCESS !=
+                 secure_Read_File(file, log, file->fileSize, sizeof(uint8_t), file->fileSize, &readCount) ||
+             readCount != file->fileSize)
+    {
+        ret = FAILURE;
+    }
+    else
+    {
+        ret = decode_FARM_Log(log, C_CAST(uint32_t, file->fileSize), table, decoded);
+    }
+    safe_free(&log);
+    secure_Close_File(file);
+    free_Secure_File_Info(&file);
+    return ret;
+}
+
+eReturnValues read_FARM_Log_Device(tDevice* device, const farmFieldTable* table, farmDecode* decoded)
+{
+    eReturnValues ret               = SUCCESS;
+    uint8_t*      log               = M_NULLPTR;
+    uint32_t      logSize           = UINT32_C(0);
+    uint32_t      blocksPerTransfer = FARM_LOG_TRANSFER_BLOCKS;
+    if (device == M_NULLPTR || table == M_NULLPTR || decoded == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    safe_memset(decoded, sizeof(farmDecode), 0, sizeof(farmDecode));
+    // SAS drives report FARM as log parameters, not in the field layout decoded here
+    if (device->drive_info.drive_type != ATA_DRIVE ||
+        SUCCESS != get_ATA_Log_Size(device, FARM_ATA_LOG_ADDRESS, &logSize, true, false) ||
+        logSize < FARM_LOG_BLOCK_SIZE)
+    {
+        return NOT_SUPPORTED;
+    }
+    if (device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength >= FARM_LOG_BLOCK_SIZE)
+    {
+        uint32_t maxBlocks = device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength / FARM_LOG_BLOCK_SIZE;
+        blocksPerTransfer  = M_Min(blocksPerTransfer, maxBlocks);
+    }
+    log = C_CAST(uint8_t*, safe_calloc_aligned(logSize, sizeof(uint8_t), device->os_info.minimumAlignment));
+    if (log == M_NULLPTR)
+    {
+        return MEMORY_FAILURE;
+    }
+    for (uint32_t block = UINT32_C(0); ret == SUCCESS && block < logSize / FARM_LOG_BLOCK_SIZE;
+         block += blocksPerTransfer)
+    {
+        uint32_t blocks = M_Min(blocksPerTransfer, logSize / FARM_LOG_BLOCK_SIZE - block);
+        ret = send_ATA_Read_Log_Ext_Cmd(device, FARM_ATA_LOG_ADDRESS, C_CAST(uint16_t, block),
+                                        &log[block * FARM_LOG_BLOCK_SIZE], blocks * FARM_LOG_BLOCK_SIZE, UINT16_C(0));
+    }
+    if (ret == SUCCESS)
+    {
+        ret = decode_FARM_Log(log, logSize, table, decoded);
+    }
+    safe_free_aligned_core(C_CAST(void**, &log));
+    return ret;
+}
+
+void free_FARM_Decode(farmDecode* decoded)
+{
+    if (decoded != M_NULLPTR)
+    {
+        safe_free(&decoded->values);
+        decoded->count = UINT32_C(0);
+    }
+}
+
+static bool get_FARM_Power_On_Hours(const farmFieldTable* table, const farmDecode* decoded, uint64_t* hours)
+{
+    for (uint32_t valueIter = UINT32_C(0); valueIter < decoded->count; ++valueIter)
+    {
+        if (strcmp(table->fields[decoded->values[valueIter].field].name, FARM_POWER_ON_HOURS) == 0)
+        {
+            *hours = decoded->values[valueIter].value;
+            return true;
+        }
+    }
+    return false;
+}
+
+// One output row, with the matching value of the baseline when there is one
+typedef struct s_farmRow
+{
+    const farmField* field;
+    const farmValue* value;
+    const farmValue* baseline;
+} farmRow;
+
+// Walks the values of current and baseline together. Both are in table order, then element order, so a value without
+// a match in the baseline is found without searching.
+static bool next_FARM_Row(const farmFieldTable* table,
+                          const farmDecode*     current,
+                          const farmDecode*     baseline,
+                          uint32_t*             valueIter,
+                          uint32_t*             baselineIter,
+                          farmRow*              row)
+{
+    if (*valueIter >= current->count)
+    {
+        return false;
+    }
+    row->value    = &current->values[*valueIter];
+    row->field    = &table->fields[row->value->field];
+    row->baseline = M_NULLPTR;
+    ++(*valueIter);
+    if (baseline != M_NULLPTR)
+    {
+        while (*baselineIter < baseline->count &&
+               (baseline->values[*baselineIter].field < row->value->field ||
+                (baseline->values[*baselineIter].field == row->value->field &&
+                 baseline->values[*baselineIter].element < row->value->element)))
+        {
+            ++(*baselineIter);
+        }
+        if (*baselineIter < baseline->count && baseline->values[*baselineIter].field == row->value->field &&
+            baseline->values[*baselineIter].element == row->value->element)
+        {
+            row->baseline = &baseline->values[*baselineIter];
+        }
+    }
+    return true;
+}
+
+static void get_FARM_Value_Name(const farmRow* row, char* name, size_t nameSize)
+{
+    if (row->value->element == FARM_NO_ELEMENT)
+    {
+        snprintf_err_handle(name, nameSize, "%s", row->field->name);
+    }
+    else
+    {
+        snprintf_err_handle(name, nameSize, "%s[%" PRIu16 "]", row->field->name, row->value->element);
+    }
+}
+
+// Rates are only meaningful for counters, over a span of time the drive was powered on
+static bool get_FARM_Rate(const farmRow* row, uint64_t hours, double* rate)
+{
+    if (row->baseline == M_NULLPTR || row->field->type != HEALTH_METRIC_COUNTER || hours == UINT64_C(0))
+    {
+        return false;
+    }
+    *rate = (C_CAST(double, row->value->value) - C_CAST(double, row->baseline->value)) / C_CAST(double, hours);
+    return true;
+}
+
+void print_FARM_Decode(const farmFieldTable* table,
+                       const farmDecode*     decoded,
+                       const farmDecode*     baseline,
+                       const char*           source,
+                       eFARMOutputFormat     format,
+                       bool                  header)
+{
+    uint32_t valueIter    = UINT32_C(0);
+    uint32_t baselineIter = UINT32_C(0);
+    uint64_t hours        = UINT64_C(0);
+    uint64_t baseHours    = UINT64_C(0);
+    farmRow  row;
+    DECLARE_ZERO_INIT_ARRAY(char, name, FARM_VALUE_NAME_LENGTH);
+    if (table == M_NULLPTR || decoded == M_NULLPTR)
+    {
+        return;
+    }
+    if (baseline != M_NULLPTR && get_FARM_Power_On_Hours(table, decoded, &hours) &&
+        get_FARM_Power_On_Hours(table, baseline, &baseHours) && hours > baseHours)
+    {
+        hours -= baseHours;
+    }
+    else
+    {
+        hours = UINT64_C(0);
+    }
+    if (format == FARM_OUTPUT_CSV)
+    {
+        // CSV rows stay on stdout when the tool's messages were moved to stderr
+        FILE* output = get_Data_Output_Stream();
+        if (header)
+        {
+            fprintf(output, "Source,Field,Element,Type,Value%s\n",
+                    baseline != M_NULLPTR ? ",Baseline,Delta,PerPowerOnHour" : "");
+        }
+        while (next_FARM_Row(table, decoded, baseline, &valueIter, &baselineIter, &row))
+        {
+            double rate = 0.0;
+            fprintf(output, "%s,%s,", source != M_NULLPTR ? source : "", row.field->name);
+            if (row.value->element != FARM_NO_ELEMENT)
+            {
+                fprintf(output, "%" PRIu16, row.value->element);
+            }
+            fprintf(output, ",%s,%" PRIu64, row.field->type == HEALTH_METRIC_COUNTER ? "counter" : "gauge",
+                    row.value->value);
+            if (baseline != M_NULLPTR)
+            {
+                if (row.baseline != M_NULLPTR)
+                {
+                    fprintf(output, ",%" PRIu64 ",%" PRId64, row.baseline->value,
+                            C_CAST(int64_t, row.value->value - row.baseline->value));
+                }
+                else
+                {
+                    fputs(",,", output);
+                }
+                if (get_FARM_Rate(&row, hours, &rate))
+                {
+                    fprintf(output, ",%0.6f", rate);
+                }
+                else
+                {
+                    fputs(",", output);
+                }
+            }
+            fputs("\n", output);
+        }
+        return;
+    }
+    printf("\nFARM log %s: revision %" PRIu64 ".%" PRIu64 ", %" PRIu16 " heads supported\n",
+           source != M_NULLPTR ? source : "", decoded->majorRevision, decoded->minorRevision, decoded->headsSupported);
+    if (baseline != M_NULLPTR)
+    {
+        printf("Compared to revision %" PRIu64 ".%" PRIu64 " baseline over %" PRIu64 " power on hours\n",
+               baseline->majorRevision, baseline->minorRevision, hours);
+        printf("%-40s %20s %20s %20s %14s\n", "Field", "Value", "Baseline", "Delta", "Per POH");
+    }
+    else
+    {
+        printf("%-40s %20s\n", "Field", "Value");
+    }
+    while (next_FARM_Row(table, decoded, baseline, &valueIter, &baselineIter, &row))
+    {
+        double rate = 0.0;
+        get_FARM_Value_Name(&row, name, FARM_VALUE_NAME_LENGTH);
+        printf("%-40s %20" PRIu64, name, row.value->value);
+        if (baseline != M_NULLPTR)
+        {
+            if (row.baseline != M_NULLPTR)
+            {
+                printf(" %20" PRIu64 " %20" PRId64, row.baseline->value,
+                       C_CAST(int64_t, row.value->value - row.baseline->value));
+            }
+            else
+            {
+                printf(" %20s %20s", "-", "-");
+            }
+            if (get_FARM_Rate(&row, hours, &rate))
+            {
+                printf(" %14.6f", rate);
+            }
+        }
+        print_str("\n");
+    }
+}
+
+static void write_JSON_FARM_Members(jsonStream*           json,
+                                    const farmFieldTable* table,
+                                    const farmDecode*     decoded,
+                                    const farmDecode*     baseline)
+{
+    uint32_t valueIter    = UINT32_C(0);
+    uint32_t baselineIter = UINT32_C(0);
+    uint64_t hours        = UINT64_C(0);
+    uint64_t baseHours    = UINT64_C(0);
+    farmRow  row;
+    write_JSON_Unsigned(json, "majorRevision", decoded->majorRevision);
+    write_JSON_Unsigned(json, "minorRevision", decoded->minorRevision);
+    write_JSON_Unsigned(json, "headsSupported", decoded->headsSupported);
+    if (baseline != M_NULLPTR)
+    {
+        if (get_FARM_Power_On_Hours(table, decoded, &hours) && get_FARM_Power_On_Hours(table, baseline, &baseHours) &&
+            hours > baseHours)
+        {
+            hours -= baseHours;
+        }
+        else
+        {
+            hours = UINT64_C(0);
+        }
+        write_JSON_Unsigned(json, "powerOnHoursElapsed", hours);
+    }
+    begin_JSON_Array(json, "fields");
+    while (next_FARM_Row(table, decoded, baseline, &valueIter, &baselineIter, &row))
+    {
+        double rate = 0.0;
+        begin_JSON_Object(json, M_NULLPTR);
+        write_JSON_String(json, "name", row.field->name);
+        if (row.value->element == FARM_NO_ELEMENT)
+        {
+            write_JSON_Null(json, "element");
+        }
+        else
+        {
+            write_JSON_Unsigned(json, "element", row.value->element);
+        }
+        write_JSON_String(json, "type", row.field->type == HEALTH_METRIC_COUNTER ? "counter" : "gauge");
+        write_JSON_Unsigned(json, "value", row.value->value);
+        if (baseline != M_NULLPTR)
+        {
+            if (row.baseline != M_NULLPTR)
+            {
+                write_JSON_Unsigned(json, "baseline", row.baseline->value);
+                write_JSON_Signed(json, "delta", C_CAST(int64_t, row.value->value - row.baseline->value));
+            }
+            else
+            {
+                write_JSON_Null(json, "baseline");
+                write_JSON_Null(json, "delta");
+            }
+            if (get_FARM_Rate(&row, hours, &rate))
+            {
+                write_JSON_Double(json, "perPowerOnHour", rate);
+            }
+            else
+            {
+                write_JSON_Null(json, "perPowerOnHour");
+            }
+        }
+        end_JSON_Object(json);
+    }
+    end_JSON_Array(json);
+}
+
+void write_JSON_FARM_Decode(jsonStream*           json,
+                            const char*           key,
+                            const farmFieldTable* table,
+                            const farmDecode*     decoded,
+                            const farmDecode*     baseline,
+                            const char*           source)
+{
+    begin_JSON_Object(json, key);
+    write_JSON_String(json, "source", source);
+    write_JSON_FARM_Members(json, table, decoded, baseline);
+    end_JSON_Object(json);
+}
+
+eReturnValues write_JSON_FARM_Log(jsonStream* json, const char* key, tDevice* device, const farmFieldTable* table)
+{
+    farmDecode    decoded;
+    eReturnValues ret = read_FARM_Log_Device(device, table, &decoded);
+    begin_JSON_Object(json, key);
+    write_JSON_Status(json, ret);
+    if (ret == SUCCESS)
+    {
+        write_JSON_FARM_Members(json, table, &decoded, M_NULLPTR);
+        free_FARM_Decode(&decoded);
+    }
+    end_JSON_Object(json);
+    return ret;
+}
@@ -0,0 +1,445 @@
+// SPDX-License-Identifier: MPL-2.0
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2014-2025 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file openseachest_fleet_dst.c
+// \brief This file implements running device self-tests on many drives at once.
+
+#include "common_types.h"
+#include "io_utils.h"
+#include "memory_safety.h"
+#include "string_utils.h"
+#include "time_utils.h"
+#include "type_conversion.h"
+
+#include "openseachest_fleet_dst.h"
+
+#include "cmds.h"
+#include "defect.h"
+#include "dst.h"
+
+#define FLEET_DST_WHEEL_SLOTS            UINT32_C(64)
+#define FLEET_DST_WHEEL_END              UINT32_MAX
+#define FLEET_DST_SHORT_SECONDS          UINT64_C(120) // short self-tests are expected to finish in 2 minutes
+#define FLEET_DST_MIN_POLL_SECONDS       UINT32_C(5)
+#define FLEET_DST_MAX_POLL_SECONDS       UINT32_C(60)
+#define FLEET_DST_TIME_LIMIT_MULTIPLIER  UINT64_C(5)
+#define FLEET_DST_TABLE_SECONDS          UINT64_C(60)
+#define FLEET_DST_STATUS_PASSED          UINT8_C(0x00)
+#define FLEET_DST_STATUS_IN_PROGRESS     UINT8_C(0x0F)
+
+eReturnValues add_Fleet_DST_Drive(fleetDST* fleet, tDevice* device, uint64_t errorLimit)
+{
+    fleetDSTDrive* drive = M_NULLPTR;
+    if (fleet == M_NULLPTR || device == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    if (fleet->count == fleet->capacity)
+    {
+        uint32_t       newCapacity = fleet->capacity == UINT32_C(0) ? UINT32_C(16) : fleet->capacity * UINT32_C(2);
+        fleetDSTDrive* newDrives   = M_NULLPTR;
+        if (newCapacity < fleet->capacity)
+        {
+            return MEMORY_FAILURE;
+        }
+        newDrives =
+            C_CAST(fleetDSTDrive*, safe_realloc(fleet->drives, C_CAST(size_t, newCapacity) * sizeof(fleetDSTDrive)));
+        if (newDrives == M_NULLPTR)
+        {
+            return MEMORY_FAILURE;
+        }
+        fleet->drives   = newDrives;
+        fleet->capacity = newCapacity;
+    }
+    drive = &fleet->drives[fleet->count];
+    safe_memset(drive, sizeof(fleetDSTDrive), 0, sizeof(fleetDSTDrive));
+    drive->device       = device;
+    drive->state        = FLEET_DST_STATE_WAITING;
+    drive->result       = UNKNOWN;
+    drive->errorLimit   = errorLimit;
+    drive->lastErrorLBA = UINT64_MAX;
+    drive->wheelNext    = FLEET_DST_WHEEL_END;
+    ++fleet->count;
+    return SUCCESS;
+}
+
+void free_Fleet_DST(fleetDST* fleet)
+{
+    if (fleet != M_NULLPTR)
+    {
+        safe_free(&fleet->drives);
+        fleet->count    = UINT32_C(0);
+        fleet->capacity = UINT32_C(0);
+    }
+}
+
+// Puts a drive into the timer wheel slot for the second it is due. Drives due more than one turn of the wheel away
+// share the slot with drives due sooner and are put back when their slot comes around early.
+static void schedule_Fleet_DST_Drive(fleetDST* fleet, uint32_t* wheel, uint32_t driveIndex, uint64_t when)
+{
+    uint32_t slot                       = C_CAST(uint32_t, when % FLEET_DST_WHEEL_SLOTS);
+    fleet->drives[driveIndex].nextPoll  = when;
+    fleet->drives[driveIndex].wheelNext = wheel[slot];
+    wheel[slot]                         = driveIndex;
+}
+
+static void finish_Fleet_DST_Drive(fleetDSTDrive* drive, eFleetDSTState state, eReturnValues result, uint64_t now)
+{
+    drive->state    = state;
+    drive->result   = result;
+    drive->finished = now;
+}
+
+// Polls about 100 times over the expected run time of the self-test and aborts it if it takes 5 times longer.
+static void set_Fleet_DST_Timing(fleetDSTDrive* drive, bool longTest, bool ignoreMaxTime)
+{
+    uint64_t expected = FLEET_DST_SHORT_SECONDS;
+    if (longTest)
+    {
+        uint8_t hours   = UINT8_C(0);
+        uint8_t minutes = UINT8_C(0);
+        expected        = UINT64_C(0);
+        if (SUCCESS == get_Long_DST_Time(drive->device, &hours, &minutes))
+        {
+            expected = (C_CAST(uint64_t, hours) * UINT64_C(3600)) + (C_CAST(uint64_t, minutes) * UINT64_C(60));
+        }
+    }
+    if (expected == UINT64_C(0))
+    {
+        // unknown run time, poll slowly and never abort
+        drive->pollInterval = FLEET_DST_MAX_POLL_SECONDS;
+        drive->timeLimit    = UINT64_C(0);
+    }
+    else
+    {
+        drive->pollInterval = C_CAST(
+            uint32_t, M_Min(M_Max(expected / UINT64_C(100), C_CAST(uint64_t, FLEET_DST_MIN_POLL_SECONDS)),
+                            C_CAST(uint64_t, FLEET_DST_MAX_POLL_SECONDS)));
+        drive->timeLimit    = ignoreMaxTime ? UINT64_C(0) : expected * FLEET_DST_TIME_LIMIT_MULTIPLIER;
+    }
+}
+
+static void start_Fleet_DST_Drive(fleetDSTDrive* drive, bool longTest, bool ignoreMaxTime, uint64_t now)
+{
+    drive->percentComplete = UINT32_C(0);
+    drive->started         = now;
+    switch (run_DST(drive->device, longTest ? DST_TYPE_LONG : DST_TYPE_SHORT, false, false, ignoreMaxTime))
+    {
+    case SUCCESS:
+        drive->state = FLEET_DST_STATE_RUNNING;
+        ++drive->passes;
+        break;
+    case IN_PROGRESS:
+        // someone else's self-test is running on this drive. Leave it alone.
+        finish_Fleet_DST_Drive(drive, FLEET_DST_STATE_FAILED, IN_PROGRESS, now);
+        break;
+    case NOT_SUPPORTED:
+        finish_Fleet_DST_Drive(drive, FLEET_DST_STATE_NOT_SUPPORTED, NOT_SUPPORTED, now);
+        break;
+    default:
+        finish_Fleet_DST_Drive(drive, FLEET_DST_STATE_FAILED, FAILURE, now);
+        break;
+    }
+}
+
+// Repairs the physical sector holding the LBA the last self-test failed on. Returns false when there is nothing that
+// can be repaired: no LBA in the DST log, the same LBA failed again after being repaired, the error limit would be
+// exceeded, or the repair itself failed.
+static bool clean_Fleet_DST_Drive(fleetDSTDrive* drive)
+{
+    tDevice*      device             = drive->device;
+    uint64_t      failedLBA          = UINT64_MAX;
+    uint32_t      logicalPerPhysical = UINT32_C(1);
+    ptrErrorLBA   repairList         = M_NULLPTR;
+    eReturnValues repairRet          = FAILURE;
+    dstLogEntries dstEntries;
+    safe_memset(&dstEntries, sizeof(dstLogEntries), 0, sizeof(dstLogEntries));
+    if (SUCCESS == get_DST_Log_Entries(device, &dstEntries) && dstEntries.numberOfEntries > 0 &&
+        dstEntries.dstEntry[0].descriptorValid)
+    {
+        // the most recent self-test is the first entry
+        failedLBA = dstEntries.dstEntry[0].lbaOfFailure;
+    }
+    if (failedLBA > device->drive_info.deviceMaxLba || failedLBA == drive->lastErrorLBA)
+    {
+        return false;
+    }
+    drive->lastErrorLBA = failedLBA;
+    if (device->drive_info.deviceBlockSize > UINT32_C(0) &&
+        device->drive_info.devicePhyBlockSize > device->drive_info.deviceBlockSize)
+    {
+        logicalPerPhysical = device->drive_info.devicePhyBlockSize / device->drive_info.deviceBlockSize;
+    }
+    if (drive->errorLimit > UINT64_C(0) && drive->repairedLBAs + logicalPerPhysical > drive->errorLimit)
+    {
+        return false;
+    }
+    failedLBA -= failedLBA % logicalPerPhysical;
+    repairList = C_CAST(ptrErrorLBA, safe_calloc(logicalPerPhysical, sizeof(errorLBA)));
+    if (repairList == M_NULLPTR)
+    {
+        return false;
+    }
+    for (uint32_t lbaIter = UINT32_C(0); lbaIter < logicalPerPhysical; ++lbaIter)
+    {
+        repairList[lbaIter].errorAddress = failedLBA + lbaIter;
+        repairList[lbaIter].repairStatus = NOT_REPAIRED;
+    }
+    repairRet = reallocate_LBAs(device, repairList, logicalPerPhysical);
+    safe_free_error_lba(&repairList);
+    if (repairRet != SUCCESS)
+    {
+        // could not reassign it, writing the whole physical sector lets the drive reallocate it instead
+        size_t   dataSize = C_CAST(size_t, logicalPerPhysical) * device->drive_info.deviceBlockSize;
+        uint8_t* zeros =
+            C_CAST(uint8_t*, safe_calloc_aligned(dataSize, sizeof(uint8_t), device->os_info.minimumAlignment));
+        if (zeros == M_NULLPTR)
+        {
+            return false;
+        }
+        repairRet = write_LBA(device, failedLBA, false, zeros, C_CAST(uint32_t, dataSize));
+        safe_free_aligned(&zeros);
+        if (repairRet != SUCCESS)
+        {
+            return false;
+        }
+    }
+    drive->repairedLBAs += logicalPerPhysical;
+    return true;
+}
+
+static void service_Fleet_DST_Drive(fleetDSTDrive* drive, bool longTest, bool clean, bool ignoreMaxTime, uint64_t now)
+{
+    uint32_t percentComplete = UINT32_C(0);
+    uint8_t  status          = UINT8_C(0);
+    if (drive->state == FLEET_DST_STATE_CLEANING)
+    {
+        if (clean_Fleet_DST_Drive(drive))
+        {
+            start_Fleet_DST_Drive(drive, longTest, ignoreMaxTime, now);
+        }
+        else
+        {
+            finish_Fleet_DST_Drive(drive, FLEET_DST_STATE_FAILED, FAILURE, now);
+        }
+        return;
+    }
+    if (SUCCESS != get_DST_Progress(drive->device, &percentComplete, &status))
+    {
+        finish_Fleet_DST_Drive(drive, FLEET_DST_STATE_FAILED, FAILURE, now);
+        return;
+    }
+    drive->status = status;
+    if (status == FLEET_DST_STATUS_IN_PROGRESS)
+    {
+        drive->percentComplete = percentComplete;
+        if (drive->timeLimit > UINT64_C(0) && now - drive->started > drive->timeLimit)
+        {
+            abort_DST(drive->device);
+            finish_Fleet_DST_Drive(drive, FLEET_DST_STATE_ABORTED, ABORTED, now);
+        }
+    }
+    else if (status == FLEET_DST_STATUS_PASSED)
+    {
+        drive->percentComplete = UINT32_C(100);
+        finish_Fleet_DST_Drive(drive, FLEET_DST_STATE_PASSED, SUCCESS, now);
+    }
+    else if (clean)
+    {
+        // repaired on the next tick so the table shows which drives are being cleaned
+        drive->state = FLEET_DST_STATE_CLEANING;
+    }
+    else
+    {
+        finish_Fleet_DST_Drive(drive, FLEET_DST_STATE_FAILED, FAILURE, now);
+    }
+}
+
+static const char* fleet_DST_State_String(eFleetDSTState state)
+{
+    switch (state)
+    {
+    case FLEET_DST_STATE_WAITING:
+        return "Waiting";
+    case FLEET_DST_STATE_RUNNING:
+        return "Running";
+    case FLEET_DST_STATE_CLEANING:
+        return "Cleaning";
+    case FLEET_DST_STATE_PASSED:
+        return "Passed";
+    case FLEET_DST_STATE_FAILED:
+        return "Failed";
+    case FLEET_DST_STATE_ABORTED:
+        return "Aborted";
+    case FLEET_DST_STATE_NOT_SUPPORTED:
+        return "Not Supported";
+    }
+    return "Unknown";
+}
+
+static void print_Fleet_DST_Table(const fleetDST* fleet, uint64_t now)
+{
+    printf("\n%-20s %-20s %-13s %8s %6s %6s %8s %8s\n", "Drive", "Serial Number", "State", "Progress", "Status",
+           "Passes", "Repaired", "Elapsed");
+    for (uint32_t driveIter = UINT32_C(0); driveIter < fleet->count; ++driveIter)
+    {
+        const fleetDSTDrive* drive = &fleet->drives[driveIter];
+        uint64_t             elapsed =
+            (drive->state == FLEET_DST_STATE_RUNNING || drive->state == FLEET_DST_STATE_CLEANING) ? now
+                                                                                                    : drive->finished;
+        printf("%-20s %-20s %-13s %7" PRIu32 "%%   0x%02" PRIX8 " %6" PRIu32 " %8" PRIu64 " %5" PRIu64
+               ":%02" PRIu64 "\n",
+               drive->device->os_info.name, drive->device->drive_info.serialNumber,
+               fleet_DST_State_String(drive->state), drive->percentComplete, drive->status, drive->passes,
+               drive->repairedLBAs, elapsed / UINT64_C(60), elapsed % UINT64_C(60));
+    }
+    flush_stdout();
+}
+
+eReturnValues run_Fleet_DST(fleetDST*        fleet,
+                            bool             longTest,
+                            bool             clean,
+                            bool             ignoreMaxTime,
+                            eVerbosityLevels toolVerbosity)
+{
+    uint32_t wheel[FLEET_DST_WHEEL_SLOTS];
+    uint32_t active        = UINT32_C(0);
+    uint32_t passed        = UINT32_C(0);
+    uint32_t notSupported  = UINT32_C(0);
+    uint32_t aborted       = UINT32_C(0);
+    uint64_t tick          = UINT64_C(0);
+    uint64_t now           = UINT64_C(0);
+    uint64_t lastTable     = UINT64_C(0);
+    bool     stateChanged  = false;
+    DECLARE_SEATIMER(fleetTimer);
+    if (fleet == M_NULLPTR || fleet->count == UINT32_C(0))
+    {
+        return BAD_PARAMETER;
+    }
+    for (uint32_t slotIter = UINT32_C(0); slotIter < FLEET_DST_WHEEL_SLOTS; ++slotIter)
+    {
+        wheel[slotIter] = FLEET_DST_WHEEL_END;
+    }
+    start_Timer(&fleetTimer);
+    for (uint32_t driveIter = UINT32_C(0); driveIter < fleet->count; ++driveIter)
+    {
+        fleetDSTDrive* drive = &fleet->drives[driveIter];
+        set_Fleet_DST_Timing(drive, longTest, ignoreMaxTime);
+        start_Fleet_DST_Drive(drive, longTest, ignoreMaxTime, now);
+        if (drive->state == FLEET_DST_STATE_RUNNING)
+        {
+            // spread the first polls out so drives with the same interval are not all polled in the same second
+            schedule_Fleet_DST_Drive(fleet, wheel, driveIter,
+                                     C_CAST(uint64_t, drive->pollInterval) + (driveIter % drive->pollInterval));
+            ++active;
+        }
+    }
+    if (VERBOSITY_QUIET < toolVerbosity)
+    {
+        printf("Started %s DST on %" PRIu32 " of %" PRIu32 " drives\n", longTest ? "long" : "short", active,
+               fleet->count);
+        print_Fleet_DST_Table(fleet, now);
+    }
+    while (active > UINT32_C(0))
+    {
+        delay_Seconds(UINT32_C(1));
+        stop_Timer(&fleetTimer);
+        now = C_CAST(uint64_t, get_Seconds(fleetTimer));
+        // catch up on every second that passed, since commands to slow drives can take longer than a tick
+        for (; tick <= now; ++tick)
+        {
+            uint32_t slot       = C_CAST(uint32_t, tick % FLEET_DST_WHEEL_SLOTS);
+            uint32_t driveIndex = wheel[slot];
+            wheel[slot]         = FLEET_DST_WHEEL_END;
+            while (driveIndex != FLEET_DST_WHEEL_END)
+            {
+                fleetDSTDrive* drive     = &fleet->drives[driveIndex];
+                uint32_t       nextDrive = drive->wheelNext;
+                if (drive->nextPoll > tick)
+                {
+                    schedule_Fleet_DST_Drive(fleet, wheel, driveIndex, drive->nextPoll);
+                }
+                else
+                {
+                    eFleetDSTState previousState = drive->state;
+                    service_Fleet_DST_Drive(drive, longTest, clean, ignoreMaxTime, now);
+                    if (drive->state != previousState)
+                    {
+                        stateChanged = true;
+                    }
+                    if (drive->state == FLEET_DST_STATE_CLEANING)
+                    {
+                        schedule_Fleet_DST_Drive(fleet, wheel, driveIndex, now + UINT64_C(1));
+                    }
+                    else if (drive->state == FLEET_DST_STATE_RUNNING)
+                    {
+                        schedule_Fleet_DST_Drive(fleet, wheel, driveIndex, now + drive->pollInterval);
+                    }
+                    else
+                    {
+                        --active;
+                    }
+                }
+                driveIndex = nextDrive;
+            }
+        }
+        if (VERBOSITY_QUIET < toolVerbosity && (stateChanged || now - lastTable >= FLEET_DST_TABLE_SECONDS))
+        {
+            print_Fleet_DST_Table(fleet, now);
+            lastTable    = now;
+            stateChanged = false;
+        }
+    }
+    for (uint32_t driveIter = UINT32_C(0); driveIter < fleet->count; ++driveIter)
+    {
+        switch (fleet->drives[driveIter].state)
+        {
+        case FLEET_DST_STATE_PASSED:
+            ++passed;
+            break;
+        case FLEET_DST_STATE_NOT_SUPPORTED:
+            ++notSupported;
+            break;
+        case FLEET_DST_STATE_ABORTED:
+            ++aborted;
+            break;
+        default:
+            break;
+        }
+    }
+    if (VERBOSITY_QUIET < toolVerbosity)
+    {
+        printf("\n%" PRIu32 " of %" PRIu32 " drives passed", passed, fleet->count);
+        if (notSupported > UINT32_C(0))
+        {
+            printf(", %" PRIu32 " not supported", notSupported);
+        }
+        if (aborted > UINT32_C(0))
+        {
+            printf(", %" PRIu32 " aborted", aborted);
+        }
+        print_str("\n");
+    }
+    if (notSupported == fleet->count)
+    {
+        return NOT_SUPPORTED;
+    }
+    else if (aborted > UINT32_C(0))
+    {
+        return ABORTED;
+    }
+    else if (passed + notSupported < fleet->count)
+    {
+        return FAILURE;
+    }
+    return SUCCESS;
+}
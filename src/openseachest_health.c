@@ -0,0 +1,1274 @@
+// SPDX-License-Identifier: MPL-2.0
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2014-2025 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file openseachest_health.c
+// \brief This file implements reading health samples from a drive and the per drive health history store.
+
+#include "common_types.h"
+#include "io_utils.h"
+#include "memory_safety.h"
+#include "string_utils.h"
+#include "time_utils.h"
+#include "type_conversion.h"
+
+#include "openseachest_health.h"
+
+#include "ata_helper_func.h"
+#include "logs.h"
+#include "nvme_helper_func.h"
+#include "scsi_helper_func.h"
+
+#if defined(UEFI_C_SOURCE)
+// files cannot be shortened in UEFI. See truncate_Health_Store.
+#elif defined(_WIN32)
+#    include <io.h>
+#else
+#    include <unistd.h>
+#endif
+
+#define HEALTH_SAMPLE_BUFFER_SIZE             UINT32_C(4096)
+#define HEALTH_SAMPLE_BLOCK_SIZE              UINT32_C(512)
+#define HEALTH_ATA_SMART_ATTRIBUTE_COUNT      UINT32_C(30)
+#define HEALTH_ATA_SMART_ATTRIBUTE_LENGTH     UINT32_C(12)
+#define HEALTH_ATA_DEVICE_STATISTICS_LOG      UINT8_C(0x04)
+#define HEALTH_NVME_SMART_LOG                 UINT8_C(0x02)
+#define HEALTH_SCSI_TEMPERATURE_PAGE          UINT8_C(0x0D)
+#define HEALTH_SCSI_SOLID_STATE_MEDIA_PAGE    UINT8_C(0x11)
+
+typedef struct s_healthNVMeField
+{
+    uint16_t          offset;
+    uint8_t           length;
+    eHealthMetricType type;
+    const char*       name;
+} healthNVMeField;
+
+// The 16 byte counters are read as 8 bytes. The upper half would take centuries of I/O to be used.
+static const healthNVMeField healthNVMeFields[] = {
+    {UINT16_C(0), UINT8_C(1), HEALTH_METRIC_GAUGE, "nvme_critical_warning"},
+    {UINT16_C(1), UINT8_C(2), HEALTH_METRIC_GAUGE, "nvme_composite_temperature_kelvin"},
+    {UINT16_C(3), UINT8_C(1), HEALTH_METRIC_GAUGE, "nvme_available_spare_percent"},
+    {UINT16_C(4), UINT8_C(1), HEALTH_METRIC_GAUGE, "nvme_available_spare_threshold_percent"},
+    {UINT16_C(5), UINT8_C(1), HEALTH_METRIC_GAUGE, "nvme_percentage_used"},
+    {UINT16_C(32), UINT8_C(8), HEALTH_METRIC_COUNTER, "nvme_data_units_read"},
+    {UINT16_C(48), UINT8_C(8), HEALTH_METRIC_COUNTER, "nvme_data_units_written"},
+    {UINT16_C(64), UINT8_C(8), HEALTH_METRIC_COUNTER, "nvme_host_read_commands"},
+    {UINT16_C(80), UINT8_C(8), HEALTH_METRIC_COUNTER, "nvme_host_write_commands"},
+    {UINT16_C(96), UINT8_C(8), HEALTH_METRIC_COUNTER, "nvme_controller_busy_time_minutes"},
+    {UINT16_C(112), UINT8_C(8), HEALTH_METRIC_COUNTER, "nvme_power_cycles"},
+    {UINT16_C(128), UINT8_C(8), HEALTH_METRIC_COUNTER, "nvme_power_on_hours"},
+    {UINT16_C(144), UINT8_C(8), HEALTH_METRIC_COUNTER, "nvme_unsafe_shutdowns"},
+    {UINT16_C(160), UINT8_C(8), HEALTH_METRIC_COUNTER, "nvme_media_errors"},
+    {UINT16_C(176), UINT8_C(8), HEALTH_METRIC_COUNTER, "nvme_error_log_entries"},
+    {UINT16_C(192), UINT8_C(4), HEALTH_METRIC_COUNTER, "nvme_warning_temperature_time_minutes"},
+    {UINT16_C(196), UINT8_C(4), HEALTH_METRIC_COUNTER, "nvme_critical_temperature_time_minutes"},
+};
+
+// Error counter, temperature and solid state media pages. The other pages are mostly lists or vendor specific.
+static const uint8_t healthSCSILogPages[] = {UINT8_C(0x02), UINT8_C(0x03), UINT8_C(0x05), UINT8_C(0x06),
+                                             HEALTH_SCSI_TEMPERATURE_PAGE, HEALTH_SCSI_SOLID_STATE_MEDIA_PAGE};
+
+// SMART attributes whose raw value is a lifetime count that only goes up. Every other attribute is a gauge since raw
+// values are often rates, current counts (such as 197 current pending sectors) or vendor specific packed values.
+static const uint8_t healthATASMARTCounterAttributes[] = {
+    UINT8_C(4),   // start/stop count
+    UINT8_C(5),   // reallocated sectors
+    UINT8_C(9),   // power on hours
+    UINT8_C(10),  // spin retry count
+    UINT8_C(12),  // power cycle count
+    UINT8_C(171), // program fail count
+    UINT8_C(172), // erase fail count
+    UINT8_C(174), // unexpected power loss count
+    UINT8_C(183), // SATA downshift count
+    UINT8_C(184), // end to end errors
+    UINT8_C(187), // reported uncorrectable errors
+    UINT8_C(188), // command timeouts
+    UINT8_C(189), // high fly writes
+    UINT8_C(192), // power off retract count
+    UINT8_C(193), // load cycle count
+    UINT8_C(196), // reallocation events
+    UINT8_C(198), // offline uncorrectable sectors
+    UINT8_C(199), // UDMA CRC errors
+    UINT8_C(240), // head flying hours
+    UINT8_C(241), // total LBAs written
+    UINT8_C(242)  // total LBAs read
+};
+
+// Device statistics that are lifetime counts, by page and offset. Everything else, such as the date and time stamp,
+// pending error count, utilization, temperatures and percentage used, is a gauge.
+static const uint16_t healthATADeviceStatisticCounters[][2] = {
+    {UINT16_C(1), UINT16_C(0x08)}, // lifetime power on resets
+    {UINT16_C(1), UINT16_C(0x10)}, // power on hours
+    {UINT16_C(1), UINT16_C(0x18)}, // logical sectors written
+    {UINT16_C(1), UINT16_C(0x20)}, // write commands
+    {UINT16_C(1), UINT16_C(0x28)}, // logical sectors read
+    {UINT16_C(1), UINT16_C(0x30)}, // read commands
+    {UINT16_C(2), UINT16_C(0x08)}, // free fall events
+    {UINT16_C(2), UINT16_C(0x10)}, // overlimit shock events
+    {UINT16_C(3), UINT16_C(0x08)}, // spindle motor power on hours
+    {UINT16_C(3), UINT16_C(0x10)}, // head flying hours
+    {UINT16_C(3), UINT16_C(0x18)}, // head load events
+    {UINT16_C(3), UINT16_C(0x20)}, // reallocated logical sectors
+    {UINT16_C(3), UINT16_C(0x28)}, // read recovery attempts
+    {UINT16_C(3), UINT16_C(0x30)}, // mechanical start failures
+    {UINT16_C(3), UINT16_C(0x40)}, // high priority unload events
+    {UINT16_C(4), UINT16_C(0x08)}, // reported uncorrectable errors
+    {UINT16_C(4), UINT16_C(0x10)}, // resets between command acceptance and completion
+    {UINT16_C(5), UINT16_C(0x40)}, // time in over temperature
+    {UINT16_C(5), UINT16_C(0x50)}, // time in under temperature
+    {UINT16_C(6), UINT16_C(0x08)}, // hardware resets
+    {UINT16_C(6), UINT16_C(0x10)}, // ASR events
+    {UINT16_C(6), UINT16_C(0x18)}  // interface CRC errors
+};
+
+static eHealthMetricType get_ATA_Device_Statistic_Metric_Type(uint16_t page, uint16_t offset)
+{
+    for (size_t statIter = SIZE_T_C(0);
+         statIter < sizeof(healthATADeviceStatisticCounters) / sizeof(healthATADeviceStatisticCounters[0]); ++statIter)
+    {
+        if (healthATADeviceStatisticCounters[statIter][0] == page &&
+            healthATADeviceStatisticCounters[statIter][1] == offset)
+        {
+            return HEALTH_METRIC_COUNTER;
+        }
+    }
+    return HEALTH_METRIC_GAUGE;
+}
+
+static eHealthMetricType get_ATA_SMART_Attribute_Metric_Type(uint8_t attributeID)
+{
+    for (size_t attrIter = SIZE_T_C(0);
+         attrIter < sizeof(healthATASMARTCounterAttributes) / sizeof(healthATASMARTCounterAttributes[0]); ++attrIter)
+    {
+        if (healthATASMARTCounterAttributes[attrIter] == attributeID)
+        {
+            return HEALTH_METRIC_COUNTER;
+        }
+    }
+    return HEALTH_METRIC_GAUGE;
+}
+
+uint64_t get_Health_Little_Endian_Value(const uint8_t* data, uint8_t length)
+{
+    uint64_t value = UINT64_C(0);
+    for (uint8_t byteIter = length; byteIter > UINT8_C(0); --byteIter)
+    {
+        value = (value << 8) | data[byteIter - UINT8_C(1)];
+    }
+    return value;
+}
+
+eReturnValues add_Health_Metric(healthSample*       sample,
+                                eHealthMetricSource source,
+                                eHealthMetricType   type,
+                                uint16_t            page,
+                                uint16_t            index,
+                                uint64_t            value)
+{
+    if (sample->count == sample->capacity)
+    {
+        uint32_t      newCapacity = sample->capacity == UINT32_C(0) ? UINT32_C(64) : sample->capacity * UINT32_C(2);
+        healthMetric* newMetrics  = M_NULLPTR;
+        if (newCapacity < sample->capacity)
+        {
+            return MEMORY_FAILURE;
+        }
+        newMetrics =
+            C_CAST(healthMetric*, safe_realloc(sample->metrics, C_CAST(size_t, newCapacity) * sizeof(healthMetric)));
+        if (newMetrics == M_NULLPTR)
+        {
+            return MEMORY_FAILURE;
+        }
+        sample->metrics  = newMetrics;
+        sample->capacity = newCapacity;
+    }
+    sample->metrics[sample->count].source = source;
+    sample->metrics[sample->count].type   = type;
+    sample->metrics[sample->count].page   = page;
+    sample->metrics[sample->count].index  = index;
+    sample->metrics[sample->count].value  = value;
+    ++sample->count;
+    return SUCCESS;
+}
+
+eReturnValues add_ATA_Device_Statistics_Metrics(healthSample* sample, const uint8_t* log, uint32_t pages)
+{
+    eReturnValues ret = SUCCESS;
+    for (uint32_t pageIter = UINT32_C(1); pageIter < pages && ret == SUCCESS; ++pageIter)
+    {
+        const uint8_t* page = &log[pageIter * HEALTH_SAMPLE_BLOCK_SIZE];
+        if (page[2] != pageIter)
+        {
+            // not a supported page
+            continue;
+        }
+        for (uint32_t offset = UINT32_C(8); offset < HEALTH_SAMPLE_BLOCK_SIZE && ret == SUCCESS;
+             offset += UINT32_C(8))
+        {
+            uint64_t qword = get_Health_Little_Endian_Value(&page[offset], UINT8_C(8));
+            // bit 63 = supported, bit 62 = value valid
+            if ((qword & BIT63) && (qword & BIT62))
+            {
+                ret = add_Health_Metric(
+                    sample, HEALTH_METRIC_ATA_DEVICE_STATISTIC,
+                    get_ATA_Device_Statistic_Metric_Type(C_CAST(uint16_t, pageIter), C_CAST(uint16_t, offset)),
+                    C_CAST(uint16_t, pageIter), C_CAST(uint16_t, offset), M_GETBITRANGE(qword, 55, 0));
+            }
+        }
+    }
+    return ret;
+}
+
+eReturnValues add_NVMe_Health_Metrics(healthSample* sample, const uint8_t* log)
+{
+    eReturnValues ret = SUCCESS;
+    for (size_t fieldIter = SIZE_T_C(0);
+         fieldIter < sizeof(healthNVMeFields) / sizeof(healthNVMeFields[0]) && ret == SUCCESS; ++fieldIter)
+    {
+        const healthNVMeField* field = &healthNVMeFields[fieldIter];
+        ret = add_Health_Metric(sample, HEALTH_METRIC_NVME_HEALTH, field->type, UINT16_C(0), field->offset,
+                                get_Health_Little_Endian_Value(&log[field->offset], field->length));
+    }
+    return ret;
+}
+
+eReturnValues add_SCSI_Log_Page_Metrics(healthSample* sample, const uint8_t* page, uint32_t length)
+{
+    eReturnValues     ret      = SUCCESS;
+    uint8_t           pageCode = M_GETBITRANGE(page[0], 5, 0);
+    uint32_t          offset   = UINT32_C(4);
+    uint32_t          end      = M_Min(UINT32_C(4) + M_BytesTo2ByteValue(page[2], page[3]), length);
+    eHealthMetricType type     = HEALTH_METRIC_GAUGE;
+    if (pageCode == UINT8_C(0x02) || pageCode == UINT8_C(0x03) || pageCode == UINT8_C(0x05) ||
+        pageCode == UINT8_C(0x06))
+    {
+        // write, read, verify and non-medium error counter pages
+        type = HEALTH_METRIC_COUNTER;
+    }
+    while (offset + UINT32_C(4) <= end && ret == SUCCESS)
+    {
+        uint16_t parameterCode    = M_BytesTo2ByteValue(page[offset], page[offset + 1]);
+        uint8_t  formatAndLinking = page[offset + 2] & UINT8_C(0x03);
+        uint8_t  parameterLength  = page[offset + 3];
+        if (offset + UINT32_C(4) + parameterLength > end)
+        {
+            break;
+        }
+        // counters and binary values up to 8 bytes (temperatures are binary format), not ASCII text
+        if (formatAndLinking != UINT8_C(1) && parameterLength > UINT8_C(0) && parameterLength <= UINT8_C(8))
+        {
+            uint64_t value = UINT64_C(0);
+            for (uint8_t byteIter = UINT8_C(0); byteIter < parameterLength; ++byteIter)
+            {
+                value = (value << 8) | page[offset + UINT32_C(4) + byteIter];
+            }
+            ret = add_Health_Metric(sample, HEALTH_METRIC_SCSI_LOG_PARAMETER, type, pageCode, parameterCode, value);
+        }
+        offset += UINT32_C(4) + parameterLength;
+    }
+    return ret;
+}
+
+static eReturnValues read_ATA_Health_Sample(tDevice* device, healthSample* sample, uint8_t* buffer)
+{
+    eReturnValues ret = SUCCESS;
+    if (!sample->probed)
+    {
+        uint32_t logSize              = UINT32_C(0);
+        sample->smartAttributes       = true;
+        sample->deviceStatisticsPages = UINT32_C(0);
+        if (SUCCESS == get_ATA_Log_Size(device, HEALTH_ATA_DEVICE_STATISTICS_LOG, &logSize, true, false))
+        {
+            sample->deviceStatisticsPages =
+                M_Min(logSize / HEALTH_SAMPLE_BLOCK_SIZE, HEALTH_ATA_DEVICE_STATISTICS_MAX_PAGE + UINT32_C(1));
+        }
+    }
+    if (sample->smartAttributes)
+    {
+        eReturnValues smartRet = UNKNOWN;
+        safe_memset(buffer, HEALTH_SAMPLE_BUFFER_SIZE, 0, HEALTH_SAMPLE_BLOCK_SIZE);
+        smartRet = ata_SMART_Read_Data(device, buffer, HEALTH_SAMPLE_BLOCK_SIZE);
+        if (smartRet == SUCCESS || smartRet == WARN_INVALID_CHECKSUM)
+        {
+            for (uint32_t attrIter = UINT32_C(0); attrIter < HEALTH_ATA_SMART_ATTRIBUTE_COUNT && ret == SUCCESS;
+                 ++attrIter)
+            {
+                const uint8_t*    attribute = &buffer[UINT32_C(2) + (attrIter * HEALTH_ATA_SMART_ATTRIBUTE_LENGTH)];
+                uint64_t          raw       = get_Health_Little_Endian_Value(&attribute[5], UINT8_C(6));
+                eHealthMetricType type      = get_ATA_SMART_Attribute_Metric_Type(attribute[0]);
+                if (attribute[0] == UINT8_C(0))
+                {
+                    continue;
+                }
+                if (attribute[0] == UINT8_C(190) || attribute[0] == UINT8_C(194))
+                {
+                    // temperature is the low byte, the other bytes hold the lifetime minimum and maximum
+                    raw = M_Byte0(raw);
+                }
+                ret = add_Health_Metric(sample, HEALTH_METRIC_ATA_SMART_RAW, type, UINT16_C(0), attribute[0], raw);
+                if (ret == SUCCESS)
+                {
+                    ret = add_Health_Metric(sample, HEALTH_METRIC_ATA_SMART_NORMALIZED, HEALTH_METRIC_GAUGE,
+                                            UINT16_C(0), attribute[0], attribute[3]);
+                }
+            }
+        }
+        else if (!sample->probed)
+        {
+            sample->smartAttributes = false;
+        }
+    }
+    if (ret == SUCCESS && sample->deviceStatisticsPages > UINT32_C(0))
+    {
+        // every page in one command instead of a command per page
+        uint32_t length = sample->deviceStatisticsPages * HEALTH_SAMPLE_BLOCK_SIZE;
+        safe_memset(buffer, HEALTH_SAMPLE_BUFFER_SIZE, 0, length);
+        if (SUCCESS == send_ATA_Read_Log_Ext_Cmd(device, HEALTH_ATA_DEVICE_STATISTICS_LOG, UINT16_C(0), buffer, length,
+                                                 UINT16_C(0)))
+        {
+            ret = add_ATA_Device_Statistics_Metrics(sample, buffer, sample->deviceStatisticsPages);
+        }
+        else if (!sample->probed)
+        {
+            sample->deviceStatisticsPages = UINT32_C(0);
+        }
+    }
+    return ret;
+}
+
+static eReturnValues read_NVMe_Health_Sample(tDevice* device, healthSample* sample, uint8_t* buffer)
+{
+    nvmeGetLogPageCmdOpts cmdOpts;
+    safe_memset(&cmdOpts, sizeof(nvmeGetLogPageCmdOpts), 0, sizeof(nvmeGetLogPageCmdOpts));
+    safe_memset(buffer, HEALTH_SAMPLE_BUFFER_SIZE, 0, HEALTH_SAMPLE_BLOCK_SIZE);
+    cmdOpts.nsid    = NVME_ALL_NAMESPACES;
+    cmdOpts.lid     = HEALTH_NVME_SMART_LOG;
+    cmdOpts.addr    = buffer;
+    cmdOpts.dataLen = HEALTH_SAMPLE_BLOCK_SIZE;
+    if (SUCCESS != nvme_Get_Log_Page(device, &cmdOpts))
+    {
+        return NOT_SUPPORTED;
+    }
+    return add_NVMe_Health_Metrics(sample, buffer);
+}
+
+static eReturnValues read_SCSI_Health_Sample(tDevice* device, healthSample* sample, uint8_t* buffer)
+{
+    eReturnValues ret = SUCCESS;
+    if (!sample->probed)
+    {
+        sample->scsiLogPageCount = UINT8_C(0);
+        safe_memset(buffer, HEALTH_SAMPLE_BUFFER_SIZE, 0, HEALTH_SAMPLE_BLOCK_SIZE);
+        if (SUCCESS == scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, UINT8_C(0), UINT8_C(0), UINT16_C(0),
+                                          buffer, UINT16_C(255)))
+        {
+            uint16_t listLength = M_Min(M_BytesTo2ByteValue(buffer[2], buffer[3]), UINT16_C(251));
+            for (uint16_t listIter = UINT16_C(0); listIter < listLength; ++listIter)
+            {
+                for (size_t pageIter = SIZE_T_C(0); pageIter < sizeof(healthSCSILogPages); ++pageIter)
+                {
+                    if (buffer[4 + listIter] == healthSCSILogPages[pageIter] &&
+                        sample->scsiLogPageCount < sizeof(sample->scsiLogPages))
+                    {
+                        sample->scsiLogPages[sample->scsiLogPageCount] = healthSCSILogPages[pageIter];
+                        ++sample->scsiLogPageCount;
+                    }
+                }
+            }
+        }
+    }
+    for (uint8_t pageIter = UINT8_C(0); pageIter < sample->scsiLogPageCount && ret == SUCCESS; ++pageIter)
+    {
+        uint8_t pageCode = sample->scsiLogPages[pageIter];
+        safe_memset(buffer, HEALTH_SAMPLE_BUFFER_SIZE, 0, HEALTH_SAMPLE_BUFFER_SIZE);
+        if (SUCCESS != scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, pageCode, UINT8_C(0), UINT16_C(0),
+                                          buffer, C_CAST(uint16_t, HEALTH_SAMPLE_BUFFER_SIZE)))
+        {
+            continue;
+        }
+        ret = add_SCSI_Log_Page_Metrics(sample, buffer, HEALTH_SAMPLE_BUFFER_SIZE);
+    }
+    return ret;
+}
+
+eReturnValues read_Health_Sample(tDevice* device, healthSample* sample)
+{
+    eReturnValues ret    = SUCCESS;
+    uint8_t*      buffer = M_NULLPTR;
+    if (device == M_NULLPTR || sample == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    buffer = C_CAST(uint8_t*,
+                    safe_calloc_aligned(HEALTH_SAMPLE_BUFFER_SIZE, sizeof(uint8_t), device->os_info.minimumAlignment));
+    if (buffer == M_NULLPTR)
+    {
+        return MEMORY_FAILURE;
+    }
+    sample->count     = UINT32_C(0);
+    sample->timestamp = C_CAST(uint64_t, time(M_NULLPTR));
+    switch (device->drive_info.drive_type)
+    {
+    case ATA_DRIVE:
+        ret = read_ATA_Health_Sample(device, sample, buffer);
+        break;
+    case NVME_DRIVE:
+        ret = read_NVMe_Health_Sample(device, sample, buffer);
+        break;
+    case SCSI_DRIVE:
+        ret = read_SCSI_Health_Sample(device, sample, buffer);
+        break;
+    default:
+        ret = NOT_SUPPORTED;
+        break;
+    }
+    sample->probed = true;
+    safe_free_aligned(&buffer);
+    if (ret == SUCCESS && sample->count == UINT32_C(0))
+    {
+        ret = NOT_SUPPORTED;
+    }
+    return ret;
+}
+
+const char* get_Health_Metric_Name(const healthMetric* metric)
+{
+    switch (metric->source)
+    {
+    case HEALTH_METRIC_ATA_SMART_RAW:
+        return "ata_smart_attribute_raw";
+    case HEALTH_METRIC_ATA_SMART_NORMALIZED:
+        return "ata_smart_attribute_normalized";
+    case HEALTH_METRIC_ATA_DEVICE_STATISTIC:
+        return "ata_device_statistic";
+    case HEALTH_METRIC_NVME_HEALTH:
+        for (size_t fieldIter = SIZE_T_C(0); fieldIter < sizeof(healthNVMeFields) / sizeof(healthNVMeFields[0]);
+             ++fieldIter)
+        {
+            if (healthNVMeFields[fieldIter].offset == metric->index)
+            {
+                return healthNVMeFields[fieldIter].name;
+            }
+        }
+        return "nvme_health";
+    case HEALTH_METRIC_SCSI_LOG_PARAMETER:
+        return "scsi_log_parameter";
+    case HEALTH_METRIC_SATA_PHY_EVENT:
+        return "sata_phy_event_counter";
+    }
+    return "unknown";
+}
+
+const healthMetric* find_Health_Metric(const healthSample* sample, const healthMetric* metric, uint32_t hint)
+{
+    if (hint < sample->count && sample->metrics[hint].source == metric->source &&
+        sample->metrics[hint].page == metric->page && sample->metrics[hint].index == metric->index)
+    {
+        return &sample->metrics[hint];
+    }
+    for (uint32_t metricIter = UINT32_C(0); metricIter < sample->count; ++metricIter)
+    {
+        if (sample->metrics[metricIter].source == metric->source && sample->metrics[metricIter].page == metric->page &&
+            sample->metrics[metricIter].index == metric->index)
+        {
+            return &sample->metrics[metricIter];
+        }
+    }
+    return M_NULLPTR;
+}
+
+void free_Health_Sample(healthSample* sample)
+{
+    if (sample != M_NULLPTR)
+    {
+        safe_free(&sample->metrics);
+        sample->count    = UINT32_C(0);
+        sample->capacity = UINT32_C(0);
+        sample->probed   = false;
+    }
+}
+
+#define HEALTH_STORE_SIGNATURE          "OSCHHIST"
+#define HEALTH_STORE_SIGNATURE_LENGTH   SIZE_T_C(8)
+#define HEALTH_STORE_HEADER_SIZE        UINT32_C(128)
+#define HEALTH_STORE_SERIAL_OFFSET      UINT32_C(16)
+#define HEALTH_STORE_SERIAL_LENGTH      UINT32_C(32)
+#define HEALTH_STORE_MODEL_OFFSET       UINT32_C(48)
+#define HEALTH_STORE_MODEL_LENGTH       UINT32_C(48)
+#define HEALTH_STORE_FIRMWARE_OFFSET    UINT32_C(96)
+#define HEALTH_STORE_FIRMWARE_LENGTH    UINT32_C(16)
+#define HEALTH_STORE_WWN_OFFSET         UINT32_C(112)
+#define HEALTH_STORE_CREATED_OFFSET     UINT32_C(120)
+#define HEALTH_STORE_RECORD_HEADER_SIZE UINT32_C(12)
+#define HEALTH_STORE_RECORD_CRC_OFFSET  UINT32_C(8)
+#define HEALTH_STORE_COLUMN_SIZE        UINT32_C(8)
+#define HEALTH_STORE_RECORD_COLUMNS     UINT8_C(1)
+#define HEALTH_STORE_RECORD_SAMPLES     UINT8_C(2)
+#define HEALTH_STORE_MAX_COLUMNS        UINT32_C(0xFFFF)
+#define HEALTH_STORE_MAX_VARINT_LENGTH  SIZE_T_C(10)
+#define HEALTH_STORE_EXTENSION          "oshs"
+
+#if defined(_WIN32)
+#    define HEALTH_STORE_PATH_SEPARATOR '\\'
+#else
+#    define HEALTH_STORE_PATH_SEPARATOR '/'
+#endif
+
+static void set_Health_Store_Little_Endian_Value(uint8_t* data, uint8_t length, uint64_t value)
+{
+    for (uint8_t byteIter = UINT8_C(0); byteIter < length; ++byteIter)
+    {
+        data[byteIter] = M_Byte0(value);
+        value >>= 8;
+    }
+}
+
+static size_t put_Health_Store_Varint(uint8_t* data, uint64_t value)
+{
+    size_t length = SIZE_T_C(0);
+    while (value >= UINT64_C(0x80))
+    {
+        data[length++] = C_CAST(uint8_t, (value & UINT64_C(0x7F)) | UINT64_C(0x80));
+        value >>= 7;
+    }
+    data[length++] = C_CAST(uint8_t, value);
+    return length;
+}
+
+static bool get_Health_Store_Varint(const uint8_t* data, uint32_t length, uint32_t* offset, uint64_t* value)
+{
+    *value = UINT64_C(0);
+    for (uint32_t shift = UINT32_C(0); shift < UINT32_C(64) && *offset < length; shift += UINT32_C(7))
+    {
+        uint8_t byte = data[*offset];
+        ++(*offset);
+        *value |= C_CAST(uint64_t, byte & UINT8_C(0x7F)) << shift;
+        if ((byte & UINT8_C(0x80)) == UINT8_C(0))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Zigzag encoding maps small negative and positive differences to small unsigned values. Differences are taken
+// modulo 2^64 so any pair of values can be encoded and decoded.
+static uint64_t get_Health_Store_Delta(uint64_t previous, uint64_t current)
+{
+    uint64_t difference = current - previous;
+    return (difference << 1) ^ ((difference & BIT63) ? UINT64_MAX : UINT64_C(0));
+}
+
+static uint64_t apply_Health_Store_Delta(uint64_t previous, uint64_t delta)
+{
+    uint64_t difference = (delta >> 1) ^ ((delta & UINT64_C(1)) ? UINT64_MAX : UINT64_C(0));
+    return previous + difference;
+}
+
+// Bitwise since records are at most a few KiB. Pass 0 as crc for the first piece of data and the previous result to
+// continue over the next piece.
+static uint32_t get_Health_Store_CRC32(uint32_t crc, const uint8_t* data, uint32_t length)
+{
+    crc ^= UINT32_C(0xFFFFFFFF);
+    for (uint32_t iter = UINT32_C(0); iter < length; ++iter)
+    {
+        crc ^= data[iter];
+        for (uint8_t bit = UINT8_C(0); bit < UINT8_C(8); ++bit)
+        {
+            crc = (crc & UINT32_C(1)) ? (crc >> 1) ^ UINT32_C(0xEDB88320) : crc >> 1;
+        }
+    }
+    return crc ^ UINT32_C(0xFFFFFFFF);
+}
+
+// Decodes one sample: the timestamp and the value of each column. previous holds the values of the previous sample
+// on entry and the values of this sample on return.
+static bool decode_Health_Store_Sample(const uint8_t* data,
+                                       uint32_t       length,
+                                       uint32_t*      offset,
+                                       uint64_t*      previous,
+                                       uint32_t       count)
+{
+    for (uint32_t iter = UINT32_C(0); iter < count; ++iter)
+    {
+        uint64_t delta = UINT64_C(0);
+        if (!get_Health_Store_Varint(data, length, offset, &delta))
+        {
+            return false;
+        }
+        previous[iter] = apply_Health_Store_Delta(previous[iter], delta);
+    }
+    return true;
+}
+
+static void get_Health_Store_Column(const uint8_t* data, healthMetric* column)
+{
+    safe_memset(column, sizeof(healthMetric), 0, sizeof(healthMetric));
+    column->source = C_CAST(eHealthMetricSource, data[0]);
+    column->type   = C_CAST(eHealthMetricType, data[1]);
+    column->page   = M_BytesTo2ByteValue(data[3], data[2]);
+    column->index  = M_BytesTo2ByteValue(data[5], data[4]);
+}
+
+static bool is_Same_Health_Metric(const healthMetric* first, const healthMetric* second)
+{
+    return first->source == second->source && first->type == second->type && first->page == second->page &&
+           first->index == second->index;
+}
+
+static bool read_Health_Store_Payload(secureFileInfo* file, uint8_t* payload, uint32_t payloadLength)
+{
+    size_t readCount = SIZE_T_C(0);
+    return payloadLength == UINT32_C(0) ||
+           (SEC_FILE_SUCCESS ==
+                secure_Read_File(file, payload, payloadLength, sizeof(uint8_t), payloadLength, &readCount) &&
+            readCount == payloadLength);
+}
+
+// Reads the record at offset, growing payload as needed. Returns VALIDATION_FAILURE at the end of the file, at a
+// record that does not fit in it or at a record that fails its CRC, which is where the valid records end.
+static eReturnValues read_Health_Store_Record(secureFileInfo* file,
+                                              uint64_t        offset,
+                                              uint8_t*        type,
+                                              uint16_t*       count,
+                                              uint8_t**       payload,
+                                              uint32_t*       payloadLength)
+{
+    DECLARE_ZERO_INIT_ARRAY(uint8_t, header, HEALTH_STORE_RECORD_HEADER_SIZE);
+    size_t   readCount  = SIZE_T_C(0);
+    uint8_t* newPayload = M_NULLPTR;
+    uint32_t crc        = UINT32_C(0);
+    if (offset + HEALTH_STORE_RECORD_HEADER_SIZE > file->fileSize ||
+        SEC_FILE_SUCCESS != secure_Seek_File(file, C_CAST(int64_t, offset), SEEK_SET) ||
+        SEC_FILE_SUCCESS != secure_Read_File(file, header, HEALTH_STORE_RECORD_HEADER_SIZE, sizeof(uint8_t),
+                                             HEALTH_STORE_RECORD_HEADER_SIZE, &readCount) ||
+        readCount != HEALTH_STORE_RECORD_HEADER_SIZE)
+    {
+        return VALIDATION_FAILURE;
+    }
+    *type          = header[0];
+    *count         = M_BytesTo2ByteValue(header[3], header[2]);
+    *payloadLength = M_BytesTo4ByteValue(header[7], header[6], header[5], header[4]);
+    crc            = M_BytesTo4ByteValue(header[11], header[10], header[9], header[8]);
+    if (offset + HEALTH_STORE_RECORD_HEADER_SIZE + *payloadLength > file->fileSize)
+    {
+        return VALIDATION_FAILURE;
+    }
+    newPayload = C_CAST(uint8_t*, safe_realloc(*payload, M_Max(*payloadLength, UINT32_C(1))));
+    if (newPayload == M_NULLPTR)
+    {
+        return MEMORY_FAILURE;
+    }
+    *payload = newPayload;
+    if (!read_Health_Store_Payload(file, *payload, *payloadLength) ||
+        crc != get_Health_Store_CRC32(get_Health_Store_CRC32(UINT32_C(0), header, HEALTH_STORE_RECORD_CRC_OFFSET),
+                                      *payload, *payloadLength))
+    {
+        return VALIDATION_FAILURE;
+    }
+    return SUCCESS;
+}
+
+// Records are only ever written at the end of the file
+static eReturnValues write_Health_Store_Record(healthStore*   store,
+                                               uint8_t        type,
+                                               uint16_t       count,
+                                               const uint8_t* payload,
+                                               uint32_t       payloadLength)
+{
+    DECLARE_ZERO_INIT_ARRAY(uint8_t, header, HEALTH_STORE_RECORD_HEADER_SIZE);
+    header[0] = type;
+    set_Health_Store_Little_Endian_Value(&header[2], UINT8_C(2), count);
+    set_Health_Store_Little_Endian_Value(&header[4], UINT8_C(4), payloadLength);
+    set_Health_Store_Little_Endian_Value(
+        &header[HEALTH_STORE_RECORD_CRC_OFFSET], UINT8_C(4),
+        get_Health_Store_CRC32(get_Health_Store_CRC32(UINT32_C(0), header, HEALTH_STORE_RECORD_CRC_OFFSET), payload,
+                               payloadLength));
+    if (SEC_FILE_SUCCESS != secure_Seek_File(store->file, C_CAST(int64_t, store->endOffset), SEEK_SET) ||
+        SEC_FILE_SUCCESS != secure_Write_File(store->file, header, HEALTH_STORE_RECORD_HEADER_SIZE, sizeof(uint8_t),
+                                              HEALTH_STORE_RECORD_HEADER_SIZE, M_NULLPTR) ||
+        (payloadLength > UINT32_C(0) && SEC_FILE_SUCCESS != secure_Write_File(store->file, payload, payloadLength,
+                                                                               sizeof(uint8_t), payloadLength,
+                                                                               M_NULLPTR)) ||
+        SEC_FILE_SUCCESS != secure_Flush_File(store->file))
+    {
+        return ERROR_WRITING_FILE;
+    }
+    store->endOffset += HEALTH_STORE_RECORD_HEADER_SIZE + payloadLength;
+    return SUCCESS;
+}
+
+// Cuts the file off after the last valid record so the next record directly follows it
+static eReturnValues truncate_Health_Store(healthStore* store)
+{
+    if (store->endOffset >= store->file->fileSize)
+    {
+        return SUCCESS;
+    }
+    if (SEC_FILE_SUCCESS != secure_Flush_File(store->file))
+    {
+        return ERROR_WRITING_FILE;
+    }
+#if defined(UEFI_C_SOURCE)
+    // no way to shorten a file here. The next record is written over the invalid data instead, and readers stop at
+    // whatever is left of it after that record
+    return SUCCESS;
+#else
+#    if defined(_WIN32)
+    if (0 != _chsize_s(_fileno(store->file->file), C_CAST(__int64, store->endOffset)))
+#    else
+    if (0 != ftruncate(fileno(store->file->file), C_CAST(off_t, store->endOffset)))
+#    endif
+    {
+        return ERROR_WRITING_FILE;
+    }
+    return SUCCESS;
+#endif
+}
+
+static eReturnValues set_Health_Store_Columns(healthStore* store, const healthMetric* columns, uint32_t columnCount)
+{
+    healthMetric* newColumns = M_NULLPTR;
+    uint64_t*     newValues  = M_NULLPTR;
+    uint8_t*      newEncoded = M_NULLPTR;
+    // worst case of a samples record: the timestamp and every value take the longest varint
+    size_t encodedSize = (C_CAST(size_t, columnCount) + SIZE_T_C(1)) * HEALTH_STORE_MAX_VARINT_LENGTH;
+    if (columnCount > UINT32_C(0))
+    {
+        newColumns = C_CAST(healthMetric*, safe_calloc(columnCount, sizeof(healthMetric)));
+    }
+    newValues  = C_CAST(uint64_t*, safe_calloc(C_CAST(size_t, columnCount) + SIZE_T_C(1), sizeof(uint64_t)));
+    newEncoded = C_CAST(uint8_t*, safe_calloc(encodedSize, sizeof(uint8_t)));
+    if ((columnCount > UINT32_C(0) && newColumns == M_NULLPTR) || newValues == M_NULLPTR || newEncoded == M_NULLPTR)
+    {
+        safe_free(&newColumns);
+        safe_free(&newValues);
+        safe_free(&newEncoded);
+        return MEMORY_FAILURE;
+    }
+    for (uint32_t columnIter = UINT32_C(0); columnIter < columnCount; ++columnIter)
+    {
+        newColumns[columnIter]       = columns[columnIter];
+        newColumns[columnIter].value = UINT64_C(0);
+    }
+    safe_free(&store->columns);
+    safe_free(&store->lastValues);
+    safe_free(&store->encoded);
+    store->columns     = newColumns;
+    store->columnCount = columnCount;
+    store->lastValues  = newValues;
+    store->encoded     = newEncoded;
+    store->encodedSize = encodedSize;
+    return SUCCESS;
+}
+
+// Walks the records of an existing file to find the current columns and the values of the last sample. The walk
+// stops at the first record that is cut short or fails its CRC, such as one left by an interrupted write, and the
+// file is truncated there. A valid record that cannot be decoded means the file was not written by this code.
+static eReturnValues load_Health_Store(healthStore* store, uint64_t offset)
+{
+    eReturnValues ret           = SUCCESS;
+    uint8_t*      payload       = M_NULLPTR;
+    uint8_t       type          = UINT8_C(0);
+    uint16_t      count         = UINT16_C(0);
+    uint32_t      payloadLength = UINT32_C(0);
+    while (ret == SUCCESS)
+    {
+        eReturnValues recordRet =
+            read_Health_Store_Record(store->file, offset, &type, &count, &payload, &payloadLength);
+        if (recordRet != SUCCESS)
+        {
+            ret = recordRet == MEMORY_FAILURE ? MEMORY_FAILURE : SUCCESS;
+            break;
+        }
+        if (type == HEALTH_STORE_RECORD_COLUMNS && payloadLength == C_CAST(uint32_t, count) * HEALTH_STORE_COLUMN_SIZE)
+        {
+            healthMetric* columns = C_CAST(healthMetric*, safe_calloc(M_Max(count, UINT16_C(1)), sizeof(healthMetric)));
+            if (columns == M_NULLPTR)
+            {
+                ret = MEMORY_FAILURE;
+                break;
+            }
+            for (uint16_t columnIter = UINT16_C(0); columnIter < count; ++columnIter)
+            {
+                get_Health_Store_Column(&payload[columnIter * HEALTH_STORE_COLUMN_SIZE], &columns[columnIter]);
+            }
+            ret = set_Health_Store_Columns(store, columns, count);
+            safe_free(&columns);
+        }
+        else if (type == HEALTH_STORE_RECORD_SAMPLES && store->lastValues != M_NULLPTR)
+        {
+            uint32_t payloadOffset = UINT32_C(0);
+            for (uint16_t sampleIter = UINT16_C(0); sampleIter < count && ret == SUCCESS; ++sampleIter)
+            {
+                if (!decode_Health_Store_Sample(payload, payloadLength, &payloadOffset, store->lastValues,
+                                                store->columnCount + UINT32_C(1)))
+                {
+                    ret = VALIDATION_FAILURE;
+                }
+            }
+        }
+        else
+        {
+            ret = VALIDATION_FAILURE;
+        }
+        offset += HEALTH_STORE_RECORD_HEADER_SIZE + payloadLength;
+    }
+    safe_free(&payload);
+    if (ret == SUCCESS)
+    {
+        store->endOffset = offset;
+        ret              = truncate_Health_Store(store);
+    }
+    return ret;
+}
+
+eReturnValues open_Health_Store(tDevice* device, const char* directory, healthStore* store)
+{
+    eReturnValues ret = SUCCESS;
+    DECLARE_ZERO_INIT_ARRAY(char, fileName, OPENSEA_PATH_MAX);
+    DECLARE_ZERO_INIT_ARRAY(char, serialNumber, HEALTH_STORE_SERIAL_LENGTH + 1);
+    DECLARE_ZERO_INIT_ARRAY(uint8_t, header, HEALTH_STORE_HEADER_SIZE);
+    size_t serialLen = SIZE_T_C(0);
+    size_t nameLen   = SIZE_T_C(0);
+    size_t readCount = SIZE_T_C(0);
+    if (device == M_NULLPTR || store == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    safe_memset(store, sizeof(healthStore), 0, sizeof(healthStore));
+    serialLen = safe_strlen(device->drive_info.serialNumber);
+    for (size_t iter = SIZE_T_C(0); iter < serialLen && nameLen < HEALTH_STORE_SERIAL_LENGTH; ++iter)
+    {
+        char character = device->drive_info.serialNumber[iter];
+        if (safe_isalnum(character) || character == '-' || character == '_')
+        {
+            serialNumber[nameLen++] = character;
+        }
+    }
+    if (nameLen == SIZE_T_C(0))
+    {
+        return BAD_PARAMETER;
+    }
+    if (directory != M_NULLPTR && safe_strlen(directory) > SIZE_T_C(0))
+    {
+        snprintf_err_handle(fileName, OPENSEA_PATH_MAX, "%s%c%s.%s", directory, HEALTH_STORE_PATH_SEPARATOR,
+                            serialNumber, HEALTH_STORE_EXTENSION);
+    }
+    else
+    {
+        snprintf_err_handle(fileName, OPENSEA_PATH_MAX, "%s.%s", serialNumber, HEALTH_STORE_EXTENSION);
+    }
+    store->file = secure_Open_File(fileName, "r+b", M_NULLPTR, M_NULLPTR, M_NULLPTR);
+    if (store->file != M_NULLPTR && store->file->error == SEC_FILE_SUCCESS)
+    {
+        if (store->file->fileSize < HEALTH_STORE_HEADER_SIZE ||
+            SEC_FILE_SUCCESS != secure_Read_File(store->file, header, HEALTH_STORE_HEADER_SIZE, sizeof(uint8_t),
+                                                 HEALTH_STORE_HEADER_SIZE, &readCount) ||
+            readCount != HEALTH_STORE_HEADER_SIZE ||
+            memcmp(header, HEALTH_STORE_SIGNATURE, HEALTH_STORE_SIGNATURE_LENGTH) != 0 ||
+            M_BytesTo2ByteValue(header[9], header[8]) != HEALTH_STORE_VERSION ||
+            strncmp(C_CAST(const char*, &header[HEALTH_STORE_SERIAL_OFFSET]), device->drive_info.serialNumber,
+                    HEALTH_STORE_SERIAL_LENGTH) != 0)
+        {
+            ret = VALIDATION_FAILURE;
+        }
+        else
+        {
+            ret = load_Health_Store(
+                store, M_Max(C_CAST(uint32_t, M_BytesTo2ByteValue(header[11], header[10])), HEALTH_STORE_HEADER_SIZE));
+        }
+    }
+    else if (store->file != M_NULLPTR && store->file->error == SEC_FILE_INSECURE_PATH)
+    {
+        ret = INSECURE_PATH;
+    }
+    else
+    {
+        free_Secure_File_Info(&store->file);
+        store->file = secure_Open_File(fileName, "w+b", M_NULLPTR, M_NULLPTR, M_NULLPTR);
+        if (store->file == M_NULLPTR || store->file->error != SEC_FILE_SUCCESS)
+        {
+            ret = (store->file != M_NULLPTR && store->file->error == SEC_FILE_INSECURE_PATH) ? INSECURE_PATH
+                                                                                              : FILE_OPEN_ERROR;
+        }
+        else
+        {
+            safe_memcpy(header, HEALTH_STORE_HEADER_SIZE, HEALTH_STORE_SIGNATURE, HEALTH_STORE_SIGNATURE_LENGTH);
+            set_Health_Store_Little_Endian_Value(&header[8], UINT8_C(2), HEALTH_STORE_VERSION);
+            set_Health_Store_Little_Endian_Value(&header[10], UINT8_C(2), HEALTH_STORE_HEADER_SIZE);
+            safe_memcpy(&header[HEALTH_STORE_SERIAL_OFFSET], HEALTH_STORE_SERIAL_LENGTH,
+                        device->drive_info.serialNumber,
+                        M_Min(serialLen, C_CAST(size_t, HEALTH_STORE_SERIAL_LENGTH)));
+            safe_memcpy(&header[HEALTH_STORE_MODEL_OFFSET], HEALTH_STORE_MODEL_LENGTH,
+                        device->drive_info.product_identification,
+                        M_Min(safe_strlen(device->drive_info.product_identification),
+                              C_CAST(size_t, HEALTH_STORE_MODEL_LENGTH)));
+            safe_memcpy(&header[HEALTH_STORE_FIRMWARE_OFFSET], HEALTH_STORE_FIRMWARE_LENGTH,
+                        device->drive_info.product_revision,
+                        M_Min(safe_strlen(device->drive_info.product_revision),
+                              C_CAST(size_t, HEALTH_STORE_FIRMWARE_LENGTH)));
+            set_Health_Store_Little_Endian_Value(&header[HEALTH_STORE_WWN_OFFSET], UINT8_C(8),
+                                                 device->drive_info.worldWideName);
+            set_Health_Store_Little_Endian_Value(&header[HEALTH_STORE_CREATED_OFFSET], UINT8_C(8),
+                                                 C_CAST(uint64_t, time(M_NULLPTR)));
+            if (SEC_FILE_SUCCESS != secure_Write_File(store->file, header, HEALTH_STORE_HEADER_SIZE, sizeof(uint8_t),
+                                                      HEALTH_STORE_HEADER_SIZE, M_NULLPTR) ||
+                SEC_FILE_SUCCESS != secure_Flush_File(store->file))
+            {
+                ret = ERROR_WRITING_FILE;
+            }
+            store->endOffset = HEALTH_STORE_HEADER_SIZE;
+        }
+    }
+    if (ret != SUCCESS)
+    {
+        close_Health_Store(store);
+    }
+    return ret;
+}
+
+eReturnValues append_Health_Store_Sample(healthStore* store, const healthSample* sample)
+{
+    eReturnValues ret           = SUCCESS;
+    bool          sameColumns   = false;
+    size_t        payloadLength = SIZE_T_C(0);
+    if (store == M_NULLPTR || store->file == M_NULLPTR || sample == M_NULLPTR ||
+        sample->count > HEALTH_STORE_MAX_COLUMNS)
+    {
+        return BAD_PARAMETER;
+    }
+    sameColumns = store->encoded != M_NULLPTR && store->columnCount == sample->count;
+    for (uint32_t columnIter = UINT32_C(0); columnIter < sample->count && sameColumns; ++columnIter)
+    {
+        sameColumns = is_Same_Health_Metric(&store->columns[columnIter], &sample->metrics[columnIter]);
+    }
+    if (!sameColumns)
+    {
+        uint8_t* payload = C_CAST(
+            uint8_t*, safe_calloc(M_Max(sample->count, UINT32_C(1)) * HEALTH_STORE_COLUMN_SIZE, sizeof(uint8_t)));
+        if (payload == M_NULLPTR)
+        {
+            return MEMORY_FAILURE;
+        }
+        for (uint32_t columnIter = UINT32_C(0); columnIter < sample->count; ++columnIter)
+        {
+            uint8_t* column = &payload[columnIter * HEALTH_STORE_COLUMN_SIZE];
+            column[0]       = C_CAST(uint8_t, sample->metrics[columnIter].source);
+            column[1]       = C_CAST(uint8_t, sample->metrics[columnIter].type);
+            set_Health_Store_Little_Endian_Value(&column[2], UINT8_C(2), sample->metrics[columnIter].page);
+            set_Health_Store_Little_Endian_Value(&column[4], UINT8_C(2), sample->metrics[columnIter].index);
+        }
+        ret = set_Health_Store_Columns(store, sample->metrics, sample->count);
+        if (ret == SUCCESS)
+        {
+            ret = write_Health_Store_Record(store, HEALTH_STORE_RECORD_COLUMNS, C_CAST(uint16_t, sample->count),
+                                            payload, sample->count * HEALTH_STORE_COLUMN_SIZE);
+            if (ret != SUCCESS)
+            {
+                // the columns are written again with the next sample
+                safe_free(&store->encoded);
+            }
+        }
+        safe_free(&payload);
+        if (ret != SUCCESS)
+        {
+            return ret;
+        }
+    }
+    payloadLength =
+        put_Health_Store_Varint(store->encoded, get_Health_Store_Delta(store->lastValues[0], sample->timestamp));
+    for (uint32_t columnIter = UINT32_C(0); columnIter < store->columnCount; ++columnIter)
+    {
+        payloadLength += put_Health_Store_Varint(
+            &store->encoded[payloadLength],
+            get_Health_Store_Delta(store->lastValues[columnIter + 1], sample->metrics[columnIter].value));
+    }
+    ret = write_Health_Store_Record(store, HEALTH_STORE_RECORD_SAMPLES, UINT16_C(1), store->encoded,
+                                    C_CAST(uint32_t, payloadLength));
+    if (ret == SUCCESS)
+    {
+        // only move the base of the differences once the record is in the file
+        store->lastValues[0] = sample->timestamp;
+        for (uint32_t columnIter = UINT32_C(0); columnIter < store->columnCount; ++columnIter)
+        {
+            store->lastValues[columnIter + 1] = sample->metrics[columnIter].value;
+        }
+    }
+    return ret;
+}
+
+void close_Health_Store(healthStore* store)
+{
+    if (store != M_NULLPTR)
+    {
+        if (store->file != M_NULLPTR)
+        {
+            if (store->file->error == SEC_FILE_SUCCESS)
+            {
+                secure_Close_File(store->file);
+            }
+            free_Secure_File_Info(&store->file);
+        }
+        safe_free(&store->columns);
+        safe_free(&store->lastValues);
+        safe_free(&store->encoded);
+        safe_memset(store, sizeof(healthStore), 0, sizeof(healthStore));
+    }
+}
+
+eReturnValues save_Health_Store_Sample(tDevice* device, const char* directory)
+{
+    healthSample  sample;
+    healthStore   store;
+    eReturnValues ret = SUCCESS;
+    safe_memset(&sample, sizeof(healthSample), 0, sizeof(healthSample));
+    ret = read_Health_Sample(device, &sample);
+    if (ret == SUCCESS)
+    {
+        ret = open_Health_Store(device, directory, &store);
+        if (ret == SUCCESS)
+        {
+            ret = append_Health_Store_Sample(&store, &sample);
+            close_Health_Store(&store);
+        }
+    }
+    free_Health_Sample(&sample);
+    return ret;
+}
+
+static healthSeries* get_Health_Store_Series(healthStoreContents* contents, const healthMetric* column, uint32_t hint)
+{
+    if (hint < contents->seriesCount && is_Same_Health_Metric(&contents->series[hint].metric, column))
+    {
+        return &contents->series[hint];
+    }
+    for (uint32_t seriesIter = UINT32_C(0); seriesIter < contents->seriesCount; ++seriesIter)
+    {
+        if (is_Same_Health_Metric(&contents->series[seriesIter].metric, column))
+        {
+            return &contents->series[seriesIter];
+        }
+    }
+    if (contents->seriesCount == contents->seriesCapacity)
+    {
+        uint32_t newCapacity =
+            contents->seriesCapacity == UINT32_C(0) ? UINT32_C(64) : contents->seriesCapacity * UINT32_C(2);
+        healthSeries* newSeries = C_CAST(
+            healthSeries*, safe_realloc(contents->series, C_CAST(size_t, newCapacity) * sizeof(healthSeries)));
+        if (newSeries == M_NULLPTR)
+        {
+            return M_NULLPTR;
+        }
+        contents->series         = newSeries;
+        contents->seriesCapacity = newCapacity;
+    }
+    safe_memset(&contents->series[contents->seriesCount], sizeof(healthSeries), 0, sizeof(healthSeries));
+    contents->series[contents->seriesCount].metric = *column;
+    return &contents->series[contents->seriesCount++];
+}
+
+static eReturnValues add_Health_Store_Series_Values(healthSeries*   series,
+                                                    const uint64_t* times,
+                                                    const uint64_t* values,
+                                                    uint32_t        count)
+{
+    if (series->count + count > series->capacity)
+    {
+        uint32_t  newCapacity = M_Max(series->capacity * UINT32_C(2), series->count + count);
+        uint64_t* newTimes =
+            C_CAST(uint64_t*, safe_realloc(series->times, C_CAST(size_t, newCapacity) * sizeof(uint64_t)));
+        uint64_t* newValues = M_NULLPTR;
+        if (newTimes == M_NULLPTR)
+        {
+            return MEMORY_FAILURE;
+        }
+        series->times = newTimes;
+        newValues     = C_CAST(uint64_t*, safe_realloc(series->values, C_CAST(size_t, newCapacity) * sizeof(uint64_t)));
+        if (newValues == M_NULLPTR)
+        {
+            return MEMORY_FAILURE;
+        }
+        series->values   = newValues;
+        series->capacity = newCapacity;
+    }
+    for (uint32_t iter = UINT32_C(0); iter < count; ++iter)
+    {
+        series->times[series->count]  = times[iter];
+        series->values[series->count] = values[iter];
+        ++series->count;
+    }
+    series->metric.value = values[count - 1];
+    return SUCCESS;
+}
+
+static void get_Health_Store_String(const uint8_t* data, uint32_t length, char* string, size_t stringSize)
+{
+    safe_memset(string, stringSize, 0, stringSize);
+    for (uint32_t iter = UINT32_C(0); iter < length && iter < stringSize - 1 && data[iter] != 0; ++iter)
+    {
+        string[iter] = safe_isprint(C_CAST(char, data[iter])) ? C_CAST(char, data[iter]) : '?';
+    }
+}
+
+eReturnValues read_Health_Store(const char* fileName, healthStoreContents* contents)
+{
+    eReturnValues   ret           = SUCCESS;
+    secureFileInfo* file          = M_NULLPTR;
+    healthMetric*   columns       = M_NULLPTR;
+    uint32_t        columnCount   = UINT32_C(0);
+    uint8_t*        payload       = M_NULLPTR;
+    uint64_t*       values        = M_NULLPTR; // timestamp then the value of each column of the last sample
+    uint64_t        offset        = HEALTH_STORE_HEADER_SIZE;
+    uint8_t         type          = UINT8_C(0);
+    uint16_t        count         = UINT16_C(0);
+    uint32_t        payloadLength = UINT32_C(0);
+    size_t          readCount     = SIZE_T_C(0);
+    DECLARE_ZERO_INIT_ARRAY(uint8_t, header, HEALTH_STORE_HEADER_SIZE);
+    if (fileName == M_NULLPTR || contents == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    safe_memset(contents, sizeof(healthStoreContents), 0, sizeof(healthStoreContents));
+    file = secure_Open_File(fileName, "rb", M_NULLPTR, M_NULLPTR, M_NULLPTR);
+    if (file == M_NULLPTR || file->error != SEC_FILE_SUCCESS)
+    {
+        ret = (file != M_NULLPTR && file->error == SEC_FILE_INSECURE_PATH) ? INSECURE_PATH : FILE_OPEN_ERROR;
+        free_Secure_File_Info(&file);
+        return ret;
+    }
+    if (file->fileSize < HEALTH_STORE_HEADER_SIZE ||
+        SEC_FILE_SUCCESS !=
+            secure_Read_File(file, header, HEALTH_STORE_HEADER_SIZE, sizeof(uint8_t), HEALTH_STORE_HEADER_SIZE,
+                             &readCount) ||
+        readCount != HEALTH_STORE_HEADER_SIZE ||
+        memcmp(header, HEALTH_STORE_SIGNATURE, HEALTH_STORE_SIGNATURE_LENGTH) != 0 ||
+        M_BytesTo2ByteValue(header[9], header[8]) != HEALTH_STORE_VERSION)
+    {
+        ret = VALIDATION_FAILURE;
+    }
+    else
+    {
+        get_Health_Store_String(&header[HEALTH_STORE_SERIAL_OFFSET], HEALTH_STORE_SERIAL_LENGTH,
+                                contents->serialNumber, sizeof(contents->serialNumber));
+        get_Health_Store_String(&header[HEALTH_STORE_MODEL_OFFSET], HEALTH_STORE_MODEL_LENGTH,
+                                contents->modelNumber, sizeof(contents->modelNumber));
+        get_Health_Store_String(&header[HEALTH_STORE_FIRMWARE_OFFSET], HEALTH_STORE_FIRMWARE_LENGTH,
+                                contents->firmwareRevision, sizeof(contents->firmwareRevision));
+        contents->worldWideName = get_Health_Little_Endian_Value(&header[HEALTH_STORE_WWN_OFFSET], UINT8_C(8));
+        contents->created       = get_Health_Little_Endian_Value(&header[HEALTH_STORE_CREATED_OFFSET], UINT8_C(8));
+        // the header size field allows fields to be added to the header later
+        offset = M_Max(C_CAST(uint32_t, M_BytesTo2ByteValue(header[11], header[10])), HEALTH_STORE_HEADER_SIZE);
+    }
+    while (ret == SUCCESS)
+    {
+        eReturnValues recordRet = read_Health_Store_Record(file, offset, &type, &count, &payload, &payloadLength);
+        uint32_t      payloadOffset = UINT32_C(0);
+        if (recordRet != SUCCESS)
+        {
+            // records from one cut short or failing its CRC onward are ignored
+            ret = recordRet == MEMORY_FAILURE ? MEMORY_FAILURE : SUCCESS;
+            break;
+        }
+        if (type == HEALTH_STORE_RECORD_COLUMNS)
+        {
+            healthMetric* newColumns  = M_NULLPTR;
+            size_t        columnsSize = C_CAST(size_t, M_Max(count, UINT16_C(1))) * sizeof(healthMetric);
+            if (payloadLength != C_CAST(uint32_t, count) * HEALTH_STORE_COLUMN_SIZE)
+            {
+                ret = VALIDATION_FAILURE;
+                break;
+            }
+            newColumns = C_CAST(healthMetric*, safe_realloc(columns, columnsSize));
+            if (newColumns == M_NULLPTR)
+            {
+                ret = MEMORY_FAILURE;
+                break;
+            }
+            columns     = newColumns;
+            columnCount = count;
+            for (uint16_t columnIter = UINT16_C(0); columnIter < count; ++columnIter)
+            {
+                get_Health_Store_Column(&payload[columnIter * HEALTH_STORE_COLUMN_SIZE], &columns[columnIter]);
+            }
+            // the differences start over from 0 after a columns record
+            safe_free(&values);
+            values = C_CAST(uint64_t*, safe_calloc(C_CAST(size_t, columnCount) + SIZE_T_C(1), sizeof(uint64_t)));
+            if (values == M_NULLPTR)
+            {
+                ret = MEMORY_FAILURE;
+                break;
+            }
+        }
+        else if (type == HEALTH_STORE_RECORD_SAMPLES)
+        {
+            if (values == M_NULLPTR)
+            {
+                ret = VALIDATION_FAILURE;
+                break;
+            }
+            for (uint16_t sampleIter = UINT16_C(0); sampleIter < count && ret == SUCCESS; ++sampleIter)
+            {
+                if (!decode_Health_Store_Sample(payload, payloadLength, &payloadOffset, values,
+                                                columnCount + UINT32_C(1)))
+                {
+                    ret = VALIDATION_FAILURE;
+                    break;
+                }
+                for (uint32_t columnIter = UINT32_C(0); columnIter < columnCount && ret == SUCCESS; ++columnIter)
+                {
+                    healthSeries* series = get_Health_Store_Series(contents, &columns[columnIter], columnIter);
+                    if (series == M_NULLPTR)
+                    {
+                        ret = MEMORY_FAILURE;
+                    }
+                    else
+                    {
+                        ret = add_Health_Store_Series_Values(series, &values[0], &values[columnIter + 1], UINT32_C(1));
+                    }
+                }
+                ++contents->sampleCount;
+            }
+        }
+        else
+        {
+            // not a record written by this version
+            break;
+        }
+        offset += HEALTH_STORE_RECORD_HEADER_SIZE + payloadLength;
+    }
+    safe_free(&columns);
+    safe_free(&payload);
+    safe_free(&values);
+    secure_Close_File(file);
+    free_Secure_File_Info(&file);
+    if (ret != SUCCESS)
+    {
+        free_Health_Store_Contents(contents);
+    }
+    return ret;
+}
+
+void free_Health_Store_Contents(healthStoreContents* contents)
+{
+    if (contents != M_NULLPTR)
+    {
+        for (uint32_t seriesIter = UINT32_C(0); seriesIter < contents->seriesCount; ++seriesIter)
+        {
+            safe_free(&contents->series[seriesIter].times);
+            safe_free(&contents->series[seriesIter].values);
+        }
+        safe_free(&contents->series);
+        contents->seriesCount    = UINT32_C(0);
+        contents->seriesCapacity = UINT32_C(0);
+    }
+}
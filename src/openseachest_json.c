@@ -0,0 +1,661 @@
+// SPDX-License-Identifier: MPL-2.0
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2014-2025 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file openseachest_json.c
+// \brief This file implements a streaming JSON writer and the JSON sections written by the tools.
+
+#include "common_types.h"
+#include "io_utils.h"
+#include "memory_safety.h"
+#include "string_utils.h"
+#include "time_utils.h"
+#include "type_conversion.h"
+
+#include "openseachest_json.h"
+#include "openseachest_util_options.h"
+
+#include "ata_helper_func.h"
+#include "dst.h"
+#include "logs.h"
+#include "nvme_helper_func.h"
+#include "power_control.h"
+#include "scsi_helper_func.h"
+
+#define JSON_STREAM_BUFFER_SIZE   SIZE_T_C(65536)
+#define JSON_VALUE_LENGTH         SIZE_T_C(32)
+#define JSON_DOUBLE_LENGTH        SIZE_T_C(40)
+#define JSON_LOG_BUFFER_SIZE      UINT32_C(1024)
+#define JSON_LOG_BLOCK_SIZE       UINT32_C(512)
+#define JSON_ATA_LOG_DIRECTORY    UINT8_C(0x00)
+#define JSON_ATA_POWER_CONDITIONS UINT8_C(0x08)
+#define JSON_NVME_SUPPORTED_LOGS  UINT8_C(0x00)
+#define JSON_SCSI_ALL_SUBPAGES    UINT8_C(0xFF)
+
+eReturnValues open_JSON_Stream(jsonStream* json, secureFileInfo* file)
+{
+    if (json == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    safe_memset(json, sizeof(jsonStream), 0, sizeof(jsonStream));
+    json->file   = file;
+    json->buffer = C_CAST(char*, safe_calloc(JSON_STREAM_BUFFER_SIZE + 1, sizeof(char)));
+    if (json->buffer == M_NULLPTR)
+    {
+        json->ret = MEMORY_FAILURE;
+    }
+    return json->ret;
+}
+
+static void flush_JSON_Stream(jsonStream* json)
+{
+    if (json->used > SIZE_T_C(0) && json->buffer != M_NULLPTR)
+    {
+        if (json->file != M_NULLPTR)
+        {
+            if (json->ret == SUCCESS && SEC_FILE_SUCCESS != secure_Write_File(json->file, json->buffer,
+                                                                              JSON_STREAM_BUFFER_SIZE, sizeof(char),
+                                                                              json->used, M_NULLPTR))
+            {
+                json->ret = ERROR_WRITING_FILE;
+            }
+        }
+        else if (json->ret == SUCCESS &&
+                 fwrite(json->buffer, sizeof(char), json->used, get_Data_Output_Stream()) != json->used)
+        {
+            json->ret = ERROR_WRITING_FILE;
+        }
+    }
+    json->used = SIZE_T_C(0);
+}
+
+static void write_JSON_Raw(jsonStream* json, const char* text, size_t length)
+{
+    if (json->buffer == M_NULLPTR)
+    {
+        return;
+    }
+    if (json->used + length > JSON_STREAM_BUFFER_SIZE)
+    {
+        flush_JSON_Stream(json);
+    }
+    // text is never longer than the buffer: strings are written a character at a time
+    safe_memcpy(&json->buffer[json->used], JSON_STREAM_BUFFER_SIZE - json->used, text, length);
+    json->used += length;
+}
+
+static void write_JSON_Escaped(jsonStream* json, const char* value)
+{
+    write_JSON_Raw(json, "\"", SIZE_T_C(1));
+    for (size_t iter = SIZE_T_C(0); value != M_NULLPTR && value[iter] != '\0'; ++iter)
+    {
+        uint8_t character = C_CAST(uint8_t, value[iter]);
+        if (character == '"' || character == '\\')
+        {
+            char escaped[2] = {'\\', C_CAST(char, character)};
+            write_JSON_Raw(json, escaped, SIZE_T_C(2));
+        }
+        else if (character < UINT8_C(0x20) || character > UINT8_C(0x7E))
+        {
+            DECLARE_ZERO_INIT_ARRAY(char, escaped, 8);
+            snprintf_err_handle(escaped, 8, "\\u%04" PRIX8, character);
+            write_JSON_Raw(json, escaped, safe_strlen(escaped));
+        }
+        else
+        {
+            char plain = C_CAST(char, character);
+            write_JSON_Raw(json, &plain, SIZE_T_C(1));
+        }
+    }
+    write_JSON_Raw(json, "\"", SIZE_T_C(1));
+}
+
+// Writes the separator and, in an object, the key of the next value
+static void write_JSON_Key(jsonStream* json, const char* key)
+{
+    if (json->needComma[json->depth])
+    {
+        write_JSON_Raw(json, ",", SIZE_T_C(1));
+    }
+    json->needComma[json->depth] = true;
+    if (json->depth > UINT8_C(0) && !json->inArray[json->depth])
+    {
+        write_JSON_Escaped(json, key != M_NULLPTR ? key : "");
+        write_JSON_Raw(json, ":", SIZE_T_C(1));
+    }
+}
+
+static void begin_JSON_Container(jsonStream* json, const char* key, bool array)
+{
+    write_JSON_Key(json, key);
+    write_JSON_Raw(json, array ? "[" : "{", SIZE_T_C(1));
+    if (json->depth + 1 < JSON_STREAM_MAX_DEPTH)
+    {
+        ++json->depth;
+        json->needComma[json->depth] = false;
+        json->inArray[json->depth]   = array;
+    }
+    else
+    {
+        json->ret = BAD_PARAMETER;
+    }
+}
+
+static void end_JSON_Container(jsonStream* json, bool array)
+{
+    write_JSON_Raw(json, array ? "]" : "}", SIZE_T_C(1));
+    if (json->depth > UINT8_C(0))
+    {
+        --json->depth;
+    }
+    if (json->depth == UINT8_C(0))
+    {
+        // one document per line
+        write_JSON_Raw(json, "\n", SIZE_T_C(1));
+        json->needComma[0] = false;
+    }
+}
+
+void begin_JSON_Object(jsonStream* json, const char* key)
+{
+    begin_JSON_Container(json, key, false);
+}
+
+void end_JSON_Object(jsonStream* json)
+{
+    end_JSON_Container(json, false);
+}
+
+void begin_JSON_Array(jsonStream* json, const char* key)
+{
+    begin_JSON_Container(json, key, true);
+}
+
+void end_JSON_Array(jsonStream* json)
+{
+    end_JSON_Container(json, true);
+}
+
+void write_JSON_String(jsonStream* json, const char* key, const char* value)
+{
+    write_JSON_Key(json, key);
+    write_JSON_Escaped(json, value);
+}
+
+void write_JSON_Unsigned(jsonStream* json, const char* key, uint64_t value)
+{
+    DECLARE_ZERO_INIT_ARRAY(char, number, JSON_VALUE_LENGTH);
+    write_JSON_Key(json, key);
+    snprintf_err_handle(number, JSON_VALUE_LENGTH, "%" PRIu64, value);
+    write_JSON_Raw(json, number, safe_strlen(number));
+}
+
+void write_JSON_Signed(jsonStream* json, const char* key, int64_t value)
+{
+    DECLARE_ZERO_INIT_ARRAY(char, number, JSON_VALUE_LENGTH);
+    write_JSON_Key(json, key);
+    snprintf_err_handle(number, JSON_VALUE_LENGTH, "%" PRId64, value);
+    write_JSON_Raw(json, number, safe_strlen(number));
+}
+
+// Infinity and NaN have no JSON representation and are written as null
+void write_JSON_Double(jsonStream* json, const char* key, double value)
+{
+    DECLARE_ZERO_INIT_ARRAY(char, number, JSON_DOUBLE_LENGTH);
+    write_JSON_Key(json, key);
+    // NaN is not equal to itself and infinity minus itself is NaN
+    if (value == value && value - value == 0.0)
+    {
+        if (value >= 1.0e18 || value <= -1.0e18)
+        {
+            snprintf_err_handle(number, JSON_DOUBLE_LENGTH, "%0.6e", value);
+        }
+        else
+        {
+            snprintf_err_handle(number, JSON_DOUBLE_LENGTH, "%0.6f", value);
+        }
+        write_JSON_Raw(json, number, safe_strlen(number));
+    }
+    else
+    {
+        write_JSON_Raw(json, "null", SIZE_T_C(4));
+    }
+}
+
+void write_JSON_Bool(jsonStream* json, const char* key, bool value)
+{
+    write_JSON_Key(json, key);
+    write_JSON_Raw(json, value ? "true" : "false", value ? SIZE_T_C(4) : SIZE_T_C(5));
+}
+
+void write_JSON_Null(jsonStream* json, const char* key)
+{
+    write_JSON_Key(json, key);
+    write_JSON_Raw(json, "null", SIZE_T_C(4));
+}
+
+eReturnValues close_JSON_Stream(jsonStream* json)
+{
+    eReturnValues ret = BAD_PARAMETER;
+    if (json != M_NULLPTR)
+    {
+        flush_JSON_Stream(json);
+        if (json->file == M_NULLPTR)
+        {
+            fflush(get_Data_Output_Stream());
+        }
+        safe_free(&json->buffer);
+        ret = json->ret;
+    }
+    return ret;
+}
+
+void write_JSON_Status(jsonStream* json, eReturnValues status)
+{
+    switch (status)
+    {
+    case SUCCESS:
+        write_JSON_String(json, "status", "success");
+        break;
+    case NOT_SUPPORTED:
+        write_JSON_String(json, "status", "not supported");
+        break;
+    default:
+        write_JSON_String(json, "status", "failed");
+        break;
+    }
+}
+
+void write_JSON_Drive_Identity(jsonStream* json, const char* key, tDevice* device)
+{
+    DECLARE_ZERO_INIT_ARRAY(char, worldWideName, JSON_VALUE_LENGTH);
+    const char* driveType     = "other";
+    const char* interfaceType = "other";
+    switch (device->drive_info.drive_type)
+    {
+    case ATA_DRIVE:
+        driveType = "ATA";
+        break;
+    case SCSI_DRIVE:
+        driveType = "SCSI";
+        break;
+    case NVME_DRIVE:
+        driveType = "NVMe";
+        break;
+    default:
+        break;
+    }
+    switch (device->drive_info.interface_type)
+    {
+    case IDE_INTERFACE:
+        interfaceType = "ATA";
+        break;
+    case SCSI_INTERFACE:
+        interfaceType = "SCSI";
+        break;
+    case USB_INTERFACE:
+        interfaceType = "USB";
+        break;
+    case NVME_INTERFACE:
+        interfaceType = "NVMe";
+        break;
+    default:
+        break;
+    }
+    begin_JSON_Object(json, key);
+    write_JSON_String(json, "handle", device->os_info.name);
+    write_JSON_String(json, "vendor", device->drive_info.T10_vendor_ident);
+    write_JSON_String(json, "model", device->drive_info.product_identification);
+    write_JSON_String(json, "serialNumber", device->drive_info.serialNumber);
+    write_JSON_String(json, "firmwareRevision", device->drive_info.product_revision);
+    if (device->drive_info.worldWideName != UINT64_C(0))
+    {
+        snprintf_err_handle(worldWideName, JSON_VALUE_LENGTH, "%016" PRIX64, device->drive_info.worldWideName);
+        write_JSON_String(json, "worldWideName", worldWideName);
+    }
+    else
+    {
+        write_JSON_Null(json, "worldWideName");
+    }
+    write_JSON_String(json, "driveType", driveType);
+    write_JSON_String(json, "interfaceType", interfaceType);
+    write_JSON_Unsigned(json, "maxLBA", device->drive_info.deviceMaxLba);
+    write_JSON_Unsigned(json, "logicalBlockSize", device->drive_info.deviceBlockSize);
+    write_JSON_Unsigned(json, "physicalBlockSize", device->drive_info.devicePhyBlockSize);
+    write_JSON_Unsigned(json, "capacityBytes",
+                        (device->drive_info.deviceMaxLba + UINT64_C(1)) * device->drive_info.deviceBlockSize);
+    end_JSON_Object(json);
+}
+
+const char* get_JSON_Metric_Type(const healthMetric* metric)
+{
+    return metric->type == HEALTH_METRIC_COUNTER ? "counter" : "gauge";
+}
+
+static bool has_Health_Source(const healthSample* sample, eHealthMetricSource source)
+{
+    for (uint32_t metricIter = UINT32_C(0); metricIter < sample->count; ++metricIter)
+    {
+        if (sample->metrics[metricIter].source == source)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+eReturnValues write_JSON_Health_Sample(jsonStream*   json,
+                                       const char*   key,
+                                       tDevice*      device,
+                                       healthSample* sample,
+                                       uint32_t      sourceMask)
+{
+    eReturnValues ret = SUCCESS;
+    // several sections of the same device share one read
+    if (sample->count == UINT32_C(0))
+    {
+        ret = read_Health_Sample(device, sample);
+    }
+    begin_JSON_Object(json, key);
+    if (ret == SUCCESS)
+    {
+        bool anySource = false;
+        for (uint32_t source = HEALTH_METRIC_ATA_SMART_RAW; source <= HEALTH_METRIC_SCSI_LOG_PARAMETER; ++source)
+        {
+            if ((sourceMask & HEALTH_METRIC_SOURCE_BIT(source)) &&
+                has_Health_Source(sample, C_CAST(eHealthMetricSource, source)))
+            {
+                anySource = true;
+            }
+        }
+        if (!anySource)
+        {
+            ret = NOT_SUPPORTED;
+        }
+    }
+    write_JSON_Status(json, ret);
+    if (ret == SUCCESS)
+    {
+        write_JSON_Unsigned(json, "timestamp", sample->timestamp);
+    }
+    if (ret == SUCCESS && (sourceMask & (HEALTH_METRIC_SOURCE_BIT(HEALTH_METRIC_ATA_SMART_RAW) |
+                                         HEALTH_METRIC_SOURCE_BIT(HEALTH_METRIC_ATA_SMART_NORMALIZED))) &&
+        has_Health_Source(sample, HEALTH_METRIC_ATA_SMART_RAW))
+    {
+        begin_JSON_Array(json, "smartAttributes");
+        for (uint32_t metricIter = UINT32_C(0); metricIter < sample->count; ++metricIter)
+        {
+            const healthMetric* raw        = &sample->metrics[metricIter];
+            const healthMetric* normalized = M_NULLPTR;
+            healthMetric        lookup;
+            if (raw->source != HEALTH_METRIC_ATA_SMART_RAW)
+            {
+                continue;
+            }
+            lookup        = *raw;
+            lookup.source = HEALTH_METRIC_ATA_SMART_NORMALIZED;
+            // the normalized value is added right after the raw value
+            normalized = find_Health_Metric(sample, &lookup, metricIter + UINT32_C(1));
+            begin_JSON_Object(json, M_NULLPTR);
+            write_JSON_Unsigned(json, "id", raw->index);
+            write_JSON_String(json, "type", get_JSON_Metric_Type(raw));
+            write_JSON_Unsigned(json, "raw", raw->value);
+            if (normalized != M_NULLPTR)
+            {
+                write_JSON_Unsigned(json, "normalized", normalized->value);
+            }
+            end_JSON_Object(json);
+        }
+        end_JSON_Array(json);
+    }
+    if (ret == SUCCESS && (sourceMask & HEALTH_METRIC_SOURCE_BIT(HEALTH_METRIC_ATA_DEVICE_STATISTIC)) &&
+        has_Health_Source(sample, HEALTH_METRIC_ATA_DEVICE_STATISTIC))
+    {
+        begin_JSON_Array(json, "deviceStatistics");
+        for (uint32_t metricIter = UINT32_C(0); metricIter < sample->count; ++metricIter)
+        {
+            const healthMetric* metric = &sample->metrics[metricIter];
+            if (metric->source == HEALTH_METRIC_ATA_DEVICE_STATISTIC)
+            {
+                begin_JSON_Object(json, M_NULLPTR);
+                write_JSON_Unsigned(json, "page", metric->page);
+                write_JSON_Unsigned(json, "offset", metric->index);
+                write_JSON_String(json, "type", get_JSON_Metric_Type(metric));
+                write_JSON_Unsigned(json, "value", metric->value);
+                end_JSON_Object(json);
+            }
+        }
+        end_JSON_Array(json);
+    }
+    if (ret == SUCCESS && (sourceMask & HEALTH_METRIC_SOURCE_BIT(HEALTH_METRIC_NVME_HEALTH)) &&
+        has_Health_Source(sample, HEALTH_METRIC_NVME_HEALTH))
+    {
+        begin_JSON_Object(json, "nvmeHealth");
+        for (uint32_t metricIter = UINT32_C(0); metricIter < sample->count; ++metricIter)
+        {
+            const healthMetric* metric = &sample->metrics[metricIter];
+            if (metric->source == HEALTH_METRIC_NVME_HEALTH)
+            {
+                write_JSON_Unsigned(json, get_Health_Metric_Name(metric), metric->value);
+            }
+        }
+        end_JSON_Object(json);
+    }
+    if (ret == SUCCESS && (sourceMask & HEALTH_METRIC_SOURCE_BIT(HEALTH_METRIC_SCSI_LOG_PARAMETER)) &&
+        has_Health_Source(sample, HEALTH_METRIC_SCSI_LOG_PARAMETER))
+    {
+        begin_JSON_Array(json, "logParameters");
+        for (uint32_t metricIter = UINT32_C(0); metricIter < sample->count; ++metricIter)
+        {
+            const healthMetric* metric = &sample->metrics[metricIter];
+            if (metric->source == HEALTH_METRIC_SCSI_LOG_PARAMETER)
+            {
+                begin_JSON_Object(json, M_NULLPTR);
+                write_JSON_Unsigned(json, "page", metric->page);
+                write_JSON_Unsigned(json, "parameter", metric->index);
+                write_JSON_String(json, "type", get_JSON_Metric_Type(metric));
+                write_JSON_Unsigned(json, "value", metric->value);
+                end_JSON_Object(json);
+            }
+        }
+        end_JSON_Array(json);
+    }
+    end_JSON_Object(json);
+    return ret;
+}
+
+eReturnValues write_JSON_DST_Log(jsonStream* json, const char* key, tDevice* device)
+{
+    dstLogEntries dstEntries;
+    eReturnValues ret = UNKNOWN;
+    safe_memset(&dstEntries, sizeof(dstLogEntries), 0, sizeof(dstLogEntries));
+    ret = get_DST_Log_Entries(device, &dstEntries);
+    begin_JSON_Object(json, key);
+    write_JSON_Status(json, ret);
+    if (ret == SUCCESS)
+    {
+        begin_JSON_Array(json, "entries");
+        for (uint8_t entryIter = UINT8_C(0); entryIter < dstEntries.numberOfEntries; ++entryIter)
+        {
+            if (!dstEntries.dstEntry[entryIter].descriptorValid)
+            {
+                continue;
+            }
+            begin_JSON_Object(json, M_NULLPTR);
+            write_JSON_Unsigned(json, "selfTestRun", dstEntries.dstEntry[entryIter].selfTestRun);
+            write_JSON_Unsigned(json, "executionStatus", dstEntries.dstEntry[entryIter].selfTestExecutionStatus);
+            write_JSON_Unsigned(json, "powerOnHours", dstEntries.dstEntry[entryIter].lifetimeTimestamp);
+            write_JSON_Unsigned(json, "lbaOfFailure", dstEntries.dstEntry[entryIter].lbaOfFailure);
+            end_JSON_Object(json);
+        }
+        end_JSON_Array(json);
+    }
+    end_JSON_Object(json);
+    return ret;
+}
+
+// Idle_a, Idle_b and Idle_c are on the first page of the power conditions log, Standby_y and Standby_z at the end of
+// the second page. Timers are in 100 millisecond units.
+static const struct
+{
+    const char* name;
+    uint32_t    offset;
+} jsonEPCConditions[] = {
+    {"idle_a", UINT32_C(0)},      {"idle_b", UINT32_C(64)},     {"idle_c", UINT32_C(128)},
+    {"standby_y", UINT32_C(896)}, {"standby_z", UINT32_C(960)},
+};
+
+eReturnValues write_JSON_EPC_Settings(jsonStream* json, const char* key, tDevice* device)
+{
+    eReturnValues ret    = NOT_SUPPORTED;
+    uint8_t*      buffer = M_NULLPTR;
+    if (device->drive_info.drive_type == ATA_DRIVE)
+    {
+        buffer = C_CAST(uint8_t*,
+                        safe_calloc_aligned(JSON_LOG_BUFFER_SIZE, sizeof(uint8_t), device->os_info.minimumAlignment));
+        if (buffer == M_NULLPTR)
+        {
+            ret = MEMORY_FAILURE;
+        }
+        else if (SUCCESS != send_ATA_Read_Log_Ext_Cmd(device, JSON_ATA_POWER_CONDITIONS, UINT16_C(0), buffer,
+                                                      JSON_LOG_BUFFER_SIZE, UINT16_C(0)))
+        {
+            // the log is only there when the EPC feature is supported
+            ret = NOT_SUPPORTED;
+        }
+        else
+        {
+            ret = SUCCESS;
+        }
+    }
+    begin_JSON_Object(json, key);
+    write_JSON_Status(json, ret);
+    if (ret == SUCCESS)
+    {
+        begin_JSON_Array(json, "powerConditions");
+        for (size_t conditionIter = SIZE_T_C(0);
+             conditionIter < sizeof(jsonEPCConditions) / sizeof(jsonEPCConditions[0]); ++conditionIter)
+        {
+            const uint8_t* descriptor = &buffer[jsonEPCConditions[conditionIter].offset];
+            begin_JSON_Object(json, M_NULLPTR);
+            write_JSON_String(json, "name", jsonEPCConditions[conditionIter].name);
+            write_JSON_Bool(json, "supported", descriptor[1] & BIT7);
+            write_JSON_Bool(json, "saveable", descriptor[1] & BIT6);
+            write_JSON_Bool(json, "changeable", descriptor[1] & BIT5);
+            write_JSON_Bool(json, "defaultTimerEnabled", descriptor[1] & BIT4);
+            write_JSON_Bool(json, "savedTimerEnabled", descriptor[1] & BIT3);
+            write_JSON_Bool(json, "currentTimerEnabled", descriptor[1] & BIT2);
+            write_JSON_Unsigned(json, "defaultTimer100ms",
+                                M_BytesTo4ByteValue(descriptor[7], descriptor[6], descriptor[5], descriptor[4]));
+            write_JSON_Unsigned(json, "savedTimer100ms",
+                                M_BytesTo4ByteValue(descriptor[11], descriptor[10], descriptor[9], descriptor[8]));
+            write_JSON_Unsigned(json, "currentTimer100ms",
+                                M_BytesTo4ByteValue(descriptor[15], descriptor[14], descriptor[13], descriptor[12]));
+            write_JSON_Unsigned(json, "recoveryTime100ms",
+                                M_BytesTo4ByteValue(descriptor[19], descriptor[18], descriptor[17], descriptor[16]));
+            write_JSON_Unsigned(json, "minimumTimer100ms",
+                                M_BytesTo4ByteValue(descriptor[23], descriptor[22], descriptor[21], descriptor[20]));
+            write_JSON_Unsigned(json, "maximumTimer100ms",
+                                M_BytesTo4ByteValue(descriptor[27], descriptor[26], descriptor[25], descriptor[24]));
+            end_JSON_Object(json);
+        }
+        end_JSON_Array(json);
+    }
+    end_JSON_Object(json);
+    safe_free_aligned(&buffer);
+    return ret;
+}
+
+eReturnValues write_JSON_Supported_Logs(jsonStream* json, const char* key, tDevice* device)
+{
+    eReturnValues ret    = NOT_SUPPORTED;
+    uint8_t*      buffer = C_CAST(
+        uint8_t*, safe_calloc_aligned(JSON_LOG_BUFFER_SIZE, sizeof(uint8_t), device->os_info.minimumAlignment));
+    if (buffer == M_NULLPTR)
+    {
+        ret = MEMORY_FAILURE;
+    }
+    else if (device->drive_info.drive_type == ATA_DRIVE)
+    {
+        // general purpose logging directory: word N is the number of pages of log address N
+        ret = send_ATA_Read_Log_Ext_Cmd(device, JSON_ATA_LOG_DIRECTORY, UINT16_C(0), buffer, JSON_LOG_BLOCK_SIZE,
+                                        UINT16_C(0)) == SUCCESS
+                  ? SUCCESS
+                  : NOT_SUPPORTED;
+    }
+    else if (device->drive_info.drive_type == NVME_DRIVE)
+    {
+        nvmeGetLogPageCmdOpts cmdOpts;
+        safe_memset(&cmdOpts, sizeof(nvmeGetLogPageCmdOpts), 0, sizeof(nvmeGetLogPageCmdOpts));
+        cmdOpts.nsid    = NVME_ALL_NAMESPACES;
+        cmdOpts.lid     = JSON_NVME_SUPPORTED_LOGS;
+        cmdOpts.addr    = buffer;
+        cmdOpts.dataLen = JSON_LOG_BUFFER_SIZE;
+        ret             = nvme_Get_Log_Page(device, &cmdOpts) == SUCCESS ? SUCCESS : NOT_SUPPORTED;
+    }
+    else if (device->drive_info.drive_type == SCSI_DRIVE)
+    {
+        ret = scsi_Log_Sense_Cmd(device, false, LPC_CUMULATIVE_VALUES, UINT8_C(0), JSON_SCSI_ALL_SUBPAGES,
+                                 UINT16_C(0), buffer, C_CAST(uint16_t, JSON_LOG_BUFFER_SIZE)) == SUCCESS
+                  ? SUCCESS
+                  : NOT_SUPPORTED;
+    }
+    begin_JSON_Object(json, key);
+    write_JSON_Status(json, ret);
+    if (ret == SUCCESS)
+    {
+        begin_JSON_Array(json, "logs");
+        if (device->drive_info.drive_type == ATA_DRIVE)
+        {
+            for (uint32_t address = UINT32_C(1); address < JSON_LOG_BLOCK_SIZE / UINT32_C(2); ++address)
+            {
+                uint16_t pages = M_BytesTo2ByteValue(buffer[(address * 2) + 1], buffer[address * 2]);
+                if (pages > UINT16_C(0))
+                {
+                    begin_JSON_Object(json, M_NULLPTR);
+                    write_JSON_Unsigned(json, "address", address);
+                    write_JSON_Unsigned(json, "pages", pages);
+                    end_JSON_Object(json);
+                }
+            }
+        }
+        else if (device->drive_info.drive_type == NVME_DRIVE)
+        {
+            for (uint32_t logID = UINT32_C(0); logID < JSON_LOG_BUFFER_SIZE / UINT32_C(4); ++logID)
+            {
+                // bit 0 of each dword = log page supported
+                if (buffer[logID * 4] & BIT0)
+                {
+                    begin_JSON_Object(json, M_NULLPTR);
+                    write_JSON_Unsigned(json, "id", logID);
+                    end_JSON_Object(json);
+                }
+            }
+        }
+        else
+        {
+            // page and subpage pairs after the 4 byte header
+            uint32_t end = M_Min(UINT32_C(4) + M_BytesTo2ByteValue(buffer[2], buffer[3]), JSON_LOG_BUFFER_SIZE);
+            for (uint32_t offset = UINT32_C(4); offset + UINT32_C(1) < end; offset += UINT32_C(2))
+            {
+                begin_JSON_Object(json, M_NULLPTR);
+                write_JSON_Unsigned(json, "page", M_GETBITRANGE(buffer[offset], 5, 0));
+                write_JSON_Unsigned(json, "subpage", buffer[offset + 1]);
+                end_JSON_Object(json);
+            }
+        }
+        end_JSON_Array(json);
+    }
+    end_JSON_Object(json);
+    safe_free_aligned(&buffer);
+    return ret;
+}
@@ -0,0 +1,950 @@
+// SPDX-License-Identifier: MPL-2.0
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2014-2025 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file openseachest_log_compression.c
+// \brief This file implements background LZ4 compression of pulled log files.
+
+#include "common_types.h"
+#include "io_utils.h"
+#include "memory_safety.h"
+#include "string_utils.h"
+#include "time_utils.h"
+#include "type_conversion.h"
+
+#include "openseachest_log_compression.h"
+#include "openseachest_util_threads.h"
+
+#if defined(UEFI_C_SOURCE)
+// directories cannot be listed in UEFI, so no pulled files are found
+#elif defined(_WIN32)
+#    include <windows.h>
+#else
+#    include <dirent.h>
+#    include <sys/stat.h>
+#endif
+
+// Compressed logs are standard LZ4 frames (lz4_Frame_format.md in the LZ4 project) so they can be read back with
+// "lz4 -d" or any LZ4 library. Every integer is little endian.
+#define LOG_COMPRESSION_FRAME_MAGIC        UINT32_C(0x184D2204)
+#define LOG_COMPRESSION_SKIPPABLE_MAGIC    UINT32_C(0x184D2A5A)
+#define LOG_COMPRESSION_FRAME_FLAGS        UINT8_C(0x64) // version 1, independent blocks, content checksum
+#define LOG_COMPRESSION_BLOCK_DESCRIPTOR   UINT8_C(0x50) // 256KiB maximum block size
+#define LOG_COMPRESSION_FRAME_HEADER_LEN   UINT32_C(7)
+#define LOG_COMPRESSION_BLOCK_HEADER_LEN   UINT32_C(4)
+#define LOG_COMPRESSION_CHECKSUM_LEN       UINT32_C(4)
+#define LOG_COMPRESSION_BLOCK_STORED       UINT32_C(0x80000000)
+#define LOG_COMPRESSION_INDEX_SIGNATURE    "OSCZIDX1"
+#define LOG_COMPRESSION_END_SIGNATURE      "OSCZEND1"
+#define LOG_COMPRESSION_SIGNATURE_LENGTH   8
+#define LOG_COMPRESSION_INDEX_ENTRY_LEN    UINT32_C(16)
+#define LOG_COMPRESSION_CHUNK_SIZE         UINT32_C(262144)
+#define LOG_COMPRESSION_HASH_BITS          14
+#define LOG_COMPRESSION_MIN_MATCH          UINT32_C(4)
+#define LOG_COMPRESSION_LAST_LITERALS      UINT32_C(5)
+#define LOG_COMPRESSION_MATCH_FIND_LIMIT   UINT32_C(12)
+#define LOG_COMPRESSION_MAX_OFFSET         UINT32_C(65535)
+// worst case LZ4 block size for input that does not compress
+#define LOG_COMPRESSION_BOUND(size)        ((size) + ((size) / UINT32_C(255)) + UINT32_C(16))
+#define LOG_COMPRESSION_BLOCK_BUFFER_LEN                                                                               \
+    (LOG_COMPRESSION_BLOCK_HEADER_LEN + LOG_COMPRESSION_BOUND(LOG_COMPRESSION_CHUNK_SIZE))
+// xxHash32 primes, used for the frame header and content checksums the LZ4 frame format requires
+#define XXH32_PRIME_1                      UINT32_C(2654435761)
+#define XXH32_PRIME_2                      UINT32_C(2246822519)
+#define XXH32_PRIME_3                      UINT32_C(3266489917)
+#define XXH32_PRIME_4                      UINT32_C(668265263)
+#define XXH32_PRIME_5                      UINT32_C(374761393)
+
+struct s_logCompressor
+{
+    char**      paths;
+    uint32_t    pathCount;
+    uint32_t    pathCapacity;
+    uint32_t    nextPath;
+    bool        finishing;
+    bool        removeOriginals;
+    uint32_t    filesCompressed;
+    uint32_t    failures;
+    uint64_t    inputBytes;
+    uint64_t    outputBytes;
+    uint8_t*    readBuffer;
+    uint8_t*    compressBuffer;
+    uint32_t*   hashTable;
+    uint32_t    crcTable[256];
+    utilLock*   lock;
+    utilSignal* signal;
+    utilThread* thread;
+};
+
+static M_INLINE void put_LE32(uint8_t* buffer, uint32_t value)
+{
+    buffer[0] = M_Byte0(value);
+    buffer[1] = M_Byte1(value);
+    buffer[2] = M_Byte2(value);
+    buffer[3] = M_Byte3(value);
+}
+
+static M_INLINE void put_LE64(uint8_t* buffer, uint64_t value)
+{
+    put_LE32(buffer, C_CAST(uint32_t, value));
+    put_LE32(&buffer[4], C_CAST(uint32_t, value >> 32));
+}
+
+static M_INLINE uint32_t get_LE32(const uint8_t* buffer)
+{
+    return M_BytesTo4ByteValue(buffer[3], buffer[2], buffer[1], buffer[0]);
+}
+
+static M_INLINE uint64_t get_LE64(const uint8_t* buffer)
+{
+    return (C_CAST(uint64_t, get_LE32(&buffer[4])) << 32) | get_LE32(buffer);
+}
+
+// Pass 0 as crc for the first piece of data and the previous result to continue over the next piece
+static uint32_t log_Compression_CRC32(const uint32_t* crcTable, uint32_t crc, const uint8_t* data, uint32_t length)
+{
+    crc ^= UINT32_C(0xFFFFFFFF);
+    for (uint32_t iter = UINT32_C(0); iter < length; ++iter)
+    {
+        crc = crcTable[(crc ^ data[iter]) & UINT32_C(0xFF)] ^ (crc >> 8);
+    }
+    return crc ^ UINT32_C(0xFFFFFFFF);
+}
+
+static M_INLINE uint32_t rotate_Left_32(uint32_t value, uint32_t bits)
+{
+    return (value << bits) | (value >> (UINT32_C(32) - bits));
+}
+
+// Streaming xxHash32 with a seed of 0 so the content checksum can be computed one block at a time
+typedef struct s_logCompressionXXH32
+{
+    uint32_t lanes[4];
+    uint64_t totalLength;
+    uint8_t  pending[16];
+    uint32_t pendingLength;
+} logCompressionXXH32;
+
+static void start_Log_Compression_XXH32(logCompressionXXH32* state)
+{
+    safe_memset(state, sizeof(logCompressionXXH32), 0, sizeof(logCompressionXXH32));
+    state->lanes[0] = XXH32_PRIME_1 + XXH32_PRIME_2;
+    state->lanes[1] = XXH32_PRIME_2;
+    state->lanes[2] = UINT32_C(0);
+    state->lanes[3] = UINT32_C(0) - XXH32_PRIME_1;
+}
+
+static M_INLINE void process_Log_Compression_XXH32_Stripe(uint32_t* lanes, const uint8_t* stripe)
+{
+    for (uint32_t lane = UINT32_C(0); lane < UINT32_C(4); ++lane)
+    {
+        lanes[lane] =
+            rotate_Left_32(lanes[lane] + get_LE32(&stripe[lane * UINT32_C(4)]) * XXH32_PRIME_2, UINT32_C(13)) *
+            XXH32_PRIME_1;
+    }
+}
+
+static void update_Log_Compression_XXH32(logCompressionXXH32* state, const uint8_t* data, uint32_t length)
+{
+    state->totalLength += length;
+    while (length > UINT32_C(0))
+    {
+        if (state->pendingLength == UINT32_C(0) && length >= UINT32_C(16))
+        {
+            process_Log_Compression_XXH32_Stripe(state->lanes, data);
+            data += 16;
+            length -= UINT32_C(16);
+        }
+        else
+        {
+            uint32_t copyLength = M_Min(UINT32_C(16) - state->pendingLength, length);
+            safe_memcpy(&state->pending[state->pendingLength], UINT32_C(16) - state->pendingLength, data, copyLength);
+            state->pendingLength += copyLength;
+            data += copyLength;
+            length -= copyLength;
+            if (state->pendingLength == UINT32_C(16))
+            {
+                process_Log_Compression_XXH32_Stripe(state->lanes, state->pending);
+                state->pendingLength = UINT32_C(0);
+            }
+        }
+    }
+}
+
+static uint32_t finish_Log_Compression_XXH32(const logCompressionXXH32* state)
+{
+    uint32_t hash   = XXH32_PRIME_5;
+    uint32_t offset = UINT32_C(0);
+    if (state->totalLength >= UINT64_C(16))
+    {
+        hash = rotate_Left_32(state->lanes[0], UINT32_C(1)) + rotate_Left_32(state->lanes[1], UINT32_C(7)) +
+               rotate_Left_32(state->lanes[2], UINT32_C(12)) + rotate_Left_32(state->lanes[3], UINT32_C(18));
+    }
+    hash += C_CAST(uint32_t, state->totalLength);
+    for (; state->pendingLength - offset >= UINT32_C(4); offset += UINT32_C(4))
+    {
+        hash = rotate_Left_32(hash + get_LE32(&state->pending[offset]) * XXH32_PRIME_3, UINT32_C(17)) * XXH32_PRIME_4;
+    }
+    for (; offset < state->pendingLength; ++offset)
+    {
+        hash = rotate_Left_32(hash + state->pending[offset] * XXH32_PRIME_5, UINT32_C(11)) * XXH32_PRIME_1;
+    }
+    hash ^= hash >> 15;
+    hash *= XXH32_PRIME_2;
+    hash ^= hash >> 13;
+    hash *= XXH32_PRIME_3;
+    hash ^= hash >> 16;
+    return hash;
+}
+
+static uint32_t write_LZ4_Length(uint8_t* output, uint32_t length)
+{
+    uint32_t written = UINT32_C(0);
+    while (length >= UINT32_C(255))
+    {
+        output[written++] = UINT8_C(255);
+        length -= UINT32_C(255);
+    }
+    output[written++] = C_CAST(uint8_t, length);
+    return written;
+}
+
+static uint32_t write_LZ4_Sequence(uint8_t*       output,
+                                   const uint8_t* literals,
+                                   uint32_t       literalLength,
+                                   uint32_t       offset,
+                                   uint32_t       matchLength)
+{
+    uint32_t written = UINT32_C(1);
+    uint8_t  token   = C_CAST(uint8_t, M_Min(literalLength, UINT32_C(15)) << 4);
+    if (literalLength >= UINT32_C(15))
+    {
+        written += write_LZ4_Length(&output[written], literalLength - UINT32_C(15));
+    }
+    safe_memcpy(&output[written], literalLength, literals, literalLength);
+    written += literalLength;
+    if (matchLength > UINT32_C(0))
+    {
+        uint32_t extraMatch = matchLength - LOG_COMPRESSION_MIN_MATCH;
+        output[written++]   = M_Byte0(offset);
+        output[written++]   = M_Byte1(offset);
+        token |= C_CAST(uint8_t, M_Min(extraMatch, UINT32_C(15)));
+        if (extraMatch >= UINT32_C(15))
+        {
+            written += write_LZ4_Length(&output[written], extraMatch - UINT32_C(15));
+        }
+    }
+    output[0] = token;
+    return written;
+}
+
+// Greedy single hash LZ4 block compressor. Output can be read by any LZ4 block decoder (LZ4_decompress_safe).
+// Logs are mostly zeros and repeated structures, so a simple match finder gets most of the benefit while keeping up
+// with device reads. output must hold LOG_COMPRESSION_BOUND(length) bytes.
+static uint32_t compress_LZ4_Block(const uint8_t* input, uint32_t length, uint8_t* output, uint32_t* hashTable)
+{
+    uint32_t position = UINT32_C(0);
+    uint32_t anchor   = UINT32_C(0);
+    uint32_t written  = UINT32_C(0);
+    safe_memset(hashTable, sizeof(uint32_t) << LOG_COMPRESSION_HASH_BITS, 0,
+                sizeof(uint32_t) << LOG_COMPRESSION_HASH_BITS);
+    if (length > LOG_COMPRESSION_MATCH_FIND_LIMIT)
+    {
+        // the format requires the last match to start 12 bytes before the end and the last 5 bytes to be literals
+        uint32_t matchStartLimit = length - LOG_COMPRESSION_MATCH_FIND_LIMIT;
+        uint32_t matchEndLimit   = length - LOG_COMPRESSION_LAST_LITERALS;
+        while (position < matchStartLimit)
+        {
+            uint32_t sequence  = get_LE32(&input[position]);
+            uint32_t hash      = (sequence * UINT32_C(2654435761)) >> (32 - LOG_COMPRESSION_HASH_BITS);
+            uint32_t candidate = hashTable[hash];
+            hashTable[hash]    = position + UINT32_C(1);
+            if (candidate > UINT32_C(0) && position - (candidate - UINT32_C(1)) <= LOG_COMPRESSION_MAX_OFFSET &&
+                get_LE32(&input[candidate - UINT32_C(1)]) == sequence)
+            {
+                uint32_t reference   = candidate - UINT32_C(1);
+                uint32_t matchLength = LOG_COMPRESSION_MIN_MATCH;
+                while (position + matchLength < matchEndLimit &&
+                       input[position + matchLength] == input[reference + matchLength])
+                {
+                    ++matchLength;
+                }
+                written += write_LZ4_Sequence(&output[written], &input[anchor], position - anchor,
+                                              position - reference, matchLength);
+                position += matchLength;
+                anchor = position;
+            }
+            else
+            {
+                ++position;
+            }
+        }
+    }
+    written += write_LZ4_Sequence(&output[written], &input[anchor], length - anchor, UINT32_C(0), UINT32_C(0));
+    return written;
+}
+
+// Reads an LZ4 length continuation (bytes of 255 followed by a final byte) after a 15 in the token.
+// Returns false if the input ends first.
+static bool read_LZ4_Length(const uint8_t* input, uint32_t inputLength, uint32_t* position, uint32_t* length)
+{
+    uint8_t extra = UINT8_C(255);
+    while (extra == UINT8_C(255))
+    {
+        if (*position >= inputLength)
+        {
+            return false;
+        }
+        extra = input[(*position)++];
+        *length += extra;
+    }
+    return true;
+}
+
+// Bounds checked LZ4 block decoder used to check each compressed file before it is kept.
+// Returns the decoded length or UINT32_MAX if the block is malformed or does not fit in output.
+static uint32_t decompress_LZ4_Block(const uint8_t* input, uint32_t inputLength, uint8_t* output, uint32_t outputLength)
+{
+    uint32_t position = UINT32_C(0);
+    uint32_t written  = UINT32_C(0);
+    while (position < inputLength)
+    {
+        uint8_t  token         = input[position++];
+        uint32_t literalLength = C_CAST(uint32_t, token >> 4);
+        uint32_t matchLength   = C_CAST(uint32_t, token & UINT8_C(0x0F));
+        uint32_t offset        = UINT32_C(0);
+        if ((literalLength == UINT32_C(15) && !read_LZ4_Length(input, inputLength, &position, &literalLength)) ||
+            literalLength > inputLength - position || literalLength > outputLength - written)
+        {
+            return UINT32_MAX;
+        }
+        safe_memcpy(&output[written], outputLength - written, &input[position], literalLength);
+        position += literalLength;
+        written += literalLength;
+        if (position == inputLength)
+        {
+            // the last sequence is literals only
+            break;
+        }
+        if (inputLength - position < UINT32_C(2))
+        {
+            return UINT32_MAX;
+        }
+        offset = M_BytesTo2ByteValue(input[position + UINT32_C(1)], input[position]);
+        position += UINT32_C(2);
+        if (offset == UINT32_C(0) || offset > written ||
+            (matchLength == UINT32_C(15) && !read_LZ4_Length(input, inputLength, &position, &matchLength)))
+        {
+            return UINT32_MAX;
+        }
+        matchLength += LOG_COMPRESSION_MIN_MATCH;
+        if (matchLength > outputLength - written)
+        {
+            return UINT32_MAX;
+        }
+        // matches may overlap the bytes they produce, so copy a byte at a time
+        for (uint32_t iter = UINT32_C(0); iter < matchLength; ++iter, ++written)
+        {
+            output[written] = output[written - offset];
+        }
+    }
+    return written;
+}
+
+// Same frame options as the lz4 command line defaults apart from the block size. Block checksums are left out since
+// lz4 1.9.4 cannot skip a skippable frame (the index) following a frame with block checksums and several blocks.
+static void fill_LZ4_Frame_Header(uint8_t* header)
+{
+    logCompressionXXH32 headerChecksum;
+    put_LE32(header, LOG_COMPRESSION_FRAME_MAGIC);
+    header[4] = LOG_COMPRESSION_FRAME_FLAGS;
+    header[5] = LOG_COMPRESSION_BLOCK_DESCRIPTOR;
+    // the header checksum covers the frame descriptor (flags and block descriptor)
+    start_Log_Compression_XXH32(&headerChecksum);
+    update_Log_Compression_XXH32(&headerChecksum, &header[4], UINT32_C(2));
+    header[6] = M_Byte1(finish_Log_Compression_XXH32(&headerChecksum));
+}
+
+// Decodes the whole compressed file again and checks the frame's content checksum and the length and CRC32 of the
+// decoded data against the original, so the original is never removed because of a compressed copy that cannot be
+// read back.
+static eReturnValues verify_Compressed_Log_File(logCompressor* compressor,
+                                                const char*    path,
+                                                uint64_t       originalSize,
+                                                uint32_t       originalCRC)
+{
+    eReturnValues       ret         = SUCCESS;
+    uint64_t            decodedSize = UINT64_C(0);
+    uint32_t            decodedCRC  = UINT32_C(0);
+    bool                endOfFrame  = false;
+    logCompressionXXH32 contentChecksum;
+    secureFileInfo*     file = secure_Open_File(path, "rb", M_NULLPTR, M_NULLPTR, M_NULLPTR);
+    DECLARE_ZERO_INIT_ARRAY(uint8_t, header, LOG_COMPRESSION_FRAME_HEADER_LEN);
+    DECLARE_ZERO_INIT_ARRAY(uint8_t, expectedHeader, LOG_COMPRESSION_FRAME_HEADER_LEN);
+    if (file == M_NULLPTR || file->error != SEC_FILE_SUCCESS)
+    {
+        free_Secure_File_Info(&file);
+        return FILE_OPEN_ERROR;
+    }
+    start_Log_Compression_XXH32(&contentChecksum);
+    fill_LZ4_Frame_Header(expectedHeader);
+    if (SEC_FILE_SUCCESS != secure_Read_File(file, header, LOG_COMPRESSION_FRAME_HEADER_LEN, sizeof(uint8_t),
+                                             LOG_COMPRESSION_FRAME_HEADER_LEN, M_NULLPTR) ||
+        memcmp(header, expectedHeader, LOG_COMPRESSION_FRAME_HEADER_LEN) != 0)
+    {
+        ret = VALIDATION_FAILURE;
+    }
+    while (ret == SUCCESS && !endOfFrame)
+    {
+        uint8_t* block         = compressor->compressBuffer;
+        uint32_t storedLength  = UINT32_C(0);
+        uint32_t decodedLength = UINT32_C(0);
+        if (SEC_FILE_SUCCESS != secure_Read_File(file, block, LOG_COMPRESSION_BLOCK_BUFFER_LEN, sizeof(uint8_t),
+                                                 LOG_COMPRESSION_BLOCK_HEADER_LEN, M_NULLPTR))
+        {
+            ret = VALIDATION_FAILURE;
+            break;
+        }
+        storedLength = get_LE32(block) & ~LOG_COMPRESSION_BLOCK_STORED;
+        if (get_LE32(block) == UINT32_C(0))
+        {
+            // the end mark is followed by the content checksum
+            endOfFrame = true;
+            if (SEC_FILE_SUCCESS != secure_Read_File(file, block, LOG_COMPRESSION_BLOCK_BUFFER_LEN, sizeof(uint8_t),
+                                                     LOG_COMPRESSION_CHECKSUM_LEN, M_NULLPTR) ||
+                get_LE32(block) != finish_Log_Compression_XXH32(&contentChecksum))
+            {
+                ret = VALIDATION_FAILURE;
+            }
+            break;
+        }
+        if (storedLength > LOG_COMPRESSION_BOUND(LOG_COMPRESSION_CHUNK_SIZE) ||
+            SEC_FILE_SUCCESS != secure_Read_File(file, &block[LOG_COMPRESSION_BLOCK_HEADER_LEN],
+                                                 LOG_COMPRESSION_BLOCK_BUFFER_LEN - LOG_COMPRESSION_BLOCK_HEADER_LEN,
+                                                 sizeof(uint8_t), storedLength, M_NULLPTR))
+        {
+            ret = VALIDATION_FAILURE;
+            break;
+        }
+        if (get_LE32(block) & LOG_COMPRESSION_BLOCK_STORED)
+        {
+            decodedLength = storedLength <= LOG_COMPRESSION_CHUNK_SIZE ? storedLength : UINT32_MAX;
+            if (decodedLength != UINT32_MAX)
+            {
+                safe_memcpy(compressor->readBuffer, LOG_COMPRESSION_CHUNK_SIZE,
+                            &block[LOG_COMPRESSION_BLOCK_HEADER_LEN], storedLength);
+            }
+        }
+        else
+        {
+            decodedLength = decompress_LZ4_Block(&block[LOG_COMPRESSION_BLOCK_HEADER_LEN], storedLength,
+                                                 compressor->readBuffer, LOG_COMPRESSION_CHUNK_SIZE);
+        }
+        if (decodedLength == UINT32_MAX)
+        {
+            ret = VALIDATION_FAILURE;
+            break;
+        }
+        decodedCRC = log_Compression_CRC32(compressor->crcTable, decodedCRC, compressor->readBuffer, decodedLength);
+        update_Log_Compression_XXH32(&contentChecksum, compressor->readBuffer, decodedLength);
+        decodedSize += decodedLength;
+    }
+    if (ret == SUCCESS && (!endOfFrame || decodedSize != originalSize || decodedCRC != originalCRC))
+    {
+        ret = VALIDATION_FAILURE;
+    }
+    secure_Close_File(file);
+    free_Secure_File_Info(&file);
+    return ret;
+}
+
+// File layout:
+//   LZ4 frame:      7 byte header (magic, flags, block descriptor, header checksum), then one block per 256KiB of
+//                   the log: stored length (high bit set if the data is stored as is) and the LZ4 block, then a zero
+//                   end mark and the xxHash32 of the whole log
+//   index:          LZ4 skippable frame (magic 0x184D2A5A, length) holding "OSCZIDX1", chunk count, reserved, then per
+//                   chunk the file offset of its block header and its uncompressed offset (8 bytes each), and finally
+//                   the file offset of the skippable frame (8 bytes) and "OSCZEND1"
+// LZ4 tools skip the index. Readers that need part of a log seek to the last 16 bytes, load the index and decode only
+// the blocks covering the range they need.
+static eReturnValues compress_Log_File(logCompressor* compressor, const char* sourcePath, uint64_t* compressedSize)
+{
+    eReturnValues       ret          = SUCCESS;
+    secureFileInfo*     source       = M_NULLPTR;
+    secureFileInfo*     destination  = M_NULLPTR;
+    uint8_t*            index        = M_NULLPTR;
+    uint64_t            fileOffset   = UINT64_C(0);
+    uint64_t            originalSize = UINT64_C(0);
+    uint64_t            remaining    = UINT64_C(0);
+    uint32_t            chunkCount   = UINT32_C(0);
+    uint32_t            originalCRC  = UINT32_C(0);
+    size_t              indexLength  = SIZE_T_C(0);
+    logCompressionXXH32 contentChecksum;
+    DECLARE_ZERO_INIT_ARRAY(char, destinationPath, OPENSEA_PATH_MAX);
+    DECLARE_ZERO_INIT_ARRAY(uint8_t, header, LOG_COMPRESSION_FRAME_HEADER_LEN);
+    *compressedSize = UINT64_C(0);
+    start_Log_Compression_XXH32(&contentChecksum);
+    source          = secure_Open_File(sourcePath, "rb", M_NULLPTR, M_NULLPTR, M_NULLPTR);
+    if (source == M_NULLPTR || source->error != SEC_FILE_SUCCESS)
+    {
+        free_Secure_File_Info(&source);
+        return FILE_OPEN_ERROR;
+    }
+    originalSize = C_CAST(uint64_t, source->fileSize);
+    remaining    = originalSize;
+    chunkCount = C_CAST(uint32_t, (remaining + LOG_COMPRESSION_CHUNK_SIZE - UINT64_C(1)) / LOG_COMPRESSION_CHUNK_SIZE);
+    // skippable frame header, index header, one entry per chunk, then the 16 byte footer
+    indexLength = SIZE_T_C(8) + (C_CAST(size_t, chunkCount) + SIZE_T_C(2)) * LOG_COMPRESSION_INDEX_ENTRY_LEN;
+    index       = C_CAST(uint8_t*, safe_calloc(indexLength, sizeof(uint8_t)));
+    snprintf_err_handle(destinationPath, OPENSEA_PATH_MAX, "%s%s", sourcePath, LOG_COMPRESSION_EXTENSION);
+    destination = secure_Open_File(destinationPath, "wb", M_NULLPTR, M_NULLPTR, M_NULLPTR);
+    if (index == M_NULLPTR || destination == M_NULLPTR || destination->error != SEC_FILE_SUCCESS)
+    {
+        ret = index == M_NULLPTR ? MEMORY_FAILURE : FILE_OPEN_ERROR;
+    }
+    else
+    {
+        fill_LZ4_Frame_Header(header);
+        if (SEC_FILE_SUCCESS != secure_Write_File(destination, header, LOG_COMPRESSION_FRAME_HEADER_LEN,
+                                                  sizeof(uint8_t), LOG_COMPRESSION_FRAME_HEADER_LEN, M_NULLPTR))
+        {
+            ret = ERROR_WRITING_FILE;
+        }
+        fileOffset = LOG_COMPRESSION_FRAME_HEADER_LEN;
+    }
+    for (uint32_t chunk = UINT32_C(0); ret == SUCCESS && chunk < chunkCount; ++chunk)
+    {
+        uint32_t chunkLength = C_CAST(uint32_t, M_Min(remaining, C_CAST(uint64_t, LOG_COMPRESSION_CHUNK_SIZE)));
+        uint8_t* stored      = compressor->compressBuffer + LOG_COMPRESSION_BLOCK_HEADER_LEN;
+        uint8_t* entry =
+            &index[SIZE_T_C(8) + (C_CAST(size_t, chunk) + SIZE_T_C(1)) * LOG_COMPRESSION_INDEX_ENTRY_LEN];
+        if (SEC_FILE_SUCCESS != secure_Read_File(source, compressor->readBuffer, LOG_COMPRESSION_CHUNK_SIZE,
+                                                 sizeof(uint8_t), chunkLength, M_NULLPTR))
+        {
+            ret = FILE_READ_ERROR;
+            break;
+        }
+        originalCRC = log_Compression_CRC32(compressor->crcTable, originalCRC, compressor->readBuffer, chunkLength);
+        update_Log_Compression_XXH32(&contentChecksum, compressor->readBuffer, chunkLength);
+        uint32_t storedLength = compress_LZ4_Block(compressor->readBuffer, chunkLength, stored, compressor->hashTable);
+        if (storedLength >= chunkLength)
+        {
+            storedLength = chunkLength;
+            safe_memcpy(stored, LOG_COMPRESSION_BOUND(LOG_COMPRESSION_CHUNK_SIZE), compressor->readBuffer, chunkLength);
+            put_LE32(compressor->compressBuffer, storedLength | LOG_COMPRESSION_BLOCK_STORED);
+        }
+        else
+        {
+            put_LE32(compressor->compressBuffer, storedLength);
+        }
+        put_LE64(entry, fileOffset);
+        put_LE64(&entry[8], C_CAST(uint64_t, chunk) * LOG_COMPRESSION_CHUNK_SIZE);
+        if (SEC_FILE_SUCCESS != secure_Write_File(destination, compressor->compressBuffer,
+                                                  LOG_COMPRESSION_BLOCK_BUFFER_LEN, sizeof(uint8_t),
+                                                  LOG_COMPRESSION_BLOCK_HEADER_LEN + storedLength, M_NULLPTR))
+        {
+            ret = ERROR_WRITING_FILE;
+        }
+        fileOffset += C_CAST(uint64_t, storedLength) + LOG_COMPRESSION_BLOCK_HEADER_LEN;
+        remaining -= chunkLength;
+    }
+    if (ret == SUCCESS)
+    {
+        DECLARE_ZERO_INIT_ARRAY(uint8_t, frameEnd, LOG_COMPRESSION_BLOCK_HEADER_LEN + LOG_COMPRESSION_CHECKSUM_LEN);
+        put_LE32(&frameEnd[LOG_COMPRESSION_BLOCK_HEADER_LEN], finish_Log_Compression_XXH32(&contentChecksum));
+        fileOffset += LOG_COMPRESSION_BLOCK_HEADER_LEN + LOG_COMPRESSION_CHECKSUM_LEN;
+        put_LE32(&index[0], LOG_COMPRESSION_SKIPPABLE_MAGIC);
+        put_LE32(&index[4], C_CAST(uint32_t, indexLength - SIZE_T_C(8)));
+        safe_memcpy(&index[8], indexLength - SIZE_T_C(8), LOG_COMPRESSION_INDEX_SIGNATURE,
+                    LOG_COMPRESSION_SIGNATURE_LENGTH);
+        put_LE32(&index[16], chunkCount);
+        put_LE64(&index[indexLength - SIZE_T_C(16)], fileOffset);
+        safe_memcpy(&index[indexLength - SIZE_T_C(8)], SIZE_T_C(8), LOG_COMPRESSION_END_SIGNATURE,
+                    LOG_COMPRESSION_SIGNATURE_LENGTH);
+        if (SEC_FILE_SUCCESS != secure_Write_File(destination, frameEnd,
+                                                  LOG_COMPRESSION_BLOCK_HEADER_LEN + LOG_COMPRESSION_CHECKSUM_LEN,
+                                                  sizeof(uint8_t),
+                                                  LOG_COMPRESSION_BLOCK_HEADER_LEN + LOG_COMPRESSION_CHECKSUM_LEN,
+                                                  M_NULLPTR) ||
+            SEC_FILE_SUCCESS !=
+                secure_Write_File(destination, index, indexLength, sizeof(uint8_t), indexLength, M_NULLPTR) ||
+            SEC_FILE_SUCCESS != secure_Flush_File(destination))
+        {
+            ret = ERROR_WRITING_FILE;
+        }
+        *compressedSize = fileOffset + indexLength;
+    }
+    if (destination != M_NULLPTR && destination->error == SEC_FILE_SUCCESS &&
+        SEC_FILE_SUCCESS != secure_Close_File(destination) && ret == SUCCESS)
+    {
+        ret = ERROR_WRITING_FILE;
+    }
+    secure_Close_File(source);
+    free_Secure_File_Info(&source);
+    free_Secure_File_Info(&destination);
+    safe_free(&index);
+    if (ret == SUCCESS)
+    {
+        ret = verify_Compressed_Log_File(compressor, destinationPath, originalSize, originalCRC);
+    }
+    if (ret != SUCCESS)
+    {
+        remove(destinationPath);
+    }
+    else if (compressor->removeOriginals)
+    {
+        // only once the compressed copy has been read back and matches
+        remove(sourcePath);
+    }
+    return ret;
+}
+
+static void run_Queued_Log_Compression(logCompressor* compressor, const char* path)
+{
+    uint64_t      compressedSize = UINT64_C(0);
+    uint64_t      originalSize   = UINT64_C(0);
+    eReturnValues ret            = SUCCESS;
+    secureFileInfo* source = secure_Open_File(path, "rb", M_NULLPTR, M_NULLPTR, M_NULLPTR);
+    if (source != M_NULLPTR && source->error == SEC_FILE_SUCCESS)
+    {
+        originalSize = C_CAST(uint64_t, source->fileSize);
+        secure_Close_File(source);
+    }
+    free_Secure_File_Info(&source);
+    ret = compress_Log_File(compressor, path, &compressedSize);
+    lock_Util_Lock(compressor->lock);
+    if (ret == SUCCESS)
+    {
+        compressor->filesCompressed += UINT32_C(1);
+        compressor->inputBytes += originalSize;
+        compressor->outputBytes += compressedSize;
+    }
+    else
+    {
+        compressor->failures += UINT32_C(1);
+    }
+    unlock_Util_Lock(compressor->lock);
+}
+
+static void log_Compressor_Thread(void* param)
+{
+    logCompressor* compressor = C_CAST(logCompressor*, param);
+    lock_Util_Lock(compressor->lock);
+    while (true)
+    {
+        while (compressor->nextPath == compressor->pathCount && !compressor->finishing)
+        {
+            wait_Util_Signal(compressor->signal, compressor->lock);
+        }
+        if (compressor->nextPath == compressor->pathCount)
+        {
+            break;
+        }
+        const char* path = compressor->paths[compressor->nextPath++];
+        unlock_Util_Lock(compressor->lock);
+        run_Queued_Log_Compression(compressor, path);
+        lock_Util_Lock(compressor->lock);
+    }
+    unlock_Util_Lock(compressor->lock);
+}
+
+static void free_Log_Compressor(logCompressor** compressor)
+{
+    if (compressor != M_NULLPTR && *compressor != M_NULLPTR)
+    {
+        for (uint32_t iter = UINT32_C(0); iter < (*compressor)->pathCount; ++iter)
+        {
+            safe_free(&(*compressor)->paths[iter]);
+        }
+        safe_free(&(*compressor)->paths);
+        safe_free(&(*compressor)->readBuffer);
+        safe_free(&(*compressor)->compressBuffer);
+        safe_free(&(*compressor)->hashTable);
+        destroy_Util_Signal(&(*compressor)->signal);
+        destroy_Util_Lock(&(*compressor)->lock);
+        safe_free(compressor);
+    }
+}
+
+logCompressor* create_Log_Compressor(bool removeOriginals)
+{
+    logCompressor* compressor = C_CAST(logCompressor*, safe_calloc(1, sizeof(logCompressor)));
+    if (compressor == M_NULLPTR)
+    {
+        return M_NULLPTR;
+    }
+    compressor->removeOriginals = removeOriginals;
+    compressor->readBuffer      = C_CAST(uint8_t*, safe_calloc(LOG_COMPRESSION_CHUNK_SIZE, sizeof(uint8_t)));
+    compressor->compressBuffer  = C_CAST(uint8_t*, safe_calloc(LOG_COMPRESSION_BLOCK_BUFFER_LEN, sizeof(uint8_t)));
+    compressor->hashTable = C_CAST(uint32_t*, safe_calloc(SIZE_T_C(1) << LOG_COMPRESSION_HASH_BITS, sizeof(uint32_t)));
+    if (compressor->readBuffer == M_NULLPTR || compressor->compressBuffer == M_NULLPTR ||
+        compressor->hashTable == M_NULLPTR)
+    {
+        free_Log_Compressor(&compressor);
+        return M_NULLPTR;
+    }
+    for (uint32_t entry = UINT32_C(0); entry < UINT32_C(256); ++entry)
+    {
+        uint32_t crc = entry;
+        for (uint8_t bit = UINT8_C(0); bit < UINT8_C(8); ++bit)
+        {
+            crc = (crc & UINT32_C(1)) ? (crc >> 1) ^ UINT32_C(0xEDB88320) : crc >> 1;
+        }
+        compressor->crcTable[entry] = crc;
+    }
+    compressor->lock   = create_Util_Lock();
+    compressor->signal = create_Util_Signal();
+    if (compressor->lock != M_NULLPTR && compressor->signal != M_NULLPTR)
+    {
+        compressor->thread = start_Util_Thread(log_Compressor_Thread, compressor);
+    }
+    // without a thread files are compressed as they are queued
+    return compressor;
+}
+
+static bool is_Log_File_Excluded_From_Compression(const char* name)
+{
+    static const char* excludedExtensions[] = {LOG_COMPRESSION_EXTENSION, ".partial", ".idx", ".lastpull", ".csv"};
+    size_t             nameLength           = safe_strlen(name);
+    for (size_t iter = SIZE_T_C(0); iter < sizeof(excludedExtensions) / sizeof(excludedExtensions[0]); ++iter)
+    {
+        size_t extensionLength = safe_strlen(excludedExtensions[iter]);
+        if (nameLength >= extensionLength &&
+            strcmp(&name[nameLength - extensionLength], excludedExtensions[iter]) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void queue_Log_File_For_Compression(logCompressor* compressor, const char* path)
+{
+    bool queued = false;
+    lock_Util_Lock(compressor->lock);
+    for (uint32_t iter = UINT32_C(0); iter < compressor->pathCount && !queued; ++iter)
+    {
+        queued = strcmp(compressor->paths[iter], path) == 0;
+    }
+    if (!queued && compressor->pathCount == compressor->pathCapacity)
+    {
+        uint32_t newCapacity = compressor->pathCapacity == UINT32_C(0) ? UINT32_C(16) : compressor->pathCapacity * 2;
+        char**   newPaths    = C_CAST(char**, safe_realloc(compressor->paths, newCapacity * sizeof(char*)));
+        if (newPaths != M_NULLPTR)
+        {
+            compressor->paths        = newPaths;
+            compressor->pathCapacity = newCapacity;
+        }
+    }
+    if (!queued && compressor->pathCount < compressor->pathCapacity)
+    {
+        char* copy = M_NULLPTR;
+        if (safe_strdup(&copy, path) == 0 && copy != M_NULLPTR)
+        {
+            compressor->paths[compressor->pathCount++] = copy;
+            broadcast_Util_Signal(compressor->signal);
+        }
+    }
+    unlock_Util_Lock(compressor->lock);
+    if (compressor->thread == M_NULLPTR)
+    {
+        while (compressor->nextPath < compressor->pathCount)
+        {
+            run_Queued_Log_Compression(compressor, compressor->paths[compressor->nextPath++]);
+        }
+    }
+}
+
+struct s_pulledLogFiles
+{
+    char     directory[OPENSEA_PATH_MAX];
+    char**   names; // sorted so a name can be looked up with bsearch
+    uint32_t count;
+    uint32_t capacity;
+};
+
+static int compare_Log_File_Names(const void* first, const void* second)
+{
+    return strcmp(*C_CAST(char* const*, first), *C_CAST(char* const*, second));
+}
+
+static void free_Log_File_Names(pulledLogFiles* files)
+{
+    for (uint32_t iter = UINT32_C(0); iter < files->count; ++iter)
+    {
+        safe_free(&files->names[iter]);
+    }
+    safe_free(&files->names);
+    files->count    = UINT32_C(0);
+    files->capacity = UINT32_C(0);
+}
+
+static bool add_Log_File_Name(pulledLogFiles* files, const char* name)
+{
+    char* copy = M_NULLPTR;
+    if (files->count == files->capacity)
+    {
+        uint32_t newCapacity = files->capacity == UINT32_C(0) ? UINT32_C(64) : files->capacity * 2;
+        char**   newNames    = C_CAST(char**, safe_realloc(files->names, newCapacity * sizeof(char*)));
+        if (newNames == M_NULLPTR)
+        {
+            return false;
+        }
+        files->names    = newNames;
+        files->capacity = newCapacity;
+    }
+    if (safe_strdup(&copy, name) != 0 || copy == M_NULLPTR)
+    {
+        return false;
+    }
+    files->names[files->count++] = copy;
+    return true;
+}
+
+// Fills files->names with the regular files in files->directory (not recursive), sorted.
+// Returns false if the directory cannot be listed or memory cannot be allocated.
+static bool list_Log_File_Names(pulledLogFiles* files)
+{
+    bool listed = false;
+#if defined(UEFI_C_SOURCE)
+    M_USE_UNUSED(files);
+#elif defined(_WIN32)
+    WIN32_FIND_DATAA findData;
+    HANDLE           findHandle = INVALID_HANDLE_VALUE;
+    DECLARE_ZERO_INIT_ARRAY(char, searchPath, OPENSEA_PATH_MAX);
+    snprintf_err_handle(searchPath, OPENSEA_PATH_MAX, "%s\\*", files->directory);
+    safe_memset(&findData, sizeof(WIN32_FIND_DATAA), 0, sizeof(WIN32_FIND_DATAA));
+    findHandle = FindFirstFileA(searchPath, &findData);
+    if (findHandle != INVALID_HANDLE_VALUE)
+    {
+        listed = true;
+        do
+        {
+            if (!(findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY))
+            {
+                listed = add_Log_File_Name(files, findData.cFileName);
+            }
+        } while (listed && FindNextFileA(findHandle, &findData));
+        FindClose(findHandle);
+    }
+#else
+    DIR* listing = opendir(files->directory);
+    if (listing != M_NULLPTR)
+    {
+        struct dirent* entry = M_NULLPTR;
+        listed               = true;
+        while (listed && (entry = readdir(listing)) != M_NULLPTR)
+        {
+            struct stat fileStat;
+            DECLARE_ZERO_INIT_ARRAY(char, filePath, OPENSEA_PATH_MAX);
+            snprintf_err_handle(filePath, OPENSEA_PATH_MAX, "%s/%s", files->directory, entry->d_name);
+            safe_memset(&fileStat, sizeof(struct stat), 0, sizeof(struct stat));
+            if (0 == stat(filePath, &fileStat) && S_ISREG(fileStat.st_mode))
+            {
+                listed = add_Log_File_Name(files, entry->d_name);
+            }
+        }
+        closedir(listing);
+    }
+#endif
+    if (listed && files->count > UINT32_C(1))
+    {
+        qsort(files->names, files->count, sizeof(char*), compare_Log_File_Names);
+    }
+    return listed;
+}
+
+pulledLogFiles* start_Pulled_Log_Files(logCompressor* compressor, const char* directory)
+{
+    pulledLogFiles* files = M_NULLPTR;
+    if (compressor == M_NULLPTR)
+    {
+        return M_NULLPTR;
+    }
+    if (directory == M_NULLPTR || safe_strlen(directory) == SIZE_T_C(0))
+    {
+        directory = ".";
+    }
+    files = C_CAST(pulledLogFiles*, safe_calloc(SIZE_T_C(1), sizeof(pulledLogFiles)));
+    if (files == M_NULLPTR)
+    {
+        return M_NULLPTR;
+    }
+    snprintf_err_handle(files->directory, OPENSEA_PATH_MAX, "%s", directory);
+    if (!list_Log_File_Names(files))
+    {
+        free_Log_File_Names(files);
+        safe_free(&files);
+    }
+    return files;
+}
+
+void queue_Pulled_Log_Files(logCompressor* compressor, pulledLogFiles** files, const char* serialNumber)
+{
+    pulledLogFiles after;
+    size_t         serialLength = safe_strlen(serialNumber);
+    if (files == M_NULLPTR || *files == M_NULLPTR)
+    {
+        return;
+    }
+    safe_memset(&after, sizeof(pulledLogFiles), 0, sizeof(pulledLogFiles));
+    snprintf_err_handle(after.directory, OPENSEA_PATH_MAX, "%s", (*files)->directory);
+    // without a serial number nothing can be tied to this device, so nothing is queued
+    if (compressor != M_NULLPTR && serialLength > SIZE_T_C(0) && list_Log_File_Names(&after))
+    {
+        for (uint32_t iter = UINT32_C(0); iter < after.count; ++iter)
+        {
+            const char* name = after.names[iter];
+            if (strncmp(name, serialNumber, serialLength) == 0 && !is_Log_File_Excluded_From_Compression(name) &&
+                ((*files)->count == UINT32_C(0) ||
+                 M_NULLPTR == bsearch(&name, (*files)->names, (*files)->count, sizeof(char*), compare_Log_File_Names)))
+            {
+                DECLARE_ZERO_INIT_ARRAY(char, filePath, OPENSEA_PATH_MAX);
+#if defined(_WIN32)
+                snprintf_err_handle(filePath, OPENSEA_PATH_MAX, "%s\\%s", after.directory, name);
+#else
+                snprintf_err_handle(filePath, OPENSEA_PATH_MAX, "%s/%s", after.directory, name);
+#endif
+                queue_Log_File_For_Compression(compressor, filePath);
+            }
+        }
+    }
+    free_Log_File_Names(&after);
+    free_Log_File_Names(*files);
+    safe_free(files);
+}
+
+uint32_t finish_Log_Compressor(logCompressor** compressor, uint64_t* inputBytes, uint64_t* outputBytes)
+{
+    uint32_t failures = UINT32_C(0);
+    if (compressor != M_NULLPTR && *compressor != M_NULLPTR)
+    {
+        if ((*compressor)->thread != M_NULLPTR)
+        {
+            lock_Util_Lock((*compressor)->lock);
+            (*compressor)->finishing = true;
+            broadcast_Util_Signal((*compressor)->signal);
+            unlock_Util_Lock((*compressor)->lock);
+            join_Util_Thread(&(*compressor)->thread);
+        }
+        failures = (*compressor)->failures;
+        if (inputBytes != M_NULLPTR)
+        {
+            *inputBytes = (*compressor)->inputBytes;
+        }
+        if (outputBytes != M_NULLPTR)
+        {
+            *outputBytes = (*compressor)->outputBytes;
+        }
+        free_Log_Compressor(compressor);
+    }
+    return failures;
+}
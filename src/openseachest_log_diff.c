@@ -0,0 +1,516 @@
+// SPDX-License-Identifier: MPL-2.0
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2014-2025 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file openseachest_log_diff.c
+// \brief This file implements comparing two saved pulls of the same log.
+
+#include "common_types.h"
+#include "io_utils.h"
+#include "memory_safety.h"
+#include "string_utils.h"
+#include "time_utils.h"
+#include "type_conversion.h"
+
+#include "openseachest_log_diff.h"
+#include "openseachest_util_options.h"
+
+#define LOG_SNAPSHOT_MAX_FILE_SIZE      UINT32_C(1048576)
+#define LOG_SNAPSHOT_BLOCK_SIZE         UINT32_C(512)
+#define LOG_SNAPSHOT_ATA_POH_PAGE       UINT16_C(1)
+#define LOG_SNAPSHOT_ATA_POH_OFFSET     UINT16_C(16)
+#define LOG_SNAPSHOT_NVME_POH_OFFSET    UINT16_C(128)
+#define LOG_SNAPSHOT_PHY_EVENT_CHECKSUM UINT32_C(511)
+#define LOG_DIFF_NAME_LENGTH            SIZE_T_C(96)
+
+typedef struct s_logDiffName
+{
+    uint16_t    page;
+    uint16_t    index;
+    const char* name;
+} logDiffName;
+
+static const logDiffName logDiffATAStatistics[] = {
+    {UINT16_C(1), UINT16_C(8),   "lifetime_power_on_resets"                         },
+    {UINT16_C(1), UINT16_C(16),  "power_on_hours"                                   },
+    {UINT16_C(1), UINT16_C(24),  "logical_sectors_written"                          },
+    {UINT16_C(1), UINT16_C(32),  "write_commands"                                   },
+    {UINT16_C(1), UINT16_C(40),  "logical_sectors_read"                             },
+    {UINT16_C(1), UINT16_C(48),  "read_commands"                                    },
+    {UINT16_C(1), UINT16_C(56),  "date_and_time_timestamp"                          },
+    {UINT16_C(1), UINT16_C(64),  "pending_error_count"                              },
+    {UINT16_C(1), UINT16_C(72),  "workload_utilization"                             },
+    {UINT16_C(1), UINT16_C(80),  "utilization_usage_rate"                           },
+    {UINT16_C(1), UINT16_C(88),  "resource_availability"                            },
+    {UINT16_C(1), UINT16_C(96),  "random_write_resources_used"                      },
+    {UINT16_C(2), UINT16_C(8),   "free_fall_events"                                 },
+    {UINT16_C(2), UINT16_C(16),  "overlimit_shock_events"                           },
+    {UINT16_C(3), UINT16_C(8),   "spindle_motor_power_on_hours"                     },
+    {UINT16_C(3), UINT16_C(16),  "head_flying_hours"                                },
+    {UINT16_C(3), UINT16_C(24),  "head_load_events"                                 },
+    {UINT16_C(3), UINT16_C(32),  "reallocated_logical_sectors"                      },
+    {UINT16_C(3), UINT16_C(40),  "read_recovery_attempts"                           },
+    {UINT16_C(3), UINT16_C(48),  "mechanical_start_failures"                        },
+    {UINT16_C(3), UINT16_C(56),  "reallocation_candidate_logical_sectors"           },
+    {UINT16_C(3), UINT16_C(64),  "high_priority_unload_events"                      },
+    {UINT16_C(4), UINT16_C(8),   "reported_uncorrectable_errors"                    },
+    {UINT16_C(4), UINT16_C(16),  "resets_between_command_acceptance_and_completion" },
+    {UINT16_C(4), UINT16_C(24),  "physical_element_status_changed"                  },
+    {UINT16_C(5), UINT16_C(8),   "current_temperature"                              },
+    {UINT16_C(5), UINT16_C(16),  "average_short_term_temperature"                   },
+    {UINT16_C(5), UINT16_C(24),  "average_long_term_temperature"                    },
+    {UINT16_C(5), UINT16_C(32),  "highest_temperature"                              },
+    {UINT16_C(5), UINT16_C(40),  "lowest_temperature"                               },
+    {UINT16_C(5), UINT16_C(48),  "highest_average_short_term_temperature"           },
+    {UINT16_C(5), UINT16_C(56),  "lowest_average_short_term_temperature"            },
+    {UINT16_C(5), UINT16_C(64),  "highest_average_long_term_temperature"            },
+    {UINT16_C(5), UINT16_C(72),  "lowest_average_long_term_temperature"             },
+    {UINT16_C(5), UINT16_C(80),  "time_in_over_temperature"                         },
+    {UINT16_C(5), UINT16_C(88),  "specified_maximum_operating_temperature"          },
+    {UINT16_C(5), UINT16_C(96),  "time_in_under_temperature"                        },
+    {UINT16_C(5), UINT16_C(104), "specified_minimum_operating_temperature"          },
+    {UINT16_C(6), UINT16_C(8),   "hardware_resets"                                  },
+    {UINT16_C(6), UINT16_C(16),  "asr_events"                                       },
+    {UINT16_C(6), UINT16_C(24),  "interface_crc_errors"                             },
+    {UINT16_C(7), UINT16_C(8),   "percentage_used_endurance_indicator"              },
+};
+
+static const logDiffName logDiffSCSIParameters[] = {
+    {UINT16_C(0x06), UINT16_C(0), "non_medium_errors"                  },
+    {UINT16_C(0x0D), UINT16_C(0), "temperature"                        },
+    {UINT16_C(0x0D), UINT16_C(1), "reference_temperature"              },
+    {UINT16_C(0x0E), UINT16_C(3), "specified_start_stop_cycles"        },
+    {UINT16_C(0x0E), UINT16_C(4), "accumulated_start_stop_cycles"      },
+    {UINT16_C(0x0E), UINT16_C(5), "specified_load_unload_cycles"       },
+    {UINT16_C(0x0E), UINT16_C(6), "accumulated_load_unload_cycles"     },
+    {UINT16_C(0x11), UINT16_C(1), "percentage_used_endurance_indicator"},
+};
+
+// Parameters 0 through 6 of the write (02h), read (03h) and verify (05h) error counter pages
+static const char* logDiffSCSIErrorCounters[] = {
+    "errors_corrected_without_delay", "errors_corrected_with_delay",      "total_rewrites_or_rereads",
+    "total_errors_corrected",         "correction_algorithm_invocations", "bytes_processed",
+    "total_uncorrected_errors"};
+
+// Bit 15 of an identifier is set for vendor specific counters, which are shown by number
+static const logDiffName logDiffSATAPhyEvents[] = {
+    {UINT16_C(0), UINT16_C(0x001), "command_failed_with_icrc_error"                        },
+    {UINT16_C(0), UINT16_C(0x002), "r_err_response_for_data_fis"                           },
+    {UINT16_C(0), UINT16_C(0x003), "r_err_response_for_device_to_host_data_fis"            },
+    {UINT16_C(0), UINT16_C(0x004), "r_err_response_for_host_to_device_data_fis"            },
+    {UINT16_C(0), UINT16_C(0x005), "r_err_response_for_non_data_fis"                       },
+    {UINT16_C(0), UINT16_C(0x006), "r_err_response_for_device_to_host_non_data_fis"        },
+    {UINT16_C(0), UINT16_C(0x007), "r_err_response_for_host_to_device_non_data_fis"        },
+    {UINT16_C(0), UINT16_C(0x008), "device_to_host_non_data_fis_retries"                   },
+    {UINT16_C(0), UINT16_C(0x009), "phyrdy_to_phyrdyn_transitions"                         },
+    {UINT16_C(0), UINT16_C(0x00A), "signature_fis_sent_after_comreset"                     },
+    {UINT16_C(0), UINT16_C(0x00B), "crc_errors_within_host_to_device_fis"                  },
+    {UINT16_C(0), UINT16_C(0x00D), "non_crc_errors_within_host_to_device_fis"              },
+    {UINT16_C(0), UINT16_C(0x00F), "r_err_response_for_host_to_device_data_fis_crc"        },
+    {UINT16_C(0), UINT16_C(0x010), "r_err_response_for_host_to_device_data_fis_non_crc"    },
+    {UINT16_C(0), UINT16_C(0x012), "r_err_response_for_host_to_device_non_data_fis_crc"    },
+    {UINT16_C(0), UINT16_C(0x013), "r_err_response_for_host_to_device_non_data_fis_non_crc"},
+};
+
+static const char* find_Log_Diff_Name(const logDiffName* names, size_t count, const healthMetric* metric)
+{
+    for (size_t nameIter = SIZE_T_C(0); nameIter < count; ++nameIter)
+    {
+        if (names[nameIter].page == metric->page && names[nameIter].index == metric->index)
+        {
+            return names[nameIter].name;
+        }
+    }
+    return M_NULLPTR;
+}
+
+// Known values are shown by name, anything else by page and offset, parameter code or counter identifier
+static void get_Log_Diff_Name(const healthMetric* metric, char* name, size_t nameSize)
+{
+    const char* known = M_NULLPTR;
+    switch (metric->source)
+    {
+    case HEALTH_METRIC_ATA_DEVICE_STATISTIC:
+        known = find_Log_Diff_Name(logDiffATAStatistics, sizeof(logDiffATAStatistics) / sizeof(logDiffATAStatistics[0]),
+                                   metric);
+        if (known == M_NULLPTR)
+        {
+            snprintf_err_handle(name, nameSize, "page %" PRIu16 " offset %" PRIu16, metric->page, metric->index);
+        }
+        break;
+    case HEALTH_METRIC_SCSI_LOG_PARAMETER:
+        if ((metric->page == UINT16_C(0x02) || metric->page == UINT16_C(0x03) || metric->page == UINT16_C(0x05)) &&
+            metric->index < sizeof(logDiffSCSIErrorCounters) / sizeof(logDiffSCSIErrorCounters[0]))
+        {
+            const char* counterPage = metric->page == UINT16_C(0x02)   ? "write"
+                                      : metric->page == UINT16_C(0x03) ? "read"
+                                                                       : "verify";
+            snprintf_err_handle(name, nameSize, "%s_%s", counterPage, logDiffSCSIErrorCounters[metric->index]);
+            return;
+        }
+        known = find_Log_Diff_Name(logDiffSCSIParameters,
+                                   sizeof(logDiffSCSIParameters) / sizeof(logDiffSCSIParameters[0]), metric);
+        if (known == M_NULLPTR)
+        {
+            snprintf_err_handle(name, nameSize, "parameter %04" PRIX16 "h", metric->index);
+        }
+        break;
+    case HEALTH_METRIC_SATA_PHY_EVENT:
+        known = find_Log_Diff_Name(logDiffSATAPhyEvents, sizeof(logDiffSATAPhyEvents) / sizeof(logDiffSATAPhyEvents[0]),
+                                   metric);
+        if (known == M_NULLPTR)
+        {
+            snprintf_err_handle(name, nameSize, "counter %03" PRIX16 "h", metric->index);
+        }
+        break;
+    default:
+        known = get_Health_Metric_Name(metric);
+        break;
+    }
+    if (known != M_NULLPTR)
+    {
+        snprintf_err_handle(name, nameSize, "%s", known);
+    }
+}
+
+static eReturnValues add_SATA_Phy_Event_Metrics(healthSample* sample, const uint8_t* log)
+{
+    eReturnValues ret    = SUCCESS;
+    uint32_t      offset = UINT32_C(4);
+    while (offset + UINT32_C(2) <= LOG_SNAPSHOT_PHY_EVENT_CHECKSUM && ret == SUCCESS)
+    {
+        uint16_t identifier = M_BytesTo2ByteValue(log[offset + 1], log[offset]);
+        // bits 14:12 are the length of the value in words
+        uint8_t length = C_CAST(uint8_t, M_GETBITRANGE(identifier, 14, 12) * 2);
+        if (identifier == UINT16_C(0))
+        {
+            // end of the list
+            break;
+        }
+        if (length == UINT8_C(0) || length > UINT8_C(8) ||
+            offset + UINT32_C(2) + length > LOG_SNAPSHOT_PHY_EVENT_CHECKSUM)
+        {
+            break;
+        }
+        ret = add_Health_Metric(sample, HEALTH_METRIC_SATA_PHY_EVENT, HEALTH_METRIC_COUNTER, UINT16_C(0),
+                                identifier & UINT16_C(0x8FFF),
+                                get_Health_Little_Endian_Value(&log[offset + 2], length));
+        offset += UINT32_C(2) + length;
+    }
+    return ret;
+}
+
+// The SATA phy event counters log has a checksum in its last byte and reserved bytes ahead of the first counter
+static bool is_SATA_Phy_Event_Log(const uint8_t* log, size_t length)
+{
+    uint8_t checksum = UINT8_C(0);
+    if (length != LOG_SNAPSHOT_BLOCK_SIZE || log[0] != 0 || log[1] != 0 || log[2] != 0 || log[3] != 0)
+    {
+        return false;
+    }
+    for (size_t iter = SIZE_T_C(0); iter < length; ++iter)
+    {
+        checksum = C_CAST(uint8_t, checksum + log[iter]);
+    }
+    return checksum == UINT8_C(0);
+}
+
+// A device statistics log pull starts with page 0, the list of supported pages, with revision 1 in its header
+static bool is_ATA_Device_Statistics_Log(const uint8_t* log, size_t length)
+{
+    return length % LOG_SNAPSHOT_BLOCK_SIZE == SIZE_T_C(0) && log[0] == UINT8_C(1) && log[1] == UINT8_C(0) &&
+           log[2] == UINT8_C(0);
+}
+
+// Only layouts with a signature, checksum or self describing length are identified. A 512 byte file that is none of
+// them is not assumed to be an NVMe SMART / health log.
+static eLogSnapshotFormat identify_Log_Snapshot(const uint8_t* log, size_t length)
+{
+    if (length == SIZE_T_C(4) + M_BytesTo2ByteValue(log[2], log[3]))
+    {
+        // a SCSI log page is exactly as long as its header says
+        return LOG_SNAPSHOT_SCSI_LOG_PAGE;
+    }
+    else if (is_ATA_Device_Statistics_Log(log, length))
+    {
+        return LOG_SNAPSHOT_ATA_DEVICE_STATISTICS;
+    }
+    else if (is_SATA_Phy_Event_Log(log, length))
+    {
+        return LOG_SNAPSHOT_SATA_PHY_EVENTS;
+    }
+    return LOG_SNAPSHOT_UNKNOWN;
+}
+
+eReturnValues read_Log_Snapshot(const char* fileName, eLogSnapshotFormat format, logSnapshot* snapshot)
+{
+    eReturnValues   ret       = SUCCESS;
+    uint8_t*        log       = M_NULLPTR;
+    size_t          length    = SIZE_T_C(0);
+    size_t          readCount = SIZE_T_C(0);
+    secureFileInfo* file      = M_NULLPTR;
+    if (fileName == M_NULLPTR || snapshot == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    safe_memset(snapshot, sizeof(logSnapshot), 0, sizeof(logSnapshot));
+    file = secure_Open_File(fileName, "rb", M_NULLPTR, M_NULLPTR, M_NULLPTR);
+    if (file == M_NULLPTR || file->error != SEC_FILE_SUCCESS)
+    {
+        ret = (file != M_NULLPTR && file->error == SEC_FILE_INSECURE_PATH) ? INSECURE_PATH : FILE_OPEN_ERROR;
+        free_Secure_File_Info(&file);
+        return ret;
+    }
+    length = file->fileSize;
+    if (length <= SIZE_T_C(4) || length > LOG_SNAPSHOT_MAX_FILE_SIZE)
+    {
+        ret = VALIDATION_FAILURE;
+    }
+    else if (M_NULLPTR == (log = C_CAST(uint8_t*, safe_calloc(length, sizeof(uint8_t)))))
+    {
+        ret = MEMORY_FAILURE;
+    }
+    else if (SEC_FILE_SUCCESS != secure_Read_File(file, log, length, sizeof(uint8_t), length, &readCount) ||
+             readCount != length)
+    {
+        ret = FAILURE;
+    }
+    else
+    {
+        eLogSnapshotFormat found = identify_Log_Snapshot(log, length);
+        if (format == LOG_SNAPSHOT_NVME_HEALTH)
+        {
+            // only the length can be checked
+            found = length == LOG_SNAPSHOT_BLOCK_SIZE ? LOG_SNAPSHOT_NVME_HEALTH : LOG_SNAPSHOT_UNKNOWN;
+        }
+        else if (format != LOG_SNAPSHOT_UNKNOWN && format != found)
+        {
+            found = LOG_SNAPSHOT_UNKNOWN;
+        }
+        snapshot->format = found;
+        switch (found)
+        {
+        case LOG_SNAPSHOT_SCSI_LOG_PAGE:
+            snapshot->page    = M_GETBITRANGE(log[0], 5, 0);
+            snapshot->subpage = (log[0] & BIT6) ? log[1] : UINT8_C(0);
+            ret               = add_SCSI_Log_Page_Metrics(&snapshot->sample, log, C_CAST(uint32_t, length));
+            break;
+        case LOG_SNAPSHOT_ATA_DEVICE_STATISTICS:
+            ret = add_ATA_Device_Statistics_Metrics(&snapshot->sample, log,
+                                                    M_Min(C_CAST(uint32_t, length / LOG_SNAPSHOT_BLOCK_SIZE),
+                                                          HEALTH_ATA_DEVICE_STATISTICS_MAX_PAGE + UINT32_C(1)));
+            break;
+        case LOG_SNAPSHOT_SATA_PHY_EVENTS:
+            ret = add_SATA_Phy_Event_Metrics(&snapshot->sample, log);
+            break;
+        case LOG_SNAPSHOT_NVME_HEALTH:
+            ret = add_NVMe_Health_Metrics(&snapshot->sample, log);
+            break;
+        case LOG_SNAPSHOT_UNKNOWN:
+            ret = VALIDATION_FAILURE;
+            break;
+        }
+    }
+    if (ret == SUCCESS &&
+        (snapshot->format == LOG_SNAPSHOT_ATA_DEVICE_STATISTICS || snapshot->format == LOG_SNAPSHOT_NVME_HEALTH))
+    {
+        // power on hours give the elapsed time between two pulls without relying on file times
+        const healthMetric* found = M_NULLPTR;
+        healthMetric        powerOnHours;
+        safe_memset(&powerOnHours, sizeof(healthMetric), 0, sizeof(healthMetric));
+        if (snapshot->format == LOG_SNAPSHOT_ATA_DEVICE_STATISTICS)
+        {
+            powerOnHours.source = HEALTH_METRIC_ATA_DEVICE_STATISTIC;
+            powerOnHours.page   = LOG_SNAPSHOT_ATA_POH_PAGE;
+            powerOnHours.index  = LOG_SNAPSHOT_ATA_POH_OFFSET;
+        }
+        else
+        {
+            powerOnHours.source = HEALTH_METRIC_NVME_HEALTH;
+            powerOnHours.index  = LOG_SNAPSHOT_NVME_POH_OFFSET;
+        }
+        found = find_Health_Metric(&snapshot->sample, &powerOnHours, UINT32_C(0));
+        if (found != M_NULLPTR)
+        {
+            snapshot->hasPowerOnHours = true;
+            snapshot->powerOnHours    = found->value;
+        }
+    }
+    else if (ret != SUCCESS)
+    {
+        free_Health_Sample(&snapshot->sample);
+    }
+    safe_free(&log);
+    secure_Close_File(file);
+    free_Secure_File_Info(&file);
+    return ret;
+}
+
+void free_Log_Snapshot(logSnapshot* snapshot)
+{
+    if (snapshot != M_NULLPTR)
+    {
+        free_Health_Sample(&snapshot->sample);
+    }
+}
+
+bool is_Same_Log_Snapshot(const logSnapshot* baseline, const logSnapshot* current)
+{
+    return baseline->format == current->format &&
+           (current->format != LOG_SNAPSHOT_SCSI_LOG_PAGE ||
+            (baseline->page == current->page && baseline->subpage == current->subpage));
+}
+
+static const char* get_Log_Snapshot_Format_Name(const logSnapshot* snapshot)
+{
+    switch (snapshot->format)
+    {
+    case LOG_SNAPSHOT_SCSI_LOG_PAGE:
+        return "SCSI log page";
+    case LOG_SNAPSHOT_ATA_DEVICE_STATISTICS:
+        return "ATA device statistics";
+    case LOG_SNAPSHOT_SATA_PHY_EVENTS:
+        return "SATA phy event counters";
+    case LOG_SNAPSHOT_NVME_HEALTH:
+        return "NVMe SMART / health information";
+    case LOG_SNAPSHOT_UNKNOWN:
+        break;
+    }
+    return "unknown";
+}
+
+// An hour count given on the command line wins over the power on hours in the logs
+static uint64_t get_Log_Diff_Hours(const logSnapshot* baseline, const logSnapshot* current, uint32_t hours)
+{
+    if (hours > UINT32_C(0))
+    {
+        return hours;
+    }
+    if (baseline->hasPowerOnHours && current->hasPowerOnHours && current->powerOnHours > baseline->powerOnHours)
+    {
+        return current->powerOnHours - baseline->powerOnHours;
+    }
+    return UINT64_C(0);
+}
+
+void print_Log_Diff(const logSnapshot* baseline,
+                    const logSnapshot* current,
+                    uint32_t           hours,
+                    const char*        baselineName,
+                    const char*        currentName)
+{
+    uint64_t elapsed   = get_Log_Diff_Hours(baseline, current, hours);
+    uint32_t unchanged = UINT32_C(0);
+    DECLARE_ZERO_INIT_ARRAY(char, name, LOG_DIFF_NAME_LENGTH);
+    printf("\nChanges in the %s", get_Log_Snapshot_Format_Name(current));
+    if (current->format == LOG_SNAPSHOT_SCSI_LOG_PAGE)
+    {
+        printf(" %02" PRIX8 "h", current->page);
+        if (current->subpage != UINT8_C(0))
+        {
+            printf(" subpage %02" PRIX8 "h", current->subpage);
+        }
+    }
+    printf(" from %s to %s\n", baselineName, currentName);
+    if (elapsed > UINT64_C(0))
+    {
+        printf("Rates are per hour over %" PRIu64 " %shours\n", elapsed, hours > UINT32_C(0) ? "" : "power on ");
+    }
+    else
+    {
+        print_str("No elapsed time in these logs. Add --" LOG_DIFF_HOURS_LONG_OPT_STRING " for rates.\n");
+    }
+    printf("%-44s %16s %16s %16s %14s\n", "Name", "Baseline", "Current", "Delta", "Per Hour");
+    for (uint32_t metricIter = UINT32_C(0); metricIter < current->sample.count; ++metricIter)
+    {
+        const healthMetric* metric = &current->sample.metrics[metricIter];
+        const healthMetric* before = find_Health_Metric(&baseline->sample, metric, metricIter);
+        if (before == M_NULLPTR || before->value == metric->value)
+        {
+            ++unchanged;
+            continue;
+        }
+        get_Log_Diff_Name(metric, name, LOG_DIFF_NAME_LENGTH);
+        printf("%-44s %16" PRIu64 " %16" PRIu64 " %16" PRId64, name, before->value, metric->value,
+               C_CAST(int64_t, metric->value - before->value));
+        if (metric->type == HEALTH_METRIC_COUNTER && elapsed > UINT64_C(0))
+        {
+            printf(" %14.3f",
+                   (C_CAST(double, metric->value) - C_CAST(double, before->value)) / C_CAST(double, elapsed));
+        }
+        print_str("\n");
+    }
+    printf("%" PRIu32 " of %" PRIu32 " values unchanged\n", unchanged, current->sample.count);
+}
+
+void write_JSON_Log_Diff(jsonStream*        json,
+                         const char*        key,
+                         const logSnapshot* baseline,
+                         const logSnapshot* current,
+                         uint32_t           hours,
+                         const char*        baselineName,
+                         const char*        currentName)
+{
+    uint64_t elapsed   = get_Log_Diff_Hours(baseline, current, hours);
+    uint32_t unchanged = UINT32_C(0);
+    DECLARE_ZERO_INIT_ARRAY(char, name, LOG_DIFF_NAME_LENGTH);
+    begin_JSON_Object(json, key);
+    write_JSON_String(json, "format", get_Log_Snapshot_Format_Name(current));
+    if (current->format == LOG_SNAPSHOT_SCSI_LOG_PAGE)
+    {
+        write_JSON_Unsigned(json, "page", current->page);
+        write_JSON_Unsigned(json, "subpage", current->subpage);
+    }
+    write_JSON_String(json, "baseline", baselineName);
+    write_JSON_String(json, "current", currentName);
+    if (elapsed > UINT64_C(0))
+    {
+        write_JSON_Unsigned(json, "hours", elapsed);
+    }
+    else
+    {
+        write_JSON_Null(json, "hours");
+    }
+    begin_JSON_Array(json, "changed");
+    for (uint32_t metricIter = UINT32_C(0); metricIter < current->sample.count; ++metricIter)
+    {
+        const healthMetric* metric = &current->sample.metrics[metricIter];
+        const healthMetric* before = find_Health_Metric(&baseline->sample, metric, metricIter);
+        if (before == M_NULLPTR || before->value == metric->value)
+        {
+            ++unchanged;
+            continue;
+        }
+        get_Log_Diff_Name(metric, name, LOG_DIFF_NAME_LENGTH);
+        begin_JSON_Object(json, M_NULLPTR);
+        write_JSON_String(json, "name", name);
+        write_JSON_Unsigned(json, "page", metric->page);
+        write_JSON_Unsigned(json, "index", metric->index);
+        write_JSON_String(json, "type", get_JSON_Metric_Type(metric));
+        write_JSON_Unsigned(json, "baseline", before->value);
+        write_JSON_Unsigned(json, "current", metric->value);
+        write_JSON_Signed(json, "delta", C_CAST(int64_t, metric->value - before->value));
+        if (metric->type == HEALTH_METRIC_COUNTER && elapsed > UINT64_C(0))
+        {
+            write_JSON_Double(json, "perHour",
+                              (C_CAST(double, metric->value) - C_CAST(double, before->value)) /
+                                  C_CAST(double, elapsed));
+        }
+        else
+        {
+            write_JSON_Null(json, "perHour");
+        }
+        end_JSON_Object(json);
+    }
+    end_JSON_Array(json);
+    write_JSON_Unsigned(json, "unchanged", unchanged);
+    end_JSON_Object(json);
+}
@@ -0,0 +1,397 @@
+// SPDX-License-Identifier: MPL-2.0
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2014-2025 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file openseachest_prometheus.c
+// \brief This file implements the Prometheus textfile exporter for health samples.
+
+#include "common_types.h"
+#include "io_utils.h"
+#include "memory_safety.h"
+#include "string_utils.h"
+#include "time_utils.h"
+#include "type_conversion.h"
+
+#include "openseachest_prometheus.h"
+
+#define PROMETHEUS_METRIC_PREFIX   "openseachest_"
+#define PROMETHEUS_BUFFER_SIZE     SIZE_T_C(65536)
+#define PROMETHEUS_LINE_LENGTH     SIZE_T_C(1024)
+#define PROMETHEUS_LABELS_LENGTH   SIZE_T_C(768)
+#define PROMETHEUS_TEMP_EXTENSION  "tmp"
+
+// Label values escape backslash, double quote and line feed. Anything else that is not printable is dropped.
+static void append_Prometheus_Label(char* labels, size_t* used, const char* name, const char* value)
+{
+    size_t valueLength = safe_strlen(value);
+    if (*used > SIZE_T_C(0) && *used < PROMETHEUS_LABELS_LENGTH - 1)
+    {
+        labels[(*used)++] = ',';
+    }
+    for (size_t iter = SIZE_T_C(0); name[iter] != '\0' && *used < PROMETHEUS_LABELS_LENGTH - 1; ++iter)
+    {
+        labels[(*used)++] = name[iter];
+    }
+    if (*used + SIZE_T_C(2) < PROMETHEUS_LABELS_LENGTH)
+    {
+        labels[(*used)++] = '=';
+        labels[(*used)++] = '"';
+    }
+    // trailing spaces of padded identify data are not part of the value
+    while (valueLength > SIZE_T_C(0) && value[valueLength - 1] == ' ')
+    {
+        --valueLength;
+    }
+    // leave room for an escape, the closing quote and the terminator
+    for (size_t iter = SIZE_T_C(0); iter < valueLength && *used + SIZE_T_C(4) < PROMETHEUS_LABELS_LENGTH; ++iter)
+    {
+        char character = value[iter];
+        if (character == '\\' || character == '"')
+        {
+            labels[(*used)++] = '\\';
+            labels[(*used)++] = character;
+        }
+        else if (character == '\n')
+        {
+            labels[(*used)++] = '\\';
+            labels[(*used)++] = 'n';
+        }
+        else if (safe_isprint(character))
+        {
+            labels[(*used)++] = character;
+        }
+    }
+    if (*used < PROMETHEUS_LABELS_LENGTH - 1)
+    {
+        labels[(*used)++] = '"';
+    }
+    labels[*used] = '\0';
+}
+
+eReturnValues add_Health_Export_Drive(healthExport* exporter, tDevice* device)
+{
+    eReturnValues      ret   = SUCCESS;
+    healthExportDrive* drive = M_NULLPTR;
+    size_t             used  = SIZE_T_C(0);
+    DECLARE_ZERO_INIT_ARRAY(char, worldWideName, 20);
+    if (exporter == M_NULLPTR || device == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    if (exporter->count == exporter->capacity)
+    {
+        uint32_t           newCapacity = exporter->capacity == UINT32_C(0) ? UINT32_C(16) : exporter->capacity * 2;
+        healthExportDrive* newDrives   = M_NULLPTR;
+        newDrives = C_CAST(healthExportDrive*,
+                           safe_realloc(exporter->drives, C_CAST(size_t, newCapacity) * sizeof(healthExportDrive)));
+        if (newDrives == M_NULLPTR)
+        {
+            return MEMORY_FAILURE;
+        }
+        exporter->drives   = newDrives;
+        exporter->capacity = newCapacity;
+    }
+    drive = &exporter->drives[exporter->count];
+    safe_memset(drive, sizeof(healthExportDrive), 0, sizeof(healthExportDrive));
+    drive->labels = C_CAST(char*, safe_calloc(PROMETHEUS_LABELS_LENGTH, sizeof(char)));
+    if (drive->labels == M_NULLPTR)
+    {
+        return MEMORY_FAILURE;
+    }
+    if (device->drive_info.worldWideName != UINT64_C(0))
+    {
+        snprintf_err_handle(worldWideName, 20, "%016" PRIX64, device->drive_info.worldWideName);
+    }
+    append_Prometheus_Label(drive->labels, &used, "device", device->os_info.name);
+    append_Prometheus_Label(drive->labels, &used, "serial", device->drive_info.serialNumber);
+    append_Prometheus_Label(drive->labels, &used, "model", device->drive_info.product_identification);
+    append_Prometheus_Label(drive->labels, &used, "firmware", device->drive_info.product_revision);
+    append_Prometheus_Label(drive->labels, &used, "wwn", worldWideName);
+    ++exporter->count;
+    ret            = read_Health_Sample(device, &drive->sample);
+    drive->sampled = ret == SUCCESS;
+    return ret;
+}
+
+typedef struct s_prometheusWriter
+{
+    secureFileInfo* file;
+    char*           buffer;
+    size_t          used;
+    eReturnValues   ret;
+} prometheusWriter;
+
+static void flush_Prometheus_Writer(prometheusWriter* writer)
+{
+    if (writer->ret == SUCCESS && writer->used > SIZE_T_C(0) &&
+        SEC_FILE_SUCCESS !=
+            secure_Write_File(writer->file, writer->buffer, PROMETHEUS_BUFFER_SIZE, sizeof(char), writer->used,
+                              M_NULLPTR))
+    {
+        writer->ret = ERROR_WRITING_FILE;
+    }
+    writer->used = SIZE_T_C(0);
+}
+
+// Lines are collected in a large buffer so a fleet of drives is written in a few hundred writes, not one per line.
+static void write_Prometheus_Line(prometheusWriter* writer, const char* line)
+{
+    size_t length = safe_strlen(line);
+    if (writer->used + length > PROMETHEUS_BUFFER_SIZE)
+    {
+        flush_Prometheus_Writer(writer);
+    }
+    safe_memcpy(&writer->buffer[writer->used], PROMETHEUS_BUFFER_SIZE - writer->used, line, length);
+    writer->used += length;
+}
+
+static const char* get_Prometheus_Help(const healthMetric* metric)
+{
+    switch (metric->source)
+    {
+    case HEALTH_METRIC_ATA_SMART_RAW:
+        return "ATA SMART attribute raw value.";
+    case HEALTH_METRIC_ATA_SMART_NORMALIZED:
+        return "ATA SMART attribute current normalized value.";
+    case HEALTH_METRIC_ATA_DEVICE_STATISTIC:
+        return "ATA device statistics log value.";
+    case HEALTH_METRIC_NVME_HEALTH:
+        return "NVMe SMART / health information log field.";
+    case HEALTH_METRIC_SCSI_LOG_PARAMETER:
+        return "SCSI log page parameter value.";
+    case HEALTH_METRIC_SATA_PHY_EVENT:
+        return "SATA phy event counter.";
+    }
+    return "Health metric.";
+}
+
+// The labels that identify the metric within its family
+static void get_Prometheus_Metric_Labels(const healthMetric* metric, char* labels, size_t labelsSize)
+{
+    switch (metric->source)
+    {
+    case HEALTH_METRIC_ATA_SMART_RAW:
+    case HEALTH_METRIC_ATA_SMART_NORMALIZED:
+        snprintf_err_handle(labels, labelsSize, ",attribute=\"%" PRIu16 "\"", metric->index);
+        break;
+    case HEALTH_METRIC_ATA_DEVICE_STATISTIC:
+        snprintf_err_handle(labels, labelsSize, ",page=\"%" PRIu16 "\",offset=\"%" PRIu16 "\"", metric->page,
+                            metric->index);
+        break;
+    case HEALTH_METRIC_SCSI_LOG_PARAMETER:
+        snprintf_err_handle(labels, labelsSize, ",page=\"%" PRIu16 "\",parameter=\"%" PRIu16 "\"", metric->page,
+                            metric->index);
+        break;
+    case HEALTH_METRIC_SATA_PHY_EVENT:
+        snprintf_err_handle(labels, labelsSize, ",counter=\"%" PRIu16 "\"", metric->index);
+        break;
+    case HEALTH_METRIC_NVME_HEALTH:
+        labels[0] = '\0';
+        break;
+    }
+}
+
+static bool is_Same_Prometheus_Family(const healthMetric* first, const healthMetric* second)
+{
+    return first->type == second->type &&
+           strcmp(get_Health_Metric_Name(first), get_Health_Metric_Name(second)) == 0;
+}
+
+// A metric family has one name and type. The same source can be in two families when some of its values are
+// gauges (such as the temperature SMART attributes) and others counters.
+static eReturnValues get_Prometheus_Families(const healthExport* exporter,
+                                             healthMetric**      families,
+                                             uint32_t*           familyCount)
+{
+    uint32_t capacity = UINT32_C(0);
+    uint32_t last     = UINT32_C(0);
+    *families         = M_NULLPTR;
+    *familyCount      = UINT32_C(0);
+    for (uint32_t driveIter = UINT32_C(0); driveIter < exporter->count; ++driveIter)
+    {
+        const healthSample* sample = &exporter->drives[driveIter].sample;
+        for (uint32_t metricIter = UINT32_C(0); exporter->drives[driveIter].sampled && metricIter < sample->count;
+             ++metricIter)
+        {
+            const healthMetric* metric = &sample->metrics[metricIter];
+            bool                found  = false;
+            // metrics of a family are next to each other, so the last family usually matches
+            if (last < *familyCount && is_Same_Prometheus_Family(&(*families)[last], metric))
+            {
+                continue;
+            }
+            for (uint32_t familyIter = UINT32_C(0); familyIter < *familyCount && !found; ++familyIter)
+            {
+                if (is_Same_Prometheus_Family(&(*families)[familyIter], metric))
+                {
+                    found = true;
+                    last  = familyIter;
+                }
+            }
+            if (found)
+            {
+                continue;
+            }
+            if (*familyCount == capacity)
+            {
+                uint32_t      newCapacity = capacity == UINT32_C(0) ? UINT32_C(16) : capacity * UINT32_C(2);
+                healthMetric* newFamilies = C_CAST(
+                    healthMetric*, safe_realloc(*families, C_CAST(size_t, newCapacity) * sizeof(healthMetric)));
+                if (newFamilies == M_NULLPTR)
+                {
+                    safe_free(families);
+                    *familyCount = UINT32_C(0);
+                    return MEMORY_FAILURE;
+                }
+                *families = newFamilies;
+                capacity  = newCapacity;
+            }
+            (*families)[*familyCount] = *metric;
+            last                      = *familyCount;
+            ++(*familyCount);
+        }
+    }
+    return SUCCESS;
+}
+
+static void write_Prometheus_Families(prometheusWriter* writer, const healthExport* exporter)
+{
+    healthMetric* families    = M_NULLPTR;
+    uint32_t      familyCount = UINT32_C(0);
+    DECLARE_ZERO_INIT_ARRAY(char, line, PROMETHEUS_LINE_LENGTH);
+    DECLARE_ZERO_INIT_ARRAY(char, metricLabels, 64);
+    write_Prometheus_Line(writer, "# HELP " PROMETHEUS_METRIC_PREFIX
+                                  "health_sample_success 1 if the health pages of the drive could be read.\n");
+    write_Prometheus_Line(writer, "# TYPE " PROMETHEUS_METRIC_PREFIX "health_sample_success gauge\n");
+    for (uint32_t driveIter = UINT32_C(0); driveIter < exporter->count; ++driveIter)
+    {
+        snprintf_err_handle(line, PROMETHEUS_LINE_LENGTH, PROMETHEUS_METRIC_PREFIX "health_sample_success{%s} %d\n",
+                            exporter->drives[driveIter].labels, exporter->drives[driveIter].sampled ? 1 : 0);
+        write_Prometheus_Line(writer, line);
+    }
+    write_Prometheus_Line(writer, "# HELP " PROMETHEUS_METRIC_PREFIX
+                                  "health_sample_timestamp_seconds When the health pages were read.\n");
+    write_Prometheus_Line(writer, "# TYPE " PROMETHEUS_METRIC_PREFIX "health_sample_timestamp_seconds gauge\n");
+    for (uint32_t driveIter = UINT32_C(0); driveIter < exporter->count; ++driveIter)
+    {
+        if (exporter->drives[driveIter].sampled)
+        {
+            snprintf_err_handle(line, PROMETHEUS_LINE_LENGTH,
+                                PROMETHEUS_METRIC_PREFIX "health_sample_timestamp_seconds{%s} %" PRIu64 "\n",
+                                exporter->drives[driveIter].labels, exporter->drives[driveIter].sample.timestamp);
+            write_Prometheus_Line(writer, line);
+        }
+    }
+    if (SUCCESS != get_Prometheus_Families(exporter, &families, &familyCount))
+    {
+        writer->ret = MEMORY_FAILURE;
+        return;
+    }
+    for (uint32_t familyIter = UINT32_C(0); familyIter < familyCount && writer->ret == SUCCESS; ++familyIter)
+    {
+        const healthMetric* family = &families[familyIter];
+        const char*         suffix = family->type == HEALTH_METRIC_COUNTER ? "_total" : "";
+        const char*         name   = get_Health_Metric_Name(family);
+        snprintf_err_handle(line, PROMETHEUS_LINE_LENGTH, "# HELP " PROMETHEUS_METRIC_PREFIX "%s%s %s\n", name, suffix,
+                            get_Prometheus_Help(family));
+        write_Prometheus_Line(writer, line);
+        snprintf_err_handle(line, PROMETHEUS_LINE_LENGTH, "# TYPE " PROMETHEUS_METRIC_PREFIX "%s%s %s\n", name, suffix,
+                            family->type == HEALTH_METRIC_COUNTER ? "counter" : "gauge");
+        write_Prometheus_Line(writer, line);
+        for (uint32_t driveIter = UINT32_C(0); driveIter < exporter->count; ++driveIter)
+        {
+            const healthExportDrive* drive = &exporter->drives[driveIter];
+            for (uint32_t metricIter = UINT32_C(0); drive->sampled && metricIter < drive->sample.count; ++metricIter)
+            {
+                const healthMetric* metric = &drive->sample.metrics[metricIter];
+                if (!is_Same_Prometheus_Family(family, metric))
+                {
+                    continue;
+                }
+                get_Prometheus_Metric_Labels(metric, metricLabels, 64);
+                snprintf_err_handle(line, PROMETHEUS_LINE_LENGTH, PROMETHEUS_METRIC_PREFIX "%s%s{%s%s} %" PRIu64 "\n",
+                                    name, suffix, drive->labels, metricLabels, metric->value);
+                write_Prometheus_Line(writer, line);
+            }
+        }
+    }
+    safe_free(&families);
+}
+
+eReturnValues write_Prometheus_Health_File(const healthExport* exporter, const char* fileName)
+{
+    prometheusWriter writer;
+    DECLARE_ZERO_INIT_ARRAY(char, tempName, OPENSEA_PATH_MAX);
+    if (exporter == M_NULLPTR || fileName == M_NULLPTR || safe_strlen(fileName) == SIZE_T_C(0))
+    {
+        return BAD_PARAMETER;
+    }
+    safe_memset(&writer, sizeof(prometheusWriter), 0, sizeof(prometheusWriter));
+    // the textfile collector only reads *.prom, so it ignores the file until it is renamed
+    snprintf_err_handle(tempName, OPENSEA_PATH_MAX, "%s.%s", fileName, PROMETHEUS_TEMP_EXTENSION);
+    writer.buffer = C_CAST(char*, safe_calloc(PROMETHEUS_BUFFER_SIZE, sizeof(char)));
+    if (writer.buffer == M_NULLPTR)
+    {
+        return MEMORY_FAILURE;
+    }
+    writer.file = secure_Open_File(tempName, "wb", M_NULLPTR, M_NULLPTR, M_NULLPTR);
+    if (writer.file == M_NULLPTR || writer.file->error != SEC_FILE_SUCCESS)
+    {
+        eReturnValues ret = FILE_OPEN_ERROR;
+        if (writer.file != M_NULLPTR && writer.file->error == SEC_FILE_INSECURE_PATH)
+        {
+            ret = INSECURE_PATH;
+        }
+        free_Secure_File_Info(&writer.file);
+        safe_free(&writer.buffer);
+        return ret;
+    }
+    write_Prometheus_Families(&writer, exporter);
+    flush_Prometheus_Writer(&writer);
+    if (writer.ret == SUCCESS && SEC_FILE_SUCCESS != secure_Flush_File(writer.file))
+    {
+        writer.ret = ERROR_WRITING_FILE;
+    }
+    secure_Close_File(writer.file);
+    free_Secure_File_Info(&writer.file);
+    safe_free(&writer.buffer);
+    if (writer.ret == SUCCESS)
+    {
+#if defined(_WIN32)
+        // rename does not replace an existing file on Windows
+        remove(fileName);
+#endif
+        if (rename(tempName, fileName) != 0)
+        {
+            writer.ret = ERROR_WRITING_FILE;
+        }
+    }
+    if (writer.ret != SUCCESS)
+    {
+        remove(tempName);
+    }
+    return writer.ret;
+}
+
+void free_Health_Export(healthExport* exporter)
+{
+    if (exporter != M_NULLPTR)
+    {
+        for (uint32_t driveIter = UINT32_C(0); driveIter < exporter->count; ++driveIter)
+        {
+            safe_free(&exporter->drives[driveIter].labels);
+            free_Health_Sample(&exporter->drives[driveIter].sample);
+        }
+        safe_free(&exporter->drives);
+        exporter->count    = UINT32_C(0);
+        exporter->capacity = UINT32_C(0);
+    }
+}
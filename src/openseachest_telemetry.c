@@ -0,0 +1,706 @@
+// SPDX-License-Identifier: MPL-2.0
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2014-2025 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file openseachest_telemetry.c
+// \brief This file implements streamed telemetry log pulls.
+
+#include "common_types.h"
+#include "io_utils.h"
+#include "memory_safety.h"
+#include "string_utils.h"
+#include "time_utils.h"
+#include "type_conversion.h"
+
+#include "openseachest_telemetry.h"
+#include "openseachest_async_writer.h"
+#include "openseachest_log_compression.h"
+
+#include "ata_helper_func.h"
+#include "logs.h"
+#include "nvme_helper_func.h"
+
+#define TELEMETRY_STREAM_BUFFER_COUNT      UINT32_C(3)
+#define TELEMETRY_STREAM_DEFAULT_TRANSFER  UINT32_C(65536)
+#define TELEMETRY_BLOCK_SIZE               UINT32_C(512)
+#define TELEMETRY_NVME_HOST_INITIATED_LOG  UINT8_C(0x07)
+#define TELEMETRY_NVME_CTRL_INITIATED_LOG  UINT8_C(0x08)
+#define TELEMETRY_ATA_CURRENT_INTERNAL_LOG UINT8_C(0x24)
+#define TELEMETRY_ATA_SAVED_INTERNAL_LOG   UINT8_C(0x25)
+#define TELEMETRY_ATA_MAX_DATA_AREA        UINT8_C(3)
+#define TELEMETRY_NVME_MAX_DATA_AREA       UINT8_C(4)
+
+// Reads one transfer of the telemetry log. offsetBlocks and blockCount are in 512 byte units for both ATA pages and
+// NVMe log page offsets. createNewData asks the device to capture new host initiated/current data and is only set on
+// the first read of the header.
+static eReturnValues read_Telemetry_Blocks(tDevice* device,
+                                           uint8_t  logAddress,
+                                           uint64_t offsetBlocks,
+                                           uint32_t blockCount,
+                                           bool     createNewData,
+                                           uint8_t* buffer)
+{
+    uint32_t length = blockCount * TELEMETRY_BLOCK_SIZE;
+    if (device->drive_info.drive_type == NVME_DRIVE)
+    {
+        nvmeGetLogPageCmdOpts cmdOpts;
+        safe_memset(&cmdOpts, sizeof(nvmeGetLogPageCmdOpts), 0, sizeof(nvmeGetLogPageCmdOpts));
+        cmdOpts.nsid    = NVME_ALL_NAMESPACES;
+        cmdOpts.lid     = logAddress;
+        cmdOpts.lsp     = createNewData ? UINT8_C(1) : UINT8_C(0);
+        cmdOpts.offset  = offsetBlocks * TELEMETRY_BLOCK_SIZE;
+        cmdOpts.addr    = buffer;
+        cmdOpts.dataLen = length;
+        return nvme_Get_Log_Page(device, &cmdOpts);
+    }
+    return send_ATA_Read_Log_Ext_Cmd(device, logAddress, C_CAST(uint16_t, offsetBlocks), buffer, length,
+                                     createNewData ? UINT16_C(1) : UINT16_C(0));
+}
+
+// Returns the number of 512 byte blocks in the log up through the requested data area, including the header block.
+static uint64_t get_Telemetry_Log_Blocks(tDevice* device, const uint8_t* header, uint8_t dataArea)
+{
+    uint64_t lastBlock = UINT64_C(0);
+    switch (dataArea)
+    {
+    case 4:
+        if (device->drive_info.drive_type == NVME_DRIVE)
+        {
+            lastBlock = M_BytesTo4ByteValue(header[19], header[18], header[17], header[16]);
+        }
+        if (lastBlock > UINT64_C(0))
+        {
+            break;
+        }
+        // extended data area not enabled, so area 3 is the last one available
+        M_FALLTHROUGH;
+    case 3:
+        lastBlock = M_BytesTo2ByteValue(header[13], header[12]);
+        break;
+    case 2:
+        lastBlock = M_BytesTo2ByteValue(header[11], header[10]);
+        break;
+    default:
+        lastBlock = M_BytesTo2ByteValue(header[9], header[8]);
+        break;
+    }
+    return lastBlock + UINT64_C(1);
+}
+
+#if defined(_WIN32)
+#    define TELEMETRY_PATH_SEPARATOR '\\'
+#else
+#    define TELEMETRY_PATH_SEPARATOR '/'
+#endif
+
+#define TELEMETRY_TRANSFER_RETRIES         UINT32_C(3)
+#define TELEMETRY_CHECKPOINT_TRANSFERS     UINT32_C(16)
+#define TELEMETRY_DATA_AVAILABLE_OFFSET    382
+#define TELEMETRY_GENERATION_NUMBER_OFFSET 383
+#define TELEMETRY_RESUME_SIGNATURE         "OSCRESUM"
+#define TELEMETRY_RESUME_SIGNATURE_LENGTH  SIZE_T_C(8)
+#define TELEMETRY_RESUME_VERSION           UINT16_C(2)
+#define TELEMETRY_RESUME_RECORD_SIZE       SIZE_T_C(64)
+#define TELEMETRY_RESUME_SERIAL_OFFSET     24
+#define TELEMETRY_RESUME_SERIAL_LENGTH     SIZE_T_C(40)
+#define TELEMETRY_RESUME_CHECKPOINT_SIZE   SIZE_T_C(8)
+
+// The .idx file kept next to a partial pull and the .lastpull file of a finished pull start with a 64 byte record.
+// All values are little endian:
+//   0  "OSCRESUM"          8 byte signature
+//   8  version             uint16, 2
+//   10 log address         uint8
+//   11 data area           uint8
+//   12 data available      uint8, from the log header
+//   13 generation number   uint8, from the log header
+//   14 reserved            2 bytes
+//   16 total blocks        uint64
+//   24 serial number       40 bytes, zero padded
+// In the .idx file it is followed by one uint64 per checkpoint holding the number of blocks known to be in the partial
+// file. In the .lastpull file it is followed by the NULL terminated path of the finished log.
+typedef struct s_telemetryResumeRecord
+{
+    uint64_t totalBlocks;
+    uint8_t  logAddress;
+    uint8_t  dataArea;
+    uint8_t  dataAvailable;
+    uint8_t  generationNumber;
+    char     serialNumber[TELEMETRY_RESUME_SERIAL_LENGTH + 1];
+} telemetryResumeRecord;
+
+static void fill_Telemetry_Resume_Record(tDevice*               device,
+                                         const uint8_t*         header,
+                                         uint8_t                logAddress,
+                                         uint8_t                dataArea,
+                                         telemetryResumeRecord* record)
+{
+    safe_memset(record, sizeof(telemetryResumeRecord), 0, sizeof(telemetryResumeRecord));
+    record->totalBlocks      = get_Telemetry_Log_Blocks(device, header, dataArea);
+    record->logAddress       = logAddress;
+    record->dataArea         = dataArea;
+    record->dataAvailable    = header[TELEMETRY_DATA_AVAILABLE_OFFSET];
+    record->generationNumber = header[TELEMETRY_GENERATION_NUMBER_OFFSET];
+    snprintf_err_handle(record->serialNumber, TELEMETRY_RESUME_SERIAL_LENGTH + 1, "%s",
+                        device->drive_info.serialNumber);
+}
+
+static bool is_Same_Telemetry_Resume_Record(const telemetryResumeRecord* first, const telemetryResumeRecord* second)
+{
+    return first->totalBlocks == second->totalBlocks && first->logAddress == second->logAddress &&
+           first->dataArea == second->dataArea && first->dataAvailable == second->dataAvailable &&
+           first->generationNumber == second->generationNumber &&
+           strcmp(first->serialNumber, second->serialNumber) == 0;
+}
+
+static void set_Telemetry_Little_Endian_Value(uint8_t* data, size_t length, uint64_t value)
+{
+    for (size_t iter = SIZE_T_C(0); iter < length; ++iter)
+    {
+        data[iter] = M_Byte0(value >> (iter * SIZE_T_C(8)));
+    }
+}
+
+static uint64_t get_Telemetry_Little_Endian_Value(const uint8_t* data, size_t length)
+{
+    uint64_t value = UINT64_C(0);
+    for (size_t iter = length; iter > SIZE_T_C(0); --iter)
+    {
+        value = (value << 8) | data[iter - SIZE_T_C(1)];
+    }
+    return value;
+}
+
+static void encode_Telemetry_Resume_Record(const telemetryResumeRecord* record, uint8_t* data)
+{
+    safe_memset(data, TELEMETRY_RESUME_RECORD_SIZE, 0, TELEMETRY_RESUME_RECORD_SIZE);
+    safe_memcpy(data, TELEMETRY_RESUME_RECORD_SIZE, TELEMETRY_RESUME_SIGNATURE, TELEMETRY_RESUME_SIGNATURE_LENGTH);
+    set_Telemetry_Little_Endian_Value(&data[8], SIZE_T_C(2), TELEMETRY_RESUME_VERSION);
+    data[10] = record->logAddress;
+    data[11] = record->dataArea;
+    data[12] = record->dataAvailable;
+    data[13] = record->generationNumber;
+    set_Telemetry_Little_Endian_Value(&data[16], SIZE_T_C(8), record->totalBlocks);
+    safe_memcpy(&data[TELEMETRY_RESUME_SERIAL_OFFSET], TELEMETRY_RESUME_SERIAL_LENGTH, record->serialNumber,
+                safe_strlen(record->serialNumber));
+}
+
+// Records from another version of the format are rejected so they are never misread
+static bool decode_Telemetry_Resume_Record(const uint8_t* data, telemetryResumeRecord* record)
+{
+    if (memcmp(data, TELEMETRY_RESUME_SIGNATURE, TELEMETRY_RESUME_SIGNATURE_LENGTH) != 0 ||
+        get_Telemetry_Little_Endian_Value(&data[8], SIZE_T_C(2)) != TELEMETRY_RESUME_VERSION)
+    {
+        return false;
+    }
+    safe_memset(record, sizeof(telemetryResumeRecord), 0, sizeof(telemetryResumeRecord));
+    record->logAddress       = data[10];
+    record->dataArea         = data[11];
+    record->dataAvailable    = data[12];
+    record->generationNumber = data[13];
+    record->totalBlocks      = get_Telemetry_Little_Endian_Value(&data[16], SIZE_T_C(8));
+    safe_memcpy(record->serialNumber, TELEMETRY_RESUME_SERIAL_LENGTH + 1, &data[TELEMETRY_RESUME_SERIAL_OFFSET],
+                TELEMETRY_RESUME_SERIAL_LENGTH);
+    record->serialNumber[TELEMETRY_RESUME_SERIAL_LENGTH] = '\0';
+    return true;
+}
+
+// Partial pulls use a fixed name (serial number and log, no date/time) so running the same command again finds them.
+static void get_Telemetry_Resume_File_Name(tDevice*    device,
+                                           const char* filePath,
+                                           const char* logName,
+                                           const char* extension,
+                                           char*       fileName)
+{
+    DECLARE_ZERO_INIT_ARRAY(char, serialNumber, SERIAL_NUM_LEN + 1);
+    size_t serialLen = safe_strlen(device->drive_info.serialNumber);
+    size_t nameLen   = SIZE_T_C(0);
+    for (size_t iter = SIZE_T_C(0); iter < serialLen && nameLen < SERIAL_NUM_LEN; ++iter)
+    {
+        char character = device->drive_info.serialNumber[iter];
+        if (safe_isalnum(character) || character == '-' || character == '_')
+        {
+            serialNumber[nameLen++] = character;
+        }
+    }
+    if (filePath != M_NULLPTR && safe_strlen(filePath) > SIZE_T_C(0))
+    {
+        snprintf_err_handle(fileName, OPENSEA_PATH_MAX, "%s%c%s_%s.%s", filePath, TELEMETRY_PATH_SEPARATOR,
+                            serialNumber, logName, extension);
+    }
+    else
+    {
+        snprintf_err_handle(fileName, OPENSEA_PATH_MAX, "%s_%s.%s", serialNumber, logName, extension);
+    }
+}
+
+// Reads the record at the start of an .idx or .lastpull file. For an .idx file completedBlocks is set from the last
+// whole checkpoint so a checkpoint torn by an interrupted write is ignored. For a .lastpull file logPath receives
+// the path of the finished log.
+static bool read_Telemetry_Resume_Record(const char*            fileName,
+                                         telemetryResumeRecord* record,
+                                         uint64_t*              completedBlocks,
+                                         char*                  logPath)
+{
+    bool            valid     = false;
+    size_t          readCount = SIZE_T_C(0);
+    secureFileInfo* file      = secure_Open_File(fileName, "rb", M_NULLPTR, M_NULLPTR, M_NULLPTR);
+    DECLARE_ZERO_INIT_ARRAY(uint8_t, data, TELEMETRY_RESUME_RECORD_SIZE);
+    if (file == M_NULLPTR || file->error != SEC_FILE_SUCCESS)
+    {
+        free_Secure_File_Info(&file);
+        return false;
+    }
+    if (SEC_FILE_SUCCESS == secure_Read_File(file, data, TELEMETRY_RESUME_RECORD_SIZE, sizeof(uint8_t),
+                                             TELEMETRY_RESUME_RECORD_SIZE, &readCount) &&
+        readCount == TELEMETRY_RESUME_RECORD_SIZE && decode_Telemetry_Resume_Record(data, record))
+    {
+        valid = true;
+        if (completedBlocks != M_NULLPTR)
+        {
+            DECLARE_ZERO_INIT_ARRAY(uint8_t, checkpoint, TELEMETRY_RESUME_CHECKPOINT_SIZE);
+            *completedBlocks = UINT64_C(0);
+            while (SEC_FILE_SUCCESS == secure_Read_File(file, checkpoint, TELEMETRY_RESUME_CHECKPOINT_SIZE,
+                                                        sizeof(uint8_t), TELEMETRY_RESUME_CHECKPOINT_SIZE,
+                                                        &readCount) &&
+                   readCount == TELEMETRY_RESUME_CHECKPOINT_SIZE)
+            {
+                *completedBlocks = get_Telemetry_Little_Endian_Value(checkpoint, TELEMETRY_RESUME_CHECKPOINT_SIZE);
+            }
+        }
+        if (logPath != M_NULLPTR)
+        {
+            size_t remaining =
+                M_Min(file->fileSize - TELEMETRY_RESUME_RECORD_SIZE, C_CAST(size_t, OPENSEA_PATH_MAX - 1));
+            if (remaining == SIZE_T_C(0) ||
+                SEC_FILE_SUCCESS != secure_Read_File(file, logPath, OPENSEA_PATH_MAX, sizeof(char), remaining,
+                                                     M_NULLPTR))
+            {
+                valid = false;
+            }
+            logPath[OPENSEA_PATH_MAX - 1] = '\0';
+        }
+    }
+    secure_Close_File(file);
+    free_Secure_File_Info(&file);
+    return valid;
+}
+
+// The saved/controller initiated log only changes when the device captures new data, which also changes the data
+// generation number in the header. A matching .lastpull record with its log still in place means there is nothing new.
+static bool is_Telemetry_Log_Unchanged(const char* lastPullName, const telemetryResumeRecord* current)
+{
+    bool                  unchanged = false;
+    telemetryResumeRecord previous;
+    DECLARE_ZERO_INIT_ARRAY(char, logPath, OPENSEA_PATH_MAX);
+    if (read_Telemetry_Resume_Record(lastPullName, &previous, M_NULLPTR, logPath) &&
+        is_Same_Telemetry_Resume_Record(&previous, current))
+    {
+        secureFileInfo* logFile = secure_Open_File(logPath, "rb", M_NULLPTR, M_NULLPTR, M_NULLPTR);
+        if (logFile != M_NULLPTR && logFile->error == SEC_FILE_SUCCESS)
+        {
+            unchanged = C_CAST(uint64_t, logFile->fileSize) == current->totalBlocks * TELEMETRY_BLOCK_SIZE;
+            secure_Close_File(logFile);
+        }
+        else
+        {
+            // the previous pull may have been compressed since
+            DECLARE_ZERO_INIT_ARRAY(char, compressedPath, OPENSEA_PATH_MAX);
+            snprintf_err_handle(compressedPath, OPENSEA_PATH_MAX, "%s%s", logPath, LOG_COMPRESSION_EXTENSION);
+            free_Secure_File_Info(&logFile);
+            logFile = secure_Open_File(compressedPath, "rb", M_NULLPTR, M_NULLPTR, M_NULLPTR);
+            if (logFile != M_NULLPTR && logFile->error == SEC_FILE_SUCCESS)
+            {
+                unchanged = logFile->fileSize > SIZE_T_C(0);
+                secure_Close_File(logFile);
+            }
+        }
+        free_Secure_File_Info(&logFile);
+    }
+    return unchanged;
+}
+
+// A partial file is only resumed when it was started on the same drive (serial number) for the same log and data area,
+// with the same data generation number, and its header still matches the one the device reports now. Otherwise the
+// device has captured new data since the partial pull started.
+static bool can_Resume_Telemetry_Pull(const char*                  partialName,
+                                      const telemetryResumeRecord* saved,
+                                      const telemetryResumeRecord* current,
+                                      const uint8_t*               header,
+                                      uint64_t                     completedBlocks)
+{
+    bool            matches = false;
+    secureFileInfo* partial = M_NULLPTR;
+    DECLARE_ZERO_INIT_ARRAY(uint8_t, savedHeader, TELEMETRY_BLOCK_SIZE);
+    if (!is_Same_Telemetry_Resume_Record(saved, current) || completedBlocks == UINT64_C(0) ||
+        completedBlocks > current->totalBlocks)
+    {
+        return false;
+    }
+    partial = secure_Open_File(partialName, "rb", M_NULLPTR, M_NULLPTR, M_NULLPTR);
+    if (partial != M_NULLPTR && partial->error == SEC_FILE_SUCCESS)
+    {
+        size_t readCount = SIZE_T_C(0);
+        if (C_CAST(uint64_t, partial->fileSize) >= completedBlocks * TELEMETRY_BLOCK_SIZE &&
+            SEC_FILE_SUCCESS == secure_Read_File(partial, savedHeader, TELEMETRY_BLOCK_SIZE, sizeof(uint8_t),
+                                                 TELEMETRY_BLOCK_SIZE, &readCount) &&
+            readCount == TELEMETRY_BLOCK_SIZE && memcmp(savedHeader, header, TELEMETRY_BLOCK_SIZE) == 0)
+        {
+            matches = true;
+        }
+        secure_Close_File(partial);
+    }
+    free_Secure_File_Info(&partial);
+    return matches;
+}
+
+// Everything queued so far is written and flushed before the block count goes into the index, so the index never
+// claims data that is not in the partial file.
+static eReturnValues checkpoint_Telemetry_Pull(asyncFileWriter* writer,
+                                               secureFileInfo*  indexFile,
+                                               uint64_t         completedBlocks)
+{
+    DECLARE_ZERO_INIT_ARRAY(uint8_t, checkpoint, TELEMETRY_RESUME_CHECKPOINT_SIZE);
+    set_Telemetry_Little_Endian_Value(checkpoint, TELEMETRY_RESUME_CHECKPOINT_SIZE, completedBlocks);
+    if (SEC_FILE_SUCCESS != sync_Async_File_Writer(writer) ||
+        SEC_FILE_SUCCESS != secure_Write_File(indexFile, checkpoint, TELEMETRY_RESUME_CHECKPOINT_SIZE,
+                                              sizeof(uint8_t), TELEMETRY_RESUME_CHECKPOINT_SIZE, M_NULLPTR) ||
+        SEC_FILE_SUCCESS != secure_Flush_File(indexFile))
+    {
+        return ERROR_WRITING_FILE;
+    }
+    return SUCCESS;
+}
+
+static eReturnValues read_Telemetry_Blocks_With_Retries(tDevice* device,
+                                                        uint8_t  logAddress,
+                                                        uint64_t offsetBlocks,
+                                                        uint32_t blockCount,
+                                                        bool     createNewData,
+                                                        uint8_t* buffer)
+{
+    eReturnValues ret = FAILURE;
+    for (uint32_t attempt = UINT32_C(0); attempt <= TELEMETRY_TRANSFER_RETRIES; ++attempt)
+    {
+        ret = read_Telemetry_Blocks(device, logAddress, offsetBlocks, blockCount, createNewData, buffer);
+        if (ret == SUCCESS || ret == NOT_SUPPORTED)
+        {
+            break;
+        }
+    }
+    return ret;
+}
+
+// The finished log gets the same serial number/date/time name as any other pulled log. The library picks the name
+// and creates the file, then the partial file takes its place.
+static eReturnValues complete_Telemetry_Pull(tDevice*                     device,
+                                             const char*                  filePath,
+                                             const char*                  logName,
+                                             const char*                  partialName,
+                                             const char*                  indexName,
+                                             const char*                  lastPullName,
+                                             const telemetryResumeRecord* record)
+{
+    secureFileInfo* finalFile = M_NULLPTR;
+    DECLARE_ZERO_INIT_ARRAY(char, finalName, OPENSEA_PATH_MAX);
+    eReturnValues ret = create_And_Open_Secure_Log_File_Dev_EZ(device, &finalFile, NAMING_SERIAL_NUMBER_DATE_TIME,
+                                                               filePath, logName, "bin");
+    if (ret != SUCCESS)
+    {
+        if (finalFile != M_NULLPTR && finalFile->error == SEC_FILE_INSECURE_PATH)
+        {
+            ret = INSECURE_PATH;
+        }
+        free_Secure_File_Info(&finalFile);
+        return ret == INSECURE_PATH ? INSECURE_PATH : FILE_OPEN_ERROR;
+    }
+    snprintf_err_handle(finalName, OPENSEA_PATH_MAX, "%s", finalFile->fullpath);
+    secure_Close_File(finalFile);
+    free_Secure_File_Info(&finalFile);
+    // rename does not replace an existing file on every system
+    if (remove(finalName) != 0 || rename(partialName, finalName) != 0)
+    {
+        return ERROR_WRITING_FILE;
+    }
+    remove(indexName);
+    // the .lastpull record only lets a later run skip an unchanged log, so failing to write it does not fail the pull
+    secureFileInfo* lastPull = secure_Open_File(lastPullName, "wb", M_NULLPTR, M_NULLPTR, M_NULLPTR);
+    DECLARE_ZERO_INIT_ARRAY(uint8_t, data, TELEMETRY_RESUME_RECORD_SIZE);
+    encode_Telemetry_Resume_Record(record, data);
+    if (lastPull != M_NULLPTR && lastPull->error == SEC_FILE_SUCCESS)
+    {
+        if (SEC_FILE_SUCCESS != secure_Write_File(lastPull, data, TELEMETRY_RESUME_RECORD_SIZE, sizeof(uint8_t),
+                                                  TELEMETRY_RESUME_RECORD_SIZE, M_NULLPTR) ||
+            SEC_FILE_SUCCESS != secure_Write_File(lastPull, finalName, OPENSEA_PATH_MAX, sizeof(char),
+                                                  safe_strlen(finalName) + SIZE_T_C(1), M_NULLPTR))
+        {
+            secure_Close_File(lastPull);
+            free_Secure_File_Info(&lastPull);
+            remove(lastPullName);
+            return SUCCESS;
+        }
+        secure_Close_File(lastPull);
+    }
+    free_Secure_File_Info(&lastPull);
+    return SUCCESS;
+}
+
+eReturnValues pull_Telemetry_Log_Streamed(tDevice*    device,
+                                          bool        currentOrSaved,
+                                          uint8_t     dataArea,
+                                          const char* filePath,
+                                          uint32_t    transferSizeBytes,
+                                          bool        skipIfUnchanged,
+                                          bool*       skipped)
+{
+    eReturnValues         ret             = SUCCESS;
+    uint8_t               logAddress      = UINT8_C(0);
+    uint8_t               maxArea         = TELEMETRY_ATA_MAX_DATA_AREA;
+    uint32_t              maxBlocks       = UINT32_C(0);
+    uint64_t              nextBlock       = UINT64_C(0);
+    uint64_t              completedBlocks = UINT64_C(0);
+    uint32_t              sinceCheckpoint = UINT32_C(0);
+    bool                  havePartial     = false;
+    bool                  resuming        = false;
+    secureFileInfo*       logFile         = M_NULLPTR;
+    secureFileInfo*       indexFile       = M_NULLPTR;
+    asyncFileWriter*      writer          = M_NULLPTR;
+    uint8_t*              buffer          = M_NULLPTR;
+    uint8_t*              header          = M_NULLPTR;
+    const char*           logName         = currentOrSaved ? "TELEMETRY_CURRENT" : "TELEMETRY_SAVED";
+    telemetryResumeRecord record;
+    telemetryResumeRecord saved;
+    DECLARE_ZERO_INIT_ARRAY(char, partialName, OPENSEA_PATH_MAX);
+    DECLARE_ZERO_INIT_ARRAY(char, indexName, OPENSEA_PATH_MAX);
+    DECLARE_ZERO_INIT_ARRAY(char, lastPullName, OPENSEA_PATH_MAX);
+    if (skipped != M_NULLPTR)
+    {
+        *skipped = false;
+    }
+    if (device == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    if (device->drive_info.drive_type == NVME_DRIVE)
+    {
+        // LPA bit 3: telemetry host and controller initiated log pages supported
+        if (!(device->drive_info.IdentifyData.nvme.ctrl.lpa & BIT3))
+        {
+            return NOT_SUPPORTED;
+        }
+        logAddress = currentOrSaved ? TELEMETRY_NVME_HOST_INITIATED_LOG : TELEMETRY_NVME_CTRL_INITIATED_LOG;
+        maxArea    = TELEMETRY_NVME_MAX_DATA_AREA;
+    }
+    else if (device->drive_info.drive_type == ATA_DRIVE)
+    {
+        uint32_t logSize = UINT32_C(0);
+        logAddress = currentOrSaved ? TELEMETRY_ATA_CURRENT_INTERNAL_LOG : TELEMETRY_ATA_SAVED_INTERNAL_LOG;
+        if (SUCCESS != get_ATA_Log_Size(device, logAddress, &logSize, true, false) || logSize == UINT32_C(0))
+        {
+            return NOT_SUPPORTED;
+        }
+        if (device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength > UINT32_C(0))
+        {
+            maxBlocks = device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength / TELEMETRY_BLOCK_SIZE;
+        }
+    }
+    else
+    {
+        return pull_Telemetry_Log(device, currentOrSaved, dataArea, true, M_NULLPTR, 0, filePath, transferSizeBytes);
+    }
+    if (dataArea == UINT8_C(0) || dataArea > maxArea)
+    {
+        return BAD_PARAMETER;
+    }
+    if (transferSizeBytes == UINT32_C(0))
+    {
+        transferSizeBytes = TELEMETRY_STREAM_DEFAULT_TRANSFER;
+    }
+    uint32_t blocksPerTransfer = M_Max(transferSizeBytes / TELEMETRY_BLOCK_SIZE, UINT32_C(1));
+    if (maxBlocks > UINT32_C(0))
+    {
+        blocksPerTransfer = M_Min(blocksPerTransfer, maxBlocks);
+    }
+    if (device->drive_info.drive_type == ATA_DRIVE)
+    {
+        // 16 bit page count in READ LOG EXT
+        blocksPerTransfer = M_Min(blocksPerTransfer, UINT32_C(65535));
+    }
+    header = C_CAST(uint8_t*,
+                    safe_calloc_aligned(TELEMETRY_BLOCK_SIZE, sizeof(uint8_t), device->os_info.minimumAlignment));
+    if (header == M_NULLPTR)
+    {
+        return MEMORY_FAILURE;
+    }
+    get_Telemetry_Resume_File_Name(device, filePath, logName, "partial", partialName);
+    get_Telemetry_Resume_File_Name(device, filePath, logName, "partial.idx", indexName);
+    get_Telemetry_Resume_File_Name(device, filePath, logName, "lastpull", lastPullName);
+    // When a partial pull exists, the header is read without creating new data first so it can be compared with the
+    // partial file. Creating new host initiated/current data would replace the data the partial file was pulled from.
+    havePartial = read_Telemetry_Resume_Record(indexName, &saved, &completedBlocks, M_NULLPTR);
+    ret         = read_Telemetry_Blocks_With_Retries(device, logAddress, UINT64_C(0), UINT32_C(1),
+                                                     currentOrSaved && !havePartial, header);
+    if (ret == SUCCESS)
+    {
+        fill_Telemetry_Resume_Record(device, header, logAddress, dataArea, &record);
+        if (skipIfUnchanged && !currentOrSaved && is_Telemetry_Log_Unchanged(lastPullName, &record))
+        {
+            if (skipped != M_NULLPTR)
+            {
+                *skipped = true;
+            }
+            safe_free_aligned_core(C_CAST(void**, &header));
+            return SUCCESS;
+        }
+        if (havePartial)
+        {
+            resuming = can_Resume_Telemetry_Pull(partialName, &saved, &record, header, completedBlocks);
+            if (!resuming && currentOrSaved)
+            {
+                ret = read_Telemetry_Blocks_With_Retries(device, logAddress, UINT64_C(0), UINT32_C(1), true, header);
+                fill_Telemetry_Resume_Record(device, header, logAddress, dataArea, &record);
+            }
+        }
+    }
+    if (ret == SUCCESS)
+    {
+        if (resuming)
+        {
+            if (device->deviceVerbosity > VERBOSITY_DEFAULT)
+            {
+                printf("Resuming telemetry pull at block %" PRIu64 " of %" PRIu64 "\n", completedBlocks,
+                       record.totalBlocks);
+            }
+            logFile   = secure_Open_File(partialName, "r+b", M_NULLPTR, M_NULLPTR, M_NULLPTR);
+            indexFile = secure_Open_File(indexName, "ab", M_NULLPTR, M_NULLPTR, M_NULLPTR);
+            nextBlock = completedBlocks;
+        }
+        else
+        {
+            remove(partialName);
+            remove(indexName);
+            logFile   = secure_Open_File(partialName, "wb", M_NULLPTR, M_NULLPTR, M_NULLPTR);
+            indexFile = secure_Open_File(indexName, "wb", M_NULLPTR, M_NULLPTR, M_NULLPTR);
+        }
+        if (logFile == M_NULLPTR || logFile->error != SEC_FILE_SUCCESS || indexFile == M_NULLPTR ||
+            indexFile->error != SEC_FILE_SUCCESS)
+        {
+            if ((logFile != M_NULLPTR && logFile->error == SEC_FILE_INSECURE_PATH) ||
+                (indexFile != M_NULLPTR && indexFile->error == SEC_FILE_INSECURE_PATH))
+            {
+                ret = INSECURE_PATH;
+            }
+            else
+            {
+                ret = FILE_OPEN_ERROR;
+            }
+        }
+        else if (resuming)
+        {
+            if (SEC_FILE_SUCCESS != secure_Seek_File(logFile, C_CAST(int64_t, nextBlock * TELEMETRY_BLOCK_SIZE), 0))
+            {
+                ret = ERROR_WRITING_FILE;
+            }
+        }
+        else
+        {
+            DECLARE_ZERO_INIT_ARRAY(uint8_t, data, TELEMETRY_RESUME_RECORD_SIZE);
+            encode_Telemetry_Resume_Record(&record, data);
+            if (SEC_FILE_SUCCESS != secure_Write_File(indexFile, data, TELEMETRY_RESUME_RECORD_SIZE, sizeof(uint8_t),
+                                                      TELEMETRY_RESUME_RECORD_SIZE, M_NULLPTR))
+            {
+                ret = ERROR_WRITING_FILE;
+            }
+        }
+    }
+    if (ret == SUCCESS)
+    {
+        writer = create_Async_File_Writer(logFile, TELEMETRY_STREAM_BUFFER_COUNT,
+                                          C_CAST(size_t, blocksPerTransfer) * TELEMETRY_BLOCK_SIZE,
+                                          device->os_info.minimumAlignment);
+        if (writer == M_NULLPTR)
+        {
+            ret = MEMORY_FAILURE;
+        }
+    }
+    if (ret == SUCCESS && !resuming)
+    {
+        buffer = get_Async_Write_Buffer(writer);
+        if (buffer == M_NULLPTR)
+        {
+            ret = ERROR_WRITING_FILE;
+        }
+        else
+        {
+            safe_memcpy(buffer, TELEMETRY_BLOCK_SIZE, header, TELEMETRY_BLOCK_SIZE);
+            if (SEC_FILE_SUCCESS != queue_Async_Write_Buffer(writer, buffer, TELEMETRY_BLOCK_SIZE))
+            {
+                ret = ERROR_WRITING_FILE;
+            }
+            nextBlock = UINT64_C(1);
+        }
+    }
+    while (ret == SUCCESS && nextBlock < record.totalBlocks)
+    {
+        uint32_t blocks = C_CAST(uint32_t, M_Min(C_CAST(uint64_t, blocksPerTransfer), record.totalBlocks - nextBlock));
+        buffer          = get_Async_Write_Buffer(writer);
+        if (buffer == M_NULLPTR)
+        {
+            ret = ERROR_WRITING_FILE;
+            break;
+        }
+        ret = read_Telemetry_Blocks_With_Retries(device, logAddress, nextBlock, blocks, false, buffer);
+        if (ret == SUCCESS)
+        {
+            if (SEC_FILE_SUCCESS !=
+                queue_Async_Write_Buffer(writer, buffer, C_CAST(size_t, blocks) * TELEMETRY_BLOCK_SIZE))
+            {
+                ret = ERROR_WRITING_FILE;
+            }
+            nextBlock += blocks;
+            if (ret == SUCCESS && ++sinceCheckpoint == TELEMETRY_CHECKPOINT_TRANSFERS)
+            {
+                ret             = checkpoint_Telemetry_Pull(writer, indexFile, nextBlock);
+                sinceCheckpoint = UINT32_C(0);
+            }
+        }
+    }
+    if (ret != SUCCESS && writer != M_NULLPTR && nextBlock > UINT64_C(0))
+    {
+        // keep whatever was pulled before the failure so the next run starts from there
+        checkpoint_Telemetry_Pull(writer, indexFile, nextBlock);
+    }
+    if (writer != M_NULLPTR && SEC_FILE_SUCCESS != finish_Async_File_Writer(&writer) && ret == SUCCESS)
+    {
+        ret = ERROR_WRITING_FILE;
+    }
+    if (logFile != M_NULLPTR && logFile->error == SEC_FILE_SUCCESS && SEC_FILE_SUCCESS != secure_Close_File(logFile) &&
+        ret == SUCCESS)
+    {
+        ret = ERROR_WRITING_FILE;
+    }
+    if (indexFile != M_NULLPTR && indexFile->error == SEC_FILE_SUCCESS)
+    {
+        secure_Close_File(indexFile);
+    }
+    free_Secure_File_Info(&logFile);
+    free_Secure_File_Info(&indexFile);
+    safe_free_aligned_core(C_CAST(void**, &header));
+    if (ret == SUCCESS)
+    {
+        ret = complete_Telemetry_Pull(device, filePath, logName, partialName, indexName, lastPullName, &record);
+    }
+    if (ret != SUCCESS && ret != ERROR_WRITING_FILE && ret != INSECURE_PATH && ret != FILE_OPEN_ERROR &&
+        ret != MEMORY_FAILURE && ret != NOT_SUPPORTED)
+    {
+        ret = FAILURE;
+    }
+    return ret;
+}
@@ -22,6 +22,30 @@
 
 #include "openseachest_util_options.h"
 
+#include "ata_helper_func.h"
+#include "cmds.h"
+#include "defect.h"
+#include "dst.h"
+#include "logs.h"
+#include "nvme_helper_func.h"
+#include "scsi_helper_func.h"
+
+#if defined(UEFI_C_SOURCE)
+// directories cannot be listed and stdout is always the console in UEFI
+#elif defined(_WIN32)
+#    include <io.h>
+#    include <windows.h>
+#else
+#    include <dirent.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+#if !defined(UEFI_C_SOURCE) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#    include <emmintrin.h>
+#    define HEX_DUMP_USE_SSE2
+#endif
+
 #if defined(__linux__)
 #    if defined(VMK_CROSS_COMP)
 const char* deviceHandleExample = "vmhba<#>";
@@ -1033,6 +1057,67 @@ void print_Show_FARM_Help(bool shortHelp)
     }
 }
 
+void print_Decode_FARM_Help(bool shortHelp)
+{
+    printf("\t--%s [file name]\n", DECODE_FARM_LONG_OPT_STRING);
+    if (!shortHelp)
+    {
+        print_str("\t\tUse this option to decode a SATA FARM log saved with\n");
+        print_str("\t\topenSeaChest_Logs --farm. Each field is shown by name,\n");
+        print_str("\t\twith one row per head for per head fields. Fields that are\n");
+        print_str("\t\tnot supported or not valid are left out. No device is\n");
+        printf("\t\tneeded. Use --%s to choose text, CSV or JSON output.\n\n", FARM_FORMAT_LONG_OPT_STRING);
+    }
+}
+
+void print_FARM_Baseline_Help(bool shortHelp)
+{
+    printf("\t--%s [file name]\n", FARM_BASELINE_LONG_OPT_STRING);
+    if (!shortHelp)
+    {
+        printf("\t\tUse this option with --%s to compare the log to an\n", DECODE_FARM_LONG_OPT_STRING);
+        print_str("\t\tearlier FARM log of the same drive. Each value is shown\n");
+        print_str("\t\twith the baseline value and the difference. Counters also\n");
+        print_str("\t\tshow the rate per power on hour between the two logs.\n\n");
+    }
+}
+
+void print_FARM_Field_Table_Help(bool shortHelp)
+{
+    printf("\t--%s [file name]\n", FARM_FIELD_TABLE_LONG_OPT_STRING);
+    if (!shortHelp)
+    {
+        print_str("\t\tUse this option to add fields to the FARM decoder. The\n");
+        print_str("\t\tbuilt in fields are the drive wide counters of the general,\n");
+        print_str("\t\tworkload, error and environment pages. Per head and per\n");
+        print_str("\t\tactuator fields depend on the FARM revision of the product\n");
+        print_str("\t\tand are added with a CSV file of one field per line:\n");
+        print_str("\t\t    name,page,field,count,type\n");
+        print_str("\t\tfield is the index of the 8 byte field in the page, count\n");
+        print_str("\t\tis 1, heads, or the number of values (e.g. 2 for one per\n");
+        print_str("\t\tactuator) and type is counter or gauge. A field with the\n");
+        print_str("\t\tname of a built in field replaces it. Lines starting with\n");
+        print_str("\t\t# are comments.\n");
+        print_str("\t\tExample line: head_write_retries,5,40,heads,counter\n\n");
+    }
+}
+
+void print_FARM_Format_Help(bool shortHelp)
+{
+    printf("\t--%s [ text | csv | json ]\n", FARM_FORMAT_LONG_OPT_STRING);
+    if (!shortHelp)
+    {
+        printf("\t\tUse this option to choose the output of --%s.\n", DECODE_FARM_LONG_OPT_STRING);
+        printf("\t\tWith --%s, csv and json decode the log with the\n", SHOW_FARM_LONG_OPT_STRING);
+        print_str("\t\tFARM decoder instead of showing the full FARM report.\n");
+        print_str("\t\t  text - a table of field names and values (default)\n");
+        print_str("\t\t  csv  - Source,Field,Element,Type,Value rows. The source is\n");
+        print_str("\t\t         the file name or drive serial number, so the rows\n");
+        print_str("\t\t         of many drives can be combined.\n");
+        print_str("\t\t  json - one JSON document\n\n");
+    }
+}
+
 void print_NVME_Health_Help(bool shortHelp)
 {
     printf("\t--%s\t(NVMe Only)\n", NVME_HEALTH_LONG_OPT_STRING);
@@ -1504,7 +1589,8 @@ void print_Error_Limit_Help(bool shortHelp)
     {
         print_str("\t\tUse this option to specify a different error\n");
         print_str("\t\tlimit for a user generic or long generic read\n");
-        print_str("\t\ttest or DST and Clean. This must be a number of\n");
+        print_str("\t\ttest, DST and Clean, or a pending list repair.\n");
+        print_str("\t\tThis must be a number of\n");
         print_str("\t\t logical LBAs to have errors. If a drive has multiple\n");
         print_str("\t\t logical sectors per physical sector, this number will\n");
         print_str("\t\tbe adjusted for you to reflect the drive\n");
@@ -2484,6 +2570,22 @@ void print_DST_And_Clean_Help(bool shortHelp)
     }
 }
 
+void print_Fleet_DST_Help(bool shortHelp)
+{
+    printf("\t--%s\n", FLEET_DST_LONG_OPT_STRING);
+    if (!shortHelp)
+    {
+        print_str("\t\tUse this option with a DST or DST and clean operation to run\n");
+        print_str("\t\tit on all selected drives at the same time instead of one\n");
+        print_str("\t\tdrive after another. All self-tests are started first, then\n");
+        print_str("\t\teach drive is polled for progress and a table showing every\n");
+        print_str("\t\tdrive is printed until all of them have finished.\n");
+        print_str("\t\tWith DST and clean, a drive is repaired and tested again as\n");
+        print_str("\t\tsoon as its own self-test fails, while the other drives keep\n");
+        print_str("\t\ttesting. This option always polls for progress.\n\n");
+    }
+}
+
 void print_Generic_Test_Mode_Help(bool shortHelp)
 {
     printf("\t--%s [ read | write | verify ]\n", GENERIC_TEST_LONG_OPT_STRING);
@@ -2571,10 +2673,10 @@ void print_Fast_Format_Help(bool shortHelp)
         print_str("\t\tPerforming a sector size change is data destructive and has a risk that\n");
         print_str("\t\tthe adapter, driver, or operating system may not know how to communicate with\n");
         print_str("\t\tthe device once this has completed.\n");
-        set_Console_Foreground_Background_Colors(CONSOLE_COLOR_BRIGHT_RED, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_BRIGHT_RED, CONSOLE_COLOR_DEFAULT);
         print_str("\t\tThere is an additional risk when performing a low-level fast format that may\n");
         print_str("\t\tmake the drive inoperable if it is reset at any time while it is formatting.\n");
-        set_Console_Foreground_Background_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
         print_str("\t\tAvailable fast format modes:\n");
         print_str("\t\t    0 - This is a standard format unit command. All logical\n");
         print_str("\t\t        blocks will be overwritten. This command will take a\n");
@@ -2589,7 +2691,7 @@ void print_Fast_Format_Help(bool shortHelp)
         print_str("\t\t        logical sector size quickly. Media may or may not be\n");
         print_str("\t\t        read accessible until a write has been performed to\n");
         print_str("\t\t        the media.\n\n");
-        set_Console_Foreground_Background_Colors(CONSOLE_COLOR_BRIGHT_YELLOW, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_BRIGHT_YELLOW, CONSOLE_COLOR_DEFAULT);
         print_str("\t\tWARNING: Any interruption to the device while it is formatting may render the\n");
         print_str("\t\t         drive inoperable! Use this at your own risk!\n");
         print_str("\t\tWARNING: Set sector size may affect all LUNs/namespaces for devices\n");
@@ -2600,7 +2702,7 @@ void print_Fast_Format_Help(bool shortHelp)
         print_str("\t\tWARNING: It is recommended that this operation is done from a bootable environment\n");
         print_str("\t\t         (Live USB) to reduce the risk of OS background activities running and\n");
         print_str("\t\t         triggering a device reset while reformating the drive.\n\n");
-        set_Console_Foreground_Background_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
     }
 }
 
@@ -2746,10 +2848,10 @@ void print_Set_Sector_Size_Help(bool shortHelp)
         print_str("\t\tPerforming a sector size change is data destructive and has a risk that\n");
         print_str("\t\tthe adapter, driver, or operating system may not know how to communicate with\n");
         print_str("\t\tthe device once this has completed.\n");
-        set_Console_Foreground_Background_Colors(CONSOLE_COLOR_BRIGHT_RED, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_BRIGHT_RED, CONSOLE_COLOR_DEFAULT);
         print_str("\t\tThere is an additional risk when performing a low-level format/fast format that may\n");
         print_str("\t\tmake the drive inoperable if it is reset at any time while it is formatting.\n");
-        set_Console_Foreground_Background_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
         print_str("\t\tFor SATA Drives, the set sector configuration command must be supported.\n");
         print_str("\t\tOn SAS Drives, fast format must be supported to make these changes.\n\n");
         printf("\t\tUse the --%s option to see the sector\n", SHOW_SUPPORTED_FORMATS_LONG_OPT_STRING);
@@ -2758,7 +2860,7 @@ void print_Set_Sector_Size_Help(bool shortHelp)
         print_str("\t\tThis option should be used to quickly change between 5xxe and\n");
         print_str("\t\t4xxx sector sizes. Using this option to change from 512 to 520\n");
         print_str("\t\tor similar is not recommended at this time due to limited drive\n\t\tsupport\n\n");
-        set_Console_Foreground_Background_Colors(CONSOLE_COLOR_BRIGHT_YELLOW, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_BRIGHT_YELLOW, CONSOLE_COLOR_DEFAULT);
         print_str("\t\tWARNING: Any interruption to the device while it is formatting may render the\n");
         print_str("\t\t         drive inoperable! Use this at your own risk!\n");
         print_str("\t\tWARNING: Set sector size may affect all LUNs/namespaces for devices\n");
@@ -2775,7 +2877,7 @@ void print_Set_Sector_Size_Help(bool shortHelp)
         print_str("\t\tWARNING: It is recommended that this operation is done from a bootable environment\n");
         print_str("\t\t         (Live USB) to reduce the risk of OS background activities running and\n");
         print_str("\t\t         triggering a device reset while reformating the drive.\n\n");
-        set_Console_Foreground_Background_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
     }
 }
 
@@ -3027,6 +3129,97 @@ void print_PUIS_Feature_Help(bool shortHelp)
     }
 }
 
+void print_Staggered_Spinup_Help(bool shortHelp)
+{
+    printf("\t--%s\n", STAGGERED_SPINUP_LONG_OPT_STRING);
+    if (!shortHelp)
+    {
+        print_str("\t\tUse this option to spin up all of the selected drives in\n");
+        print_str("\t\tstaggered waves instead of all at once. Each drive is sent\n");
+        print_str("\t\tthe command needed to bring it to the active state (PUIS\n");
+        print_str("\t\tspinup for SATA drives that require it), then it is polled\n");
+        print_str("\t\twith check power mode (ATA) or test unit ready (SCSI) until\n");
+        print_str("\t\tit reports ready. As soon as a drive is ready, the next drive\n");
+        print_str("\t\tin the queue is started. Use this with --scan or a list of\n");
+        print_str("\t\tdevices to avoid exceeding the power supply's limits when\n");
+        print_str("\t\tpowering on a large enclosure.\n");
+        printf("\t\tSee --%s, --%s, and --%s\n", SPINUP_CONCURRENCY_LONG_OPT_STRING,
+               SPINUP_CURRENT_BUDGET_LONG_OPT_STRING, SPINUP_PROFILE_LONG_OPT_STRING);
+        print_str("\t\tto control how many drives spin up at a time.\n\n");
+    }
+}
+
+void print_Spinup_Concurrency_Help(bool shortHelp)
+{
+    printf("\t--%s [count]\n", SPINUP_CONCURRENCY_LONG_OPT_STRING);
+    if (!shortHelp)
+    {
+        printf("\t\tUse this option with --%s to set the maximum number\n", STAGGERED_SPINUP_LONG_OPT_STRING);
+        print_str("\t\tof drives that may be spinning up at the same time.\n");
+        print_str("\t\tWhen neither this nor a current budget is given, up to 4\n");
+        print_str("\t\tdrives are spun up at a time.\n\n");
+    }
+}
+
+void print_Spinup_Current_Budget_Help(bool shortHelp)
+{
+    printf("\t--%s [milliamps]\n", SPINUP_CURRENT_BUDGET_LONG_OPT_STRING);
+    if (!shortHelp)
+    {
+        printf("\t\tUse this option with --%s to set the total 12v\n", STAGGERED_SPINUP_LONG_OPT_STRING);
+        print_str("\t\tspin up current, in milliamps, that may be drawn at once.\n");
+        print_str("\t\tA drive is only started when its spin up current fits within\n");
+        print_str("\t\tthe remaining budget. A drive that needs more than the whole\n");
+        print_str("\t\tbudget is spun up by itself. Spin up current for each drive\n");
+        printf("\t\tcomes from the --%s file, or a default of 2000mA\n", SPINUP_PROFILE_LONG_OPT_STRING);
+        print_str("\t\tfor HDDs and 0mA for SSDs.\n");
+        printf("\t\tThis may be combined with --%s.\n\n", SPINUP_CONCURRENCY_LONG_OPT_STRING);
+    }
+}
+
+void print_Spinup_Profile_Help(bool shortHelp)
+{
+    printf("\t--%s [file]\n", SPINUP_PROFILE_LONG_OPT_STRING);
+    if (!shortHelp)
+    {
+        printf("\t\tUse this option with --%s to provide the spin up\n", STAGGERED_SPINUP_LONG_OPT_STRING);
+        print_str("\t\tcurrent and time for each drive model. Each line of the file is\n");
+        print_str("\t\t    model prefix,milliamps,seconds\n");
+        print_str("\t\tThe longest model prefix that matches the start of a drive's\n");
+        print_str("\t\tmodel number is used. Lines starting with # are ignored.\n");
+        print_str("\t\tThe seconds value sets how long to wait for the drive to become\n");
+        print_str("\t\tready (3x this value, minimum 60 seconds) before moving on.\n");
+        print_str("\t\tExample:\n");
+        print_str("\t\t    # model prefix,milliamps,seconds\n");
+        print_str("\t\t    ST16000NM,1850,25\n");
+        print_str("\t\t    ST4000,1500,15\n\n");
+    }
+}
+
+void print_Wake_Latency_Help(bool shortHelp)
+{
+    printf("\t--%s [iterations]\n", WAKE_LATENCY_LONG_OPT_STRING);
+    if (!shortHelp)
+    {
+        print_str("\t\tUse this option to measure how long a drive takes to respond\n");
+        print_str("\t\tto its first command after entering each power condition.\n");
+        print_str("\t\tFor each of idle, standby, idle_a, idle_b, idle_c, standby_y\n");
+        print_str("\t\tand standby_z, the drive is transitioned to that condition,\n");
+        print_str("\t\tpolled until it reports being in it (up to 30 seconds), then\n");
+        print_str("\t\ta single sector verify is timed. Iterations where the drive\n");
+        print_str("\t\tnever reports the condition are shown as missed and are not\n");
+        print_str("\t\ttimed. This is repeated the number of iterations given (1 to\n");
+        print_str("\t\t1000) and the min, average, median, 99th percentile and max\n");
+        print_str("\t\tlatency are shown for each condition along with the latency\n");
+        print_str("\t\tof the same command when the drive is already active.\n");
+        print_str("\t\tPower conditions the drive does not support are skipped. The\n");
+        print_str("\t\tlongest the benchmark can take is shown before it starts.\n");
+        print_str("\t\tNote: Each standby iteration spins the drive down and back up.\n");
+        print_str("\t\t      Use a small number of iterations to limit the start/stop\n");
+        print_str("\t\t      and load/unload cycles added to the drive.\n\n");
+    }
+}
+
 void print_Show_EPC_Settings_Help(bool shortHelp)
 {
     printf("\t--%s\n", SHOW_EPC_SETTINGS_LONG_OPT_STRING);
@@ -3224,6 +3417,182 @@ void print_Device_Statistics_Help(bool shortHelp)
     }
 }
 
+void print_Watch_Help(bool shortHelp)
+{
+    printf("\t--%s [seconds]\n", WATCH_LONG_OPT_STRING);
+    if (!shortHelp)
+    {
+        print_str("\t\tUse this option to keep sampling the SMART attributes and\n");
+        print_str("\t\tdevice statistics (SATA), the SMART / health log (NVMe) or\n");
+        print_str("\t\tthe error counter and temperature log pages (SAS) of all\n");
+        print_str("\t\tselected drives every [seconds] seconds. Device handles\n");
+        print_str("\t\tstay open and only these pages are read for each sample.\n");
+        print_str("\t\tThe change and rate per second of each value since the last\n");
+        print_str("\t\tsample are appended to a CSV file. Every value is written\n");
+        print_str("\t\tfor the first sample, then only values that changed.\n");
+        printf("\t\tUse --%s to choose the file. When the file reaches 64MiB it\n", WATCH_FILE_LONG_OPT_STRING);
+        print_str("\t\tis renamed to <file>.1 (older files are renamed up to\n");
+        print_str("\t\t<file>.4) and a new file is started.\n");
+        print_str("\t\tSampling continues until the tool is interrupted (Ctrl+C).\n\n");
+    }
+}
+
+void print_Watch_File_Help(bool shortHelp)
+{
+    printf("\t--%s [file name]\n", WATCH_FILE_LONG_OPT_STRING);
+    if (!shortHelp)
+    {
+        printf("\t\tUse this option with --%s to set the CSV file samples are\n", WATCH_LONG_OPT_STRING);
+        print_str("\t\tappended to. The default is openSeaChest_SMART_watch.csv\n");
+        print_str("\t\tin the current directory.\n\n");
+    }
+}
+
+void print_Health_Store_Help(bool shortHelp)
+{
+    printf("\t--%s [directory]\n", HEALTH_STORE_LONG_OPT_STRING);
+    if (!shortHelp)
+    {
+        print_str("\t\tUse this option to append a sample of the SMART attributes\n");
+        print_str("\t\tand device statistics (SATA), the SMART / health log (NVMe)\n");
+        print_str("\t\tor the error counter and temperature log pages (SAS) to a\n");
+        print_str("\t\thistory file for each drive in [directory]. The file is\n");
+        print_str("\t\tnamed <serial number>.oshs and is created on first use.\n");
+        print_str("\t\tValues are stored as differences from the previous sample,\n");
+        print_str("\t\tso a sample usually takes a few hundred bytes. The file is\n");
+        print_str("\t\tonly appended to and every record has a CRC. A record left\n");
+        print_str("\t\tincomplete by an interrupted run is removed. Run this\n");
+        print_str("\t\tperiodically (e.g. from cron) to keep a long term history.\n");
+        printf("\t\tWith --%s in openSeaChest_SMART, every sample is appended.\n\n",
+               WATCH_LONG_OPT_STRING);
+    }
+}
+
+void print_Prometheus_File_Help(bool shortHelp)
+{
+    printf("\t--%s [file name]\n", PROMETHEUS_FILE_LONG_OPT_STRING);
+    if (!shortHelp)
+    {
+        print_str("\t\tUse this option to read the SMART attributes and device\n");
+        print_str("\t\tstatistics (SATA), the SMART / health log (NVMe) or the\n");
+        print_str("\t\terror counter and temperature log pages (SAS) of all\n");
+        print_str("\t\tselected drives and write them as Prometheus metrics for\n");
+        print_str("\t\tthe node_exporter textfile collector. Lifetime counts are\n");
+        print_str("\t\ttyped as counters and named with a _total suffix, all other\n");
+        print_str("\t\tvalues are gauges. Each value is labeled with the device handle,\n");
+        print_str("\t\tserial number, model number, firmware revision and WWN.\n");
+        print_str("\t\tThe file is written under a temporary name and renamed\n");
+        print_str("\t\tover [file name] once complete, so a scrape never sees a\n");
+        print_str("\t\tpartial file. The file name should end in .prom.\n");
+        print_str("\t\tExample: --prometheusFile /var/lib/node_exporter/drives.prom\n\n");
+    }
+}
+
+void print_JSON_Output_Help(bool shortHelp, const char* supportedOptions)
+{
+    printf("\t--%s\n", JSON_OUTPUT_LONG_OPT_STRING);
+    if (!shortHelp)
+    {
+        print_str("\t\tUse this option to write the results of the informational\n");
+        print_str("\t\toptions as a single JSON document on stdout instead of\n");
+        print_str("\t\tthe human readable output. Each selected device is an\n");
+        print_str("\t\tentry in the \"devices\" array with its identity and one\n");
+        print_str("\t\tsection per option. A section has a \"status\" of\n");
+        print_str("\t\t\"success\", \"not supported\" or \"failed\".\n");
+        if (supportedOptions != M_NULLPTR)
+        {
+            printf("\t\tSupported with: %s\n", supportedOptions);
+        }
+        print_str("\n");
+    }
+}
+
+bool check_JSON_Output_Options(const textOnlyOption* options, size_t count, const char* supportedOptions)
+{
+    for (size_t iter = SIZE_T_C(0); options != M_NULLPTR && iter < count; ++iter)
+    {
+        if (options[iter].given)
+        {
+            printf("\nError: %s cannot be used with --%s.\n", options[iter].name, JSON_OUTPUT_LONG_OPT_STRING);
+            if (supportedOptions != M_NULLPTR)
+            {
+                printf("--%s is supported with: %s\n", JSON_OUTPUT_LONG_OPT_STRING, supportedOptions);
+            }
+            print_str("Use -h option to view command line help\n");
+            return false;
+        }
+    }
+    return true;
+}
+
+// stdout as it was before move_Messages_To_Stderr. M_NULLPTR until then.
+static FILE* dataOutputStream = M_NULLPTR;
+
+void move_Messages_To_Stderr(void)
+{
+    if (dataOutputStream != M_NULLPTR)
+    {
+        return;
+    }
+    flush_stdout();
+#if defined(UEFI_C_SOURCE)
+    dataOutputStream = stdout;
+#elif defined(_WIN32)
+    int dataDescriptor = _dup(_fileno(stdout));
+    if (dataDescriptor >= 0)
+    {
+        dataOutputStream = _fdopen(dataDescriptor, "w");
+        if (dataOutputStream == M_NULLPTR)
+        {
+            _close(dataDescriptor);
+        }
+        else if (_dup2(_fileno(stderr), _fileno(stdout)) != 0)
+        {
+            // messages stay on stdout
+            fclose(dataOutputStream);
+            dataOutputStream = M_NULLPTR;
+        }
+    }
+#else
+    int dataDescriptor = dup(fileno(stdout));
+    if (dataDescriptor >= 0)
+    {
+        dataOutputStream = fdopen(dataDescriptor, "w");
+        if (dataOutputStream == M_NULLPTR)
+        {
+            close(dataDescriptor);
+        }
+        else if (dup2(fileno(stderr), fileno(stdout)) < 0)
+        {
+            // messages stay on stdout
+            fclose(dataOutputStream);
+            dataOutputStream = M_NULLPTR;
+        }
+    }
+#endif
+    if (dataOutputStream == M_NULLPTR)
+    {
+        dataOutputStream = stdout;
+    }
+}
+
+FILE* get_Data_Output_Stream(void)
+{
+    return dataOutputStream != M_NULLPTR ? dataOutputStream : stdout;
+}
+
+void print_Read_Health_Store_Help(bool shortHelp)
+{
+    printf("\t--%s [file name]\n", READ_HEALTH_STORE_LONG_OPT_STRING);
+    if (!shortHelp)
+    {
+        printf("\t\tUse this option to print the history saved with --%s\n", HEALTH_STORE_LONG_OPT_STRING);
+        print_str("\t\tas CSV with one series per metric:\n");
+        print_str("\t\tMetric,Page,Index,Type,Time,Value\n");
+        print_str("\t\tNo device is needed. Add -q to print only the CSV.\n\n");
+    }
+}
+
 void print_Reinitialize_Device_Statistics_Help(bool shortHelp)
 {
     printf("\t--%s [", REINITIALIZE_DEV_STATS_LONG_OPT_STRING);
@@ -3282,6 +3651,124 @@ void print_Zone_ID_Help(bool shortHelp)
     }
 }
 
+void print_Zone_Summary_Help(bool shortHelp)
+{
+    printf("\t--%s [snapshot file]\n", ZONE_SUMMARY_LONG_OPT_STRING);
+    if (!shortHelp)
+    {
+        print_str("\t\tUse this option to summarize all zones on the device instead of\n");
+        print_str("\t\tlisting each one. The summary shows how many zones are in each\n");
+        print_str("\t\tcondition, how much of the write pointer zone capacity is written,\n");
+        print_str("\t\thow many zones are partially written, and how fragmented the empty\n");
+        print_str("\t\tzones are.\n");
+        print_str("\t\tIf a snapshot file is given, the zone index is saved to it. Later runs\n");
+        print_str("\t\tthat give the same file only reread the open and closed zones when\n");
+        print_str("\t\tthe zone counts and the first page of zones on the device still\n");
+        print_str("\t\tmatch the snapshot, which is much faster on drives with many zones.\n\n");
+    }
+}
+
+void print_Zone_Count_Help(bool shortHelp)
+{
+    printf("\t--%s [count]\n", ZONE_COUNT_LONG_OPT_STRING);
+    if (!shortHelp)
+    {
+        printf("\t\tUse this option with --%s to apply --%s, --%s, --%s, or\n", ZONE_ID_LONG_OPT_STRING,
+               CLOSE_ZONE_LONG_OPT_STRING, FINISH_ZONE_LONG_OPT_STRING, OPEN_ZONE_LONG_OPT_STRING);
+        printf("\t\t--%s to this many zones, starting with the specified zone.\n", RESET_WP_LONG_OPT_STRING);
+        printf("\t\tWhen --%s is also given, only matching zones are counted.\n", ZONE_FILTER_LONG_OPT_STRING);
+        print_str("\t\tThe zones are processed back to back and the time each command\n");
+        print_str("\t\ttook is summarized at the end.\n\n");
+    }
+}
+
+void print_Zone_List_Help(bool shortHelp)
+{
+    printf("\t--%s [file]\n", ZONE_LIST_LONG_OPT_STRING);
+    if (!shortHelp)
+    {
+        printf("\t\tUse this option to apply --%s, --%s, --%s, or --%s\n", CLOSE_ZONE_LONG_OPT_STRING,
+               FINISH_ZONE_LONG_OPT_STRING, OPEN_ZONE_LONG_OPT_STRING, RESET_WP_LONG_OPT_STRING);
+        print_str("\t\tto each zone ID in a text file. Zone IDs may be separated by spaces,\n");
+        print_str("\t\tcommas, or new lines, and anything after a # is ignored.\n");
+        print_str("\t\tIDs that are not the start of a zone are skipped.\n\n");
+    }
+}
+
+void print_Zone_Filter_Help(bool shortHelp)
+{
+    printf("\t--%s [empty | implicitOpen | explicitOpen | closed | full | \n", ZONE_FILTER_LONG_OPT_STRING);
+    print_str("\t          readOnly | offline | resetRecommended | nonSeqResourceAvailable]\n");
+    if (!shortHelp)
+    {
+        printf("\t\tUse this option to limit --%s, --%s, --%s, or --%s\n", CLOSE_ZONE_LONG_OPT_STRING,
+               FINISH_ZONE_LONG_OPT_STRING, OPEN_ZONE_LONG_OPT_STRING, RESET_WP_LONG_OPT_STRING);
+        printf("\t\tto zones in a given state, as reported by --%s.\n", REPORT_ZONES_LONG_OPT_STRING);
+        printf("\t\tCombine with --%s, --%s and --%s, or with --%s all.\n", ZONE_ID_LONG_OPT_STRING,
+               ZONE_COUNT_LONG_OPT_STRING, ZONE_LIST_LONG_OPT_STRING, ZONE_ID_LONG_OPT_STRING);
+        printf("\t\tEx: --%s --%s all --%s full\n\n", RESET_WP_LONG_OPT_STRING, ZONE_ID_LONG_OPT_STRING,
+               ZONE_FILTER_LONG_OPT_STRING);
+    }
+}
+
+void print_Zone_Batch_Help(bool shortHelp)
+{
+    printf("\t--%s\n", ZONE_BATCH_LONG_OPT_STRING);
+    if (!shortHelp)
+    {
+        printf("\t\tUse this option with --%s, --%s, or --%s to send each run\n", ZONE_COUNT_LONG_OPT_STRING,
+               ZONE_LIST_LONG_OPT_STRING, ZONE_FILTER_LONG_OPT_STRING);
+        print_str("\t\tof consecutive zones as a single command using the zone count field.\n");
+        print_str("\t\tThis requires a ZBC-2 or ZAC-2 device. If any zone in a run cannot\n");
+        print_str("\t\tchange state, the whole command fails.\n\n");
+    }
+}
+
+void print_Zone_Write_Benchmark_Help(bool shortHelp)
+{
+    printf("\t--%s [open zones]\n", ZONE_WRITE_BENCHMARK_LONG_OPT_STRING);
+    if (!shortHelp)
+    {
+        print_str("\t\tUse this option to measure sequential write performance on a zoned\n");
+        print_str("\t\tdevice. The given number of empty sequential zones (default 4) are\n");
+        print_str("\t\texplicitly opened and written together, one write per zone in turn,\n");
+        print_str("\t\talways at each zone's write pointer, until the amount set with\n");
+        printf("\t\t--%s (default 256MiB) is written to each zone. The\n", ZONE_WRITE_LIMIT_LONG_OPT_STRING);
+        print_str("\t\ttotal amount to be written is shown before starting. Throughput\n");
+        print_str("\t\tand latency are reported for every zone, then all of the zones are\n");
+        print_str("\t\treset to empty.\n");
+        print_str("\t\tOnly empty zones are written, but anything else writing to the drive\n");
+        print_str("\t\tat the same time, such as a mounted zoned filesystem, may choose the\n");
+        printf("\t\tsame zones, so this option requires --%s %s\n\n", CONFIRM_LONG_OPT_STRING,
+               POSSIBLE_DATA_ERASE_ACCEPT_STRING);
+    }
+}
+
+void print_Zone_Write_Transfer_Size_Help(bool shortHelp)
+{
+    printf("\t--%s [bytes]\n", ZONE_WRITE_TRANSFER_SIZE_LONG_OPT_STRING);
+    if (!shortHelp)
+    {
+        printf("\t\tUse this option to set the size of each write issued by --%s.\n",
+               ZONE_WRITE_BENCHMARK_LONG_OPT_STRING);
+        print_str("\t\tThe size is rounded down to a whole number of logical blocks.\n");
+        print_str("\t\tUnits such as KiB or MiB may be used. The default is 128KiB.\n\n");
+    }
+}
+
+void print_Zone_Write_Limit_Help(bool shortHelp)
+{
+    printf("\t--%s [bytes | all]\n", ZONE_WRITE_LIMIT_LONG_OPT_STRING);
+    if (!shortHelp)
+    {
+        printf("\t\tUse this option to set how much --%s writes to\n", ZONE_WRITE_BENCHMARK_LONG_OPT_STRING);
+        print_str("\t\teach zone. The amount is rounded down to a whole number of logical\n");
+        print_str("\t\tblocks and limited to the zone size. Units such as MiB or GiB may\n");
+        print_str("\t\tbe used. The default is 256MiB. Use \"all\" to fill every zone,\n");
+        print_str("\t\twhich can take a long time on drives with large zones.\n\n");
+    }
+}
+
 void print_Max_Zones_Help(bool shortHelp)
 {
     printf("\t--%s [count]\n", MAX_ZONES_LONG_OPT_STRING);
@@ -3655,12 +4142,12 @@ void print_Remove_Physical_Element_Status_Help(bool shortHelp)
         print_str("\t\tusable without the provided element #.\n");
         printf("\t\tUse the --%s option to see the status\n", SHOW_PHYSICAL_ELEMENT_STATUS_LONG_OPT_STRING);
         print_str("\t\tof the depopulation operation.\n");
-        set_Console_Foreground_Background_Colors(CONSOLE_COLOR_BRIGHT_RED, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_BRIGHT_RED, CONSOLE_COLOR_DEFAULT);
         print_str(
             "\t\tThere is an additional risk when performing a remove physical element as it low-level formats\n");
         print_str(
             "\t\tthe drive and may make the drive inoperable if it is reset at any time while it is formatting.\n");
-        set_Console_Foreground_Background_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
         print_str("\t\tWARNING: Removing a physical element affect all LUNs/namespaces for devices\n");
         print_str("\t\t         with multiple logical units or namespaces.\n\n");
     }
@@ -3678,12 +4165,12 @@ void print_Remove_Physical_Element_And_Modify_Zones_Help(bool shortHelp)
         print_str("\t\tusable without the provided element #.\n");
         printf("\t\tUse the --%s option to see the status\n", SHOW_PHYSICAL_ELEMENT_STATUS_LONG_OPT_STRING);
         print_str("\t\tof the depopulation operation.\n");
-        set_Console_Foreground_Background_Colors(CONSOLE_COLOR_BRIGHT_RED, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_BRIGHT_RED, CONSOLE_COLOR_DEFAULT);
         print_str(
             "\t\tThere is an additional risk when performing a remove physical element as it low-level formats\n");
         print_str(
             "\t\tthe drive and may make the drive inoperable if it is reset at any time while it is formatting.\n");
-        set_Console_Foreground_Background_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
         print_str("\t\tWARNING: Removing a physical element affect all LUNs/namespaces for devices\n");
         print_str("\t\t         with multiple logical units or namespaces.\n\n");
     }
@@ -3712,11 +4199,11 @@ void print_Repopulate_Elements_Help(bool shortHelp)
         print_str("\t\telements that have been removed from use.\n");
         print_str("\t\tA full disk overwrite is necessary before\n");
         print_str("\t\tthe drive is usable.\n");
-        set_Console_Foreground_Background_Colors(CONSOLE_COLOR_BRIGHT_RED, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_BRIGHT_RED, CONSOLE_COLOR_DEFAULT);
         print_str("\t\tThere is an additional risk when performing a repopulate as it low-level formats\n");
         print_str(
             "\t\tthe drive and may make the drive inoperable if it is reset at any time while it is formatting.\n");
-        set_Console_Foreground_Background_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
         print_str("\t\tWARNING: Removing a physical element affect all LUNs/namespaces for devices\n");
         print_str("\t\t         with multiple logical units or namespaces.\n\n");
         print_str("\n");
@@ -3853,6 +4340,34 @@ void print_SCSI_Defects_Format_Help(bool shortHelp)
     }
 }
 
+void print_SCSI_Defects_File_Help(bool shortHelp)
+{
+    printf("\t--%s [filename]\t(SAS Only)\n", SCSI_DEFECTS_FILE_LONG_OPT_STRING);
+    if (!shortHelp)
+    {
+        printf("\t\tUse this option with --%s to write the defects to a file\n", SCSI_DEFECTS_LONG_OPT_STRING);
+        print_str("\t\tinstead of the screen. The list is read in fixed size pieces and each\n");
+        print_str("\t\tpiece is written before the next is read, so very large primary lists\n");
+        print_str("\t\tdo not need to fit in memory and an interrupted run keeps the defects\n");
+        print_str("\t\tread so far.\n");
+        printf("\t\tUse the --%s option to choose CSV or binary output.\n\n",
+               SCSI_DEFECTS_FILE_FORMAT_LONG_OPT_STRING);
+    }
+}
+
+void print_SCSI_Defects_File_Format_Help(bool shortHelp)
+{
+    printf("\t--%s [ csv | bin ]\t(SAS Only)\n", SCSI_DEFECTS_FILE_FORMAT_LONG_OPT_STRING);
+    if (!shortHelp)
+    {
+        printf("\t\tSet the format of the file written by --%s.\n", SCSI_DEFECTS_FILE_LONG_OPT_STRING);
+        print_str("\t\tArguments:\n");
+        print_str("\t\t  csv - one defect per row, in the columns of the defect format (default)\n");
+        print_str("\t\t  bin - the READ DEFECT DATA (12) header followed by the raw address\n");
+        print_str("\t\t        descriptors returned by the drive.\n\n");
+    }
+}
+
 void print_Reallocate_LBAs_Help(bool shortHelp)
 {
     printf("\t--%s [address,address,...]\t(SAS Only)\n", SCSI_REALLOCATE_BLOCKS_LIST_LONG_OPT_STRING);
@@ -3919,6 +4434,127 @@ void print_Pull_Device_Statistics_Log_Help(bool shortHelp)
     }
 }
 
+void print_Parallel_Logs_Help(bool shortHelp)
+{
+    printf("\t--%s [max per controller]\n", PARALLEL_LOGS_LONG_OPT_STRING);
+    if (!shortHelp)
+    {
+        print_str("\t\tUse this option with -d all or a list of devices to pull the\n");
+        print_str("\t\tFARM, telemetry, DST, identify device data, SATA phy event,\n");
+        print_str("\t\tdevice statistics and informational exceptions logs from all\n");
+        print_str("\t\tdevices at the same time instead of one device after another.\n");
+        print_str("\t\tEach device's logs are saved in a subdirectory of the output\n");
+        print_str("\t\tpath named by serial number, and a manifest CSV with the size,\n");
+        print_str("\t\ttime and status of every pull is written to the output path.\n");
+        print_str("\t\tThe optional value limits how many devices on the same\n");
+        print_str("\t\tcontroller are pulled from at once (default 4). NVMe devices\n");
+        print_str("\t\tare each their own controller. SATA/SAS devices are grouped\n");
+        print_str("\t\tby the adapter vendor and product they are attached through.\n");
+        print_str("\t\tThe generic log and error history pulls cannot be combined\n");
+        print_str("\t\twith this option.\n\n");
+    }
+}
+
+void print_Skip_Unchanged_Logs_Help(bool shortHelp)
+{
+    printf("\t--%s\n", SKIP_UNCHANGED_LOGS_LONG_OPT_STRING);
+    if (!shortHelp)
+    {
+        print_str("\t\tUse this option with --getTelemetry saved (cntl on NVMe) to\n");
+        print_str("\t\tskip pulling the log when the device has not captured new data\n");
+        print_str("\t\tsince the last pull to the same output path. The data\n");
+        print_str("\t\tgeneration number and size in the log header are compared to\n");
+        print_str("\t\tthe .lastpull record kept from the previous pull.\n");
+        print_str("\t\tTelemetry pulls always go to a .partial file first. If a pull\n");
+        print_str("\t\tfails part way, running the same command again resumes it from\n");
+        print_str("\t\tthe last completed transfer as long as the data on the device\n");
+        print_str("\t\thas not changed.\n\n");
+    }
+}
+
+void print_Compress_Logs_Help(bool shortHelp)
+{
+    printf("\t--%s\n", COMPRESS_LOGS_LONG_OPT_STRING);
+    if (!shortHelp)
+    {
+        print_str("\t\tUse this option to compress the log files this run writes to\n");
+        print_str("\t\tthe output path. Files that were already in the output path\n");
+        print_str("\t\tare left alone. Files are compressed in the background while the\n");
+        print_str("\t\tnext logs are pulled, and each one is written to <file>.lz4.\n");
+        print_str("\t\tThese are standard LZ4 frames that can be read with lz4 -d.\n");
+        print_str("\t\tLogs are stored in independent 256KiB blocks, followed by an\n");
+        print_str("\t\tindex of the blocks that lz4 skips, so part of a log can be read\n");
+        print_str("\t\twithout decompressing the whole file. Every compressed file is\n");
+        print_str("\t\tdecoded again and compared to the original before it is kept.\n");
+        printf("\t\tThe original logs are kept unless --%s\n", COMPRESS_LOGS_REMOVE_ORIGINAL_LONG_OPT_STRING);
+        print_str("\t\tis also given.\n\n");
+    }
+}
+
+void print_Compress_Logs_Remove_Original_Help(bool shortHelp)
+{
+    printf("\t--%s\n", COMPRESS_LOGS_REMOVE_ORIGINAL_LONG_OPT_STRING);
+    if (!shortHelp)
+    {
+        printf("\t\tUse this option with --%s to remove each original log\n", COMPRESS_LOGS_LONG_OPT_STRING);
+        print_str("\t\tonce its compressed copy has been decoded and matches the\n");
+        print_str("\t\toriginal length and CRC32. Logs that fail this check are kept\n");
+        print_str("\t\tand the compressed copy is removed.\n\n");
+    }
+}
+
+void print_Log_Diff_Help(bool shortHelp)
+{
+    printf("\t--%s [file]\n", LOG_DIFF_LONG_OPT_STRING);
+    if (!shortHelp)
+    {
+        print_str("\t\tUse this option with --logDiffBaseline to compare two binary\n");
+        print_str("\t\tpulls of the same log saved by this tool, such as a SCSI log\n");
+        print_str("\t\tpage, the ATA device statistics, the SATA phy event counters or\n");
+        printf("\t\tthe NVMe SMART / health information log (with --%s).\n", LOG_DIFF_FORMAT_LONG_OPT_STRING);
+        print_str("\t\tThe known values are decoded by name and only the ones that\n");
+        print_str("\t\tchanged are shown, with the difference and the rate per hour\n");
+        print_str("\t\tfor counters.\n");
+        print_str("\t\tNo device is needed for this option.\n\n");
+    }
+}
+
+void print_Log_Diff_Baseline_Help(bool shortHelp)
+{
+    printf("\t--%s [file]\n", LOG_DIFF_BASELINE_LONG_OPT_STRING);
+    if (!shortHelp)
+    {
+        print_str("\t\tThe earlier pull of the log to compare against the file given\n");
+        print_str("\t\tto --logDiff.\n\n");
+    }
+}
+
+void print_Log_Diff_Format_Help(bool shortHelp)
+{
+    printf("\t--%s [scsi | deviceStatistics | phyEvents | nvmeHealth]\n", LOG_DIFF_FORMAT_LONG_OPT_STRING);
+    if (!shortHelp)
+    {
+        printf("\t\tThe layout of the two files given to --%s. Without this\n", LOG_DIFF_LONG_OPT_STRING);
+        print_str("\t\toption SCSI log pages, the ATA device statistics and the SATA\n");
+        print_str("\t\tphy event counters are identified from their content. The NVMe\n");
+        print_str("\t\tSMART / health information log has no signature, so it is only\n");
+        print_str("\t\tcompared when nvmeHealth is given. Files that do not match the\n");
+        print_str("\t\tgiven layout are rejected.\n\n");
+    }
+}
+
+void print_Log_Diff_Hours_Help(bool shortHelp)
+{
+    printf("\t--%s [hours]\n", LOG_DIFF_HOURS_LONG_OPT_STRING);
+    if (!shortHelp)
+    {
+        print_str("\t\tThe number of hours between the two pulls given to --logDiff.\n");
+        print_str("\t\tWithout this option the difference in power on hours is used\n");
+        print_str("\t\tfor logs that report it. Logs without power on hours show no\n");
+        print_str("\t\trates unless this option is given.\n\n");
+    }
+}
+
 void print_Pull_Informational_Exceptions_Log_Help(bool shortHelp)
 {
     printf("\t--%s\t\t\t(SAS only)\n", INFORMATIONAL_EXCEPTIONS_LONG_OPT_STRING);
@@ -4635,13 +5271,41 @@ void print_Pull_Power_Telemetry_Help(bool shortHelp)
     }
 }
 
-void print_Show_Reservation_Capabilities(bool shortHelp)
+void print_Power_Sampling_Help(bool shortHelp)
 {
-    printf("\t--%s\t(NVMe & SAS Only)\n", SHOW_RESERVATION_CAPABILITIES_LONG_OPT_STRING);
+    printf("\t--%s [seconds]\t(Seagate Only)\n", POWER_SAMPLING_LONG_OPT_STRING);
     if (!shortHelp)
     {
-        print_str("\t\tThis options shows the persistent reservation\n");
-        print_str("\t\tcapabilities for a device.\n");
+        print_str("\t\tUse this option to request power measurements one after\n");
+        print_str("\t\tanother for the given number of seconds and keep every sample\n");
+        print_str("\t\tfrom every selected drive. Samples are buffered in memory and\n");
+        print_str("\t\twritten every few minutes to <serial number>_<start time>.ospw,\n");
+        print_str("\t\ta compact binary file with the time, 5v and 12v power of each\n");
+        print_str("\t\tsample. Each run writes new files, earlier ones are kept.\n");
+        print_str("\t\tThe mean, minimum and maximum 5v and 12v power of each drive\n");
+        print_str("\t\tare shown when sampling completes.\n");
+        printf("\t\tUse the --%s option to choose which power sources to measure.\n\n",
+               REQUEST_POWER_TELEMETRY_MEASUREMENT_MODE_LONG_OPT_STRING);
+    }
+}
+
+void print_Power_Sample_Dir_Help(bool shortHelp)
+{
+    printf("\t--%s [directory]\t(Seagate Only)\n", POWER_SAMPLE_DIR_LONG_OPT_STRING);
+    if (!shortHelp)
+    {
+        printf("\t\tThe directory --%s writes the sample files to.\n", POWER_SAMPLING_LONG_OPT_STRING);
+        print_str("\t\tThe current directory is used when this option is not given.\n\n");
+    }
+}
+
+void print_Show_Reservation_Capabilities(bool shortHelp)
+{
+    printf("\t--%s\t(NVMe & SAS Only)\n", SHOW_RESERVATION_CAPABILITIES_LONG_OPT_STRING);
+    if (!shortHelp)
+    {
+        print_str("\t\tThis options shows the persistent reservation\n");
+        print_str("\t\tcapabilities for a device.\n");
         print_str("\t\tNOTE: Older device supporting SPC or SPC2 may not support\n");
         print_str("\t\tshowing capabilities, but do support persistent reservations.\n\n");
     }
@@ -5465,7 +6129,12 @@ void print_Raw_Output_File_Help(bool shortHelp)
         print_str("\t\tcreated files. If an error occurs on a datain\n");
         print_str("\t\traw command, the returned error data will not be\n");
         print_str("\t\tsaved to a file to prevent adding unexpected data\n");
-        print_str("\t\tto the created file.\n\n");
+        print_str("\t\tto the created file.\n");
+        print_str("\t\tREAD (10/12/16), READ SECTORS/DMA EXT, and READ LOG\n");
+        print_str("\t\t(DMA) EXT commands larger than the maximum transfer\n");
+        print_str("\t\tlength are split into multiple commands and each piece\n");
+        print_str("\t\tis appended to this file as it is received. Returned\n");
+        print_str("\t\tdata is not displayed for these split transfers.\n\n");
     }
 }
 
@@ -5509,6 +6178,21 @@ void print_Raw_Input_File_Offset_Help(bool shortHelp)
     }
 }
 
+void print_Raw_Hex_Dump_Benchmark_Help(bool shortHelp)
+{
+    printf("\t--%s [MiB]\n", RAW_HEX_DUMP_BENCHMARK_LONG_OPT_STRING);
+    if (!shortHelp)
+    {
+        print_str("\t\tUse this option to measure how fast data buffers are formatted\n");
+        print_str("\t\tas hex dumps. A buffer of random data (16MiB by default) is\n");
+        print_str("\t\tformatted with the per-byte formatter and the block formatter\n");
+        print_str("\t\tused for large transfers, and the throughput of each is shown.\n");
+        print_str("\t\tThe dumps themselves go to stdout and the results to stderr, so\n");
+        print_str("\t\tredirect stdout to a file or null device to time only formatting.\n");
+        print_str("\t\tNo device handle is needed for this option.\n\n");
+    }
+}
+
 void print_Check_Pending_List_Help(bool shortHelp)
 {
     printf("\t--%s [count to check]\n", CHECK_PENDING_LIST_COUNT_LONG_OPT_STRING);
@@ -5542,6 +6226,28 @@ void print_Show_Pending_List_Help(bool shortHelp)
     }
 }
 
+void print_Repair_Pending_List_Help(bool shortHelp)
+{
+    printf("\t--%s [reassign | write]\n", REPAIR_PENDING_LIST_LONG_OPT_STRING);
+    if (!shortHelp)
+    {
+        print_str("\t\tUse this option to repair every LBA on the pending list. The list is\n");
+        print_str("\t\tsorted and merged into ranges of whole physical sectors, which are\n");
+        print_str("\t\trepaired with as few commands as possible while progress and\n");
+        print_str("\t\tthroughput are reported.\n");
+        print_str("\t\t    reassign - send the LBAs to the drive in long REASSIGN BLOCKS\n");
+        print_str("\t\t               lists. This is the default for SAS/SCSI devices.\n");
+        print_str("\t\t    write - write zeros over each range in large transfers so that\n");
+        print_str("\t\t            the drive reallocates any sector it cannot write.\n");
+        print_str("\t\t            This is the default for all other devices.\n");
+        print_str("\t\tLBAs that cannot be repaired are listed as ranges at the end. Every\n");
+        printf("\t\tpending LBA is attempted unless --%s is also given, in which\n", ERROR_LIMIT_LONG_OPT_STRING);
+        print_str("\t\tcase the repair stops once more of them fail than that limit.\n");
+        print_str("\t\tAny data in the pending LBAs is lost. This option requires\n");
+        printf("\t\t--%s %s\n\n", CONFIRM_LONG_OPT_STRING, SINGLE_SECTOR_DATA_ERASE_ACCEPT_STRING);
+    }
+}
+
 void print_Create_Uncorrectable_Help(bool shortHelp)
 {
     printf("\t--%s [lba]\n", CREATE_UNCORRECTABLE_LONG_OPT_STRING);
@@ -5597,6 +6303,39 @@ void print_Random_Uncorrectable_Help(bool shortHelp)
     }
 }
 
+void print_Uncorrectable_List_Help(bool shortHelp)
+{
+    printf("\t--%s [filename]\n", UNCORRECTABLE_LIST_LONG_OPT_STRING);
+    if (!shortHelp)
+    {
+        print_str("\t\tUse this option to create uncorrectable errors at every range\n");
+        print_str("\t\tin a file. Each line holds a starting LBA and an optional\n");
+        print_str("\t\tnumber of LBAs (default 1), separated by a comma, space or tab.\n");
+        print_str("\t\tLines that do not start with a number, such as # comments or\n");
+        print_str("\t\ta CSV header, are skipped, so a manifest from an earlier run\n");
+        print_str("\t\tcan be used to inject the same ranges again.\n");
+        print_str("\t\tRanges are merged and sent as range commands (ATA WRITE\n");
+        print_str("\t\tUNCORRECTABLE EXT or NVMe Write Uncorrectable) where the\n");
+        print_str("\t\tdevice supports them, otherwise one LBA at a time.\n");
+        print_str("\t\tThe first and last LBA of each range are read back unless\n");
+        printf("\t\t--%s is given. Everything that was injected\n", DISABLE_READ_UNCORRECTABLES_LONG_OPT_STRING);
+        print_str("\t\tis recorded in an UNCORRECTABLES CSV manifest.\n");
+        printf("\t\tUse --%s to flag the LBAs instead.\n\n", FLAG_UNCORRECTABLE_LONG_OPT_STRING);
+    }
+}
+
+void print_Random_Uncorrectable_Ranges_Help(bool shortHelp)
+{
+    printf("\t--%s [number of ranges]\n", RANDOM_UNCORRECTABLE_RANGES_LONG_OPT_STRING);
+    if (!shortHelp)
+    {
+        print_str("\t\tUse this option to create uncorrectable errors at a number of\n");
+        print_str("\t\trandom, non-overlapping ranges in one batch. Each range is\n");
+        printf("\t\t1 to --%s LBAs long (default 1).\n", UNCORRECTABLE_RANGE_LONG_OPT_STRING);
+        printf("\t\tThe ranges are injected as described for --%s.\n\n", UNCORRECTABLE_LIST_LONG_OPT_STRING);
+    }
+}
+
 void print_Disable_Read_Uncorrectables_Help(bool shortHelp)
 {
     printf("\t--%s\n", DISABLE_READ_UNCORRECTABLES_LONG_OPT_STRING);
@@ -5747,3 +6486,908 @@ void print_Config_CDL_Settings_Help(bool shortHelp)
     }
 }
 #endif
+
+#define HEX_DUMP_BYTES_PER_LINE   UINT32_C(16)
+#define HEX_DUMP_OUTPUT_BLOCK_LEN SIZE_T_C(65536)
+#define HEX_DUMP_FALLBACK_LEN     SIZE_T_C(4096)
+// "  0x" + 8 offset digits + space + 16 * "XX " + 2 spaces + 16 ASCII characters + newline
+#define HEX_DUMP_MAX_LINE_LEN SIZE_T_C(88)
+
+// Two characters per byte value so a byte is formatted with a single 2 byte copy.
+static const char hexDumpBytePairs[] =
+    "000102030405060708090A0B0C0D0E0F101112131415161718191A1B1C1D1E1F"
+    "202122232425262728292A2B2C2D2E2F303132333435363738393A3B3C3D3E3F"
+    "404142434445464748494A4B4C4D4E4F505152535455565758595A5B5C5D5E5F"
+    "606162636465666768696A6B6C6D6E6F707172737475767778797A7B7C7D7E7F"
+    "808182838485868788898A8B8C8D8E8F909192939495969798999A9B9C9D9E9F"
+    "A0A1A2A3A4A5A6A7A8A9AAABACADAEAFB0B1B2B3B4B5B6B7B8B9BABBBCBDBEBF"
+    "C0C1C2C3C4C5C6C7C8C9CACBCCCDCECFD0D1D2D3D4D5D6D7D8D9DADBDCDDDEDF"
+    "E0E1E2E3E4E5E6E7E8E9EAEBECEDEEEFF0F1F2F3F4F5F6F7F8F9FAFBFCFDFEFF";
+
+static const char hexDumpDigits[] = "0123456789ABCDEF";
+
+static M_INLINE void hex_Dump_ASCII_Column(char* output, const uint8_t* data, uint32_t count)
+{
+#if defined(HEX_DUMP_USE_SSE2)
+    if (count == HEX_DUMP_BYTES_PER_LINE)
+    {
+        // signed compares: bytes 0x80-0xFF are negative so they fail the > 0x1F test along with control characters
+        __m128i bytes     = _mm_loadu_si128(C_CAST(const __m128i*, C_CAST(const void*, data)));
+        __m128i printable = _mm_and_si128(_mm_cmpgt_epi8(bytes, _mm_set1_epi8(0x1F)),
+                                          _mm_cmplt_epi8(bytes, _mm_set1_epi8(0x7F)));
+        __m128i result    = _mm_or_si128(_mm_and_si128(printable, bytes),
+                                         _mm_andnot_si128(printable, _mm_set1_epi8(C_CAST(char, '.'))));
+        _mm_storeu_si128(C_CAST(__m128i*, C_CAST(void*, output)), result);
+        return;
+    }
+#endif
+    for (uint32_t iter = UINT32_C(0); iter < count; ++iter)
+    {
+        output[iter] = (data[iter] > 0x1F && data[iter] < 0x7F) ? C_CAST(char, data[iter]) : '.';
+    }
+}
+
+static bool write_Hex_Dump_Block(const char* block, size_t length, uint64_t* totalWritten)
+{
+    if (length > SIZE_T_C(0))
+    {
+        size_t written = fwrite(block, sizeof(char), length, stdout);
+        *totalWritten += written;
+        return written == length;
+    }
+    return true;
+}
+
+uint64_t print_Data_Buffer_Fast(const uint8_t* dataBuffer, uint32_t bufferLen, bool showPrint)
+{
+    uint64_t totalWritten = UINT64_C(0);
+    DECLARE_ZERO_INIT_ARRAY(char, fallbackBlock, HEX_DUMP_FALLBACK_LEN);
+    char*  block       = C_CAST(char*, safe_malloc(HEX_DUMP_OUTPUT_BLOCK_LEN));
+    size_t blockSize   = HEX_DUMP_OUTPUT_BLOCK_LEN;
+    size_t used        = SIZE_T_C(0);
+    int    offsetWidth = 2;
+    if (block == M_NULLPTR)
+    {
+        block     = fallbackBlock;
+        blockSize = HEX_DUMP_FALLBACK_LEN;
+    }
+    if (bufferLen > UINT8_MAX)
+    {
+        offsetWidth = bufferLen > UINT16_MAX ? (bufferLen > UINT32_C(0xFFFFFF) ? 8 : 6) : 4;
+    }
+    // header row of column offsets lined up over the first digit of each byte
+    block[used++] = '\n';
+    safe_memset(&block[used], blockSize - used, ' ', C_CAST(size_t, offsetWidth) + SIZE_T_C(5));
+    used += C_CAST(size_t, offsetWidth) + SIZE_T_C(5);
+    for (uint32_t column = UINT32_C(0); column < HEX_DUMP_BYTES_PER_LINE && column < bufferLen; ++column)
+    {
+        block[used++] = hexDumpDigits[column];
+        block[used++] = ' ';
+        block[used++] = ' ';
+    }
+    block[used++] = '\n';
+    for (uint32_t lineOffset = UINT32_C(0); lineOffset < bufferLen; lineOffset += HEX_DUMP_BYTES_PER_LINE)
+    {
+        const uint8_t* line      = &dataBuffer[lineOffset];
+        uint32_t       lineCount = M_Min(HEX_DUMP_BYTES_PER_LINE, bufferLen - lineOffset);
+        if (blockSize - used < HEX_DUMP_MAX_LINE_LEN)
+        {
+            if (!write_Hex_Dump_Block(block, used, &totalWritten))
+            {
+                break;
+            }
+            used = SIZE_T_C(0);
+        }
+        block[used++] = ' ';
+        block[used++] = ' ';
+        block[used++] = '0';
+        block[used++] = 'x';
+        for (int digit = offsetWidth - 1; digit >= 0; --digit)
+        {
+            block[used++] = hexDumpDigits[(lineOffset >> (C_CAST(uint32_t, digit) * UINT32_C(4))) & UINT32_C(0xF)];
+        }
+        block[used++] = ' ';
+        for (uint32_t byteIter = UINT32_C(0); byteIter < lineCount; ++byteIter)
+        {
+            const char* pair = &hexDumpBytePairs[C_CAST(size_t, line[byteIter]) * SIZE_T_C(2)];
+            block[used++]    = pair[0];
+            block[used++]    = pair[1];
+            block[used++]    = ' ';
+        }
+        if (showPrint)
+        {
+            // pad a short final line so the ASCII column stays aligned with the lines above it
+            size_t padding = C_CAST(size_t, HEX_DUMP_BYTES_PER_LINE - lineCount) * SIZE_T_C(3) + SIZE_T_C(2);
+            safe_memset(&block[used], blockSize - used, ' ', padding);
+            used += padding;
+            hex_Dump_ASCII_Column(&block[used], line, lineCount);
+            used += lineCount;
+        }
+        block[used++] = '\n';
+    }
+    block[used++] = '\n';
+    write_Hex_Dump_Block(block, used, &totalWritten);
+    if (block != fallbackBlock)
+    {
+        safe_free(&block);
+    }
+    return totalWritten;
+}
+
+bool get_Directory_File_Bytes(const char* path, uint64_t* totalBytes)
+{
+    bool listed = false;
+    if (path == M_NULLPTR || totalBytes == M_NULLPTR)
+    {
+        return false;
+    }
+    *totalBytes = UINT64_C(0);
+#if defined(UEFI_C_SOURCE)
+    listed = false;
+#elif defined(_WIN32)
+    WIN32_FIND_DATAA findData;
+    HANDLE           findHandle = INVALID_HANDLE_VALUE;
+    DECLARE_ZERO_INIT_ARRAY(char, searchPath, OPENSEA_PATH_MAX);
+    snprintf_err_handle(searchPath, OPENSEA_PATH_MAX, "%s\\*", path);
+    safe_memset(&findData, sizeof(WIN32_FIND_DATAA), 0, sizeof(WIN32_FIND_DATAA));
+    findHandle = FindFirstFileA(searchPath, &findData);
+    if (findHandle != INVALID_HANDLE_VALUE)
+    {
+        listed = true;
+        do
+        {
+            if (!(findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY))
+            {
+                *totalBytes += (C_CAST(uint64_t, findData.nFileSizeHigh) << 32) | findData.nFileSizeLow;
+            }
+        } while (FindNextFileA(findHandle, &findData));
+        FindClose(findHandle);
+    }
+#else
+    DIR* directory = opendir(path);
+    if (directory != M_NULLPTR)
+    {
+        struct dirent* entry = M_NULLPTR;
+        listed               = true;
+        while ((entry = readdir(directory)) != M_NULLPTR)
+        {
+            struct stat fileStat;
+            DECLARE_ZERO_INIT_ARRAY(char, filePath, OPENSEA_PATH_MAX);
+            snprintf_err_handle(filePath, OPENSEA_PATH_MAX, "%s/%s", path, entry->d_name);
+            safe_memset(&fileStat, sizeof(struct stat), 0, sizeof(struct stat));
+            if (0 == stat(filePath, &fileStat) && S_ISREG(fileStat.st_mode))
+            {
+                *totalBytes += C_CAST(uint64_t, fileStat.st_size);
+            }
+        }
+        closedir(directory);
+    }
+#endif
+    return listed;
+}
+
+// First range that ends at or after lba, so a range starting at lba can be merged with it.
+static uint32_t find_First_LBA_Interval_Ending_At(const lbaIntervalSet* set, uint64_t lba)
+{
+    uint32_t low  = UINT32_C(0);
+    uint32_t high = set->count;
+    while (low < high)
+    {
+        uint32_t middle = low + ((high - low) / UINT32_C(2));
+        if (set->intervals[middle].start + set->intervals[middle].length < lba)
+        {
+            low = middle + UINT32_C(1);
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+// First range that starts after lba.
+static uint32_t find_First_LBA_Interval_Starting_After(const lbaIntervalSet* set, uint64_t lba)
+{
+    uint32_t low  = UINT32_C(0);
+    uint32_t high = set->count;
+    while (low < high)
+    {
+        uint32_t middle = low + ((high - low) / UINT32_C(2));
+        if (set->intervals[middle].start <= lba)
+        {
+            low = middle + UINT32_C(1);
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+static bool grow_LBA_Interval_Set(lbaIntervalSet* set, uint32_t needed)
+{
+    if (set->count + needed > set->capacity)
+    {
+        uint32_t     newCapacity  = set->capacity == UINT32_C(0) ? UINT32_C(64) : set->capacity * UINT32_C(2);
+        lbaInterval* newIntervals = M_NULLPTR;
+        if (set->count + needed < set->count || newCapacity < set->capacity)
+        {
+            return false;
+        }
+        newCapacity  = M_Max(newCapacity, set->count + needed);
+        newIntervals =
+            C_CAST(lbaInterval*, safe_realloc(set->intervals, C_CAST(size_t, newCapacity) * sizeof(lbaInterval)));
+        if (newIntervals == M_NULLPTR)
+        {
+            return false;
+        }
+        set->intervals = newIntervals;
+        set->capacity  = newCapacity;
+    }
+    return true;
+}
+
+// Replaces intervals[first] through intervals[first + removed - 1] with the ranges in replacements.
+static void replace_LBA_Intervals(lbaIntervalSet*    set,
+                                  uint32_t           first,
+                                  uint32_t           removed,
+                                  const lbaInterval* replacements,
+                                  uint32_t           replacementCount)
+{
+    uint32_t tail = set->count - first - removed;
+    for (uint32_t iter = first; iter < first + removed; ++iter)
+    {
+        set->totalLBAs -= set->intervals[iter].length;
+    }
+    if (tail > UINT32_C(0) && removed != replacementCount)
+    {
+        safe_memmove(&set->intervals[first + replacementCount],
+                     C_CAST(size_t, set->capacity - first - replacementCount) * sizeof(lbaInterval),
+                     &set->intervals[first + removed], C_CAST(size_t, tail) * sizeof(lbaInterval));
+    }
+    for (uint32_t iter = UINT32_C(0); iter < replacementCount; ++iter)
+    {
+        set->intervals[first + iter] = replacements[iter];
+        set->totalLBAs += replacements[iter].length;
+    }
+    set->count = set->count - removed + replacementCount;
+}
+
+eReturnValues add_LBA_Interval(lbaIntervalSet* set, uint64_t start, uint64_t length)
+{
+    lbaInterval merged;
+    uint32_t    first = UINT32_C(0);
+    uint32_t    last  = UINT32_C(0);
+    if (set == M_NULLPTR || length == UINT64_C(0) || start + length < start)
+    {
+        return BAD_PARAMETER;
+    }
+    merged.start  = start;
+    merged.length = length;
+    first         = find_First_LBA_Interval_Ending_At(set, start);
+    last          = find_First_LBA_Interval_Starting_After(set, start + length);
+    if (first == last && !grow_LBA_Interval_Set(set, UINT32_C(1)))
+    {
+        return MEMORY_FAILURE;
+    }
+    if (first < last)
+    {
+        uint64_t end  = M_Max(start + length, set->intervals[last - 1].start + set->intervals[last - 1].length);
+        merged.start  = M_Min(start, set->intervals[first].start);
+        merged.length = end - merged.start;
+    }
+    replace_LBA_Intervals(set, first, last - first, &merged, UINT32_C(1));
+    return SUCCESS;
+}
+
+eReturnValues remove_LBA_Interval(lbaIntervalSet* set, uint64_t start, uint64_t length)
+{
+    lbaInterval pieces[2];
+    uint32_t    pieceCount = UINT32_C(0);
+    uint32_t    first      = UINT32_C(0);
+    uint32_t    last       = UINT32_C(0);
+    uint64_t    end        = start + length;
+    if (set == M_NULLPTR || end < start)
+    {
+        return BAD_PARAMETER;
+    }
+    if (length == UINT64_C(0))
+    {
+        return SUCCESS;
+    }
+    // ranges that end exactly at start or begin exactly at end are not touched
+    first = find_First_LBA_Interval_Ending_At(set, start + UINT64_C(1));
+    last  = find_First_LBA_Interval_Starting_After(set, end - UINT64_C(1));
+    if (first >= last)
+    {
+        return SUCCESS;
+    }
+    if (set->intervals[first].start < start)
+    {
+        pieces[pieceCount].start  = set->intervals[first].start;
+        pieces[pieceCount].length = start - set->intervals[first].start;
+        ++pieceCount;
+    }
+    if (set->intervals[last - 1].start + set->intervals[last - 1].length > end)
+    {
+        pieces[pieceCount].start  = end;
+        pieces[pieceCount].length = set->intervals[last - 1].start + set->intervals[last - 1].length - end;
+        ++pieceCount;
+    }
+    if (pieceCount > last - first && !grow_LBA_Interval_Set(set, pieceCount - (last - first)))
+    {
+        return MEMORY_FAILURE;
+    }
+    replace_LBA_Intervals(set, first, last - first, pieces, pieceCount);
+    return SUCCESS;
+}
+
+bool find_LBA_Interval(const lbaIntervalSet* set, uint64_t lba, uint32_t* index)
+{
+    bool     found = false;
+    uint32_t next  = UINT32_C(0);
+    if (set != M_NULLPTR)
+    {
+        next = find_First_LBA_Interval_Starting_After(set, lba);
+        if (next > UINT32_C(0) && lba < set->intervals[next - 1].start + set->intervals[next - 1].length)
+        {
+            found = true;
+            --next;
+        }
+    }
+    if (index != M_NULLPTR)
+    {
+        *index = next;
+    }
+    return found;
+}
+
+void free_LBA_Interval_Set(lbaIntervalSet* set)
+{
+    if (set != M_NULLPTR)
+    {
+        safe_free(&set->intervals);
+        set->count     = UINT32_C(0);
+        set->capacity  = UINT32_C(0);
+        set->totalLBAs = UINT64_C(0);
+    }
+}
+
+#define SCSI_DEFECT_STREAM_BUFFER_SIZE  UINT32_C(65536)
+#define SCSI_DEFECT_HEADER_LENGTH       UINT32_C(8)
+#define SCSI_DEFECT_TEXT_LINE_LENGTH    SIZE_T_C(64)
+#define SCSI_DEFECT_FULL_TRACK          UINT32_C(0xFFFFFFFF)
+#define SCSI_DEFECT_EXTENDED_FULL_TRACK UINT32_C(0x0FFFFFFF)
+
+static uint32_t get_SCSI_Defect_Descriptor_Length(uint8_t defectListFormat)
+{
+    switch (defectListFormat)
+    {
+    case AD_SHORT_BLOCK_FORMAT_ADDRESS_DESCRIPTOR:
+        return UINT32_C(4);
+    case AD_EXTENDED_BYTES_FROM_INDEX_FORMAT_ADDRESS_DESCRIPTOR:
+    case AD_EXTENDED_PHYSICAL_SECTOR_FORMAT_ADDRESS_DESCRIPTOR:
+    case AD_LONG_BLOCK_FORMAT_ADDRESS_DESCRIPTOR:
+    case AD_BYTES_FROM_INDEX_FORMAT_ADDRESS_DESCRIPTOR:
+    case AD_PHYSICAL_SECTOR_FORMAT_ADDRESS_DESCRIPTOR:
+        return UINT32_C(8);
+    default:
+        return UINT32_C(0);
+    }
+}
+
+static bool is_SCSI_Defect_Format_Block(uint8_t defectListFormat)
+{
+    return defectListFormat == AD_SHORT_BLOCK_FORMAT_ADDRESS_DESCRIPTOR ||
+           defectListFormat == AD_LONG_BLOCK_FORMAT_ADDRESS_DESCRIPTOR;
+}
+
+// Writes the heading for the screen or the CSV column names before the first page of descriptors.
+static void get_SCSI_Defect_Heading(uint8_t defectListFormat, bool csv, char* heading, size_t headingLength)
+{
+    const char* offsetName = "Sector";
+    if (defectListFormat == AD_BYTES_FROM_INDEX_FORMAT_ADDRESS_DESCRIPTOR ||
+        defectListFormat == AD_EXTENDED_BYTES_FROM_INDEX_FORMAT_ADDRESS_DESCRIPTOR)
+    {
+        offsetName = "Bytes From Index";
+    }
+    if (is_SCSI_Defect_Format_Block(defectListFormat))
+    {
+        snprintf_err_handle(heading, headingLength, csv ? "%s\n" : "  %20s\n", "LBA");
+    }
+    else if (csv)
+    {
+        snprintf_err_handle(heading, headingLength, "Cylinder,Head,%s,Full Track,Multi-Address Sector\n", offsetName);
+    }
+    else
+    {
+        snprintf_err_handle(heading, headingLength, "  %10s  %4s  %16s\n", "Cylinder", "Head", offsetName);
+    }
+}
+
+// Formats one address descriptor as a screen or CSV row. Returns the number of characters written.
+// In the extended formats, a descriptor with the multi-address sector (MADS) bit set starts a range of defects that
+// ends at the next descriptor.
+static size_t format_SCSI_Defect_Descriptor(uint8_t        defectListFormat,
+                                            const uint8_t* descriptor,
+                                            bool           csv,
+                                            char*          row,
+                                            size_t         rowLength)
+{
+    int written = 0;
+    if (is_SCSI_Defect_Format_Block(defectListFormat))
+    {
+        uint64_t lba = UINT64_C(0);
+        if (defectListFormat == AD_SHORT_BLOCK_FORMAT_ADDRESS_DESCRIPTOR)
+        {
+            lba = M_BytesTo4ByteValue(descriptor[0], descriptor[1], descriptor[2], descriptor[3]);
+        }
+        else
+        {
+            lba = M_BytesTo8ByteValue(descriptor[0], descriptor[1], descriptor[2], descriptor[3], descriptor[4],
+                                      descriptor[5], descriptor[6], descriptor[7]);
+        }
+        written = snprintf_err_handle(row, rowLength, csv ? "%" PRIu64 "\n" : "  %20" PRIu64 "\n", lba);
+    }
+    else
+    {
+        uint32_t cylinder     = M_BytesTo4ByteValue(UINT8_C(0), descriptor[0], descriptor[1], descriptor[2]);
+        uint8_t  head         = descriptor[3];
+        uint32_t offset       = M_BytesTo4ByteValue(descriptor[4], descriptor[5], descriptor[6], descriptor[7]);
+        bool     fullTrack    = offset == SCSI_DEFECT_FULL_TRACK;
+        bool     multiAddress = false;
+        if (defectListFormat == AD_EXTENDED_BYTES_FROM_INDEX_FORMAT_ADDRESS_DESCRIPTOR ||
+            defectListFormat == AD_EXTENDED_PHYSICAL_SECTOR_FORMAT_ADDRESS_DESCRIPTOR)
+        {
+            multiAddress = descriptor[4] & BIT7;
+            offset       = M_BytesTo4ByteValue(M_Nibble0(descriptor[4]), descriptor[5], descriptor[6], descriptor[7]);
+            fullTrack    = offset == SCSI_DEFECT_EXTENDED_FULL_TRACK;
+        }
+        if (csv)
+        {
+            written = snprintf_err_handle(row, rowLength, "%" PRIu32 ",%" PRIu8 ",%" PRIu32 ",%s,%s\n", cylinder, head,
+                                          offset, fullTrack ? "Y" : "N", multiAddress ? "Y" : "N");
+        }
+        else if (fullTrack)
+        {
+            written = snprintf_err_handle(row, rowLength, "  %10" PRIu32 "  %4" PRIu8 "  %16s\n", cylinder, head,
+                                          "Full Track");
+        }
+        else
+        {
+            written = snprintf_err_handle(row, rowLength, "  %10" PRIu32 "  %4" PRIu8 "  %16" PRIu32 "%s\n", cylinder,
+                                          head, offset, multiAddress ? "  (multi-address start)" : "");
+        }
+    }
+    return written > 0 ? M_Min(C_CAST(size_t, written), rowLength - SIZE_T_C(1)) : SIZE_T_C(0);
+}
+
+eReturnValues stream_SCSI_Defect_List(tDevice*                device,
+                                      uint8_t                 defectListFormat,
+                                      bool                    grownList,
+                                      bool                    primaryList,
+                                      eSCSIDefectStreamFormat outputFormat,
+                                      const char*             fileName,
+                                      uint64_t*               defectCount)
+{
+    eReturnValues   ret              = SUCCESS;
+    uint32_t        descriptorLength = get_SCSI_Defect_Descriptor_Length(defectListFormat);
+    uint32_t        bufferSize       = SCSI_DEFECT_STREAM_BUFFER_SIZE;
+    uint32_t        perPage          = UINT32_C(0);
+    uint32_t        totalDescriptors = UINT32_C(0);
+    uint32_t        index            = UINT32_C(0);
+    uint16_t        generation       = UINT16_C(0);
+    bool            changed          = false;
+    size_t          textSize         = SIZE_T_C(0);
+    uint8_t*        buffer           = M_NULLPTR;
+    char*           text             = M_NULLPTR;
+    secureFileInfo* file             = M_NULLPTR;
+    if (defectCount != M_NULLPTR)
+    {
+        *defectCount = UINT64_C(0);
+    }
+    if (device == M_NULLPTR || descriptorLength == UINT32_C(0) || (!grownList && !primaryList) ||
+        (outputFormat != SCSI_DEFECT_STREAM_SCREEN && fileName == M_NULLPTR))
+    {
+        return BAD_PARAMETER;
+    }
+    if (device->drive_info.passThroughHacks.scsiHacks.maxTransferLength > UINT32_C(0))
+    {
+        bufferSize = M_Min(bufferSize, device->drive_info.passThroughHacks.scsiHacks.maxTransferLength);
+    }
+    perPage    = M_Max((bufferSize - M_Min(bufferSize, SCSI_DEFECT_HEADER_LENGTH)) / descriptorLength, UINT32_C(1));
+    bufferSize = SCSI_DEFECT_HEADER_LENGTH + (perPage * descriptorLength);
+    buffer     = C_CAST(uint8_t*, safe_calloc_aligned(bufferSize, sizeof(uint8_t), device->os_info.minimumAlignment));
+    if (buffer == M_NULLPTR)
+    {
+        return MEMORY_FAILURE;
+    }
+    if (outputFormat != SCSI_DEFECT_STREAM_BINARY)
+    {
+        textSize = (C_CAST(size_t, perPage) * SCSI_DEFECT_TEXT_LINE_LENGTH) + SIZE_T_C(1);
+        text     = C_CAST(char*, safe_calloc(textSize, sizeof(char)));
+        if (text == M_NULLPTR)
+        {
+            safe_free_aligned(&buffer);
+            return MEMORY_FAILURE;
+        }
+    }
+    // The first page also gives the list length, generation and the format the device used. If it cannot be read in
+    // the requested format, let the caller fall back to the library which also knows READ DEFECT DATA (10).
+    if (SUCCESS != scsi_Read_Defect_Data_12(device, primaryList, grownList, defectListFormat, index, buffer,
+                                            bufferSize) ||
+        M_GETBITRANGE(buffer[1], 2, 0) != defectListFormat)
+    {
+        safe_free(&text);
+        safe_free_aligned(&buffer);
+        return NOT_SUPPORTED;
+    }
+    generation       = M_BytesTo2ByteValue(buffer[2], buffer[3]);
+    totalDescriptors = M_BytesTo4ByteValue(buffer[4], buffer[5], buffer[6], buffer[7]) / descriptorLength;
+    if (outputFormat == SCSI_DEFECT_STREAM_SCREEN)
+    {
+        print_str("\n===SCSI Defect List===\n");
+        if (primaryList && grownList)
+        {
+            print_str("List includes primary and grown defects\n");
+        }
+        else if (primaryList)
+        {
+            print_str("List includes primary defects\n");
+        }
+        else
+        {
+            print_str("List includes grown defects\n");
+        }
+        printf("Total Defects in list: %" PRIu32 "\n", totalDescriptors);
+        if (totalDescriptors > UINT32_C(0))
+        {
+            get_SCSI_Defect_Heading(defectListFormat, false, text, textSize);
+            print_str(text);
+        }
+    }
+    else
+    {
+        file = secure_Open_File(fileName, outputFormat == SCSI_DEFECT_STREAM_CSV ? "w" : "wb", M_NULLPTR, M_NULLPTR,
+                                M_NULLPTR);
+        if (file == M_NULLPTR || file->error != SEC_FILE_SUCCESS)
+        {
+            ret = (file != M_NULLPTR && file->error == SEC_FILE_INSECURE_PATH) ? INSECURE_PATH : FILE_OPEN_ERROR;
+            free_Secure_File_Info(&file);
+            safe_free(&text);
+            safe_free_aligned(&buffer);
+            return ret;
+        }
+        if (outputFormat == SCSI_DEFECT_STREAM_CSV)
+        {
+            get_SCSI_Defect_Heading(defectListFormat, true, text, textSize);
+            if (SEC_FILE_SUCCESS !=
+                secure_Write_File(file, text, textSize, sizeof(char), safe_strlen(text), M_NULLPTR))
+            {
+                ret = ERROR_WRITING_FILE;
+            }
+        }
+        else if (SEC_FILE_SUCCESS != secure_Write_File(file, buffer, bufferSize, sizeof(uint8_t),
+                                                       SCSI_DEFECT_HEADER_LENGTH, M_NULLPTR))
+        {
+            ret = ERROR_WRITING_FILE;
+        }
+    }
+    while (ret == SUCCESS && index < totalDescriptors)
+    {
+        uint32_t pageDescriptors = M_Min(perPage, totalDescriptors - index);
+        if (index > UINT32_C(0))
+        {
+            // Some devices report the length of the whole list on every page and some report only what follows the
+            // address descriptor index, so never take more than either says is there.
+            uint32_t listDescriptors =
+                M_BytesTo4ByteValue(buffer[4], buffer[5], buffer[6], buffer[7]) / descriptorLength;
+            pageDescriptors = M_Min(pageDescriptors, listDescriptors);
+            if (!changed && M_BytesTo2ByteValue(buffer[2], buffer[3]) != generation)
+            {
+                changed = true;
+                if (device->deviceVerbosity > VERBOSITY_QUIET)
+                {
+                    print_str("WARNING: The defect list changed while it was being read. Defects may be missing or\n");
+                    print_str("         repeated. Read the list again for a consistent copy.\n");
+                }
+            }
+        }
+        if (pageDescriptors == UINT32_C(0))
+        {
+            break;
+        }
+        if (outputFormat == SCSI_DEFECT_STREAM_BINARY)
+        {
+            if (SEC_FILE_SUCCESS != secure_Write_File(file, &buffer[SCSI_DEFECT_HEADER_LENGTH],
+                                                      bufferSize - SCSI_DEFECT_HEADER_LENGTH, sizeof(uint8_t),
+                                                      C_CAST(size_t, pageDescriptors) * descriptorLength, M_NULLPTR))
+            {
+                ret = ERROR_WRITING_FILE;
+            }
+        }
+        else
+        {
+            size_t textLength = SIZE_T_C(0);
+            for (uint32_t iter = UINT32_C(0); iter < pageDescriptors; ++iter)
+            {
+                textLength += format_SCSI_Defect_Descriptor(
+                    defectListFormat, &buffer[SCSI_DEFECT_HEADER_LENGTH + (iter * descriptorLength)],
+                    outputFormat == SCSI_DEFECT_STREAM_CSV, &text[textLength], textSize - textLength);
+            }
+            if (outputFormat == SCSI_DEFECT_STREAM_SCREEN)
+            {
+                print_str(text);
+            }
+            else if (SEC_FILE_SUCCESS != secure_Write_File(file, text, textSize, sizeof(char), textLength, M_NULLPTR))
+            {
+                ret = ERROR_WRITING_FILE;
+            }
+        }
+        if (ret == SUCCESS && file != M_NULLPTR && SEC_FILE_SUCCESS != secure_Flush_File(file))
+        {
+            ret = ERROR_WRITING_FILE;
+        }
+        if (ret != SUCCESS)
+        {
+            break;
+        }
+        index += pageDescriptors;
+        if (defectCount != M_NULLPTR)
+        {
+            *defectCount += pageDescriptors;
+        }
+        if (index < totalDescriptors)
+        {
+            safe_memset(buffer, bufferSize, 0, bufferSize);
+            ret = scsi_Read_Defect_Data_12(device, primaryList, grownList, defectListFormat, index, buffer,
+                                           bufferSize);
+            if (ret != SUCCESS)
+            {
+                ret = FAILURE;
+            }
+        }
+    }
+    if (file != M_NULLPTR)
+    {
+        if (SEC_FILE_SUCCESS != secure_Close_File(file) && ret == SUCCESS)
+        {
+            ret = ERROR_WRITING_FILE;
+        }
+        free_Secure_File_Info(&file);
+    }
+    safe_free(&text);
+    safe_free_aligned(&buffer);
+    return ret;
+}
+
+static bool is_Stream_Terminal(FILE* stream)
+{
+#if defined(UEFI_C_SOURCE)
+    M_USE_UNUSED(stream);
+    return true;
+#elif defined(_WIN32)
+    return _isatty(_fileno(stream)) != 0;
+#else
+    return isatty(fileno(stream)) != 0;
+#endif
+}
+
+void set_Console_Output_Colors(eConsoleColors foreground, eConsoleColors background)
+{
+    if (is_Stream_Terminal(stdout))
+    {
+        // The Windows console changes colors immediately, so text still in the buffer has to be written first
+        flush_stdout();
+        set_Console_Foreground_Background_Colors(foreground, background);
+    }
+}
+
+char* next_Table_File_Column(char** cursor)
+{
+    char* column = *cursor;
+    char* end    = M_NULLPTR;
+    if (column == M_NULLPTR)
+    {
+        return M_NULLPTR;
+    }
+    end = strchr(column, ',');
+    if (end != M_NULLPTR)
+    {
+        *end    = '\0';
+        *cursor = end + 1;
+    }
+    else
+    {
+        *cursor = M_NULLPTR;
+    }
+    while (*column == ' ' || *column == '\t')
+    {
+        ++column;
+    }
+    end = column + safe_strlen(column);
+    while (end > column && (end[-1] == ' ' || end[-1] == '\t' || end[-1] == '\r'))
+    {
+        --end;
+    }
+    *end = '\0';
+    return column;
+}
+
+#define SPINUP_MAX_PROFILE_FILE_SIZE UINT32_C(1048576)
+#define SPINUP_MAX_PROFILE_MILLIAMPS UINT32_C(100000)
+#define SPINUP_MAX_PROFILE_SECONDS   UINT32_C(3600)
+// typical 3.5" drive, used when no profile matches
+#define SPINUP_DEFAULT_HDD_MILLIAMPS UINT32_C(2000)
+#define SPINUP_DEFAULT_HDD_SECONDS   UINT32_C(20)
+
+static bool get_Spinup_Profile_Number(const char* column, uint32_t maximum, uint32_t* number)
+{
+    char*         end   = M_NULLPTR;
+    unsigned long value = 0UL;
+    if (column == M_NULLPTR || !safe_isdigit(column[0]) ||
+        0 != safe_strtoul(&value, column, &end, BASE_10_DECIMAL) || *end != '\0' || value > maximum)
+    {
+        return false;
+    }
+    *number = C_CAST(uint32_t, value);
+    return true;
+}
+
+// model prefix,milliamps,seconds
+static bool parse_Spinup_Profile_Line(char* line, spinupProfile* profile)
+{
+    char*  cursor    = line;
+    char*  prefix    = next_Table_File_Column(&cursor);
+    char*  milliamps = next_Table_File_Column(&cursor);
+    char*  seconds   = next_Table_File_Column(&cursor);
+    size_t length    = safe_strlen(prefix);
+    if (seconds == M_NULLPTR || cursor != M_NULLPTR || length == SIZE_T_C(0) || length > MODEL_NUM_LEN)
+    {
+        return false;
+    }
+    safe_memset(profile, sizeof(spinupProfile), 0, sizeof(spinupProfile));
+    snprintf_err_handle(profile->modelPrefix, MODEL_NUM_LEN + 1, "%s", prefix);
+    return get_Spinup_Profile_Number(milliamps, SPINUP_MAX_PROFILE_MILLIAMPS, &profile->milliamps) &&
+           get_Spinup_Profile_Number(seconds, SPINUP_MAX_PROFILE_SECONDS, &profile->seconds);
+}
+
+static eReturnValues add_Spinup_Profile(spinupProfileTable* table, const spinupProfile* profile)
+{
+    if (table->count == table->capacity)
+    {
+        uint32_t       newCapacity = table->capacity == UINT32_C(0) ? UINT32_C(16) : table->capacity * 2;
+        spinupProfile* newProfiles = C_CAST(
+            spinupProfile*, safe_realloc(table->profiles, C_CAST(size_t, newCapacity) * sizeof(spinupProfile)));
+        if (newProfiles == M_NULLPTR)
+        {
+            return MEMORY_FAILURE;
+        }
+        table->profiles = newProfiles;
+        table->capacity = newCapacity;
+    }
+    safe_memcpy(&table->profiles[table->count], sizeof(spinupProfile), profile, sizeof(spinupProfile));
+    ++table->count;
+    return SUCCESS;
+}
+
+eReturnValues init_Spinup_Profile_Table(spinupProfileTable* table, const char* fileName, uint32_t* errorLine)
+{
+    eReturnValues   ret       = SUCCESS;
+    char*           text      = M_NULLPTR;
+    char*           line      = M_NULLPTR;
+    uint32_t        lineCount = UINT32_C(0);
+    size_t          readCount = SIZE_T_C(0);
+    secureFileInfo* file      = M_NULLPTR;
+    if (table == M_NULLPTR)
+    {
+        return BAD_PARAMETER;
+    }
+    safe_memset(table, sizeof(spinupProfileTable), 0, sizeof(spinupProfileTable));
+    if (fileName == M_NULLPTR)
+    {
+        return SUCCESS;
+    }
+    file = secure_Open_File(fileName, "rb", M_NULLPTR, M_NULLPTR, M_NULLPTR);
+    if (file == M_NULLPTR || file->error != SEC_FILE_SUCCESS)
+    {
+        ret = (file != M_NULLPTR && file->error == SEC_FILE_INSECURE_PATH) ? INSECURE_PATH : FILE_OPEN_ERROR;
+        free_Secure_File_Info(&file);
+        return ret;
+    }
+    if (file->fileSize > SPINUP_MAX_PROFILE_FILE_SIZE)
+    {
+        ret = VALIDATION_FAILURE;
+    }
+    else if (M_NULLPTR == (text = C_CAST(char*, safe_calloc(file->fileSize + SIZE_T_C(1), sizeof(char)))))
+    {
+        ret = MEMORY_FAILURE;
+    }
+    else if (file->fileSize > SIZE_T_C(0) &&
+             SEC_FILE_SUCCESS != secure_Read_File(file, text, file->fileSize, sizeof(char), file->fileSize, &readCount))
+    {
+        ret = FAILURE;
+    }
+    line = text;
+    while (ret == SUCCESS && line != M_NULLPTR && *line != '\0')
+    {
+        char*         next = strchr(line, '\n');
+        spinupProfile profile;
+        if (next != M_NULLPTR)
+        {
+            *next++ = '\0';
+        }
+        ++lineCount;
+        while (*line == ' ' || *line == '\t')
+        {
+            ++line;
+        }
+        if (*line != '\0' && *line != '\r' && *line != '#')
+        {
+            if (!parse_Spinup_Profile_Line(line, &profile))
+            {
+                ret = VALIDATION_FAILURE;
+                if (errorLine != M_NULLPTR)
+                {
+                    *errorLine = lineCount;
+                }
+            }
+            else
+            {
+                ret = add_Spinup_Profile(table, &profile);
+            }
+        }
+        line = next;
+    }
+    safe_free(&text);
+    secure_Close_File(file);
+    free_Secure_File_Info(&file);
+    if (ret != SUCCESS)
+    {
+        free_Spinup_Profile_Table(table);
+    }
+    return ret;
+}
+
+void free_Spinup_Profile_Table(spinupProfileTable* table)
+{
+    if (table != M_NULLPTR)
+    {
+        safe_free(&table->profiles);
+        table->count    = UINT32_C(0);
+        table->capacity = UINT32_C(0);
+    }
+}
+
+spinupProfile get_Spinup_Profile(const spinupProfileTable* table, tDevice* device)
+{
+    spinupProfile match;
+    size_t        matchLength = SIZE_T_C(0);
+    safe_memset(&match, sizeof(spinupProfile), 0, sizeof(spinupProfile));
+    if (device == M_NULLPTR)
+    {
+        return match;
+    }
+    if (device->drive_info.drive_type != NVME_DRIVE && !is_SSD(device))
+    {
+        match.milliamps = SPINUP_DEFAULT_HDD_MILLIAMPS;
+        match.seconds   = SPINUP_DEFAULT_HDD_SECONDS;
+    }
+    if (table != M_NULLPTR)
+    {
+        for (uint32_t profileIter = UINT32_C(0); profileIter < table->count; ++profileIter)
+        {
+            const spinupProfile* profile = &table->profiles[profileIter];
+            size_t               length  = safe_strlen(profile->modelPrefix);
+            if (length > matchLength &&
+                strncmp(device->drive_info.product_identification, profile->modelPrefix, length) == 0)
+            {
+                safe_memcpy(&match, sizeof(spinupProfile), profile, sizeof(spinupProfile));
+                matchLength = length;
+            }
+        }
+    }
+    return match;
+}
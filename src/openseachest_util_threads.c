@@ -0,0 +1,248 @@
+// SPDX-License-Identifier: MPL-2.0
+//
+// Do NOT modify or remove this copyright and license
+//
+// Copyright (c) 2014-2025 Seagate Technology LLC and/or its Affiliates, All Rights Reserved
+//
+// This software is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+//
+// ******************************************************************************************
+//
+// \file openseachest_util_threads.c
+// \brief This file implements the thread, lock and signal wrappers used by the tools to run work in the background.
+
+#include "common_types.h"
+#include "io_utils.h"
+#include "memory_safety.h"
+#include "string_utils.h"
+#include "time_utils.h"
+#include "type_conversion.h"
+
+#include "openseachest_util_threads.h"
+
+#if defined(UEFI_C_SOURCE)
+// no threads in UEFI. Work runs inline on the calling thread.
+#elif defined(_WIN32)
+#    include <windows.h>
+#else
+#    include <pthread.h>
+#endif
+
+struct s_utilThread
+{
+#if defined(UEFI_C_SOURCE)
+    int unused;
+#elif defined(_WIN32)
+    HANDLE             handle;
+    utilThreadFunction function;
+    void*              param;
+#else
+    pthread_t          handle;
+    utilThreadFunction function;
+    void*              param;
+#endif
+};
+
+struct s_utilLock
+{
+#if defined(UEFI_C_SOURCE)
+    int unused;
+#elif defined(_WIN32)
+    CRITICAL_SECTION section;
+#else
+    pthread_mutex_t mutex;
+#endif
+};
+
+struct s_utilSignal
+{
+#if defined(UEFI_C_SOURCE)
+    int unused;
+#elif defined(_WIN32)
+    CONDITION_VARIABLE condition;
+#else
+    pthread_cond_t condition;
+#endif
+};
+
+#if !defined(UEFI_C_SOURCE)
+#    if defined(_WIN32)
+static DWORD WINAPI util_Thread_Start_Routine(LPVOID param)
+{
+    utilThread* thread = C_CAST(utilThread*, param);
+    thread->function(thread->param);
+    return 0;
+}
+#    else
+static void* util_Thread_Start_Routine(void* param)
+{
+    utilThread* thread = C_CAST(utilThread*, param);
+    thread->function(thread->param);
+    return M_NULLPTR;
+}
+#    endif
+#endif
+
+utilThread* start_Util_Thread(utilThreadFunction function, void* param)
+{
+#if defined(UEFI_C_SOURCE)
+    M_USE_UNUSED(function);
+    M_USE_UNUSED(param);
+    return M_NULLPTR;
+#else
+    utilThread* thread = M_NULLPTR;
+    if (function == M_NULLPTR)
+    {
+        return M_NULLPTR;
+    }
+    thread = C_CAST(utilThread*, safe_calloc(1, sizeof(utilThread)));
+    if (thread != M_NULLPTR)
+    {
+        thread->function = function;
+        thread->param    = param;
+#    if defined(_WIN32)
+        thread->handle = CreateThread(M_NULLPTR, 0, util_Thread_Start_Routine, thread, 0, M_NULLPTR);
+        if (thread->handle == M_NULLPTR)
+        {
+            safe_free(&thread);
+        }
+#    else
+        if (0 != pthread_create(&thread->handle, M_NULLPTR, util_Thread_Start_Routine, thread))
+        {
+            safe_free(&thread);
+        }
+#    endif
+    }
+    return thread;
+#endif
+}
+
+void join_Util_Thread(utilThread** thread)
+{
+    if (thread != M_NULLPTR && *thread != M_NULLPTR)
+    {
+#if defined(_WIN32) && !defined(UEFI_C_SOURCE)
+        WaitForSingleObject((*thread)->handle, INFINITE);
+        CloseHandle((*thread)->handle);
+#elif !defined(UEFI_C_SOURCE)
+        pthread_join((*thread)->handle, M_NULLPTR);
+#endif
+        safe_free(thread);
+    }
+}
+
+utilLock* create_Util_Lock(void)
+{
+#if defined(UEFI_C_SOURCE)
+    return M_NULLPTR;
+#else
+    utilLock* lock = C_CAST(utilLock*, safe_calloc(1, sizeof(utilLock)));
+    if (lock != M_NULLPTR)
+    {
+#    if defined(_WIN32)
+        InitializeCriticalSection(&lock->section);
+#    else
+        if (0 != pthread_mutex_init(&lock->mutex, M_NULLPTR))
+        {
+            safe_free(&lock);
+        }
+#    endif
+    }
+    return lock;
+#endif
+}
+
+void lock_Util_Lock(utilLock* lock)
+{
+    if (lock != M_NULLPTR)
+    {
+#if defined(_WIN32) && !defined(UEFI_C_SOURCE)
+        EnterCriticalSection(&lock->section);
+#elif !defined(UEFI_C_SOURCE)
+        pthread_mutex_lock(&lock->mutex);
+#endif
+    }
+}
+
+void unlock_Util_Lock(utilLock* lock)
+{
+    if (lock != M_NULLPTR)
+    {
+#if defined(_WIN32) && !defined(UEFI_C_SOURCE)
+        LeaveCriticalSection(&lock->section);
+#elif !defined(UEFI_C_SOURCE)
+        pthread_mutex_unlock(&lock->mutex);
+#endif
+    }
+}
+
+void destroy_Util_Lock(utilLock** lock)
+{
+    if (lock != M_NULLPTR && *lock != M_NULLPTR)
+    {
+#if defined(_WIN32) && !defined(UEFI_C_SOURCE)
+        DeleteCriticalSection(&(*lock)->section);
+#elif !defined(UEFI_C_SOURCE)
+        pthread_mutex_destroy(&(*lock)->mutex);
+#endif
+        safe_free(lock);
+    }
+}
+
+utilSignal* create_Util_Signal(void)
+{
+#if defined(UEFI_C_SOURCE)
+    return M_NULLPTR;
+#else
+    utilSignal* signal = C_CAST(utilSignal*, safe_calloc(1, sizeof(utilSignal)));
+    if (signal != M_NULLPTR)
+    {
+#    if defined(_WIN32)
+        InitializeConditionVariable(&signal->condition);
+#    else
+        if (0 != pthread_cond_init(&signal->condition, M_NULLPTR))
+        {
+            safe_free(&signal);
+        }
+#    endif
+    }
+    return signal;
+#endif
+}
+
+void wait_Util_Signal(utilSignal* signal, utilLock* lock)
+{
+    if (signal != M_NULLPTR && lock != M_NULLPTR)
+    {
+#if defined(_WIN32) && !defined(UEFI_C_SOURCE)
+        SleepConditionVariableCS(&signal->condition, &lock->section, INFINITE);
+#elif !defined(UEFI_C_SOURCE)
+        pthread_cond_wait(&signal->condition, &lock->mutex);
+#endif
+    }
+}
+
+void broadcast_Util_Signal(utilSignal* signal)
+{
+    if (signal != M_NULLPTR)
+    {
+#if defined(_WIN32) && !defined(UEFI_C_SOURCE)
+        WakeAllConditionVariable(&signal->condition);
+#elif !defined(UEFI_C_SOURCE)
+        pthread_cond_broadcast(&signal->condition);
+#endif
+    }
+}
+
+void destroy_Util_Signal(utilSignal** signal)
+{
+    if (signal != M_NULLPTR && *signal != M_NULLPTR)
+    {
+#if !defined(_WIN32) && !defined(UEFI_C_SOURCE)
+        pthread_cond_destroy(&(*signal)->condition);
+#endif
+        safe_free(signal);
+    }
+}
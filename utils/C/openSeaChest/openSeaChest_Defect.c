@@ -17,15 +17,22 @@
 #include "common_types.h"
 #include "io_utils.h"
 #include "memory_safety.h"
+#include "precision_timer.h"
 #include "string_utils.h"
+#include "time_utils.h"
 #include "type_conversion.h"
 #include "unit_conversion.h"
 
 #include "EULA.h"
+#include "ata_helper_func.h"
+#include "cmds.h"
 #include "defect.h"
 #include "drive_info.h"
 #include "dst.h"
 #include "getopt.h"
+#include "logs.h"
+#include "nvme_helper_func.h"
+#include "openseachest_fleet_dst.h"
 #include "openseachest_util_options.h"
 #include "operations.h"
 #include "seagate_operations.h"
@@ -64,6 +71,690 @@ void atexit_clean_reallocate_list(ptrErrorLBA errorLBAList)
     }
 }
 
+// Sizes for --repairPendingList. A long REASSIGN BLOCKS list uses 8 bytes per LBA so 4096 LBAs is a 32KiB parameter
+// list, and each write of zeros is capped at 1MiB.
+#define PENDING_REPAIR_REASSIGN_BATCH UINT32_C(4096)
+#define PENDING_REPAIR_WRITE_BYTES    UINT32_C(1048576)
+
+typedef enum eRepairPendingMethodEnum
+{
+    REPAIR_PENDING_AUTO,
+    REPAIR_PENDING_REASSIGN,
+    REPAIR_PENDING_WRITE
+} eRepairPendingMethod;
+
+// Adds the pending list to pendingLBAs as ranges of whole physical sectors, since a partial write of a physical sector
+// would need the drive to read the unreadable part.
+static eReturnValues build_Pending_LBA_Set(tDevice*             device,
+                                           const pendingDefect* pending,
+                                           uint32_t             pendingCount,
+                                           lbaIntervalSet*      pendingLBAs)
+{
+    eReturnValues ret                = SUCCESS;
+    uint64_t      logicalPerPhysical = UINT64_C(1);
+    if (device->drive_info.deviceBlockSize > UINT32_C(0) &&
+        device->drive_info.devicePhyBlockSize > device->drive_info.deviceBlockSize)
+    {
+        logicalPerPhysical = device->drive_info.devicePhyBlockSize / device->drive_info.deviceBlockSize;
+    }
+    for (uint32_t iter = UINT32_C(0); iter < pendingCount && ret == SUCCESS; ++iter)
+    {
+        uint64_t start = pending[iter].lba - (pending[iter].lba % logicalPerPhysical);
+        uint64_t end   = M_Min(start + logicalPerPhysical, device->drive_info.deviceMaxLba + UINT64_C(1));
+        if (pending[iter].lba <= device->drive_info.deviceMaxLba)
+        {
+            ret = add_LBA_Interval(pendingLBAs, start, end - start);
+        }
+    }
+    return ret;
+}
+
+static void print_Pending_Repair_Progress(uint64_t repairedLBAs, uint64_t totalLBAs, eVerbosityLevels toolVerbosity)
+{
+    if (toolVerbosity > VERBOSITY_QUIET)
+    {
+        printf("\r\tProcessed %" PRIu64 " of %" PRIu64 " LBAs (%0.01f%%)", repairedLBAs, totalLBAs,
+               (C_CAST(double, repairedLBAs) * 100.0) / C_CAST(double, totalLBAs));
+        flush_stdout();
+    }
+}
+
+// Records LBAs that could not be repaired. Returns true once more LBAs have failed than errorLimit allows.
+static bool record_Failed_Pending_LBAs(lbaIntervalSet* failedLBAs, uint64_t start, uint64_t length, uint64_t errorLimit)
+{
+    if (SUCCESS != add_LBA_Interval(failedLBAs, start, length))
+    {
+        // without memory to track the failures, stop rather than repair blind
+        return true;
+    }
+    return errorLimit > UINT64_C(0) && failedLBAs->totalLBAs > errorLimit;
+}
+
+static eReturnValues reassign_Pending_LBA_Ranges(tDevice*              device,
+                                                 const lbaIntervalSet* pendingLBAs,
+                                                 lbaIntervalSet*       failedLBAs,
+                                                 uint64_t              errorLimit,
+                                                 uint32_t*             commands,
+                                                 eVerbosityLevels      toolVerbosity)
+{
+    eReturnValues ret       = SUCCESS;
+    uint64_t      processed = UINT64_C(0);
+    uint32_t      batchSize =
+        C_CAST(uint32_t, M_Min(pendingLBAs->totalLBAs, C_CAST(uint64_t, PENDING_REPAIR_REASSIGN_BATCH)));
+    uint32_t    batched = UINT32_C(0);
+    bool        stop    = false;
+    ptrErrorLBA batch   = C_CAST(ptrErrorLBA, safe_calloc(batchSize, sizeof(errorLBA)));
+    if (batch == M_NULLPTR)
+    {
+        return MEMORY_FAILURE;
+    }
+    for (uint32_t rangeIter = UINT32_C(0); rangeIter < pendingLBAs->count && !stop; ++rangeIter)
+    {
+        const lbaInterval* range = &pendingLBAs->intervals[rangeIter];
+        for (uint64_t offset = UINT64_C(0); offset < range->length && !stop; ++offset)
+        {
+            batch[batched].errorAddress = range->start + offset;
+            batch[batched].repairStatus = NOT_REPAIRED;
+            ++batched;
+            if (batched == batchSize ||
+                (rangeIter + UINT32_C(1) == pendingLBAs->count && offset + UINT64_C(1) == range->length))
+            {
+                eReturnValues batchRet = reallocate_LBAs(device, batch, batched);
+                *commands += UINT32_C(1);
+                if (batchRet == NOT_SUPPORTED)
+                {
+                    ret  = NOT_SUPPORTED;
+                    stop = true;
+                    break;
+                }
+                else if (batchRet != SUCCESS)
+                {
+                    ret = FAILURE;
+                    for (uint32_t batchIter = UINT32_C(0); batchIter < batched && !stop; ++batchIter)
+                    {
+                        if (batch[batchIter].repairStatus != SUCCESSFULLY_REPAIRED)
+                        {
+                            stop = record_Failed_Pending_LBAs(failedLBAs, batch[batchIter].errorAddress, UINT64_C(1),
+                                                              errorLimit);
+                        }
+                    }
+                }
+                processed += batched;
+                batched = UINT32_C(0);
+                print_Pending_Repair_Progress(processed, pendingLBAs->totalLBAs, toolVerbosity);
+            }
+        }
+    }
+    safe_free_error_lba(&batch);
+    return ret;
+}
+
+static eReturnValues write_Pending_LBA_Ranges(tDevice*              device,
+                                              const lbaIntervalSet* pendingLBAs,
+                                              lbaIntervalSet*       failedLBAs,
+                                              uint64_t              errorLimit,
+                                              uint32_t*             commands,
+                                              eVerbosityLevels      toolVerbosity)
+{
+    eReturnValues ret       = SUCCESS;
+    uint64_t      processed = UINT64_C(0);
+    uint32_t      blockSize = device->drive_info.deviceBlockSize;
+    uint32_t      maxBlocks = UINT32_C(0);
+    bool          stop      = false;
+    uint8_t*      zeros     = M_NULLPTR;
+    if (blockSize == UINT32_C(0))
+    {
+        return BAD_PARAMETER;
+    }
+    maxBlocks = M_Max(UINT32_C(1), PENDING_REPAIR_WRITE_BYTES / blockSize);
+    if (device->drive_info.devicePhyBlockSize > blockSize)
+    {
+        // keep every write on a physical sector boundary
+        uint32_t logicalPerPhysical = device->drive_info.devicePhyBlockSize / blockSize;
+        maxBlocks                   = M_Max(logicalPerPhysical, maxBlocks - (maxBlocks % logicalPerPhysical));
+    }
+    zeros = C_CAST(uint8_t*, safe_calloc_aligned(C_CAST(size_t, maxBlocks) * blockSize, sizeof(uint8_t),
+                                                 device->os_info.minimumAlignment));
+    if (zeros == M_NULLPTR)
+    {
+        return MEMORY_FAILURE;
+    }
+    for (uint32_t rangeIter = UINT32_C(0); rangeIter < pendingLBAs->count && !stop; ++rangeIter)
+    {
+        uint64_t lba = pendingLBAs->intervals[rangeIter].start;
+        uint64_t end = lba + pendingLBAs->intervals[rangeIter].length;
+        while (lba < end && !stop)
+        {
+            uint32_t      blocks   = C_CAST(uint32_t, M_Min(C_CAST(uint64_t, maxBlocks), end - lba));
+            eReturnValues writeRet = write_LBA(device, lba, false, zeros, blocks * blockSize);
+            *commands += UINT32_C(1);
+            if (writeRet == NOT_SUPPORTED)
+            {
+                ret  = NOT_SUPPORTED;
+                stop = true;
+                break;
+            }
+            else if (writeRet != SUCCESS)
+            {
+                ret  = FAILURE;
+                stop = record_Failed_Pending_LBAs(failedLBAs, lba, blocks, errorLimit);
+            }
+            lba += blocks;
+            processed += blocks;
+            print_Pending_Repair_Progress(processed, pendingLBAs->totalLBAs, toolVerbosity);
+        }
+    }
+    safe_free_aligned(&zeros);
+    return ret;
+}
+
+// Repairs everything on the pending list in as few commands as possible. SCSI devices default to REASSIGN BLOCKS with
+// long lists; everything else is written with zeros, which makes the drive reallocate any sector it cannot write.
+// LBAs that cannot be repaired are kept as ranges and the repair stops once there are more than errorLimit of them.
+// An errorLimit of 0 means no limit.
+static eReturnValues repair_Pending_List(tDevice*             device,
+                                         eRepairPendingMethod method,
+                                         uint64_t             errorLimit,
+                                         eVerbosityLevels     toolVerbosity)
+{
+    eReturnValues    ret          = SUCCESS;
+    uint32_t         pendingCount = UINT32_C(0);
+    uint32_t         commands     = UINT32_C(0);
+    lbaIntervalSet   pendingLBAs;
+    lbaIntervalSet   failedLBAs;
+    ptrPendingDefect pending =
+        M_REINTERPRET_CAST(ptrPendingDefect, safe_calloc(MAX_PLIST_ENTRIES, sizeof(pendingDefect)));
+    DECLARE_SEATIMER(repairTimer);
+    safe_memset(&pendingLBAs, sizeof(lbaIntervalSet), 0, sizeof(lbaIntervalSet));
+    safe_memset(&failedLBAs, sizeof(lbaIntervalSet), 0, sizeof(lbaIntervalSet));
+    if (pending == M_NULLPTR)
+    {
+        return MEMORY_FAILURE;
+    }
+    ret = get_LBAs_From_Pending_List(device, pending, &pendingCount);
+    if (ret != SUCCESS || pendingCount == UINT32_C(0))
+    {
+        if (ret == SUCCESS && toolVerbosity > VERBOSITY_QUIET)
+        {
+            print_str("The pending list is empty. Nothing to repair.\n");
+        }
+        safe_free_pending_defect(&pending);
+        return ret;
+    }
+    if (SUCCESS != build_Pending_LBA_Set(device, pending, pendingCount, &pendingLBAs))
+    {
+        free_LBA_Interval_Set(&pendingLBAs);
+        safe_free_pending_defect(&pending);
+        return MEMORY_FAILURE;
+    }
+    bool automaticMethod = method == REPAIR_PENDING_AUTO;
+    if (automaticMethod)
+    {
+        method = device->drive_info.drive_type == SCSI_DRIVE ? REPAIR_PENDING_REASSIGN : REPAIR_PENDING_WRITE;
+    }
+    if (toolVerbosity > VERBOSITY_QUIET)
+    {
+        printf("Repairing %" PRIu32 " pending list entries as %" PRIu32 " range(s) totaling %" PRIu64
+               " LBAs using %s\n",
+               pendingCount, pendingLBAs.count, pendingLBAs.totalLBAs,
+               method == REPAIR_PENDING_REASSIGN ? "REASSIGN BLOCKS" : "writes of zeros");
+    }
+    start_Timer(&repairTimer);
+    if (pendingLBAs.count > UINT32_C(0))
+    {
+        if (method == REPAIR_PENDING_REASSIGN)
+        {
+            ret = reassign_Pending_LBA_Ranges(device, &pendingLBAs, &failedLBAs, errorLimit, &commands,
+                                              toolVerbosity);
+            if (ret == NOT_SUPPORTED && automaticMethod && commands == UINT32_C(1))
+            {
+                // the first list was rejected so nothing has been reassigned yet, repair by writing instead
+                if (toolVerbosity > VERBOSITY_QUIET)
+                {
+                    print_str("\tREASSIGN BLOCKS is not supported, writing zeros instead.\n");
+                }
+                method   = REPAIR_PENDING_WRITE;
+                commands = UINT32_C(0);
+            }
+        }
+        if (method == REPAIR_PENDING_WRITE)
+        {
+            ret = write_Pending_LBA_Ranges(device, &pendingLBAs, &failedLBAs, errorLimit, &commands, toolVerbosity);
+        }
+    }
+    stop_Timer(&repairTimer);
+    if (toolVerbosity > VERBOSITY_QUIET && ret != NOT_SUPPORTED)
+    {
+        double seconds = get_Seconds(repairTimer);
+        printf("\n\t%" PRIu64 " LBAs in %" PRIu32 " command(s), %" PRIu64 " LBAs failed, %0.03f seconds",
+               pendingLBAs.totalLBAs, commands, failedLBAs.totalLBAs, seconds);
+        if (seconds > 0.0)
+        {
+            printf(" (%0.01f LBAs/second)", C_CAST(double, pendingLBAs.totalLBAs) / seconds);
+        }
+        print_str("\n");
+        if (errorLimit > UINT64_C(0) && failedLBAs.totalLBAs > errorLimit)
+        {
+            printf("\tStopped after exceeding the error limit of %" PRIu64 " LBAs.\n", errorLimit);
+        }
+        for (uint32_t failedIter = UINT32_C(0); failedIter < failedLBAs.count; ++failedIter)
+        {
+            printf("\tNot repaired: %" PRIu64 " - %" PRIu64 "\n", failedLBAs.intervals[failedIter].start,
+                   failedLBAs.intervals[failedIter].start + failedLBAs.intervals[failedIter].length - UINT64_C(1));
+        }
+        if (SUCCESS == get_LBAs_From_Pending_List(device, pending, &pendingCount))
+        {
+            printf("\t%" PRIu32 " entries remain on the pending list.\n", pendingCount);
+        }
+    }
+    free_LBA_Interval_Set(&failedLBAs);
+    free_LBA_Interval_Set(&pendingLBAs);
+    safe_free_pending_defect(&pending);
+    return ret;
+}
+
+// Uncorrectable batch engine for --uncorrectableList and --randomUncorrectableRanges. ATA WRITE UNCORRECTABLE EXT and
+// NVMe Write Uncorrectable both carry a 16 bit block count, so longer ranges are split into several commands.
+#define UNCORRECTABLE_BATCH_MAX_RANGE_LBAS UINT32_C(65535)
+#define ATA_WRITE_UNCORRECTABLE_PSEUDO     UINT8_C(0x55)
+#define ATA_WRITE_UNCORRECTABLE_FLAGGED    UINT8_C(0xAA)
+#define UNCORRECTABLE_MANIFEST_LINE_LENGTH SIZE_T_C(256)
+
+typedef enum eUncorrectableCommandEnum
+{
+    UNCORRECTABLE_COMMAND_RANGE,
+    UNCORRECTABLE_COMMAND_SINGLE
+} eUncorrectableCommand;
+
+// One manifest row: a run of LBAs handled by the same kind of command with the same result.
+typedef struct s_uncorrectableRow
+{
+    uint64_t              start;
+    uint64_t              length;
+    eUncorrectableCommand command;
+    bool                  injected;
+} uncorrectableRow;
+
+typedef struct s_uncorrectableBatch
+{
+    tDevice*         device;
+    secureFileInfo*  manifest;
+    bool             flagged;
+    bool             readBack;
+    bool             rangeCommands; // cleared if the device rejects the first range command
+    bool             rangeWorked;
+    uint8_t*         readBuffer;
+    uncorrectableRow row;
+    uint64_t         injectedLBAs;
+    uint64_t         failedLBAs;
+    uint64_t         readableRows;
+    uint32_t         commands;
+    bool             manifestError;
+} uncorrectableBatch;
+
+// xorshift64* so a batch can be reproduced from the seed recorded in the manifest
+static uint64_t next_Uncorrectable_Random(uint64_t* state)
+{
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+    return *state * UINT64_C(0x2545F4914F6CDD1D);
+}
+
+// Adds rangeCount random ranges of 1 to maxLength LBAs. Ranges are kept at least one LBA apart so each one stays a
+// separate range in the manifest.
+static eReturnValues build_Random_Uncorrectable_Ranges(tDevice*        device,
+                                                       uint32_t        rangeCount,
+                                                       uint64_t        maxLength,
+                                                       uint64_t        seed,
+                                                       lbaIntervalSet* targets)
+{
+    eReturnValues ret      = SUCCESS;
+    uint64_t      state    = seed == UINT64_C(0) ? UINT64_C(0x9E3779B97F4A7C15) : seed;
+    uint64_t      lbaCount = device->drive_info.deviceMaxLba + UINT64_C(1);
+    uint32_t      added    = UINT32_C(0);
+    uint64_t      attempts = (C_CAST(uint64_t, rangeCount) * UINT64_C(8)) + UINT64_C(64);
+    maxLength              = M_Max(UINT64_C(1), M_Min(maxLength, lbaCount));
+    while (added < rangeCount && attempts > UINT64_C(0) && ret == SUCCESS)
+    {
+        uint64_t length = (next_Uncorrectable_Random(&state) % maxLength) + UINT64_C(1);
+        uint64_t start  = next_Uncorrectable_Random(&state) % (lbaCount - length + UINT64_C(1));
+        uint32_t next   = UINT32_C(0);
+        --attempts;
+        if (find_LBA_Interval(targets, start > UINT64_C(0) ? start - UINT64_C(1) : start, &next) ||
+            (next < targets->count && targets->intervals[next].start <= start + length))
+        {
+            continue;
+        }
+        ret = add_LBA_Interval(targets, start, length);
+        ++added;
+    }
+    if (ret == SUCCESS && added < rangeCount)
+    {
+        printf("Only %" PRIu32 " of %" PRIu32 " random ranges fit on the device without overlapping\n", added,
+               rangeCount);
+    }
+    return ret;
+}
+
+// Reads "start[,length]" lines. Lines that do not start with a number are skipped so that comments, a CSV header or
+// a manifest from an earlier run can be used.
+static eReturnValues read_Uncorrectable_List_File(const char* fileName, uint64_t maxLBA, lbaIntervalSet* targets)
+{
+    eReturnValues   ret      = SUCCESS;
+    char*           fileData = M_NULLPTR;
+    size_t          bytesRead = SIZE_T_C(0);
+    uint32_t        lineNumber = UINT32_C(0);
+    secureFileInfo* listFile  = secure_Open_File(fileName, "r", M_NULLPTR, M_NULLPTR, M_NULLPTR);
+    if (listFile == M_NULLPTR || listFile->error != SEC_FILE_SUCCESS)
+    {
+        printf("Unable to open uncorrectable list %s\n", fileName);
+        free_Secure_File_Info(&listFile);
+        return FILE_OPEN_ERROR;
+    }
+    size_t dataLength = C_CAST(size_t, listFile->fileSize);
+    fileData          = C_CAST(char*, safe_calloc(dataLength + SIZE_T_C(1), sizeof(char)));
+    if (fileData == M_NULLPTR)
+    {
+        ret = MEMORY_FAILURE;
+    }
+    else if (dataLength > SIZE_T_C(0) &&
+             SEC_FILE_SUCCESS != secure_Read_File(listFile, fileData, dataLength + SIZE_T_C(1), sizeof(char),
+                                                  dataLength, &bytesRead) &&
+             bytesRead == SIZE_T_C(0))
+    {
+        printf("Unable to read uncorrectable list %s\n", fileName);
+        ret = FILE_READ_ERROR;
+    }
+    for (char* line = fileData; ret == SUCCESS && line != M_NULLPTR && line < &fileData[bytesRead];)
+    {
+        char*    lineEnd   = strchr(line, '\n');
+        char*    field     = line;
+        uint64_t values[2] = {UINT64_C(0), UINT64_C(1)};
+        uint8_t  fields    = UINT8_C(0);
+        ++lineNumber;
+        if (lineEnd != M_NULLPTR)
+        {
+            *lineEnd = '\0';
+        }
+        while (*field == ' ' || *field == '\t')
+        {
+            ++field;
+        }
+        if (safe_isdigit(*field))
+        {
+            for (char* cursor = field; fields < UINT8_C(2); ++cursor)
+            {
+                if (*cursor == ',' || *cursor == ' ' || *cursor == '\t' || *cursor == '\r' || *cursor == '\0')
+                {
+                    char separator = *cursor;
+                    *cursor        = '\0';
+                    if (safe_strlen(field) > SIZE_T_C(0))
+                    {
+                        if (!get_And_Validate_Integer_Input_Uint64(field, M_NULLPTR, ALLOW_UNIT_NONE,
+                                                                   &values[fields]))
+                        {
+                            break;
+                        }
+                        ++fields;
+                    }
+                    if (separator == '\0' || separator == '\r')
+                    {
+                        break;
+                    }
+                    field = cursor + 1;
+                }
+            }
+            if (fields == UINT8_C(0) || values[1] == UINT64_C(0) || values[0] > maxLBA ||
+                values[1] > maxLBA - values[0] + UINT64_C(1))
+            {
+                printf("Invalid range on line %" PRIu32 " of %s. Ranges must be within the device's max LBA.\n",
+                       lineNumber, fileName);
+                ret = BAD_PARAMETER;
+            }
+            else
+            {
+                ret = add_LBA_Interval(targets, values[0], values[1]);
+            }
+        }
+        line = lineEnd != M_NULLPTR ? lineEnd + 1 : M_NULLPTR;
+    }
+    if (ret == SUCCESS && targets->count == UINT32_C(0))
+    {
+        printf("No ranges found in %s\n", fileName);
+        ret = BAD_PARAMETER;
+    }
+    safe_free(&fileData);
+    secure_Close_File(listFile);
+    free_Secure_File_Info(&listFile);
+    return ret;
+}
+
+static void write_Uncorrectable_Manifest(uncorrectableBatch* batch, const char* text)
+{
+    if (!batch->manifestError && SEC_FILE_SUCCESS != secure_Write_File(batch->manifest, text, safe_strlen(text),
+                                                                        sizeof(char), safe_strlen(text), M_NULLPTR))
+    {
+        batch->manifestError = true;
+    }
+}
+
+// An injected LBA is expected to fail to read.
+static bool is_Uncorrectable_LBA_Readable(uncorrectableBatch* batch, uint64_t lba)
+{
+    return SUCCESS == read_LBA(batch->device, lba, false, batch->readBuffer, batch->device->drive_info.deviceBlockSize);
+}
+
+// Writes the current row to the manifest. Injected rows are checked by reading their first and last LBA, which is a
+// fixed two reads per row no matter how many LBAs the row covers.
+static void flush_Uncorrectable_Row(uncorrectableBatch* batch)
+{
+    const char* readBack = "Not Read";
+    DECLARE_ZERO_INIT_ARRAY(char, line, UNCORRECTABLE_MANIFEST_LINE_LENGTH);
+    if (batch->row.length == UINT64_C(0))
+    {
+        return;
+    }
+    if (batch->row.injected && batch->readBack)
+    {
+        uint64_t last = batch->row.start + batch->row.length - UINT64_C(1);
+        if (is_Uncorrectable_LBA_Readable(batch, batch->row.start) ||
+            (last != batch->row.start && is_Uncorrectable_LBA_Readable(batch, last)))
+        {
+            readBack = "Readable";
+            ++batch->readableRows;
+        }
+        else
+        {
+            readBack = "Unreadable";
+        }
+    }
+    snprintf_err_handle(line, UNCORRECTABLE_MANIFEST_LINE_LENGTH, "%" PRIu64 ",%" PRIu64 ",%s,%s,%s\n",
+                        batch->row.start, batch->row.length,
+                        batch->row.command == UNCORRECTABLE_COMMAND_RANGE ? "Range" : "Per LBA",
+                        batch->row.injected ? "Injected" : "Failed", readBack);
+    write_Uncorrectable_Manifest(batch, line);
+    batch->row.length = UINT64_C(0);
+}
+
+static void record_Uncorrectable_Result(uncorrectableBatch*   batch,
+                                        uint64_t              start,
+                                        uint64_t              length,
+                                        eUncorrectableCommand command,
+                                        bool                  injected)
+{
+    if (batch->row.length > UINT64_C(0) &&
+        (batch->row.start + batch->row.length != start || batch->row.command != command ||
+         batch->row.injected != injected))
+    {
+        flush_Uncorrectable_Row(batch);
+    }
+    if (batch->row.length == UINT64_C(0))
+    {
+        batch->row.start    = start;
+        batch->row.command  = command;
+        batch->row.injected = injected;
+    }
+    batch->row.length += length;
+    if (injected)
+    {
+        batch->injectedLBAs += length;
+    }
+    else
+    {
+        batch->failedLBAs += length;
+    }
+}
+
+static eReturnValues send_Uncorrectable_Range_Command(uncorrectableBatch* batch, uint64_t start, uint32_t count)
+{
+    if (batch->device->drive_info.drive_type == NVME_DRIVE)
+    {
+        // number of logical blocks is zero based
+        return nvme_Write_Uncorrectable(batch->device, start, C_CAST(uint16_t, count - UINT32_C(1)));
+    }
+    return ata_Write_Uncorrectable(batch->device,
+                                   batch->flagged ? ATA_WRITE_UNCORRECTABLE_FLAGGED : ATA_WRITE_UNCORRECTABLE_PSEUDO,
+                                   C_CAST(uint16_t, count), start);
+}
+
+static eReturnValues inject_Uncorrectable_Interval(uncorrectableBatch* batch, const lbaInterval* interval)
+{
+    uint64_t lba = interval->start;
+    uint64_t end = interval->start + interval->length;
+    while (lba < end)
+    {
+        eReturnValues commandRet = SUCCESS;
+        if (batch->rangeCommands)
+        {
+            uint32_t count = C_CAST(uint32_t, M_Min(end - lba, C_CAST(uint64_t, UNCORRECTABLE_BATCH_MAX_RANGE_LBAS)));
+            commandRet     = send_Uncorrectable_Range_Command(batch, lba, count);
+            ++batch->commands;
+            if (commandRet == SUCCESS || batch->rangeWorked)
+            {
+                batch->rangeWorked = batch->rangeWorked || commandRet == SUCCESS;
+                record_Uncorrectable_Result(batch, lba, count, UNCORRECTABLE_COMMAND_RANGE, commandRet == SUCCESS);
+                lba += count;
+                continue;
+            }
+            // the very first range command failed, so use the single LBA commands for the whole batch
+            batch->rangeCommands = false;
+            if (batch->device->deviceVerbosity > VERBOSITY_QUIET)
+            {
+                print_str("\tRange commands are not supported, injecting one LBA at a time.\n");
+            }
+        }
+        if (batch->flagged)
+        {
+            commandRet = write_Flagged_Uncorrectable_Error(batch->device, lba);
+        }
+        else
+        {
+            commandRet = write_Psuedo_Uncorrectable_Error(batch->device, lba);
+        }
+        ++batch->commands;
+        if (commandRet == NOT_SUPPORTED && batch->injectedLBAs == UINT64_C(0) && batch->failedLBAs == UINT64_C(0))
+        {
+            return NOT_SUPPORTED;
+        }
+        record_Uncorrectable_Result(batch, lba, UINT64_C(1), UNCORRECTABLE_COMMAND_SINGLE, commandRet == SUCCESS);
+        ++lba;
+    }
+    return SUCCESS;
+}
+
+// Injects every range in targets and records exactly what was injected in an UNCORRECTABLES csv manifest.
+static eReturnValues run_Uncorrectable_Batch(tDevice*              device,
+                                             const lbaIntervalSet* targets,
+                                             bool                  flagged,
+                                             bool                  readBack,
+                                             const char*           source,
+                                             eVerbosityLevels      toolVerbosity)
+{
+    eReturnValues      ret = SUCCESS;
+    uncorrectableBatch batch;
+    DECLARE_ZERO_INIT_ARRAY(char, line, UNCORRECTABLE_MANIFEST_LINE_LENGTH);
+    DECLARE_SEATIMER(batchTimer);
+    safe_memset(&batch, sizeof(uncorrectableBatch), 0, sizeof(uncorrectableBatch));
+    batch.device   = device;
+    batch.flagged  = flagged;
+    batch.readBack = readBack;
+    // NVMe Write Uncorrectable has no flagged form, so flagged errors on NVMe go through the single LBA path
+    batch.rangeCommands =
+        device->drive_info.drive_type == ATA_DRIVE || (device->drive_info.drive_type == NVME_DRIVE && !flagged);
+    batch.readBuffer = C_CAST(uint8_t*, safe_calloc_aligned(device->drive_info.deviceBlockSize, sizeof(uint8_t),
+                                                            device->os_info.minimumAlignment));
+    if (batch.readBuffer == M_NULLPTR)
+    {
+        return MEMORY_FAILURE;
+    }
+    ret = create_And_Open_Secure_Log_File_Dev_EZ(device, &batch.manifest, NAMING_SERIAL_NUMBER_DATE_TIME, M_NULLPTR,
+                                                 "UNCORRECTABLES", "csv");
+    if (ret != SUCCESS || batch.manifest == M_NULLPTR)
+    {
+        free_Secure_File_Info(&batch.manifest);
+        safe_free_aligned(&batch.readBuffer);
+        return ret == SUCCESS ? FILE_OPEN_ERROR : ret;
+    }
+    snprintf_err_handle(line, UNCORRECTABLE_MANIFEST_LINE_LENGTH,
+                        "# Model: %s\n# Serial: %s\n# Logical block size: %" PRIu32 "\n# Type: %s\n# Source: %s\n",
+                        device->drive_info.product_identification, device->drive_info.serialNumber,
+                        device->drive_info.deviceBlockSize, flagged ? "flagged" : "pseudo", source);
+    write_Uncorrectable_Manifest(&batch, line);
+    write_Uncorrectable_Manifest(&batch, "Start LBA,Length,Command,Result,Read Back\n");
+    if (toolVerbosity > VERBOSITY_QUIET)
+    {
+        printf("%s %" PRIu64 " LBAs in %" PRIu32 " range(s)\n", flagged ? "Flagging" : "Creating uncorrectables at",
+               targets->totalLBAs, targets->count);
+    }
+    start_Timer(&batchTimer);
+    for (uint32_t rangeIter = UINT32_C(0); rangeIter < targets->count && ret == SUCCESS; ++rangeIter)
+    {
+        ret = inject_Uncorrectable_Interval(&batch, &targets->intervals[rangeIter]);
+        if (toolVerbosity > VERBOSITY_QUIET)
+        {
+            printf("\r\tProcessed %" PRIu32 " of %" PRIu32 " ranges", rangeIter + UINT32_C(1), targets->count);
+            flush_stdout();
+        }
+    }
+    flush_Uncorrectable_Row(&batch);
+    stop_Timer(&batchTimer);
+    snprintf_err_handle(line, UNCORRECTABLE_MANIFEST_LINE_LENGTH,
+                        "# Injected LBAs: %" PRIu64 ", failed LBAs: %" PRIu64 ", commands: %" PRIu32
+                        ", seconds: %0.03f\n",
+                        batch.injectedLBAs, batch.failedLBAs, batch.commands, get_Seconds(batchTimer));
+    write_Uncorrectable_Manifest(&batch, line);
+    if (!batch.manifestError && SEC_FILE_SUCCESS != secure_Flush_File(batch.manifest))
+    {
+        batch.manifestError = true;
+    }
+    if (toolVerbosity > VERBOSITY_QUIET)
+    {
+        printf("\n\t%" PRIu64 " LBAs injected, %" PRIu64 " LBAs failed in %" PRIu32 " command(s), %0.03f seconds\n",
+               batch.injectedLBAs, batch.failedLBAs, batch.commands, get_Seconds(batchTimer));
+        if (readBack && batch.readableRows > UINT64_C(0))
+        {
+            printf("\t%" PRIu64 " injected range(s) could still be read back\n", batch.readableRows);
+        }
+        printf("\tManifest: %s\n", batch.manifest->fullpath);
+    }
+    if (SEC_FILE_SUCCESS != secure_Close_File(batch.manifest))
+    {
+        batch.manifestError = true;
+    }
+    free_Secure_File_Info(&batch.manifest);
+    safe_free_aligned(&batch.readBuffer);
+    if (ret == SUCCESS && batch.manifestError)
+    {
+        ret = ERROR_WRITING_FILE;
+    }
+    else if (ret == SUCCESS && (batch.failedLBAs > UINT64_C(0) || batch.readableRows > UINT64_C(0)))
+    {
+        ret = FAILURE;
+    }
+    return ret;
+}
+
 //-----------------------------------------------------------------------------
 //
 //  main()
@@ -111,6 +802,7 @@ int main(int argc, char* argv[])
     // scan output flags
     SCAN_FLAGS_UTIL_VARS
     DST_AND_CLEAN_VAR
+    FLEET_DST_VAR
     ERROR_LIMIT_VAR
 #if defined(ENABLE_CSMI)
     CSMI_FORCE_VARS
@@ -120,10 +812,13 @@ int main(int argc, char* argv[])
     CHECK_PENDING_LIST_COUNT_VARS
     CHECK_GROWN_LIST_COUNT_VARS
     SHOW_PENDING_LIST_VAR
+    REPAIR_PENDING_LIST_VARS
     CREATE_UNCORRECTABLE_VAR
     CREATE_UNCORRECTABLE_LBA_VAR
     UNCORRECTABLE_RANGE_VAR
     RANDOM_UNCORRECTABLES_VAR
+    UNCORRECTABLE_LIST_VAR
+    RANDOM_UNCORRECTABLE_RANGES_VAR
     READ_UNCORRECTABLES_VAR
     FLAG_UNCORRECTABLES_VAR
     CORRUPT_LBA_VAR
@@ -171,12 +866,16 @@ int main(int argc, char* argv[])
         // tool specific options go here
         ERROR_LIMIT_LONG_OPT,
         DST_AND_CLEAN_LONG_OPT,
+        FLEET_DST_LONG_OPT,
         CHECK_PENDING_LIST_COUNT_LONG_OPT,
         CHECK_GROWN_LIST_COUNT_LONG_OPT,
         SHOW_PENDING_LIST_LONG_OPT,
+        REPAIR_PENDING_LIST_LONG_OPT,
         CREATE_UNCORRECTABLE_LONG_OPT,
         UNCORRECTABLE_RANGE_LONG_OPT,
         RANDOM_UNCORRECTABLES_LONG_OPT,
+        UNCORRECTABLE_LIST_LONG_OPT,
+        RANDOM_UNCORRECTABLE_RANGES_LONG_OPT,
         DISABLE_READ_UNCORRECTABLES_LONG_OPT,
         FLAG_UNCORRECTABLE_LONG_OPT,
         CORRUPT_LBA_LONG_OPT,
@@ -237,11 +936,37 @@ int main(int argc, char* argv[])
                     exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
                 }
             }
+            else if (strcmp(longopts[optionIndex].name, REPAIR_PENDING_LIST_LONG_OPT_STRING) == 0)
+            {
+                REPAIR_PENDING_LIST_FLAG      = true;
+                REPAIR_PENDING_LIST_MODE_FLAG = REPAIR_PENDING_AUTO;
+                if (optarg == M_NULLPTR && optind < argc && argv[optind][0] != '-')
+                {
+                    optarg = argv[optind++];
+                }
+                if (optarg != M_NULLPTR)
+                {
+                    if (strcmp(optarg, "reassign") == 0)
+                    {
+                        REPAIR_PENDING_LIST_MODE_FLAG = REPAIR_PENDING_REASSIGN;
+                    }
+                    else if (strcmp(optarg, "write") == 0)
+                    {
+                        REPAIR_PENDING_LIST_MODE_FLAG = REPAIR_PENDING_WRITE;
+                    }
+                    else
+                    {
+                        print_Error_In_Cmd_Line_Args(REPAIR_PENDING_LIST_LONG_OPT_STRING, optarg);
+                        exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
+                    }
+                }
+            }
             else if (strcmp(longopts[optionIndex].name, ERROR_LIMIT_LONG_OPT_STRING) == 0)
             {
                 char* unit = M_NULLPTR;
                 if (get_And_Validate_Integer_Input_Uint16(optarg, &unit, ALLOW_UNIT_SECTOR_TYPE, &ERROR_LIMIT_FLAG))
                 {
+                    REPAIR_PENDING_LIST_LIMIT_FLAG = true;
                     if (unit)
                     {
                         if (strcmp(unit, "l") == 0)
@@ -387,6 +1112,26 @@ int main(int argc, char* argv[])
                     }
                 }
             }
+            else if (strcmp(longopts[optionIndex].name, SCSI_DEFECTS_FILE_LONG_OPT_STRING) == 0)
+            {
+                SCSI_DEFECTS_FILE = optarg;
+            }
+            else if (strcmp(longopts[optionIndex].name, SCSI_DEFECTS_FILE_FORMAT_LONG_OPT_STRING) == 0)
+            {
+                if (strcmp("csv", optarg) == 0)
+                {
+                    SCSI_DEFECTS_FILE_FORMAT = SCSI_DEFECT_STREAM_CSV;
+                }
+                else if (strcmp("bin", optarg) == 0)
+                {
+                    SCSI_DEFECTS_FILE_FORMAT = SCSI_DEFECT_STREAM_BINARY;
+                }
+                else
+                {
+                    print_Error_In_Cmd_Line_Args(SCSI_DEFECTS_FILE_FORMAT_LONG_OPT_STRING, optarg);
+                    exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
+                }
+            }
             else if (strcmp(longopts[optionIndex].name, SCSI_REALLOCATE_BLOCKS_LIST_LONG_OPT_STRING) == 0)
             {
                 // Parse a comma separated list of options, then register the allocated memory for cleanup at exit
@@ -468,6 +1213,20 @@ int main(int argc, char* argv[])
                     exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
                 }
             }
+            else if (strcmp(longopts[optionIndex].name, UNCORRECTABLE_LIST_LONG_OPT_STRING) == 0)
+            {
+                UNCORRECTABLE_LIST_FLAG = optarg;
+            }
+            else if (strcmp(longopts[optionIndex].name, RANDOM_UNCORRECTABLE_RANGES_LONG_OPT_STRING) == 0)
+            {
+                if (!get_And_Validate_Integer_Input_Uint32(optarg, M_NULLPTR, ALLOW_UNIT_NONE,
+                                                           &RANDOM_UNCORRECTABLE_RANGES_FLAG) ||
+                    RANDOM_UNCORRECTABLE_RANGES_FLAG == UINT32_C(0))
+                {
+                    print_Error_In_Cmd_Line_Args(RANDOM_UNCORRECTABLE_RANGES_LONG_OPT_STRING, optarg);
+                    exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
+                }
+            }
             else if (strcmp(longopts[optionIndex].name, DISABLE_READ_UNCORRECTABLES_LONG_OPT_STRING) == 0)
             {
                 READ_UNCORRECTABLES_FLAG = false;
@@ -829,7 +1588,9 @@ int main(int argc, char* argv[])
           // check for other tool specific options here
           || DST_AND_CLEAN_FLAG || CHECK_PENDING_LIST_COUNT_FLAG || CHECK_GROWN_LIST_COUNT_FLAG || SHOW_PENDING_LIST ||
           CREATE_UNCORRECTABLE_FLAG || UNCORRECTABLE_RANGE_FLAG > 1 || RANDOM_UNCORRECTABLES_FLAG || CORRUPT_LBA_FLAG ||
-          CORRUPT_RANDOM_LBAS || SCSI_DEFECTS_FLAG || SCSI_REALLOCATE_BLOCKS_LIST_LENGTH > 0))
+          UNCORRECTABLE_LIST_FLAG != M_NULLPTR || RANDOM_UNCORRECTABLE_RANGES_FLAG > 0 ||
+          CORRUPT_RANDOM_LBAS || SCSI_DEFECTS_FLAG || SCSI_REALLOCATE_BLOCKS_LIST_LENGTH > 0 ||
+          REPAIR_PENDING_LIST_FLAG))
     {
         utility_Usage(true);
         free_Handle_List(&HANDLE_LIST, DEVICE_LIST_COUNT);
@@ -993,6 +1754,10 @@ int main(int argc, char* argv[])
     }
     free_Handle_List(&HANDLE_LIST, DEVICE_LIST_COUNT);
     uint32_t skippedDevices = UINT32_C(0);
+    // With --fleetDST, DST and clean is run on all drives together once every drive has been checked
+    fleetDST fleet;
+    bool     fleetDSTAndClean = FLEET_DST_FLAG && DST_AND_CLEAN_FLAG && SINGLE_SECTOR_DATA_ERASE_FLAG;
+    safe_memset(&fleet, sizeof(fleetDST), 0, sizeof(fleetDST));
     for (uint32_t deviceIter = UINT32_C(0); deviceIter < DEVICE_LIST_COUNT; ++deviceIter)
     {
         deviceList[deviceIter].deviceVerbosity = toolVerbosity;
@@ -1330,6 +2095,60 @@ int main(int argc, char* argv[])
             }
         }
 
+        if (REPAIR_PENDING_LIST_FLAG)
+        {
+            if (SINGLE_SECTOR_DATA_ERASE_FLAG)
+            {
+                // the other tests' default error limit does not apply here, every pending LBA is attempted unless
+                // --errorLimit was given
+                uint64_t repairErrorLimit = REPAIR_PENDING_LIST_LIMIT_FLAG ? ERROR_LIMIT_FLAG : UINT64_C(0);
+                if (!ERROR_LIMIT_LOGICAL_COUNT && deviceList[deviceIter].drive_info.deviceBlockSize > UINT32_C(0) &&
+                    deviceList[deviceIter].drive_info.devicePhyBlockSize >
+                        deviceList[deviceIter].drive_info.deviceBlockSize)
+                {
+                    // the limit was given in physical sectors and failures are counted in logical blocks
+                    repairErrorLimit *= deviceList[deviceIter].drive_info.devicePhyBlockSize /
+                                        deviceList[deviceIter].drive_info.deviceBlockSize;
+                }
+                switch (repair_Pending_List(&deviceList[deviceIter],
+                                            C_CAST(eRepairPendingMethod, REPAIR_PENDING_LIST_MODE_FLAG),
+                                            repairErrorLimit, toolVerbosity))
+                {
+                case SUCCESS:
+                    if (VERBOSITY_QUIET < toolVerbosity)
+                    {
+                        print_str("Pending list repair completed successfully\n");
+                    }
+                    break;
+                case NOT_SUPPORTED:
+                    if (VERBOSITY_QUIET < toolVerbosity)
+                    {
+                        print_str("\nRepairing the pending list is not supported on this device.\n");
+                    }
+                    exitCode = UTIL_EXIT_OPERATION_NOT_SUPPORTED;
+                    break;
+                default:
+                    if (VERBOSITY_QUIET < toolVerbosity)
+                    {
+                        print_str("Failed to repair all pending LBAs\n");
+                    }
+                    exitCode = UTIL_EXIT_OPERATION_FAILURE;
+                    break;
+                }
+            }
+            else
+            {
+                if (VERBOSITY_QUIET < toolVerbosity)
+                {
+                    print_str("\n");
+                    printf("You must add the flag:\n\"%s\" \n", SINGLE_SECTOR_DATA_ERASE_ACCEPT_STRING);
+                    print_str("to the command line arguments to repair the pending list.\n\n");
+                    printf("e.g.: %s -d %s --%s --confirm %s\n\n", util_name, deviceHandleExample,
+                           REPAIR_PENDING_LIST_LONG_OPT_STRING, SINGLE_SECTOR_DATA_ERASE_ACCEPT_STRING);
+                }
+            }
+        }
+
         if (SCSI_REALLOCATE_BLOCKS_LIST_LENGTH > 0)
         {
             switch (reallocate_LBAs(&deviceList[deviceIter], SCSI_REALLOCATE_BLOCKS_LIST,
@@ -1360,14 +2179,38 @@ int main(int argc, char* argv[])
 
         if (SCSI_DEFECTS_FLAG)
         {
-            ptrSCSIDefectList defects = M_NULLPTR;
-            switch (get_SCSI_Defect_List(&deviceList[deviceIter],
-                                         C_CAST(eSCSIAddressDescriptors, SCSI_DEFECTS_DESCRIPTOR_MODE),
-                                         SCSI_DEFECTS_GROWN_LIST, SCSI_DEFECTS_PRIMARY_LIST, &defects))
+            uint64_t                defectCount  = UINT64_C(0);
+            eSCSIDefectStreamFormat defectOutput = SCSI_DEFECT_STREAM_SCREEN;
+            eReturnValues           defectResult = SUCCESS;
+            if (SCSI_DEFECTS_FILE != M_NULLPTR)
+            {
+                defectOutput = SCSI_DEFECTS_FILE_FORMAT;
+            }
+            defectResult = stream_SCSI_Defect_List(&deviceList[deviceIter],
+                                                   C_CAST(uint8_t, SCSI_DEFECTS_DESCRIPTOR_MODE),
+                                                   SCSI_DEFECTS_GROWN_LIST, SCSI_DEFECTS_PRIMARY_LIST, defectOutput,
+                                                   SCSI_DEFECTS_FILE, &defectCount);
+            if (defectResult == NOT_SUPPORTED && defectOutput == SCSI_DEFECT_STREAM_SCREEN)
+            {
+                // READ DEFECT DATA (12) with an address descriptor index did not work. The library can still read the
+                // whole list at once, including with READ DEFECT DATA (10) on older drives.
+                ptrSCSIDefectList defects = M_NULLPTR;
+                defectResult              = get_SCSI_Defect_List(&deviceList[deviceIter],
+                                                    C_CAST(eSCSIAddressDescriptors, SCSI_DEFECTS_DESCRIPTOR_MODE),
+                                                    SCSI_DEFECTS_GROWN_LIST, SCSI_DEFECTS_PRIMARY_LIST, &defects);
+                if (defectResult == SUCCESS)
+                {
+                    print_SCSI_Defect_List(defects);
+                    free_Defect_List(&defects);
+                }
+            }
+            switch (defectResult)
             {
             case SUCCESS:
-                print_SCSI_Defect_List(defects);
-                free_Defect_List(&defects);
+                if (SCSI_DEFECTS_FILE != M_NULLPTR && VERBOSITY_QUIET < toolVerbosity)
+                {
+                    printf("Wrote %" PRIu64 " defects to %s\n", defectCount, SCSI_DEFECTS_FILE);
+                }
                 break;
             case NOT_SUPPORTED:
                 if (VERBOSITY_QUIET < toolVerbosity)
@@ -1377,6 +2220,21 @@ int main(int argc, char* argv[])
                 }
                 exitCode = UTIL_EXIT_OPERATION_NOT_SUPPORTED;
                 break;
+            case INSECURE_PATH:
+            case FILE_OPEN_ERROR:
+                if (VERBOSITY_QUIET < toolVerbosity)
+                {
+                    printf("Couldn't open file %s\n", SCSI_DEFECTS_FILE);
+                }
+                exitCode = UTIL_EXIT_CANNOT_OPEN_FILE;
+                break;
+            case ERROR_WRITING_FILE:
+                if (VERBOSITY_QUIET < toolVerbosity)
+                {
+                    printf("Error writing defects to %s after %" PRIu64 " defects\n", SCSI_DEFECTS_FILE, defectCount);
+                }
+                exitCode = UTIL_EXIT_ERROR_WRITING_FILE;
+                break;
             default:
                 if (VERBOSITY_QUIET < toolVerbosity)
                 {
@@ -1387,7 +2245,30 @@ int main(int argc, char* argv[])
             }
         }
 
-        if (DST_AND_CLEAN_FLAG)
+        bool addedToFleet = false;
+        if (fleetDSTAndClean)
+        {
+            uint64_t fleetErrorLimit = ERROR_LIMIT_FLAG;
+            if (!ERROR_LIMIT_LOGICAL_COUNT && deviceList[deviceIter].drive_info.deviceBlockSize > UINT32_C(0) &&
+                deviceList[deviceIter].drive_info.devicePhyBlockSize >
+                    deviceList[deviceIter].drive_info.deviceBlockSize)
+            {
+                // the limit was given in physical sectors and repairs are counted in logical blocks
+                fleetErrorLimit *= deviceList[deviceIter].drive_info.devicePhyBlockSize /
+                                   deviceList[deviceIter].drive_info.deviceBlockSize;
+            }
+            if (SUCCESS == add_Fleet_DST_Drive(&fleet, &deviceList[deviceIter], fleetErrorLimit))
+            {
+                addedToFleet = true;
+            }
+            else if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                print_str(
+                    "Unable to add this drive to the fleet DST. Running DST and clean on this drive by itself.\n");
+            }
+        }
+
+        if (DST_AND_CLEAN_FLAG && !addedToFleet)
         {
             if (SINGLE_SECTOR_DATA_ERASE_FLAG)
             {
@@ -1621,6 +2502,79 @@ int main(int argc, char* argv[])
             }
         }
 
+        if (UNCORRECTABLE_LIST_FLAG != M_NULLPTR || RANDOM_UNCORRECTABLE_RANGES_FLAG > 0)
+        {
+            eReturnValues  batchRet = SUCCESS;
+            lbaIntervalSet targets;
+            DECLARE_ZERO_INIT_ARRAY(char, batchSource, OPENSEA_PATH_MAX + 64);
+            safe_memset(&targets, sizeof(lbaIntervalSet), 0, sizeof(lbaIntervalSet));
+            if (UNCORRECTABLE_LIST_FLAG != M_NULLPTR)
+            {
+                batchRet = read_Uncorrectable_List_File(UNCORRECTABLE_LIST_FLAG,
+                                                        deviceList[deviceIter].drive_info.deviceMaxLba, &targets);
+                snprintf_err_handle(batchSource, OPENSEA_PATH_MAX + 64, "list %s", UNCORRECTABLE_LIST_FLAG);
+            }
+            if (batchRet == SUCCESS && RANDOM_UNCORRECTABLE_RANGES_FLAG > 0)
+            {
+                uint64_t seed       = C_CAST(uint64_t, time(M_NULLPTR)) + deviceIter;
+                size_t   sourceUsed = safe_strlen(batchSource);
+                batchRet = build_Random_Uncorrectable_Ranges(&deviceList[deviceIter], RANDOM_UNCORRECTABLE_RANGES_FLAG,
+                                                             UNCORRECTABLE_RANGE_FLAG, seed, &targets);
+                snprintf_err_handle(&batchSource[sourceUsed], OPENSEA_PATH_MAX + 64 - sourceUsed,
+                                    "%srandom ranges %" PRIu32 " max length %" PRIu64 " seed %" PRIu64,
+                                    sourceUsed > 0 ? " + " : "", RANDOM_UNCORRECTABLE_RANGES_FLAG,
+                                    UNCORRECTABLE_RANGE_FLAG, seed);
+            }
+            if (batchRet == SUCCESS)
+            {
+                batchRet = run_Uncorrectable_Batch(&deviceList[deviceIter], &targets, FLAG_UNCORRECTABLES_FLAG,
+                                                   READ_UNCORRECTABLES_FLAG, batchSource, toolVerbosity);
+            }
+            switch (batchRet)
+            {
+            case SUCCESS:
+                if (toolVerbosity > VERBOSITY_QUIET)
+                {
+                    print_str("Successfully injected all uncorrectable ranges.\n");
+                }
+                break;
+            case NOT_SUPPORTED:
+                exitCode = UTIL_EXIT_OPERATION_NOT_SUPPORTED;
+                if (toolVerbosity > VERBOSITY_QUIET)
+                {
+                    print_str("Creating uncorrectable errors is not supported by this device at this time.\n");
+                }
+                break;
+            case BAD_PARAMETER:
+                exitCode = UTIL_EXIT_ERROR_IN_COMMAND_LINE;
+                break;
+            case FILE_OPEN_ERROR:
+            case INSECURE_PATH:
+            case FILE_READ_ERROR:
+                exitCode = UTIL_EXIT_CANNOT_OPEN_FILE;
+                if (toolVerbosity > VERBOSITY_QUIET)
+                {
+                    print_str("Unable to open the uncorrectable list or create the manifest.\n");
+                }
+                break;
+            case ERROR_WRITING_FILE:
+                exitCode = UTIL_EXIT_ERROR_WRITING_FILE;
+                if (toolVerbosity > VERBOSITY_QUIET)
+                {
+                    print_str("Error writing the uncorrectable manifest. It may not list everything injected.\n");
+                }
+                break;
+            default:
+                exitCode = UTIL_EXIT_OPERATION_FAILURE;
+                if (toolVerbosity > VERBOSITY_QUIET)
+                {
+                    print_str("Failed to inject all uncorrectable ranges. See the manifest for details.\n");
+                }
+                break;
+            }
+            free_LBA_Interval_Set(&targets);
+        }
+
         if (CORRUPT_LBA_FLAG)
         {
             if (is_Read_Long_Write_Long_Supported(&deviceList[deviceIter]))
@@ -1758,7 +2712,49 @@ int main(int argc, char* argv[])
         }
 
         // At this point, close the device handle since it is no longer needed. Do not put any further IO below this.
-        close_Device(&deviceList[deviceIter]);
+        // Drives in the fleet DST stay open until it finishes.
+        if (!addedToFleet)
+        {
+            close_Device(&deviceList[deviceIter]);
+        }
+    }
+    if (fleet.count > UINT32_C(0))
+    {
+        switch (run_Fleet_DST(&fleet, false, true, false, toolVerbosity))
+        {
+        case SUCCESS:
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                print_str("DST and Clean completed successfully on all drives\n");
+            }
+            break;
+        case ABORTED:
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                print_str("DST And Clean was aborted on some drives!\n");
+            }
+            exitCode = UTIL_EXIT_OPERATION_ABORTED;
+            break;
+        case NOT_SUPPORTED:
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                print_str("DST and Clean is not supported on any of these drives\n");
+            }
+            exitCode = UTIL_EXIT_OPERATION_NOT_SUPPORTED;
+            break;
+        default:
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                print_str("DST and Clean Failed on some drives!\n");
+            }
+            exitCode = UTIL_EXIT_OPERATION_FAILURE;
+            break;
+        }
+        for (uint32_t fleetIter = UINT32_C(0); fleetIter < fleet.count; ++fleetIter)
+        {
+            close_Device(fleet.drives[fleetIter].device);
+        }
+        free_Fleet_DST(&fleet);
     }
     free_device_list(&DEVICE_LIST);
     if (getDevsRet != SUCCESS && skippedDevices == DEVICE_LIST_COUNT)
@@ -1854,6 +2850,7 @@ void utility_Usage(bool shortUsage)
     print_Fast_Discovery_Help(shortUsage);
     // utility tests/operations go here - alphabetized
     print_Error_Limit_Help(shortUsage);
+    print_Fleet_DST_Help(shortUsage);
     // multiple interfaces
     print_Check_Grown_List_Help(shortUsage);
     print_Check_Pending_List_Help(shortUsage);
@@ -1864,6 +2861,8 @@ void utility_Usage(bool shortUsage)
 
     // SAS Only Options
     print_str("\n\tSAS Only:\n\n");
+    print_SCSI_Defects_File_Help(shortUsage);
+    print_SCSI_Defects_File_Format_Help(shortUsage);
     print_SCSI_Defects_Format_Help(shortUsage);
     print_SCSI_Defects_Help(shortUsage);
     print_Reallocate_LBAs_Help(shortUsage);
@@ -1874,6 +2873,7 @@ void utility_Usage(bool shortUsage)
     // utility data destructive tests/operations go here
     print_Bytes_To_Corrupt_Help(shortUsage);
     print_DST_And_Clean_Help(shortUsage);
+    print_Repair_Pending_List_Help(shortUsage);
     print_Corrupt_LBA_Help(shortUsage);
     print_Corrupt_Random_LBAs_Help(shortUsage);
     print_Corrupt_Range_Help(shortUsage);
@@ -1881,6 +2881,8 @@ void utility_Usage(bool shortUsage)
     print_Flag_Uncorrectable_Help(shortUsage);
     print_Create_Uncorrectable_Help(shortUsage);
     print_Random_Uncorrectable_Help(shortUsage);
+    print_Random_Uncorrectable_Ranges_Help(shortUsage);
+    print_Uncorrectable_List_Help(shortUsage);
     print_Uncorrectable_Range_Help(shortUsage);
 }
 
@@ -1535,11 +1535,11 @@ int main(int argc, char* argv[])
         print_str("environment to reduce the risk of these interuptions. If the OS is unable to complete\n");
         print_str("certain commands for it's background polling of the device, it may trigger a device\n");
         print_str("reset and interrupt the format, leaving the drive inoperable if it cannot be recovered.\n");
-        set_Console_Foreground_Background_Colors(CONSOLE_COLOR_BRIGHT_RED, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_BRIGHT_RED, CONSOLE_COLOR_DEFAULT);
         print_str("\t\tThere is a risk when performing a low-level format/fast format that may\n");
         print_str("\t\tmake the drive inoperable if it is reset at any time while it is formatting.\n");
-        set_Console_Foreground_Background_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
-        set_Console_Foreground_Background_Colors(CONSOLE_COLOR_BRIGHT_YELLOW, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_BRIGHT_YELLOW, CONSOLE_COLOR_DEFAULT);
         print_str("\t\tWARNING: Any interruption to the device while it is formatting may render the\n");
         print_str("\t\t         drive inoperable! Use this at your own risk!\n");
         print_str("\t\tWARNING: Set sector size may affect all LUNs/namespaces for devices\n");
@@ -1556,7 +1556,7 @@ int main(int argc, char* argv[])
         print_str("\t\tWARNING: It is recommended that this operation is done from a bootable environment\n");
         print_str("\t\t         (Live USB) to reduce the risk of OS background activities running and\n");
         print_str("\t\t         triggering a device reset while reformating the drive.\n\n");
-        set_Console_Foreground_Background_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
 
         // if the user has provided the confirmation flag, skip the countdown
         if (!LOW_LEVEL_FORMAT_FLAG)
@@ -2878,10 +2878,10 @@ int main(int argc, char* argv[])
                         printf("e.g.: %s -d %s --%s current --%s 1 --confirm %s\n\n", util_name, deviceHandleExample,
                                FORMAT_UNIT_LONG_OPT_STRING, FAST_FORMAT_LONG_OPT_STRING,
                                LOW_LEVEL_FORMAT_ACCEPT_STRING);
-                        set_Console_Foreground_Background_Colors(CONSOLE_COLOR_BRIGHT_RED, CONSOLE_COLOR_DEFAULT);
+                        set_Console_Output_Colors(CONSOLE_COLOR_BRIGHT_RED, CONSOLE_COLOR_DEFAULT);
                         print_str("\t\tThere is an additional risk when performing a low-level fast format that may\n");
                         print_str("\t\tmake the drive inoperable if it is reset at any time while it is formatting.\n");
-                        set_Console_Foreground_Background_Colors(CONSOLE_COLOR_BRIGHT_YELLOW, CONSOLE_COLOR_DEFAULT);
+                        set_Console_Output_Colors(CONSOLE_COLOR_BRIGHT_YELLOW, CONSOLE_COLOR_DEFAULT);
                         print_str(
                             "\t\tWARNING: Any interruption to the device while it is formatting may render the\n");
                         print_str("\t\t         drive inoperable! Use this at your own risk!\n");
@@ -2895,7 +2895,7 @@ int main(int argc, char* argv[])
                         print_str(
                             "\t\t         (Live USB) to reduce the risk of OS background activities running and\n");
                         print_str("\t\t         triggering a device reset while reformating the drive.\n\n");
-                        set_Console_Foreground_Background_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
+                        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                     }
                     else
                     {
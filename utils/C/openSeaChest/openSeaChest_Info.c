@@ -27,6 +27,8 @@
 #include "device_statistics.h"
 #include "drive_info.h"
 #include "getopt.h"
+#include "openseachest_health.h"
+#include "openseachest_json.h"
 #include "openseachest_util_options.h"
 #include "operations.h"
 #include "smart.h"
@@ -46,6 +48,8 @@
 ////////////////////////
 const char* util_name    = "openSeaChest_Info";
 #define buildVersion UTIL_BUILD_VERSION
+// options that have a section in the --jsonOutput document
+#define JSON_OUTPUT_OPTIONS "-i, --smartAttributes, --deviceStatistics"
 
 ////////////////////////////
 //  functions to declare  //
@@ -98,6 +102,8 @@ int main(int argc, char* argv[])
     OUTPUTPATH_VAR
     // tool specific
     DEVICE_STATISTICS_VAR
+    HEALTH_STORE_VAR
+    JSON_OUTPUT_VAR
     SHOW_CDL_SETTINGS_VAR
     SMART_ATTRIBUTES_VARS
     SCSI_DEFECTS_VARS
@@ -147,6 +153,8 @@ int main(int argc, char* argv[])
         OUTPUTPATH_LONG_OPT,
         // tool specific options go here
         DEVICE_STATISTICS_LONG_OPT,
+        HEALTH_STORE_LONG_OPT,
+        JSON_OUTPUT_LONG_OPT,
         SHOW_CDL_SETTINGS_LONG_OPT,
         SMART_ATTRIBUTES_LONG_OPT,
         SCSI_DEFECTS_LONG_OPTS,
@@ -278,6 +286,26 @@ int main(int argc, char* argv[])
                     }
                 }
             }
+            else if (strcmp(longopts[optionIndex].name, SCSI_DEFECTS_FILE_LONG_OPT_STRING) == 0)
+            {
+                SCSI_DEFECTS_FILE = optarg;
+            }
+            else if (strcmp(longopts[optionIndex].name, SCSI_DEFECTS_FILE_FORMAT_LONG_OPT_STRING) == 0)
+            {
+                if (strcmp("csv", optarg) == 0)
+                {
+                    SCSI_DEFECTS_FILE_FORMAT = SCSI_DEFECT_STREAM_CSV;
+                }
+                else if (strcmp("bin", optarg) == 0)
+                {
+                    SCSI_DEFECTS_FILE_FORMAT = SCSI_DEFECT_STREAM_BINARY;
+                }
+                else
+                {
+                    print_Error_In_Cmd_Line_Args(SCSI_DEFECTS_FILE_FORMAT_LONG_OPT_STRING, optarg);
+                    exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
+                }
+            }
             else if (strcmp(longopts[optionIndex].name, REINITIALIZE_DEV_STATS_LONG_OPT_STRING) == 0)
             {
                 bool optargIsValid = false;
@@ -302,6 +330,10 @@ int main(int argc, char* argv[])
                     exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
                 }
             }
+            else if (strcmp(longopts[optionIndex].name, HEALTH_STORE_LONG_OPT_STRING) == 0)
+            {
+                HEALTH_STORE_FLAG = optarg;
+            }
             else if (strcmp(longopts[optionIndex].name, SHOW_CDL_SETTINGS_LONG_OPT_STRING) == 0)
             {
                 if (optarg == M_NULLPTR && optind < argc && argv[optind][0] != '-')
@@ -452,6 +484,12 @@ int main(int argc, char* argv[])
         }
     }
 
+    if (JSON_OUTPUT_FLAG)
+    {
+        // nothing but the JSON document is written to stdout. Messages go to stderr.
+        move_Messages_To_Stderr();
+    }
+
     if (0 != atexit(atexit_Print_Final_newline))
     {
         perror("Registering final newline print");
@@ -646,13 +684,36 @@ int main(int argc, char* argv[])
           || CSMI_INFO_FLAG
 #endif
           || SHOW_CONCURRENT_RANGES || PARTITION_INFO_FLAG || SHOW_PHY_EVENT_COUNTERS || REINITIALIZE_SATA_PHY_EVENTS ||
-          REINITIALIZE_DEV_STATS >= 0))
+          REINITIALIZE_DEV_STATS >= 0 || HEALTH_STORE_FLAG != M_NULLPTR))
     {
         utility_Usage(true);
         free_Handle_List(&HANDLE_LIST, DEVICE_LIST_COUNT);
         exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
     }
 
+    if (JSON_OUTPUT_FLAG)
+    {
+        const textOnlyOption textOnlyOptions[] = {
+            {M_ToBool(TEST_UNIT_READY_FLAG), "--" TEST_UNIT_READY_LONG_OPT_STRING},
+            {M_ToBool(LOWLEVEL_INFO_FLAG), "--" LOWLEVEL_INFO_LONG_OPT_STRING},
+            {M_ToBool(PARTITION_INFO_FLAG), "--" PARTITION_INFO_LONG_OPT_STRING},
+#if defined(ENABLE_CSMI)
+            {M_ToBool(CSMI_INFO_FLAG), "--" CSMI_INFO_LONG_OPT_STRING},
+#endif
+            {SHOW_CDL_SETTINGS_FLAG && SHOW_CDL_SETTINGS_MODE_FLAG == CDL_SETTINGS_OUTPUT_RAW,
+             "--" SHOW_CDL_SETTINGS_LONG_OPT_STRING},
+            {M_ToBool(SCSI_DEFECTS_FLAG), "--" SCSI_DEFECTS_LONG_OPT_STRING},
+            {M_ToBool(SHOW_CONCURRENT_RANGES), "--" SHOW_CONCURRENT_RANGES_LONG_OPT_STRING},
+            {M_ToBool(SHOW_PHY_EVENT_COUNTERS), "--" SHOW_PHY_EVENT_COUNTERS_LONG_OPT_STRING},
+        };
+        if (!check_JSON_Output_Options(textOnlyOptions, sizeof(textOnlyOptions) / sizeof(textOnlyOptions[0]),
+                                       JSON_OUTPUT_OPTIONS))
+        {
+            free_Handle_List(&HANDLE_LIST, DEVICE_LIST_COUNT);
+            exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
+        }
+    }
+
     uint64_t flags = UINT64_C(0);
     DEVICE_LIST    = M_REINTERPRET_CAST(tDevice*, safe_calloc(DEVICE_LIST_COUNT, sizeof(tDevice)));
     if (!DEVICE_LIST)
@@ -810,6 +871,17 @@ int main(int argc, char* argv[])
     }
     free_Handle_List(&HANDLE_LIST, DEVICE_LIST_COUNT);
     uint32_t skippedDevices = UINT32_C(0);
+    // With --jsonOutput, each device is an entry in the "devices" array of one document
+    jsonStream json;
+    safe_memset(&json, sizeof(jsonStream), 0, sizeof(jsonStream));
+    if (JSON_OUTPUT_FLAG)
+    {
+        open_JSON_Stream(&json, M_NULLPTR);
+        begin_JSON_Object(&json, M_NULLPTR);
+        write_JSON_String(&json, "tool", util_name);
+        write_JSON_String(&json, "version", buildVersion);
+        begin_JSON_Array(&json, "devices");
+    }
     for (uint32_t deviceIter = UINT32_C(0); deviceIter < DEVICE_LIST_COUNT; ++deviceIter)
     {
         deviceList[deviceIter].deviceVerbosity = toolVerbosity;
@@ -964,8 +1036,16 @@ int main(int argc, char* argv[])
                    print_drive_type(&deviceList[deviceIter]));
         }
 
+        healthSample jsonSample;
+        safe_memset(&jsonSample, sizeof(healthSample), 0, sizeof(healthSample));
+        if (JSON_OUTPUT_FLAG)
+        {
+            begin_JSON_Object(&json, M_NULLPTR);
+            write_JSON_Drive_Identity(&json, "identity", &deviceList[deviceIter]);
+        }
+
         // now start looking at what operations are going to be performed and kick them off
-        if (DEVICE_INFO_FLAG)
+        if (DEVICE_INFO_FLAG && !JSON_OUTPUT_FLAG)
         {
             if (SUCCESS != print_Drive_Information(&deviceList[deviceIter], SAT_INFO_FLAG))
             {
@@ -1014,8 +1094,20 @@ int main(int argc, char* argv[])
 
         if (SMART_ATTRIBUTES_FLAG)
         {
-            switch (
-                print_SMART_Attributes(&deviceList[deviceIter], C_CAST(eSMARTAttrOutMode, SMART_ATTRIBUTES_MODE_FLAG)))
+            eReturnValues attributesRet = UNKNOWN;
+            if (JSON_OUTPUT_FLAG)
+            {
+                attributesRet = write_JSON_Health_Sample(
+                    &json, "smartAttributes", &deviceList[deviceIter], &jsonSample,
+                    HEALTH_METRIC_SOURCE_BIT(HEALTH_METRIC_ATA_SMART_RAW) |
+                        HEALTH_METRIC_SOURCE_BIT(HEALTH_METRIC_ATA_SMART_NORMALIZED));
+            }
+            else
+            {
+                attributesRet = print_SMART_Attributes(&deviceList[deviceIter],
+                                                       C_CAST(eSMARTAttrOutMode, SMART_ATTRIBUTES_MODE_FLAG));
+            }
+            switch (attributesRet)
             {
             case SUCCESS:
                 // nothing to print here since if it was successful, the attributes will be printed to the screen
@@ -1039,11 +1131,27 @@ int main(int argc, char* argv[])
 
         if (DEVICE_STATISTICS_FLAG)
         {
+            eReturnValues    deviceStatsRet = UNKNOWN;
             deviceStatistics deviceStats;
             safe_memset(&deviceStats, sizeof(deviceStatistics), 0, sizeof(deviceStatistics));
-            switch (get_DeviceStatistics(&deviceList[deviceIter], &deviceStats))
+            if (JSON_OUTPUT_FLAG)
+            {
+                deviceStatsRet =
+                    write_JSON_Health_Sample(&json, "deviceStatistics", &deviceList[deviceIter], &jsonSample,
+                                             HEALTH_METRIC_SOURCE_BIT(HEALTH_METRIC_ATA_DEVICE_STATISTIC) |
+                                                 HEALTH_METRIC_SOURCE_BIT(HEALTH_METRIC_SCSI_LOG_PARAMETER));
+            }
+            else
+            {
+                deviceStatsRet = get_DeviceStatistics(&deviceList[deviceIter], &deviceStats);
+            }
+            switch (deviceStatsRet)
             {
             case SUCCESS:
+                if (JSON_OUTPUT_FLAG)
+                {
+                    break;
+                }
                 print_DeviceStatistics(&deviceList[deviceIter], &deviceStats);
                 // if supported then print Seagate Device Statistics also
                 if (is_Seagate_DeviceStatistics_Supported(&deviceList[deviceIter]))
@@ -1074,6 +1182,61 @@ int main(int argc, char* argv[])
             }
         }
 
+        if (HEALTH_STORE_FLAG != M_NULLPTR)
+        {
+            switch (save_Health_Store_Sample(&deviceList[deviceIter], HEALTH_STORE_FLAG))
+            {
+            case SUCCESS:
+                if (VERBOSITY_QUIET < toolVerbosity)
+                {
+                    print_str("Health sample saved to the health store.\n");
+                }
+                break;
+            case NOT_SUPPORTED:
+                if (VERBOSITY_QUIET < toolVerbosity)
+                {
+                    print_str("No health information could be read from this device.\n");
+                }
+                exitCode = UTIL_EXIT_OPERATION_NOT_SUPPORTED;
+                break;
+            case INSECURE_PATH:
+                if (VERBOSITY_QUIET < toolVerbosity)
+                {
+                    print_str("The health store path is not secure. Choose a different location.\n");
+                }
+                exitCode = UTIL_EXIT_INSECURE_PATH;
+                break;
+            case FILE_OPEN_ERROR:
+                if (VERBOSITY_QUIET < toolVerbosity)
+                {
+                    print_str("Unable to open the health store file.\n");
+                }
+                exitCode = UTIL_EXIT_CANNOT_OPEN_FILE;
+                break;
+            case VALIDATION_FAILURE:
+                if (VERBOSITY_QUIET < toolVerbosity)
+                {
+                    print_str("The health store file belongs to another drive or is not a health store.\n");
+                }
+                exitCode = UTIL_EXIT_OPERATION_FAILURE;
+                break;
+            case ERROR_WRITING_FILE:
+                if (VERBOSITY_QUIET < toolVerbosity)
+                {
+                    print_str("Error writing to the health store file.\n");
+                }
+                exitCode = UTIL_EXIT_ERROR_WRITING_FILE;
+                break;
+            default:
+                if (VERBOSITY_QUIET < toolVerbosity)
+                {
+                    print_str("Failed to save a health sample.\n");
+                }
+                exitCode = UTIL_EXIT_OPERATION_FAILURE;
+                break;
+            }
+        }
+
         if (REINITIALIZE_DEV_STATS >= 0)
         {
             switch (ata_Device_Statistics_Reinitialize(&deviceList[deviceIter], REINITIALIZE_DEV_STATS))
@@ -1147,14 +1310,38 @@ int main(int argc, char* argv[])
 
         if (SCSI_DEFECTS_FLAG)
         {
-            ptrSCSIDefectList defects = M_NULLPTR;
-            switch (get_SCSI_Defect_List(&deviceList[deviceIter],
-                                         C_CAST(eSCSIAddressDescriptors, SCSI_DEFECTS_DESCRIPTOR_MODE),
-                                         SCSI_DEFECTS_GROWN_LIST, SCSI_DEFECTS_PRIMARY_LIST, &defects))
+            uint64_t                defectCount  = UINT64_C(0);
+            eSCSIDefectStreamFormat defectOutput = SCSI_DEFECT_STREAM_SCREEN;
+            eReturnValues           defectResult = SUCCESS;
+            if (SCSI_DEFECTS_FILE != M_NULLPTR)
+            {
+                defectOutput = SCSI_DEFECTS_FILE_FORMAT;
+            }
+            defectResult = stream_SCSI_Defect_List(&deviceList[deviceIter],
+                                                   C_CAST(uint8_t, SCSI_DEFECTS_DESCRIPTOR_MODE),
+                                                   SCSI_DEFECTS_GROWN_LIST, SCSI_DEFECTS_PRIMARY_LIST, defectOutput,
+                                                   SCSI_DEFECTS_FILE, &defectCount);
+            if (defectResult == NOT_SUPPORTED && defectOutput == SCSI_DEFECT_STREAM_SCREEN)
+            {
+                // READ DEFECT DATA (12) with an address descriptor index did not work. The library can still read the
+                // whole list at once, including with READ DEFECT DATA (10) on older drives.
+                ptrSCSIDefectList defects = M_NULLPTR;
+                defectResult              = get_SCSI_Defect_List(&deviceList[deviceIter],
+                                                    C_CAST(eSCSIAddressDescriptors, SCSI_DEFECTS_DESCRIPTOR_MODE),
+                                                    SCSI_DEFECTS_GROWN_LIST, SCSI_DEFECTS_PRIMARY_LIST, &defects);
+                if (defectResult == SUCCESS)
+                {
+                    print_SCSI_Defect_List(defects);
+                    free_Defect_List(&defects);
+                }
+            }
+            switch (defectResult)
             {
             case SUCCESS:
-                print_SCSI_Defect_List(defects);
-                free_Defect_List(&defects);
+                if (SCSI_DEFECTS_FILE != M_NULLPTR && VERBOSITY_QUIET < toolVerbosity)
+                {
+                    printf("Wrote %" PRIu64 " defects to %s\n", defectCount, SCSI_DEFECTS_FILE);
+                }
                 break;
             case NOT_SUPPORTED:
                 if (VERBOSITY_QUIET < toolVerbosity)
@@ -1164,6 +1351,21 @@ int main(int argc, char* argv[])
                 }
                 exitCode = UTIL_EXIT_OPERATION_NOT_SUPPORTED;
                 break;
+            case INSECURE_PATH:
+            case FILE_OPEN_ERROR:
+                if (VERBOSITY_QUIET < toolVerbosity)
+                {
+                    printf("Couldn't open file %s\n", SCSI_DEFECTS_FILE);
+                }
+                exitCode = UTIL_EXIT_CANNOT_OPEN_FILE;
+                break;
+            case ERROR_WRITING_FILE:
+                if (VERBOSITY_QUIET < toolVerbosity)
+                {
+                    printf("Error writing defects to %s after %" PRIu64 " defects\n", SCSI_DEFECTS_FILE, defectCount);
+                }
+                exitCode = UTIL_EXIT_ERROR_WRITING_FILE;
+                break;
             default:
                 if (VERBOSITY_QUIET < toolVerbosity)
                 {
@@ -1254,9 +1456,20 @@ int main(int argc, char* argv[])
                 break;
             }
         }
+        if (JSON_OUTPUT_FLAG)
+        {
+            end_JSON_Object(&json);
+        }
+        free_Health_Sample(&jsonSample);
         // At this point, close the device handle since it is no longer needed. Do not put any further IO below this.
         close_Device(&deviceList[deviceIter]);
     }
+    if (JSON_OUTPUT_FLAG)
+    {
+        end_JSON_Array(&json);
+        end_JSON_Object(&json);
+        close_JSON_Stream(&json);
+    }
     free_device_list(&DEVICE_LIST);
     if (getDevsRet != SUCCESS && skippedDevices == DEVICE_LIST_COUNT)
     {
@@ -1334,6 +1547,7 @@ void utility_Usage(bool shortUsage)
     print_Force_ATA_UDMA_Help(shortUsage);
     print_Force_SCSI_Help(shortUsage);
     print_Help_Help(shortUsage);
+    print_JSON_Output_Help(shortUsage, JSON_OUTPUT_OPTIONS);
     print_License_Help(shortUsage);
     print_Model_Match_Help(shortUsage);
     print_No_Banner_Help(shortUsage);
@@ -1361,6 +1575,7 @@ void utility_Usage(bool shortUsage)
     print_CSMI_Info_Help(shortUsage);
 #endif
     print_Device_Statistics_Help(shortUsage);
+    print_Health_Store_Help(shortUsage);
     print_Show_CDL_Settings_Help(shortUsage);
     print_Show_Concurrent_Position_Ranges_Help(shortUsage);
     print_Partition_Info_Help(shortUsage);
@@ -1372,6 +1587,8 @@ void utility_Usage(bool shortUsage)
     print_SMART_Attributes_Help(shortUsage);
     // SAS Only Options
     print_str("\n\tSAS Only:\n\t=========\n");
+    print_SCSI_Defects_File_Help(shortUsage);
+    print_SCSI_Defects_File_Format_Help(shortUsage);
     print_SCSI_Defects_Format_Help(shortUsage);
     print_SCSI_Defects_Help(shortUsage);
 }
@@ -19,7 +19,9 @@
 #include "io_utils.h"
 #include "memory_safety.h"
 #include "secure_file.h"
+#include "precision_timer.h"
 #include "string_utils.h"
+#include "time_utils.h"
 #include "type_conversion.h"
 #include "unit_conversion.h"
 
@@ -31,7 +33,12 @@
 #include "drive_info.h"
 #include "farm_log.h"
 #include "logs.h"
+#include "openseachest_json.h"
+#include "openseachest_log_compression.h"
+#include "openseachest_log_diff.h"
+#include "openseachest_telemetry.h"
 #include "openseachest_util_options.h"
+#include "openseachest_util_threads.h"
 #include "smart.h"
 
 ////////////////////////
@@ -39,12 +46,475 @@
 ////////////////////////
 const char* util_name    = "openSeaChest_Logs";
 #define buildVersion UTIL_BUILD_VERSION
+// options that have a section in the --jsonOutput document
+#define JSON_OUTPUT_OPTIONS "-i, --listSupportedLogs, --logDiff"
 
 ////////////////////////////
 //  functions to declare  //
 ////////////////////////////
 static void utility_Usage(bool shortUsage);
 
+#if defined(_WIN32)
+#    define LOG_COLLECTION_PATH_SEPARATOR '\\'
+#else
+#    define LOG_COLLECTION_PATH_SEPARATOR '/'
+#endif
+
+typedef enum eLogCollectionItemEnum
+{
+    LOG_COLLECTION_TELEMETRY,
+    LOG_COLLECTION_FARM,
+    LOG_COLLECTION_FARM_COMBINED,
+    LOG_COLLECTION_DST,
+    LOG_COLLECTION_IDENTIFY_DEVICE_DATA,
+    LOG_COLLECTION_SATA_PHY_COUNTERS,
+    LOG_COLLECTION_DEVICE_STATISTICS,
+    LOG_COLLECTION_INFORMATIONAL_EXCEPTIONS,
+    LOG_COLLECTION_ITEM_COUNT
+} eLogCollectionItem;
+
+static const char* logCollectionItemNames[LOG_COLLECTION_ITEM_COUNT] = {"Telemetry",
+                                                                         "FARM",
+                                                                         "FARM Combined",
+                                                                         "Self Test",
+                                                                         "Identify Device Data",
+                                                                         "SATA Phy Event Counters",
+                                                                         "Device Statistics",
+                                                                         "Informational Exceptions"};
+
+typedef struct s_logCollectionOptions
+{
+    bool     pull[LOG_COLLECTION_ITEM_COUNT];
+    bool     telemetryCurrent;
+    bool     skipUnchanged;
+    uint8_t  telemetryDataArea;
+    uint32_t transferLength;
+    int      sataFarmCopyType;
+    // M_NULLPTR unless --compressLogs was given
+    logCompressor* compressor;
+} logCollectionOptions;
+
+typedef struct s_logCollectionResult
+{
+    eReturnValues status;
+    uint64_t      bytes;
+    uint64_t      nanoSeconds;
+} logCollectionResult;
+
+typedef struct s_logCollectionJob
+{
+    tDevice*            device;
+    uint64_t            controllerKey;
+    bool                started;
+    bool                finished;
+    uint64_t            totalNanoSeconds;
+    logCollectionResult results[LOG_COLLECTION_ITEM_COUNT];
+    char                directory[OPENSEA_PATH_MAX];
+} logCollectionJob;
+
+typedef struct s_logCollectionQueue
+{
+    logCollectionJob*           jobs;
+    uint32_t                    jobCount;
+    uint32_t                    maxPerController;
+    const logCollectionOptions* options;
+    eVerbosityLevels            verbosity;
+    utilLock*                   lock;
+    utilSignal*                 signal;
+} logCollectionQueue;
+
+// NVMe devices are their own controller. Other devices are grouped by the adapter they are attached through so that
+// an HBA or RAID controller is not sent more concurrent log pulls than the cap allows. Identical adapters end up in the
+// same group, which only makes the cap more conservative.
+static uint64_t get_Log_Collection_Controller_Key(tDevice* device, uint32_t deviceIndex)
+{
+    if (device->drive_info.drive_type == NVME_DRIVE)
+    {
+        return UINT64_C(0x8000000000000000) | deviceIndex;
+    }
+    return (C_CAST(uint64_t, device->drive_info.interface_type) << 48) ^
+           (C_CAST(uint64_t, device->drive_info.adapter_info.vendorID) << 24) ^
+           C_CAST(uint64_t, device->drive_info.adapter_info.productID);
+}
+
+// One subdirectory per device named by serial number. Duplicate or missing serial numbers get the device index added.
+static eReturnValues setup_Log_Collection_Directory(logCollectionJob* jobs, uint32_t jobIndex, const char* basePath)
+{
+    logCollectionJob* job = &jobs[jobIndex];
+    DECLARE_ZERO_INIT_ARRAY(char, name, SERIAL_NUM_LEN + 32);
+    size_t nameLen = SIZE_T_C(0);
+    bool   unique  = true;
+    size_t serialLen = safe_strlen(job->device->drive_info.serialNumber);
+    for (size_t iter = SIZE_T_C(0); iter < serialLen && nameLen < SERIAL_NUM_LEN; ++iter)
+    {
+        char character = job->device->drive_info.serialNumber[iter];
+        if (safe_isalnum(character) || character == '-' || character == '_')
+        {
+            name[nameLen++] = character;
+        }
+    }
+    for (uint32_t previous = UINT32_C(0); previous < jobIndex && nameLen > SIZE_T_C(0); ++previous)
+    {
+        if (strcmp(jobs[previous].device->drive_info.serialNumber, job->device->drive_info.serialNumber) == 0)
+        {
+            unique = false;
+        }
+    }
+    if (nameLen == SIZE_T_C(0) || !unique)
+    {
+        snprintf_err_handle(&name[nameLen], sizeof(name) - nameLen, "%sdevice%" PRIu32,
+                            nameLen > SIZE_T_C(0) ? "_" : "", jobIndex);
+    }
+    if (basePath != M_NULLPTR)
+    {
+        snprintf_err_handle(job->directory, OPENSEA_PATH_MAX, "%s%c%s", basePath, LOG_COLLECTION_PATH_SEPARATOR, name);
+    }
+    else
+    {
+        snprintf_err_handle(job->directory, OPENSEA_PATH_MAX, "%s", name);
+    }
+    if (os_Directory_Exists(job->directory))
+    {
+        return SUCCESS;
+    }
+    return os_Create_Directory(job->directory);
+}
+
+static eReturnValues run_Log_Collection_Item(logCollectionJob*           job,
+                                             eLogCollectionItem          item,
+                                             const logCollectionOptions* options)
+{
+    tDevice*    device = job->device;
+    const char* path   = job->directory;
+    switch (item)
+    {
+    case LOG_COLLECTION_TELEMETRY:
+        return pull_Telemetry_Log_Streamed(device, options->telemetryCurrent, options->telemetryDataArea, path,
+                                           options->transferLength, options->skipUnchanged, M_NULLPTR);
+    case LOG_COLLECTION_FARM:
+        return pull_FARM_Log(device, path, options->transferLength, 0,
+                             SEAGATE_ATA_LOG_FIELD_ACCESSIBLE_RELIABILITY_METRICS, PULL_LOG_BIN_FILE_MODE,
+                             NAMING_SERIAL_NUMBER_DATE_TIME);
+    case LOG_COLLECTION_FARM_COMBINED:
+        return pull_FARM_Combined_Log(device, path, options->transferLength, options->sataFarmCopyType,
+                                      NAMING_SERIAL_NUMBER_DATE_TIME);
+    case LOG_COLLECTION_DST:
+        return get_DST_Log(device, path);
+    case LOG_COLLECTION_IDENTIFY_DEVICE_DATA:
+        return get_Identify_Device_Data_Log(device, path);
+    case LOG_COLLECTION_SATA_PHY_COUNTERS:
+        return get_SATA_Phy_Event_Counters_Log(device, path);
+    case LOG_COLLECTION_DEVICE_STATISTICS:
+        return get_Device_Statistics_Log(device, path);
+    case LOG_COLLECTION_INFORMATIONAL_EXCEPTIONS:
+        return pull_SCSI_Informational_Exceptions_Log(device, path);
+    case LOG_COLLECTION_ITEM_COUNT:
+        break;
+    }
+    return BAD_PARAMETER;
+}
+
+static void collect_Device_Logs(logCollectionJob* job, const logCollectionOptions* options)
+{
+    pulledLogFiles* pulledFiles = start_Pulled_Log_Files(options->compressor, job->directory);
+    DECLARE_SEATIMER(deviceTimer);
+    start_Timer(&deviceTimer);
+    for (int item = LOG_COLLECTION_TELEMETRY; item < LOG_COLLECTION_ITEM_COUNT; ++item)
+    {
+        uint64_t bytesBefore = UINT64_C(0);
+        uint64_t bytesAfter  = UINT64_C(0);
+        DECLARE_SEATIMER(itemTimer);
+        if (!options->pull[item])
+        {
+            continue;
+        }
+        // only this job writes into its directory, so the growth of the directory is the size of this log
+        get_Directory_File_Bytes(job->directory, &bytesBefore);
+        start_Timer(&itemTimer);
+        job->results[item].status = run_Log_Collection_Item(job, C_CAST(eLogCollectionItem, item), options);
+        stop_Timer(&itemTimer);
+        job->results[item].nanoSeconds = get_Nano_Seconds(itemTimer);
+        if (get_Directory_File_Bytes(job->directory, &bytesAfter) && bytesAfter > bytesBefore)
+        {
+            job->results[item].bytes = bytesAfter - bytesBefore;
+        }
+    }
+    stop_Timer(&deviceTimer);
+    job->totalNanoSeconds = get_Nano_Seconds(deviceTimer);
+    // queued only once all logs are pulled so compression does not change the directory sizes measured above
+    queue_Pulled_Log_Files(options->compressor, &pulledFiles, job->device->drive_info.serialNumber);
+}
+
+static uint32_t get_Active_Log_Collection_Jobs(const logCollectionQueue* queue, uint64_t controllerKey)
+{
+    uint32_t active = UINT32_C(0);
+    for (uint32_t iter = UINT32_C(0); iter < queue->jobCount; ++iter)
+    {
+        if (queue->jobs[iter].started && !queue->jobs[iter].finished &&
+            queue->jobs[iter].controllerKey == controllerKey)
+        {
+            ++active;
+        }
+    }
+    return active;
+}
+
+static void print_Log_Collection_Job_Summary(const logCollectionQueue* queue, const logCollectionJob* job)
+{
+    uint32_t pulled = UINT32_C(0);
+    uint32_t failed = UINT32_C(0);
+    uint64_t bytes  = UINT64_C(0);
+    for (int item = LOG_COLLECTION_TELEMETRY; item < LOG_COLLECTION_ITEM_COUNT; ++item)
+    {
+        if (queue->options->pull[item])
+        {
+            if (job->results[item].status == SUCCESS)
+            {
+                ++pulled;
+                bytes += job->results[item].bytes;
+            }
+            else if (job->results[item].status != NOT_SUPPORTED)
+            {
+                ++failed;
+            }
+        }
+    }
+    printf("%s - %s: %" PRIu32 " logs pulled, %" PRIu32 " failed, %" PRIu64 " bytes in %0.02f seconds\n",
+           job->device->os_info.name, job->device->drive_info.serialNumber, pulled, failed, bytes,
+           C_CAST(double, job->totalNanoSeconds) / 1000000000.0);
+    flush_stdout();
+}
+
+static void log_Collection_Worker(void* param)
+{
+    logCollectionQueue* queue = C_CAST(logCollectionQueue*, param);
+    lock_Util_Lock(queue->lock);
+    while (true)
+    {
+        logCollectionJob* job     = M_NULLPTR;
+        bool              pending = false;
+        for (uint32_t iter = UINT32_C(0); iter < queue->jobCount && job == M_NULLPTR; ++iter)
+        {
+            if (!queue->jobs[iter].started)
+            {
+                pending = true;
+                if (get_Active_Log_Collection_Jobs(queue, queue->jobs[iter].controllerKey) < queue->maxPerController)
+                {
+                    job = &queue->jobs[iter];
+                }
+            }
+        }
+        if (job == M_NULLPTR)
+        {
+            if (!pending)
+            {
+                break;
+            }
+            // everything left is on a controller that is at its limit. Wait for a job to finish.
+            wait_Util_Signal(queue->signal, queue->lock);
+            continue;
+        }
+        job->started = true;
+        unlock_Util_Lock(queue->lock);
+        collect_Device_Logs(job, queue->options);
+        lock_Util_Lock(queue->lock);
+        job->finished = true;
+        if (VERBOSITY_QUIET < queue->verbosity)
+        {
+            print_Log_Collection_Job_Summary(queue, job);
+        }
+        broadcast_Util_Signal(queue->signal);
+    }
+    unlock_Util_Lock(queue->lock);
+}
+
+// Runs the jobs with one worker per device that is allowed to run at once. The calling thread is one of the workers,
+// so this still completes one device at a time if no threads can be started.
+static void run_Parallel_Log_Collection(logCollectionQueue* queue)
+{
+    uint32_t     workerCount = UINT32_C(0);
+    utilThread** workers     = M_NULLPTR;
+    for (uint32_t iter = UINT32_C(0); iter < queue->jobCount; ++iter)
+    {
+        bool firstOnController = true;
+        for (uint32_t previous = UINT32_C(0); previous < iter; ++previous)
+        {
+            if (queue->jobs[previous].controllerKey == queue->jobs[iter].controllerKey)
+            {
+                firstOnController = false;
+                break;
+            }
+        }
+        if (firstOnController)
+        {
+            uint32_t onController = UINT32_C(0);
+            for (uint32_t other = iter; other < queue->jobCount; ++other)
+            {
+                if (queue->jobs[other].controllerKey == queue->jobs[iter].controllerKey)
+                {
+                    ++onController;
+                }
+            }
+            workerCount += M_Min(onController, queue->maxPerController);
+        }
+    }
+    queue->lock   = create_Util_Lock();
+    queue->signal = create_Util_Signal();
+    if (workerCount > UINT32_C(1) && queue->lock != M_NULLPTR && queue->signal != M_NULLPTR)
+    {
+        workers = C_CAST(utilThread**, safe_calloc(workerCount - UINT32_C(1), sizeof(utilThread*)));
+        if (workers != M_NULLPTR)
+        {
+            for (uint32_t iter = UINT32_C(0); iter < workerCount - UINT32_C(1); ++iter)
+            {
+                workers[iter] = start_Util_Thread(log_Collection_Worker, queue);
+            }
+        }
+    }
+    log_Collection_Worker(queue);
+    if (workers != M_NULLPTR)
+    {
+        for (uint32_t iter = UINT32_C(0); iter < workerCount - UINT32_C(1); ++iter)
+        {
+            join_Util_Thread(&workers[iter]);
+        }
+        safe_free(&workers);
+    }
+    destroy_Util_Signal(&queue->signal);
+    destroy_Util_Lock(&queue->lock);
+}
+
+static const char* get_Log_Collection_Status_String(eReturnValues status)
+{
+    switch (status)
+    {
+    case SUCCESS:
+        return "Success";
+    case NOT_SUPPORTED:
+        return "Not Supported";
+    case INSECURE_PATH:
+        return "Insecure Path";
+    default:
+        return "Failed";
+    }
+}
+
+// Writes a CSV with one row per device and log, plus a total row with the wall clock time of the whole collection.
+static eUtilExitCodes write_Log_Collection_Manifest(const logCollectionQueue* queue,
+                                                    const char*               basePath,
+                                                    uint64_t                  wallNanoSeconds)
+{
+    eUtilExitCodes  exitCode   = UTIL_EXIT_NO_ERROR;
+    secureFileInfo* manifest   = M_NULLPTR;
+    uint64_t        totalBytes = UINT64_C(0);
+    DECLARE_ZERO_INIT_ARRAY(char, manifestName, OPENSEA_PATH_MAX);
+    DECLARE_ZERO_INIT_ARRAY(char, line, OPENSEA_PATH_MAX + 256);
+    if (basePath != M_NULLPTR)
+    {
+        snprintf_err_handle(manifestName, OPENSEA_PATH_MAX, "%s%clog_collection_manifest_%" PRIu64 ".csv", basePath,
+                            LOG_COLLECTION_PATH_SEPARATOR, C_CAST(uint64_t, time(M_NULLPTR)));
+    }
+    else
+    {
+        snprintf_err_handle(manifestName, OPENSEA_PATH_MAX, "log_collection_manifest_%" PRIu64 ".csv",
+                            C_CAST(uint64_t, time(M_NULLPTR)));
+    }
+    manifest = secure_Open_File(manifestName, "w", M_NULLPTR, M_NULLPTR, M_NULLPTR);
+    if (manifest == M_NULLPTR || manifest->error != SEC_FILE_SUCCESS)
+    {
+        exitCode = (manifest != M_NULLPTR && manifest->error == SEC_FILE_INSECURE_PATH) ? UTIL_EXIT_INSECURE_PATH
+                                                                                        : UTIL_EXIT_CANNOT_OPEN_FILE;
+        free_Secure_File_Info(&manifest);
+        return exitCode;
+    }
+    snprintf_err_handle(line, sizeof(line), "Handle,Serial Number,Model,Directory,Log,Status,Bytes,Milliseconds\n");
+    if (SEC_FILE_SUCCESS != secure_Write_File(manifest, line, sizeof(line), sizeof(char), safe_strlen(line), M_NULLPTR))
+    {
+        exitCode = UTIL_EXIT_ERROR_WRITING_FILE;
+    }
+    for (uint32_t jobIter = UINT32_C(0); jobIter < queue->jobCount && exitCode == UTIL_EXIT_NO_ERROR; ++jobIter)
+    {
+        const logCollectionJob* job = &queue->jobs[jobIter];
+        for (int item = LOG_COLLECTION_TELEMETRY; item < LOG_COLLECTION_ITEM_COUNT; ++item)
+        {
+            if (!queue->options->pull[item])
+            {
+                continue;
+            }
+            totalBytes += job->results[item].bytes;
+            snprintf_err_handle(line, sizeof(line), "%s,%s,%s,%s,%s,%s,%" PRIu64 ",%" PRIu64 "\n",
+                                job->device->os_info.name, job->device->drive_info.serialNumber,
+                                job->device->drive_info.product_identification, job->directory,
+                                logCollectionItemNames[item],
+                                get_Log_Collection_Status_String(job->results[item].status), job->results[item].bytes,
+                                job->results[item].nanoSeconds / UINT64_C(1000000));
+            if (SEC_FILE_SUCCESS !=
+                secure_Write_File(manifest, line, sizeof(line), sizeof(char), safe_strlen(line), M_NULLPTR))
+            {
+                exitCode = UTIL_EXIT_ERROR_WRITING_FILE;
+                break;
+            }
+        }
+    }
+    if (exitCode == UTIL_EXIT_NO_ERROR)
+    {
+        snprintf_err_handle(line, sizeof(line), "Total,,,,,,%" PRIu64 ",%" PRIu64 "\n", totalBytes,
+                            wallNanoSeconds / UINT64_C(1000000));
+        if (SEC_FILE_SUCCESS !=
+            secure_Write_File(manifest, line, sizeof(line), sizeof(char), safe_strlen(line), M_NULLPTR))
+        {
+            exitCode = UTIL_EXIT_ERROR_WRITING_FILE;
+        }
+    }
+    if (SEC_FILE_SUCCESS != secure_Flush_File(manifest) || SEC_FILE_SUCCESS != secure_Close_File(manifest))
+    {
+        exitCode = UTIL_EXIT_ERROR_WRITING_FILE;
+    }
+    if (exitCode == UTIL_EXIT_NO_ERROR && VERBOSITY_QUIET < queue->verbosity)
+    {
+        printf("Log collection manifest saved to %s\n", manifest->fullpath);
+    }
+    free_Secure_File_Info(&manifest);
+    return exitCode;
+}
+
+// Same precedence as the sequential pulls would end up with: any failure, then insecure path, then not supported.
+static eUtilExitCodes get_Log_Collection_Exit_Code(const logCollectionQueue* queue)
+{
+    eUtilExitCodes exitCode = UTIL_EXIT_NO_ERROR;
+    for (uint32_t jobIter = UINT32_C(0); jobIter < queue->jobCount; ++jobIter)
+    {
+        for (int item = LOG_COLLECTION_TELEMETRY; item < LOG_COLLECTION_ITEM_COUNT; ++item)
+        {
+            if (!queue->options->pull[item])
+            {
+                continue;
+            }
+            switch (queue->jobs[jobIter].results[item].status)
+            {
+            case SUCCESS:
+                break;
+            case NOT_SUPPORTED:
+                if (exitCode == UTIL_EXIT_NO_ERROR)
+                {
+                    exitCode = UTIL_EXIT_OPERATION_NOT_SUPPORTED;
+                }
+                break;
+            case INSECURE_PATH:
+                if (exitCode != UTIL_EXIT_OPERATION_FAILURE)
+                {
+                    exitCode = UTIL_EXIT_INSECURE_PATH;
+                }
+                break;
+            default:
+                exitCode = UTIL_EXIT_OPERATION_FAILURE;
+                break;
+            }
+        }
+    }
+    return exitCode;
+}
+
 //-----------------------------------------------------------------------------
 //
 //  main()
@@ -107,6 +577,15 @@ int main(int argc, char* argv[])
     GET_TELEMETRY_VAR
     TELEMETRY_DATA_AREA_VAR
     INFORMATIONAL_EXCEPTIONS_VAR
+    PARALLEL_LOGS_VARS
+    SKIP_UNCHANGED_LOGS_VAR
+    COMPRESS_LOGS_VAR
+    COMPRESS_LOGS_REMOVE_ORIGINAL_VAR
+    LOG_DIFF_VAR
+    LOG_DIFF_BASELINE_VAR
+    LOG_DIFF_HOURS_VAR
+    LOG_DIFF_FORMAT_VAR
+    JSON_OUTPUT_VAR
 
 #if defined(ENABLE_CSMI)
     CSMI_FORCE_VARS
@@ -171,6 +650,15 @@ int main(int argc, char* argv[])
         INFROMATIONAL_EXCEPTIONS_LONG_OPT,
         LOG_TRANSFER_LENGTH_LONG_OPT,
         LOG_LENGTH_LONG_OPT,
+        PARALLEL_LOGS_LONG_OPT,
+        SKIP_UNCHANGED_LOGS_LONG_OPT,
+        COMPRESS_LOGS_LONG_OPT,
+        COMPRESS_LOGS_REMOVE_ORIGINAL_LONG_OPT,
+        LOG_DIFF_LONG_OPT,
+        LOG_DIFF_BASELINE_LONG_OPT,
+        LOG_DIFF_HOURS_LONG_OPT,
+        LOG_DIFF_FORMAT_LONG_OPT,
+        JSON_OUTPUT_LONG_OPT,
         LONG_OPT_TERMINATOR
     };
     // clang-format on
@@ -368,6 +856,63 @@ int main(int argc, char* argv[])
                     exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
                 }
             }
+            else if (strcmp(longopts[optionIndex].name, PARALLEL_LOGS_LONG_OPT_STRING) == 0)
+            {
+                PARALLEL_LOGS_FLAG = true;
+                if (optarg == M_NULLPTR && optind < argc && argv[optind][0] != '-')
+                {
+                    optarg = argv[optind++];
+                }
+                if (optarg != M_NULLPTR &&
+                    (!get_And_Validate_Integer_Input_Uint32(optarg, M_NULLPTR, ALLOW_UNIT_NONE,
+                                                            &PARALLEL_LOGS_PER_CONTROLLER) ||
+                     PARALLEL_LOGS_PER_CONTROLLER == UINT32_C(0)))
+                {
+                    print_Error_In_Cmd_Line_Args(PARALLEL_LOGS_LONG_OPT_STRING, optarg);
+                    exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
+                }
+            }
+            else if (strcmp(longopts[optionIndex].name, LOG_DIFF_LONG_OPT_STRING) == 0)
+            {
+                LOG_DIFF_FLAG = optarg;
+            }
+            else if (strcmp(longopts[optionIndex].name, LOG_DIFF_BASELINE_LONG_OPT_STRING) == 0)
+            {
+                LOG_DIFF_BASELINE_FLAG = optarg;
+            }
+            else if (strcmp(longopts[optionIndex].name, LOG_DIFF_HOURS_LONG_OPT_STRING) == 0)
+            {
+                if (!get_And_Validate_Integer_Input_Uint32(optarg, M_NULLPTR, ALLOW_UNIT_NONE, &LOG_DIFF_HOURS_FLAG) ||
+                    LOG_DIFF_HOURS_FLAG == UINT32_C(0))
+                {
+                    print_Error_In_Cmd_Line_Args(LOG_DIFF_HOURS_LONG_OPT_STRING, optarg);
+                    exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
+                }
+            }
+            else if (strcmp(longopts[optionIndex].name, LOG_DIFF_FORMAT_LONG_OPT_STRING) == 0)
+            {
+                if (strcmp(optarg, "scsi") == 0)
+                {
+                    LOG_DIFF_FORMAT_FLAG = LOG_SNAPSHOT_SCSI_LOG_PAGE;
+                }
+                else if (strcmp(optarg, "deviceStatistics") == 0)
+                {
+                    LOG_DIFF_FORMAT_FLAG = LOG_SNAPSHOT_ATA_DEVICE_STATISTICS;
+                }
+                else if (strcmp(optarg, "phyEvents") == 0)
+                {
+                    LOG_DIFF_FORMAT_FLAG = LOG_SNAPSHOT_SATA_PHY_EVENTS;
+                }
+                else if (strcmp(optarg, "nvmeHealth") == 0)
+                {
+                    LOG_DIFF_FORMAT_FLAG = LOG_SNAPSHOT_NVME_HEALTH;
+                }
+                else
+                {
+                    print_Error_In_Cmd_Line_Args(LOG_DIFF_FORMAT_LONG_OPT_STRING, optarg);
+                    exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
+                }
+            }
             else if (strcmp(longopts[optionIndex].name, MODEL_MATCH_LONG_OPT_STRING) == 0)
             {
                 MODEL_MATCH_FLAG = true;
@@ -506,6 +1051,12 @@ int main(int argc, char* argv[])
         }
     }
 
+    if (JSON_OUTPUT_FLAG)
+    {
+        // nothing but the JSON document is written to stdout. Messages go to stderr.
+        move_Messages_To_Stderr();
+    }
+
     if (0 != atexit(atexit_Print_Final_newline))
     {
         perror("Registering final newline print");
@@ -618,6 +1169,104 @@ int main(int argc, char* argv[])
         }
         scan_And_Print_Devs(scanControl, toolVerbosity);
     }
+
+    if (LOG_DIFF_FLAG != M_NULLPTR)
+    {
+        logSnapshot   current;
+        logSnapshot   baseline;
+        const char*   diffFile = LOG_DIFF_FLAG;
+        eReturnValues diffRet =
+            read_Log_Snapshot(LOG_DIFF_FLAG, C_CAST(eLogSnapshotFormat, LOG_DIFF_FORMAT_FLAG), &current);
+        safe_memset(&baseline, sizeof(logSnapshot), 0, sizeof(logSnapshot));
+        if (diffRet == SUCCESS)
+        {
+            diffFile = LOG_DIFF_BASELINE_FLAG;
+            diffRet  = LOG_DIFF_BASELINE_FLAG == M_NULLPTR
+                           ? BAD_PARAMETER
+                           : read_Log_Snapshot(LOG_DIFF_BASELINE_FLAG, C_CAST(eLogSnapshotFormat, LOG_DIFF_FORMAT_FLAG),
+                                               &baseline);
+        }
+        if (diffRet == SUCCESS && !is_Same_Log_Snapshot(&baseline, &current))
+        {
+            diffRet = NOT_SUPPORTED;
+        }
+        switch (diffRet)
+        {
+        case SUCCESS:
+            if (JSON_OUTPUT_FLAG)
+            {
+                jsonStream diffJSON;
+                open_JSON_Stream(&diffJSON, M_NULLPTR);
+                begin_JSON_Object(&diffJSON, M_NULLPTR);
+                write_JSON_String(&diffJSON, "tool", util_name);
+                write_JSON_String(&diffJSON, "version", buildVersion);
+                write_JSON_Log_Diff(&diffJSON, "logDiff", &baseline, &current, LOG_DIFF_HOURS_FLAG,
+                                    LOG_DIFF_BASELINE_FLAG, LOG_DIFF_FLAG);
+                end_JSON_Object(&diffJSON);
+                close_JSON_Stream(&diffJSON);
+            }
+            else
+            {
+                print_Log_Diff(&baseline, &current, LOG_DIFF_HOURS_FLAG, LOG_DIFF_BASELINE_FLAG, LOG_DIFF_FLAG);
+            }
+            break;
+        case BAD_PARAMETER:
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                printf("--%s is required with --%s\n", LOG_DIFF_BASELINE_LONG_OPT_STRING, LOG_DIFF_LONG_OPT_STRING);
+            }
+            exitCode = UTIL_EXIT_ERROR_IN_COMMAND_LINE;
+            break;
+        case NOT_SUPPORTED:
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                printf("%s and %s are not pulls of the same log\n", LOG_DIFF_BASELINE_FLAG, LOG_DIFF_FLAG);
+            }
+            exitCode = UTIL_EXIT_OPERATION_FAILURE;
+            break;
+        case INSECURE_PATH:
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                print_str("The log path is not secure. Choose a different location.\n");
+            }
+            exitCode = UTIL_EXIT_INSECURE_PATH;
+            break;
+        case FILE_OPEN_ERROR:
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                printf("Unable to open %s\n", diffFile);
+            }
+            exitCode = UTIL_EXIT_CANNOT_OPEN_FILE;
+            break;
+        case VALIDATION_FAILURE:
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                if (LOG_DIFF_FORMAT_FLAG == LOG_SNAPSHOT_UNKNOWN)
+                {
+                    printf("%s could not be identified as a log this tool can compare. For an NVMe SMART /\n"
+                           "health log, add --%s nvmeHealth\n",
+                           diffFile, LOG_DIFF_FORMAT_LONG_OPT_STRING);
+                }
+                else
+                {
+                    printf("%s does not have the layout given to --%s\n", diffFile, LOG_DIFF_FORMAT_LONG_OPT_STRING);
+                }
+            }
+            exitCode = UTIL_EXIT_OPERATION_FAILURE;
+            break;
+        default:
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                printf("Failed to read %s\n", diffFile);
+            }
+            exitCode = UTIL_EXIT_OPERATION_FAILURE;
+            break;
+        }
+        free_Log_Snapshot(&baseline);
+        free_Log_Snapshot(&current);
+        free_Handle_List(&HANDLE_LIST, DEVICE_LIST_COUNT);
+        exit(exitCode);
+    }
     // Add to this if list anything that is suppose to be independent.
     // e.g. you can't say enumerate & then pull logs in the same command line.
     // SIMPLE IS BEAUTIFUL
@@ -702,6 +1351,34 @@ int main(int argc, char* argv[])
         exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
     }
 
+    if (JSON_OUTPUT_FLAG)
+    {
+        const textOnlyOption textOnlyOptions[] = {
+            {M_ToBool(TEST_UNIT_READY_FLAG), "--" TEST_UNIT_READY_LONG_OPT_STRING},
+            {M_ToBool(LOWLEVEL_INFO_FLAG), "--" LOWLEVEL_INFO_LONG_OPT_STRING},
+            {M_ToBool(LIST_ERROR_HISTORY_FLAG), "--" LIST_ERROR_HISTORY_LONG_OPT_STRING},
+            {PULL_LOG_MODE == PULL_LOG_RAW_MODE, "--" PULL_LOG_MODE_LONG_OPT_STRING " raw"},
+            {PULL_LOG_MODE == PULL_LOG_PIPE_MODE, "--" PULL_LOG_MODE_LONG_OPT_STRING " pipe"},
+        };
+        if (!check_JSON_Output_Options(textOnlyOptions, sizeof(textOnlyOptions) / sizeof(textOnlyOptions[0]),
+                                       JSON_OUTPUT_OPTIONS))
+        {
+            free_Handle_List(&HANDLE_LIST, DEVICE_LIST_COUNT);
+            exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
+        }
+    }
+
+    if (PARALLEL_LOGS_FLAG && (GENERIC_LOG_PULL_FLAG || GENERIC_ERROR_HISTORY_PULL_FLAG))
+    {
+        if (VERBOSITY_QUIET < toolVerbosity)
+        {
+            printf("\n--%s cannot be used with --%s or --%s\n", PARALLEL_LOGS_LONG_OPT_STRING,
+                   GENERIC_LOG_LONG_OPT_STRING, GENERIC_ERROR_HISTORY_LONG_OPT_STRING);
+        }
+        free_Handle_List(&HANDLE_LIST, DEVICE_LIST_COUNT);
+        exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
+    }
+
     uint64_t flags = UINT64_C(0);
     DEVICE_LIST    = M_REINTERPRET_CAST(tDevice*, safe_calloc(DEVICE_LIST_COUNT, sizeof(tDevice)));
     if (!DEVICE_LIST)
@@ -859,7 +1536,67 @@ int main(int argc, char* argv[])
         }
     }
     free_Handle_List(&HANDLE_LIST, DEVICE_LIST_COUNT);
+    logCompressor* compressor = M_NULLPTR;
+    if (COMPRESS_LOGS_FLAG)
+    {
+        compressor = create_Log_Compressor(M_ToBool(COMPRESS_LOGS_REMOVE_ORIGINAL_FLAG));
+        if (compressor == M_NULLPTR)
+        {
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                print_str("Unable to allocate memory\n");
+            }
+            free_device_list(&DEVICE_LIST);
+            exit(UTIL_EXIT_NOT_ENOUGH_RESOURCES);
+        }
+    }
+    logCollectionOptions parallelOptions;
+    logCollectionQueue   parallelQueue;
+    safe_memset(&parallelOptions, sizeof(logCollectionOptions), 0, sizeof(logCollectionOptions));
+    safe_memset(&parallelQueue, sizeof(logCollectionQueue), 0, sizeof(logCollectionQueue));
+    if (PARALLEL_LOGS_FLAG)
+    {
+        parallelOptions.pull[LOG_COLLECTION_TELEMETRY]                = GET_TELEMETRY_IDENTIFIER > 0;
+        parallelOptions.pull[LOG_COLLECTION_FARM]                     = FARM_PULL_FLAG;
+        parallelOptions.pull[LOG_COLLECTION_FARM_COMBINED]            = FARM_COMBINED_FLAG;
+        parallelOptions.pull[LOG_COLLECTION_DST]                      = DST_LOG_FLAG;
+        parallelOptions.pull[LOG_COLLECTION_IDENTIFY_DEVICE_DATA]     = IDENTIFY_DEVICE_DATA_LOG_FLAG;
+        parallelOptions.pull[LOG_COLLECTION_SATA_PHY_COUNTERS]        = SATA_PHY_COUNTERS_LOG_FLAG;
+        parallelOptions.pull[LOG_COLLECTION_DEVICE_STATISTICS]        = DEVICE_STATS_LOG_FLAG;
+        parallelOptions.pull[LOG_COLLECTION_INFORMATIONAL_EXCEPTIONS] = INFORMATIONAL_EXCEPTIONS_FLAG;
+        parallelOptions.telemetryCurrent                              = GET_TELEMETRY_IDENTIFIER == 1 ? true : false;
+        parallelOptions.skipUnchanged                                 = SKIP_UNCHANGED_LOGS_FLAG;
+        parallelOptions.telemetryDataArea                             = TELEMETRY_DATA_AREA;
+        parallelOptions.transferLength                                = LOG_TRANSFER_LENGTH_BYTES;
+        parallelOptions.sataFarmCopyType                              = SATA_FARM_COPY_TYPE_FLAG;
+        parallelOptions.compressor                                    = compressor;
+        parallelQueue.options                                         = &parallelOptions;
+        parallelQueue.maxPerController                                = PARALLEL_LOGS_PER_CONTROLLER;
+        parallelQueue.verbosity                                       = toolVerbosity;
+        parallelQueue.jobs =
+            M_REINTERPRET_CAST(logCollectionJob*, safe_calloc(DEVICE_LIST_COUNT, sizeof(logCollectionJob)));
+        if (parallelQueue.jobs == M_NULLPTR)
+        {
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                print_str("Unable to allocate memory\n");
+            }
+            free_device_list(&DEVICE_LIST);
+            exit(UTIL_EXIT_NOT_ENOUGH_RESOURCES);
+        }
+    }
     uint32_t skippedDevices = UINT32_C(0);
+    // With --jsonOutput, each device is an entry in the "devices" array of one document
+    jsonStream json;
+    safe_memset(&json, sizeof(jsonStream), 0, sizeof(jsonStream));
+    if (JSON_OUTPUT_FLAG)
+    {
+        open_JSON_Stream(&json, M_NULLPTR);
+        begin_JSON_Object(&json, M_NULLPTR);
+        write_JSON_String(&json, "tool", util_name);
+        write_JSON_String(&json, "version", buildVersion);
+        begin_JSON_Array(&json, "devices");
+    }
     for (uint32_t deviceIter = UINT32_C(0); deviceIter < DEVICE_LIST_COUNT; ++deviceIter)
     {
         deviceList[deviceIter].deviceVerbosity = toolVerbosity;
@@ -1015,8 +1752,14 @@ int main(int argc, char* argv[])
             }
         }
 
+        if (JSON_OUTPUT_FLAG)
+        {
+            begin_JSON_Object(&json, M_NULLPTR);
+            write_JSON_Drive_Identity(&json, "identity", &deviceList[deviceIter]);
+        }
+
         // now start looking at what operations are going to be performed and kick them off
-        if (DEVICE_INFO_FLAG)
+        if (DEVICE_INFO_FLAG && !JSON_OUTPUT_FLAG)
         {
             if (SUCCESS != print_Drive_Information(&deviceList[deviceIter], SAT_INFO_FLAG))
             {
@@ -1040,7 +1783,16 @@ int main(int argc, char* argv[])
 
         if (LIST_LOGS_FLAG)
         {
-            switch (print_Supported_Logs(&deviceList[deviceIter], 0))
+            eReturnValues listLogsRet = UNKNOWN;
+            if (JSON_OUTPUT_FLAG)
+            {
+                listLogsRet = write_JSON_Supported_Logs(&json, "supportedLogs", &deviceList[deviceIter]);
+            }
+            else
+            {
+                listLogsRet = print_Supported_Logs(&deviceList[deviceIter], 0);
+            }
+            switch (listLogsRet)
             {
             case SUCCESS:
                 break;
@@ -1085,6 +1837,24 @@ int main(int argc, char* argv[])
             }
         }
 
+        if (JSON_OUTPUT_FLAG)
+        {
+            // the log pulls below write files, so the device entry is complete here
+            end_JSON_Object(&json);
+        }
+
+        if (parallelQueue.jobs != M_NULLPTR)
+        {
+            // The file based pulls below run for all devices at once after every device has been checked.
+            // The handle stays open until then.
+            parallelQueue.jobs[parallelQueue.jobCount].device = &deviceList[deviceIter];
+            parallelQueue.jobs[parallelQueue.jobCount].controllerKey =
+                get_Log_Collection_Controller_Key(&deviceList[deviceIter], deviceIter);
+            ++parallelQueue.jobCount;
+            continue;
+        }
+
+        pulledLogFiles* pulledFiles = start_Pulled_Log_Files(compressor, OUTPUTPATH_FLAG);
         if (GENERIC_LOG_PULL_FLAG)
         {
             switch (pull_Generic_Log(&deviceList[deviceIter], GENERIC_LOG_DATA_SET, GENERIC_LOG_SUBPAGE_DATA_SET,
@@ -1211,14 +1981,23 @@ int main(int argc, char* argv[])
         {
             if (TELEMETRY_DATA_AREA > TELEMETRY_LOG_MIN_DATA_SET && TELEMETRY_DATA_AREA <= TELEMETRY_LOG_MAX_DATA_SET)
             {
-                switch (pull_Telemetry_Log(&deviceList[deviceIter], GET_TELEMETRY_IDENTIFIER == 1 ? true : false,
-                                           TELEMETRY_DATA_AREA, true, M_NULLPTR, 0, OUTPUTPATH_FLAG,
-                                           LOG_TRANSFER_LENGTH_BYTES))
+                bool telemetrySkipped = false;
+                switch (pull_Telemetry_Log_Streamed(&deviceList[deviceIter],
+                                                    GET_TELEMETRY_IDENTIFIER == 1 ? true : false, TELEMETRY_DATA_AREA,
+                                                    OUTPUTPATH_FLAG, LOG_TRANSFER_LENGTH_BYTES,
+                                                    SKIP_UNCHANGED_LOGS_FLAG, &telemetrySkipped))
                 {
                 case SUCCESS:
                     if (VERBOSITY_QUIET < toolVerbosity)
                     {
-                        print_str("Telemetry log pulled successfully from device!\n");
+                        if (telemetrySkipped)
+                        {
+                            print_str("Telemetry log has not changed since the last pull. Skipping.\n");
+                        }
+                        else
+                        {
+                            print_str("Telemetry log pulled successfully from device!\n");
+                        }
                     }
                     break;
                 case NOT_SUPPORTED:
@@ -1239,6 +2018,7 @@ int main(int argc, char* argv[])
                     if (VERBOSITY_QUIET < toolVerbosity)
                     {
                         print_str("Failed to pull telemetry log from this device!\n");
+                        print_str("Run the same command again to resume the pull where it stopped.\n");
                     }
                     exitCode = UTIL_EXIT_OPERATION_FAILURE;
                 }
@@ -1502,9 +2282,95 @@ int main(int argc, char* argv[])
                 exitCode = UTIL_EXIT_OPERATION_FAILURE;
             }
         }
+        // compressed in the background while the next device's logs are pulled
+        queue_Pulled_Log_Files(compressor, &pulledFiles, deviceList[deviceIter].drive_info.serialNumber);
         // At this point, close the device handle since it is no longer needed. Do not put any further IO below this.
         close_Device(&deviceList[deviceIter]);
     }
+    if (JSON_OUTPUT_FLAG)
+    {
+        end_JSON_Array(&json);
+        end_JSON_Object(&json);
+        close_JSON_Stream(&json);
+    }
+    if (parallelQueue.jobs != M_NULLPTR)
+    {
+        if (parallelQueue.jobCount > UINT32_C(0))
+        {
+            DECLARE_SEATIMER(collectionTimer);
+            bool directoriesReady = true;
+            for (uint32_t jobIter = UINT32_C(0); jobIter < parallelQueue.jobCount; ++jobIter)
+            {
+                ret = setup_Log_Collection_Directory(parallelQueue.jobs, jobIter, OUTPUTPATH_FLAG);
+                if (ret != SUCCESS)
+                {
+                    if (VERBOSITY_QUIET < toolVerbosity)
+                    {
+                        printf("Unable to create directory %s\n", parallelQueue.jobs[jobIter].directory);
+                    }
+                    exitCode         = UTIL_EXIT_CANNOT_OPEN_FILE;
+                    directoriesReady = false;
+                    break;
+                }
+            }
+            if (directoriesReady)
+            {
+                if (VERBOSITY_QUIET < toolVerbosity)
+                {
+                    printf("\nPulling logs from %" PRIu32 " devices, up to %" PRIu32 " at a time per controller\n",
+                           parallelQueue.jobCount, parallelQueue.maxPerController);
+                }
+                start_Timer(&collectionTimer);
+                run_Parallel_Log_Collection(&parallelQueue);
+                stop_Timer(&collectionTimer);
+                eUtilExitCodes collectionError = get_Log_Collection_Exit_Code(&parallelQueue);
+                eUtilExitCodes manifestError   = write_Log_Collection_Manifest(&parallelQueue, OUTPUTPATH_FLAG,
+                                                                               get_Nano_Seconds(collectionTimer));
+                if (collectionError != UTIL_EXIT_NO_ERROR)
+                {
+                    exitCode = collectionError;
+                }
+                if (manifestError != UTIL_EXIT_NO_ERROR)
+                {
+                    if (VERBOSITY_QUIET < toolVerbosity)
+                    {
+                        print_str("Failed to write the log collection manifest\n");
+                    }
+                    if (collectionError == UTIL_EXIT_NO_ERROR)
+                    {
+                        exitCode = manifestError;
+                    }
+                }
+            }
+            for (uint32_t jobIter = UINT32_C(0); jobIter < parallelQueue.jobCount; ++jobIter)
+            {
+                close_Device(parallelQueue.jobs[jobIter].device);
+            }
+        }
+        safe_free(&parallelQueue.jobs);
+    }
+    if (compressor != M_NULLPTR)
+    {
+        uint64_t originalBytes   = UINT64_C(0);
+        uint64_t compressedBytes = UINT64_C(0);
+        uint32_t failures        = finish_Log_Compressor(&compressor, &originalBytes, &compressedBytes);
+        if (VERBOSITY_QUIET < toolVerbosity && originalBytes > UINT64_C(0))
+        {
+            printf("\nCompressed pulled logs from %" PRIu64 " to %" PRIu64 " bytes\n", originalBytes,
+                   compressedBytes);
+        }
+        if (failures > UINT32_C(0))
+        {
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                printf("%" PRIu32 " log files could not be compressed and were left as they are\n", failures);
+            }
+            if (exitCode == UTIL_EXIT_NO_ERROR)
+            {
+                exitCode = UTIL_EXIT_ERROR_WRITING_FILE;
+            }
+        }
+    }
     free_device_list(&DEVICE_LIST);
     if (getDevsRet != SUCCESS && skippedDevices == DEVICE_LIST_COUNT)
     {
@@ -1597,6 +2463,7 @@ void utility_Usage(bool shortUsage)
     print_Force_ATA_UDMA_Help(shortUsage);
     print_Force_SCSI_Help(shortUsage);
     print_Help_Help(shortUsage);
+    print_JSON_Output_Help(shortUsage, JSON_OUTPUT_OPTIONS);
     print_License_Help(shortUsage);
     print_Model_Match_Help(shortUsage);
     print_No_Banner_Help(shortUsage);
@@ -1624,10 +2491,18 @@ void utility_Usage(bool shortUsage)
     print_Fast_Discovery_Help(shortUsage);
     print_str("\n");
     print_Pull_Device_Statistics_Log_Help(shortUsage);
+    print_Parallel_Logs_Help(shortUsage);
+    print_Skip_Unchanged_Logs_Help(shortUsage);
+    print_Compress_Logs_Help(shortUsage);
+    print_Compress_Logs_Remove_Original_Help(shortUsage);
     print_FARM_Log_Help(shortUsage);
     print_FARM_Combined_Log_Help(shortUsage);
     print_Get_Telemetry_Help(shortUsage);
     print_Supported_Logs_Help(shortUsage);
+    print_Log_Diff_Help(shortUsage);
+    print_Log_Diff_Baseline_Help(shortUsage);
+    print_Log_Diff_Format_Help(shortUsage);
+    print_Log_Diff_Hours_Help(shortUsage);
     print_Log_Length_Help(shortUsage);
     print_Log_Mode_Help(shortUsage);
     print_Log_Transfer_Length_Help(shortUsage);
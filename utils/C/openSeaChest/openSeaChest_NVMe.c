@@ -22,6 +22,7 @@
 #include "secure_file.h"
 #include "sleep.h"
 #include "string_utils.h"
+#include "time_utils.h"
 #include "type_conversion.h"
 #include "unit_conversion.h"
 
@@ -32,6 +33,8 @@
 #include "getopt.h"
 #include "logs.h"
 #include "nvme_operations.h"
+#include "openseachest_log_compression.h"
+#include "openseachest_telemetry.h"
 #include "openseachest_util_options.h"
 #include "operations.h"
 #include "power_control.h"
@@ -119,6 +122,8 @@ int main(int argc, char* argv[])
     SHOW_SUPPORTED_FORMATS_VAR
     LOWLEVEL_INFO_VAR
     LIST_LOGS_VAR
+    COMPRESS_LOGS_VAR
+    COMPRESS_LOGS_REMOVE_ORIGINAL_VAR
     FORCE_DRIVE_TYPE_VARS
 
 #if defined(ENABLE_HWRAID_SUPPORT)
@@ -181,6 +186,8 @@ int main(int argc, char* argv[])
         NVM_FORMAT_LONG_OPT,
         NVM_FORMAT_OPTIONS_LONG_OPTS,
         LIST_LOGS_LONG_OPT,
+        COMPRESS_LOGS_LONG_OPT,
+        COMPRESS_LOGS_REMOVE_ORIGINAL_LONG_OPT,
         FORCE_DRIVE_TYPE_LONG_OPTS,
         LONG_OPT_TERMINATOR
     };
@@ -1009,6 +1016,20 @@ int main(int argc, char* argv[])
     }
     free_Handle_List(&HANDLE_LIST, DEVICE_LIST_COUNT);
 
+    logCompressor* compressor = M_NULLPTR;
+    if (COMPRESS_LOGS_FLAG)
+    {
+        compressor = create_Log_Compressor(M_ToBool(COMPRESS_LOGS_REMOVE_ORIGINAL_FLAG));
+        if (compressor == M_NULLPTR)
+        {
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                print_str("Unable to allocate memory\n");
+            }
+            free_device_list(&DEVICE_LIST);
+            exit(UTIL_EXIT_NOT_ENOUGH_RESOURCES);
+        }
+    }
     uint32_t skippedDevices = UINT32_C(0);
     for (uint32_t deviceIter = UINT32_C(0); deviceIter < DEVICE_LIST_COUNT; ++deviceIter)
     {
@@ -1091,6 +1112,7 @@ int main(int argc, char* argv[])
                    print_drive_type(&deviceList[deviceIter]));
         }
 
+        pulledLogFiles* pulledFiles = start_Pulled_Log_Files(compressor, OUTPUTPATH_FLAG);
         // now start looking at what operations are going to be performed and kick them off
         if (DEVICE_INFO_FLAG)
         {
@@ -1362,7 +1384,7 @@ int main(int argc, char* argv[])
                             {
                                 printf("Log Page %d Buffer:\n", GET_NVME_LOG_IDENTIFIER);
                                 print_str("================================\n");
-                                print_Data_Buffer(C_CAST(uint8_t*, logBuffer), C_CAST(uint32_t, size), true);
+                                print_Data_Buffer_Fast(C_CAST(uint8_t*, logBuffer), C_CAST(uint32_t, size), true);
                                 print_str("================================\n");
                             }
                             else if (OUTPUT_MODE_IDENTIFIER == UTIL_OUTPUT_MODE_BIN)
@@ -1617,9 +1639,9 @@ int main(int argc, char* argv[])
         {
             if (TELEMETRY_DATA_AREA >= TELEMETRY_LOG_MIN_DATA_SET && TELEMETRY_DATA_AREA <= TELEMETRY_LOG_MAX_DATA_SET)
             {
-                switch (pull_Telemetry_Log(&deviceList[deviceIter], GET_TELEMETRY_IDENTIFIER == 1 ? true : false,
-                                           TELEMETRY_DATA_AREA, true, M_NULLPTR, 0, OUTPUTPATH_FLAG,
-                                           LOG_TRANSFER_LENGTH_BYTES))
+                switch (pull_Telemetry_Log_Streamed(&deviceList[deviceIter],
+                                                    GET_TELEMETRY_IDENTIFIER == 1 ? true : false, TELEMETRY_DATA_AREA,
+                                                    OUTPUTPATH_FLAG, LOG_TRANSFER_LENGTH_BYTES, false, M_NULLPTR))
                 {
                 case SUCCESS:
                     if (VERBOSITY_QUIET < toolVerbosity)
@@ -2289,9 +2311,33 @@ int main(int argc, char* argv[])
                 break;
             }
         }
+        // compressed in the background while the next device's logs are pulled
+        queue_Pulled_Log_Files(compressor, &pulledFiles, deviceList[deviceIter].drive_info.serialNumber);
         // At this point, close the device handle since it is no longer needed. Do not put any further IO below this.
         close_Device(&deviceList[deviceIter]);
     }
+    if (compressor != M_NULLPTR)
+    {
+        uint64_t originalBytes   = UINT64_C(0);
+        uint64_t compressedBytes = UINT64_C(0);
+        uint32_t failures        = finish_Log_Compressor(&compressor, &originalBytes, &compressedBytes);
+        if (VERBOSITY_QUIET < toolVerbosity && originalBytes > UINT64_C(0))
+        {
+            printf("\nCompressed pulled logs from %" PRIu64 " to %" PRIu64 " bytes\n", originalBytes,
+                   compressedBytes);
+        }
+        if (failures > UINT32_C(0))
+        {
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                printf("%" PRIu32 " log files could not be compressed and were left as they are\n", failures);
+            }
+            if (exitCode == UTIL_EXIT_NO_ERROR)
+            {
+                exitCode = UTIL_EXIT_ERROR_WRITING_FILE;
+            }
+        }
+    }
     free_device_list(&DEVICE_LIST);
     if (getDevsRet != SUCCESS && skippedDevices == DEVICE_LIST_COUNT)
     {
@@ -2415,6 +2461,8 @@ void utility_Usage(bool shortUsage)
     print_Get_Features_Help(shortUsage);
     print_NVMe_Get_Log_Help(shortUsage);
     print_NVMe_Get_Tele_Help(shortUsage);
+    print_Compress_Logs_Help(shortUsage);
+    print_Compress_Logs_Remove_Original_Help(shortUsage);
     print_Supported_Logs_Help(shortUsage);
     print_Firmware_Revision_Match_Help(shortUsage);
     print_pcierr_Help(shortUsage);
@@ -748,9 +748,9 @@ int main(int argc, char* argv[])
                                 // Windows ATA passthrough and FreeBSD ATA passthrough)
     )
     {
-        set_Console_Colors(true, ERROR_COLOR);
+        set_Console_Output_Colors(ERROR_COLOR, CONSOLE_COLOR_DEFAULT);
         print_str("\nError: Only one force flag can be used at a time.\n");
-        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
         free_Handle_List(&HANDLE_LIST, DEVICE_LIST_COUNT);
         exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
     }
@@ -1216,9 +1216,9 @@ static eReturnValues return_Response_Extend_Bit_Test(tDevice* device)
                 {
                     if (device->drive_info.passThroughHacks.ataPTHacks.returnResponseIgnoreExtendBit)
                     {
-                        set_Console_Colors(true, HACK_COLOR);
+                        set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
                         print_str("HACK FOUND: RSIE\n");
-                        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                     }
                     else
                     {
@@ -1245,9 +1245,9 @@ static eReturnValues return_Response_Extend_Bit_Test(tDevice* device)
                     print_str("WARNING: This device is only able to return partial return task file registers.\n");
                     print_str("         This means only 28bit commands will get full results. 48bit commands will be "
                               "partial\n");
-                    set_Console_Colors(true, HACK_COLOR);
+                    set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
                     print_str("HACK FOUND: PARTRTFR\n");
-                    set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                    set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                     device->drive_info.passThroughHacks.ataPTHacks.partialRTFRs = true;
                 }
             }
@@ -1276,29 +1276,29 @@ static eReturnValues return_Response_Extend_Bit_Test(tDevice* device)
                     print_str("WARNING: This device is only able to return partial return task file registers.\n");
                     print_str("         This means only 28bit commands will get full results. 48bit commands will be "
                               "partial\n");
-                    set_Console_Colors(true, HACK_COLOR);
+                    set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
                     print_str("HACK FOUND: PARTRTFR\n");
-                    set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                    set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                     device->drive_info.passThroughHacks.ataPTHacks.partialRTFRs = true;
                 }
             }
             else
             {
                 // Something went really wrong
-                set_Console_Colors(true, ERROR_COLOR);
+                set_Console_Output_Colors(ERROR_COLOR, CONSOLE_COLOR_DEFAULT);
                 print_str("ERROR: Command failure while trying to perform RTFR return response info test.\n");
-                set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                 return FAILURE;
             }
         }
     }
     else
     {
-        set_Console_Colors(true, NOTE_COLOR);
+        set_Console_Output_Colors(NOTE_COLOR, CONSOLE_COLOR_DEFAULT);
         print_str("NOTE: This device doesn't support 48bit commands. Cannot test for proper extend bit in\n");
         print_str("      return response information test. It is strongly recommended that this adapter is retested\n");
         print_str("      with a device that supports 48bit commands so that this can be tested properly\n");
-        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
     }
     return ret;
 }
@@ -1342,9 +1342,9 @@ static void multi_Sector_PIO_Test_With_Logs(tDevice* device, bool gpl, uint8_t l
                         // this worked!!!
                         if (device->drive_info.passThroughHacks.ataPTHacks.multiSectorPIOWithMultipleMode)
                         {
-                            set_Console_Colors(true, HACK_COLOR);
+                            set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
                             print_str("HACK FOUND: MMPIO\n");
-                            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                         }
                         else
                         {
@@ -1356,9 +1356,9 @@ static void multi_Sector_PIO_Test_With_Logs(tDevice* device, bool gpl, uint8_t l
                         if (device->drive_info.passThroughHacks.ataPTHacks.multiSectorPIOWithMultipleMode)
                         {
                             device->drive_info.passThroughHacks.ataPTHacks.multiSectorPIOWithMultipleMode = false;
-                            set_Console_Colors(true, HACK_COLOR);
+                            set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
                             print_str("HACK FOUND: SPIO\n");
-                            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                             device->drive_info.passThroughHacks.ataPTHacks.singleSectorPIOOnly = true;
                         }
                         else
@@ -1390,9 +1390,9 @@ static void multi_Sector_PIO_Test_With_Logs(tDevice* device, bool gpl, uint8_t l
                             }
                             else
                             {
-                                set_Console_Colors(true, HACK_COLOR);
+                                set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
                                 print_str("HACK FOUND: SPIO\n");
-                                set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                                set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                                 device->drive_info.passThroughHacks.ataPTHacks.singleSectorPIOOnly = true;
                             }
                         }
@@ -1418,9 +1418,9 @@ static void multi_Sector_PIO_Test_With_Logs(tDevice* device, bool gpl, uint8_t l
             }
             else
             {
-                set_Console_Colors(true, ERROR_COLOR);
+                set_Console_Output_Colors(ERROR_COLOR, CONSOLE_COLOR_DEFAULT);
                 print_str("FATAL ERROR: Unable to allocate enough memory to finish multi-sector PIO test!\n");
-                set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
             }
             // clear the log back to zeros if necessary
         }
@@ -1451,9 +1451,9 @@ static void multi_Sector_PIO_Test_With_Logs(tDevice* device, bool gpl, uint8_t l
             }
             else
             {
-                set_Console_Colors(true, HACK_COLOR);
+                set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
                 print_str("HACK FOUND: SPIO\n");
-                set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                 device->drive_info.passThroughHacks.ataPTHacks.singleSectorPIOOnly = true;
             }
         }
@@ -1550,9 +1550,9 @@ static void multi_Sector_PIO_Test(tDevice* device, bool smartSupported, bool sma
                                     ata_Set_Multiple_Mode(device, currentDRQblocks);
                                     device->drive_info.passThroughHacks.ataPTHacks.multiSectorPIOWithMultipleMode =
                                         false;
-                                    set_Console_Colors(true, LIKELY_HACK_COLOR);
+                                    set_Console_Output_Colors(LIKELY_HACK_COLOR, CONSOLE_COLOR_DEFAULT);
                                     print_str("HACK FOUND: SPIO\n");
-                                    set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                                    set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                                     device->drive_info.passThroughHacks.ataPTHacks.singleSectorPIOOnly = true;
                                 }
                             }
@@ -1560,17 +1560,17 @@ static void multi_Sector_PIO_Test(tDevice* device, bool smartSupported, bool sma
                             {
                                 device->drive_info.passThroughHacks.ataPTHacks.multiSectorPIOWithMultipleMode = false;
                                 print_str("Unable to perform test of multi-sector PIO commands\n");
-                                set_Console_Colors(true, HACK_COLOR);
+                                set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
                                 print_str("HACK FOUND: SPIO\n");
-                                set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                                set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                                 device->drive_info.passThroughHacks.ataPTHacks.singleSectorPIOOnly = true;
                                 break;
                             }
                             else
                             {
-                                set_Console_Colors(true, HACK_COLOR);
+                                set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
                                 print_str("HACK FOUND: SPIO\n");
-                                set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                                set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                                 device->drive_info.passThroughHacks.ataPTHacks.singleSectorPIOOnly = true;
                                 break;
                             }
@@ -1621,10 +1621,10 @@ static void multi_Sector_PIO_Test(tDevice* device, bool smartSupported, bool sma
                         else
                         {
                             safe_free_aligned_core(C_CAST(void**, &log));
-                            set_Console_Colors(true, WARNING_COLOR);
+                            set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
                             print_str("WARNING: Failed to read multi-sector log with PIO commands. Likely a chip not "
                                       "compliant with multisector PIO commands\n");
-                            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                             if (!device->drive_info.passThroughHacks.ataPTHacks.multiSectorPIOWithMultipleMode &&
                                 M_Byte1(device->drive_info.IdentifyData.ata.Word047) == 0x80 &&
                                 M_Byte0(device->drive_info.IdentifyData.ata.Word047) > 0)
@@ -1653,17 +1653,17 @@ static void multi_Sector_PIO_Test(tDevice* device, bool smartSupported, bool sma
                             {
                                 device->drive_info.passThroughHacks.ataPTHacks.multiSectorPIOWithMultipleMode = false;
                                 print_str("Unable to perform test of multi-sector PIO commands\n");
-                                set_Console_Colors(true, HACK_COLOR);
+                                set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
                                 print_str("HACK FOUND: SPIO\n");
-                                set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                                set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                                 device->drive_info.passThroughHacks.ataPTHacks.singleSectorPIOOnly = true;
                                 break;
                             }
                             else
                             {
-                                set_Console_Colors(true, HACK_COLOR);
+                                set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
                                 print_str("HACK FOUND: SPIO\n");
-                                set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                                set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                                 device->drive_info.passThroughHacks.ataPTHacks.singleSectorPIOOnly = true;
                                 break;
                             }
@@ -1705,29 +1705,29 @@ static void sat_DMA_UDMA_Protocol_Test(tDevice*           device,
 
         if (dmaReadRet != SUCCESS && udmaReadRet != SUCCESS)
         {
-            set_Console_Colors(true, HACK_COLOR);
+            set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
             print_str("HACK FOUND: NDMA\n"); // Cannot issue any DMA mode commands.
-            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
-            set_Console_Colors(true, ERROR_COLOR);
+            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
+            set_Console_Output_Colors(ERROR_COLOR, CONSOLE_COLOR_DEFAULT);
             print_str("ERROR: No possible way to issue a DMA mode command on this device.\n");
-            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
             device->drive_info.ata_Options.dmaMode = ATA_DMA_MODE_NO_DMA;
         }
         else
         {
             if (udmaReadRet != SUCCESS && dmaReadRet == SUCCESS)
             {
-                set_Console_Colors(true, HACK_COLOR);
+                set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
                 print_str("HACK FOUND: FDMA\n"); // force using DMA mode instead of UDMA
-                set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                 device->drive_info.ata_Options.dmaMode = ATA_DMA_MODE_DMA;
             }
             else if (udmaReadRet == SUCCESS && dmaReadRet != SUCCESS)
             {
-                set_Console_Colors(true, NOTE_COLOR);
+                set_Console_Output_Colors(NOTE_COLOR, CONSOLE_COLOR_DEFAULT);
                 print_str("NOTE: Device only supports UDMA mode for passthrough. This is the default for the tool, but "
                           "may be an issue for some other tools.\n");
-                set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                 device->drive_info.ata_Options.dmaMode = ATA_DMA_MODE_UDMA;
             }
             else if (udmaReadRet == SUCCESS && dmaReadRet == SUCCESS)
@@ -1736,18 +1736,18 @@ static void sat_DMA_UDMA_Protocol_Test(tDevice*           device,
             }
             else
             {
-                set_Console_Colors(true, ERROR_COLOR);
+                set_Console_Output_Colors(ERROR_COLOR, CONSOLE_COLOR_DEFAULT);
                 print_str("FATAL ERROR: You shouldn't be seeing this message. Something went horribly wrong\n");
-                set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
             }
         }
         safe_free_aligned_core(C_CAST(void**, &ptrData));
     }
     else
     {
-        set_Console_Colors(true, ERROR_COLOR);
+        set_Console_Output_Colors(ERROR_COLOR, CONSOLE_COLOR_DEFAULT);
         print_str("ERROR: Unable to allocate memory for DMA/UDMA protocol test\n");
-        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
     }
 }
 
@@ -1821,9 +1821,9 @@ static void check_Condition_Bit_Test(tDevice* device, bool smartSupported, bool
         }
         else if (gotValidRTFRsGPL || gotValidRTFRsSMART)
         {
-            set_Console_Colors(true, HACK_COLOR);
+            set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
             print_str("HACK FOUND: CHK\n"); // check condition bit is always supported properly
-            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
         }
         else
         {
@@ -1837,15 +1837,15 @@ static void check_Condition_Bit_Test(tDevice* device, bool smartSupported, bool
                     !(ATA_STATUS_BIT_ERROR & device->drive_info.lastCommandRTFRs.status) &&
                     device->drive_info.lastCommandRTFRs.error == 0)
                 {
-                    set_Console_Colors(true, HACK_COLOR);
+                    set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
                     print_str("HACK FOUND: CHKND\n"); // check condition bit is supported for non-data commands only
-                    set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                    set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                 }
                 else
                 {
-                    set_Console_Colors(true, HACK_COLOR);
+                    set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
                     print_str("HACK FOUND: CHKE\n");
-                    set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                    set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                     device->drive_info.passThroughHacks.ataPTHacks.checkConditionEmpty = true;
                 }
             }
@@ -1863,16 +1863,16 @@ static void check_Condition_Bit_Test(tDevice* device, bool smartSupported, bool
                 !(ATA_STATUS_BIT_ERROR & device->drive_info.lastCommandRTFRs.status) &&
                 device->drive_info.lastCommandRTFRs.error == 0)
             {
-                set_Console_Colors(true, HACK_COLOR);
+                set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
                 print_str("HACK FOUND: CHKND\n"); // check condition bit is supported for non-data commands only
-                set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
             }
         }
         else
         {
-            set_Console_Colors(true, HACK_COLOR);
+            set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
             print_str("HACK FOUND: NCHK\n");
-            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
             device->drive_info.passThroughHacks.ataPTHacks.disableCheckCondition = true;
         }
     }
@@ -1891,10 +1891,10 @@ static void return_Response_Info_Test(tDevice*           device,
     if (SUCCESS == request_Return_TFRs_From_Device(device, &device->drive_info.lastCommandRTFRs))
     {
         device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-        set_Console_Colors(true, HACK_COLOR);
+        set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
         print_str("HACK FOUND: RS\n");   // returnResponseInfoSupported
         print_str("HACK FOUND: RSTD\n"); // returnResponseInfoNeedsTDIR
-        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
     }
     else if (testWithoutTDirAllowed)
     {
@@ -1904,9 +1904,9 @@ static void return_Response_Info_Test(tDevice*           device,
         if (SUCCESS == request_Return_TFRs_From_Device(device, &device->drive_info.lastCommandRTFRs))
         {
             device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported = true;
-            set_Console_Colors(true, HACK_COLOR);
+            set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
             print_str("HACK FOUND: RS\n"); // returnResponseInfoSupported
-            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
         }
     }
     if (device->drive_info.passThroughHacks.ataPTHacks.returnResponseInfoSupported)
@@ -2178,11 +2178,11 @@ typedef struct s_scsiDevInfo
 
 static void scsi_VPD_Pages(tDevice* device, ptrScsiDevInformation scsiDevInfo)
 {
-    set_Console_Colors(true, HEADING_COLOR);
+    set_Console_Output_Colors(HEADING_COLOR, CONSOLE_COLOR_DEFAULT);
     print_str("\n=========================\n");
     print_str("Checking VPD page support\n");
     print_str("=========================\n");
-    set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+    set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
 
 #define SUPPORTED_PAGES_LEN 36
     DECLARE_ZERO_INIT_ARRAY(uint8_t, supportedPages, SUPPORTED_PAGES_LEN);
@@ -2191,12 +2191,12 @@ static void scsi_VPD_Pages(tDevice* device, ptrScsiDevInformation scsiDevInfo)
     if (SUCCESS != scsi_Inquiry(device, supportedPages, SUPPORTED_PAGES_LEN, SUPPORTED_VPD_PAGES, true, false))
     {
         dummiedPages = true;
-        set_Console_Colors(true, WARNING_COLOR);
+        set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
         print_str("WARNING: Device did not report supported VPD pages.\n");
         print_str("         VPD pages communicate other device capabilities\n");
         print_str("         and limits which are useful to the host.\n");
         print_str("Will dummy up support to see if any pages are supported that are useful.\n");
-        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
         safe_memset(supportedPages, SUPPORTED_PAGES_LEN, 0, SUPPORTED_PAGES_LEN);
         uint16_t offset = UINT16_C(4); // start of pages to dummy up
         // in here we will set up a fake supported VPD pages buffer so that we try to read the unit serial number page,
@@ -2253,9 +2253,9 @@ static void scsi_VPD_Pages(tDevice* device, ptrScsiDevInformation scsiDevInfo)
     uint16_t supportedVPDPagesLength = M_BytesTo2ByteValue(supportedPages[2], supportedPages[3]);
     if ((supportedVPDPagesLength + 4) > INQ_RETURN_DATA_LENGTH)
     {
-        set_Console_Colors(true, WARNING_COLOR);
+        set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
         print_str("WARNING: Supported VPD pages length seems suspiciously large!\n");
-        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
     }
     uint16_t pagesread = UINT16_C(0);
     // TODO: validate peripheral qualifier and peripheral device type on every page with std inquiry data
@@ -2284,10 +2284,10 @@ static void scsi_VPD_Pages(tDevice* device, ptrScsiDevInformation scsiDevInfo)
                     // TODO: Also validate the peripheral qualifier and peripheral device type???
                     if (pageToRead[1] != supportedPages[vpdIter])
                     {
-                        set_Console_Colors(true, ERROR_COLOR);
+                        set_Console_Output_Colors(ERROR_COLOR, CONSOLE_COLOR_DEFAULT);
                         printf("ERROR: Expected page %" PRIX8 "h, but got %" PRIX8 "h\n", supportedPages[vpdIter],
                                pageToRead[1]);
-                        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                     }
                     else
                     {
@@ -2297,28 +2297,28 @@ static void scsi_VPD_Pages(tDevice* device, ptrScsiDevInformation scsiDevInfo)
                 }
                 else if (!dummiedPages)
                 {
-                    set_Console_Colors(true, ERROR_COLOR);
+                    set_Console_Output_Colors(ERROR_COLOR, CONSOLE_COLOR_DEFAULT);
                     printf("ERROR: Failed to read page %" PRIX8 "h. Was reported as supported, but cannot be read.\n",
                            supportedPages[vpdIter]);
                     printf("       Attempted to read %" PRIu16 " bytes as reported by device.\n", vpdPageLength);
-                    set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                    set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                 }
             }
             else
             {
-                set_Console_Colors(true, ERROR_COLOR);
+                set_Console_Output_Colors(ERROR_COLOR, CONSOLE_COLOR_DEFAULT);
                 printf("ERROR: Unable to allocate memory to read %" PRIu16 "B of page %" PRIX8 "h\n", vpdPageLength,
                        supportedPages[vpdIter]);
-                set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
             }
         }
         else if (!dummiedPages)
         {
-            set_Console_Colors(true, ERROR_COLOR);
+            set_Console_Output_Colors(ERROR_COLOR, CONSOLE_COLOR_DEFAULT);
             printf("ERROR: Failed to read page %" PRIX8 "h. Was reported as supported, but cannot be read.\n",
                    supportedPages[vpdIter]);
             print_str("       Attempted to read only first 4 bytes to determine full VPD page size as spec allows.\n");
-            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
         }
         switch (supportedPages[vpdIter])
         {
@@ -2331,9 +2331,9 @@ static void scsi_VPD_Pages(tDevice* device, ptrScsiDevInformation scsiDevInfo)
             {
                 if (dummiedPages)
                 {
-                    set_Console_Colors(true, HACK_COLOR);
+                    set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
                     print_str("HACK FOUND: UNA\n");
-                    set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                    set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                     device->drive_info.passThroughHacks.scsiHacks.unitSNAvailable = true;
                 }
                 char* unitSerialNumber = M_REINTERPRET_CAST(
@@ -2347,16 +2347,16 @@ static void scsi_VPD_Pages(tDevice* device, ptrScsiDevInformation scsiDevInfo)
                         if (!safe_isascii(unitSerialNumber[iter]) || !safe_isprint(unitSerialNumber[iter]))
                         {
                             unitSerialNumber[iter] = ' ';
-                            set_Console_Colors(true, WARNING_COLOR);
+                            set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
                             print_str("WARNING: Unit Serial Number contains non-ASCII or non-Printable Characters!\n");
-                            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                         }
                     }
                     if (safe_strlen(unitSerialNumber) == 0)
                     {
-                        set_Console_Colors(true, WARNING_COLOR);
+                        set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
                         print_str("WARNING: Unit Serial Number is empty!\n");
-                        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                     }
                     else
                     {
@@ -2369,9 +2369,9 @@ static void scsi_VPD_Pages(tDevice* device, ptrScsiDevInformation scsiDevInfo)
                 }
                 else
                 {
-                    set_Console_Colors(true, ERROR_COLOR);
+                    set_Console_Output_Colors(ERROR_COLOR, CONSOLE_COLOR_DEFAULT);
                     printf("ERROR: Unable to allocate %" PRIu16 " Bytes for the serial number\n", vpdPageLength + 1);
-                    set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                    set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                 }
             }
             break;
@@ -2539,9 +2539,9 @@ static void scsi_VPD_Pages(tDevice* device, ptrScsiDevInformation scsiDevInfo)
                         }
                         break;
                     case 3: // reserved
-                        set_Console_Colors(true, WARNING_COLOR);
+                        set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
                         print_str("\t\t\tWARNING: Reserved association\n");
-                        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                         break;
                     }
                     switch (designatorType)
@@ -2554,9 +2554,9 @@ static void scsi_VPD_Pages(tDevice* device, ptrScsiDevInformation scsiDevInfo)
                         print_str("\t\t\tT10 Vendor ID Based Designator:\n");
                         if (!isASCII)
                         {
-                            set_Console_Colors(true, WARNING_COLOR);
+                            set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
                             print_str("WARNING: Code set does not mark this as ASCII! This should be ASCII data!!!\n");
-                            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                         }
                         {
                             DECLARE_ZERO_INIT_ARRAY(char, desVendorID, 9);
@@ -2578,12 +2578,12 @@ static void scsi_VPD_Pages(tDevice* device, ptrScsiDevInformation scsiDevInfo)
                             }
                             else
                             {
-                                set_Console_Colors(true, WARNING_COLOR);
+                                set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
                                 print_str("WARNING: T10 Vendor ID based designator is missing vendor specific "
                                           "identifier!!!\n");
                                 print_str("Recommended method from SPC is to concatenate Product ID and Product Serial "
                                           "number\n");
-                                set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                                set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                             }
                         }
                         break;
@@ -2769,15 +2769,15 @@ static void scsi_VPD_Pages(tDevice* device, ptrScsiDevInformation scsiDevInfo)
                         print_str("\t\t\tRelative Target Port Identifier Designator:\n");
                         if (isASCII || isUTF8)
                         {
-                            set_Console_Colors(true, WARNING_COLOR);
+                            set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
                             print_str("WARNING: Code set is not set properly! This should be set to 1 for binary!\n");
-                            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                         }
                         else if (association != 1)
                         {
-                            set_Console_Colors(true, WARNING_COLOR);
+                            set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
                             print_str("WARNING: Use of this designator with association not set to 1 is reserved!\n");
-                            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                         }
                         {
                             uint16_t relativeTargetPortID =
@@ -2789,15 +2789,15 @@ static void scsi_VPD_Pages(tDevice* device, ptrScsiDevInformation scsiDevInfo)
                         print_str("\t\t\tTarget Port Group Designator:\n");
                         if (isASCII || isUTF8)
                         {
-                            set_Console_Colors(true, WARNING_COLOR);
+                            set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
                             print_str("WARNING: Code set is not set properly! This should be set to 1 for binary!\n");
-                            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                         }
                         else if (association != 1)
                         {
-                            set_Console_Colors(true, WARNING_COLOR);
+                            set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
                             print_str("WARNING: Use of this designator with association not set to 1 is reserved!\n");
-                            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                         }
                         {
                             uint16_t targetPortGroup =
@@ -2809,15 +2809,15 @@ static void scsi_VPD_Pages(tDevice* device, ptrScsiDevInformation scsiDevInfo)
                         print_str("\t\t\tLogical Unit Group Designator:\n");
                         if (isASCII || isUTF8)
                         {
-                            set_Console_Colors(true, WARNING_COLOR);
+                            set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
                             print_str("WARNING: Code set is not set properly! This should be set to 1 for binary!\n");
-                            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                         }
                         else if (association != 0)
                         {
-                            set_Console_Colors(true, WARNING_COLOR);
+                            set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
                             print_str("WARNING: Use of this designator with association not set to 0 is reserved!\n");
-                            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                         }
                         {
                             uint16_t luGroup =
@@ -2837,9 +2837,9 @@ static void scsi_VPD_Pages(tDevice* device, ptrScsiDevInformation scsiDevInfo)
                         print_str("\t\t\tSCSI Name String Designator:\n");
                         if (!isUTF8)
                         {
-                            set_Console_Colors(true, WARNING_COLOR);
+                            set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
                             print_str("WARNING: Code set is not properly set! This should be set to 3 for UTF8!\n");
-                            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                         }
                         {
                             char* scsiNameString = M_NULLPTR;
@@ -2854,10 +2854,10 @@ static void scsi_VPD_Pages(tDevice* device, ptrScsiDevInformation scsiDevInfo)
                             }
                             else
                             {
-                                set_Console_Colors(true, ERROR_COLOR);
+                                set_Console_Output_Colors(ERROR_COLOR, CONSOLE_COLOR_DEFAULT);
                                 printf("ERROR: failed to allocate memory (%" PRIu16 "B) to read SCSI Name string\n",
                                        designatorLength + 1);
-                                set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                                set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                             }
                         }
                         break;
@@ -2866,17 +2866,17 @@ static void scsi_VPD_Pages(tDevice* device, ptrScsiDevInformation scsiDevInfo)
                         // this is either USB or PCIe information depending on the protocol identifier field
                         if (association != 0x01)
                         {
-                            set_Console_Colors(true, WARNING_COLOR);
+                            set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
                             print_str("WARNING: Association is not set to 1! This may cause parsing issues!\n");
-                            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                         }
                         if (!piv)
                         {
                             // This should be an error since we can only parse this if the interface is set.
-                            set_Console_Colors(true, ERROR_COLOR);
+                            set_Console_Output_Colors(ERROR_COLOR, CONSOLE_COLOR_DEFAULT);
                             print_str("ERROR: Protocol identifier valid bit is not set! Cannot parse this without this "
                                       "bit!\n");
-                            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                         }
                         else
                         {
@@ -2919,10 +2919,10 @@ static void scsi_VPD_Pages(tDevice* device, ptrScsiDevInformation scsiDevInfo)
                                 // print bytes 2 - 17
                                 if (designatorLength < 18)
                                 {
-                                    set_Console_Colors(true, WARNING_COLOR);
+                                    set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
                                     printf("WARNING: Designator length should be 18B, but got %" PRIu16 "B\n",
                                            designatorLength);
-                                    set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                                    set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                                 }
                                 for (uint16_t uuidOffset = designatorOffset; uuidOffset < (designatorLength + 4);
                                      ++uuidOffset)
@@ -2947,10 +2947,10 @@ static void scsi_VPD_Pages(tDevice* device, ptrScsiDevInformation scsiDevInfo)
                 // checking if we got an MD5 when we shouldn't have!
                 if (gotMD5 && (gotEUI64 || gotNAA || gotSCSINameString || gotUUID))
                 {
-                    set_Console_Colors(true, WARNING_COLOR);
+                    set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
                     print_str("WARNING: Device reported MD5 designator while also reporting a\n");
                     print_str("         unique identifier as well. This is not allowed per SPC!\n");
-                    set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                    set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                 }
                 else if (gotMD5 && md5Offset)
                 {
@@ -2981,11 +2981,11 @@ static void scsi_VPD_Pages(tDevice* device, ptrScsiDevInformation scsiDevInfo)
             {
                 if (vpdPageLength < 0x003C)
                 {
-                    set_Console_Colors(true, ERROR_COLOR);
+                    set_Console_Output_Colors(ERROR_COLOR, CONSOLE_COLOR_DEFAULT);
                     printf("ERROR: VPD Page length is less than specified in SPC! Expected %" PRIX16
                            "h, but got %" PRIX16 "h\n",
                            0x003C, vpdPageLength);
-                    set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                    set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                 }
                 else
                 {
@@ -2996,10 +2996,10 @@ static void scsi_VPD_Pages(tDevice* device, ptrScsiDevInformation scsiDevInfo)
                     uint16_t extDSTMinutes = M_BytesTo2ByteValue(pageToRead[10], pageToRead[11]);
                     if (extDSTMinutes == 0)
                     {
-                        set_Console_Colors(true, WARNING_COLOR);
+                        set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
                         print_str("WARNING: Extended DST time in minutes was reported as zero! This means SCSI DST "
                                   "translation is not available!\n");
-                        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                     }
                     else
                     {
@@ -3008,16 +3008,16 @@ static void scsi_VPD_Pages(tDevice* device, ptrScsiDevInformation scsiDevInfo)
                     }
                     if (pageToRead[13] == 0)
                     {
-                        set_Console_Colors(true, WARNING_COLOR);
+                        set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
                         printf("WARNING: Maximum Sense Length not reported. Will assume %u Bytes\n", SPC3_SENSE_LEN);
-                        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                     }
                     else if (pageToRead[13] > SPC3_SENSE_LEN)
                     {
-                        set_Console_Colors(true, WARNING_COLOR);
+                        set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
                         printf("WARNING: Maximum Sense Length reported as larger than max allowed by SPC! %u Bytes\n",
                                pageToRead[13]);
-                        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                     }
                     else
                     {
@@ -3045,11 +3045,11 @@ static void scsi_VPD_Pages(tDevice* device, ptrScsiDevInformation scsiDevInfo)
             {
                 if (vpdPageLength < 0x0238)
                 {
-                    set_Console_Colors(true, ERROR_COLOR);
+                    set_Console_Output_Colors(ERROR_COLOR, CONSOLE_COLOR_DEFAULT);
                     printf("ERROR: VPD Page length is less than specified in SAT! Expected %" PRIX16
                            "h, but got %" PRIX16 "h\n",
                            0x0238, vpdPageLength);
-                    set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                    set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                 }
                 else
                 {
@@ -3066,17 +3066,17 @@ static void scsi_VPD_Pages(tDevice* device, ptrScsiDevInformation scsiDevInfo)
                         if (!safe_isascii(satVendor[iter]) || !safe_isprint(satVendor[iter]))
                         {
                             satVendor[iter] = ' ';
-                            set_Console_Colors(true, WARNING_COLOR);
+                            set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
                             print_str("WARNING: SAT Vendor ID contains non-ASCII or non-Printable Characters!\n");
-                            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                         }
                     }
                     safe_memcpy(device->drive_info.bridge_info.t10SATvendorID, 9, satVendor, 8);
                     if (safe_strlen(satVendor) == 0)
                     {
-                        set_Console_Colors(true, WARNING_COLOR);
+                        set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
                         print_str("WARNING: SAT Vendor ID is empty!\n");
-                        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                     }
                     else
                     {
@@ -3087,17 +3087,17 @@ static void scsi_VPD_Pages(tDevice* device, ptrScsiDevInformation scsiDevInfo)
                         if (!safe_isascii(satProductID[iter]) || !safe_isprint(satProductID[iter]))
                         {
                             satProductID[iter] = ' ';
-                            set_Console_Colors(true, WARNING_COLOR);
+                            set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
                             print_str("WARNING: SAT Product ID contains non-ASCII or non-Printable Characters!\n");
-                            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                         }
                     }
                     safe_memcpy(device->drive_info.bridge_info.SATproductID, 17, satProductID, 16);
                     if (safe_strlen(satProductID) == 0)
                     {
-                        set_Console_Colors(true, WARNING_COLOR);
+                        set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
                         print_str("WARNING: SAT Product ID is empty!\n");
-                        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                     }
                     else
                     {
@@ -3108,18 +3108,18 @@ static void scsi_VPD_Pages(tDevice* device, ptrScsiDevInformation scsiDevInfo)
                         if (!safe_isascii(satRevision[iter]) || !safe_isprint(satRevision[iter]))
                         {
                             satRevision[iter] = ' ';
-                            set_Console_Colors(true, WARNING_COLOR);
+                            set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
                             print_str(
                                 "WARNING: SAT Product Revision contains non-ASCII or non-Printable Characters!\n");
-                            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                         }
                     }
                     safe_memcpy(device->drive_info.bridge_info.SATfwRev, 9, satRevision, 4);
                     if (safe_strlen(satRevision) == 0)
                     {
-                        set_Console_Colors(true, WARNING_COLOR);
+                        set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
                         print_str("WARNING: SAT Product Revision is empty!\n");
-                        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                     }
                     else
                     {
@@ -3190,11 +3190,11 @@ static void scsi_VPD_Pages(tDevice* device, ptrScsiDevInformation scsiDevInfo)
             {
                 if (vpdPageLength < 0x0E)
                 {
-                    set_Console_Colors(true, ERROR_COLOR);
+                    set_Console_Output_Colors(ERROR_COLOR, CONSOLE_COLOR_DEFAULT);
                     printf("ERROR: VPD Page length is less than specified in SPC! Expected %" PRIX16
                            "h, but got %" PRIX16 "h\n",
                            0x0E, vpdPageLength);
-                    set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                    set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                 }
                 else
                 {
@@ -3480,11 +3480,11 @@ static void scsi_VPD_Pages(tDevice* device, ptrScsiDevInformation scsiDevInfo)
             {
                 if (vpdPageLength < 0x003C)
                 {
-                    set_Console_Colors(true, ERROR_COLOR);
+                    set_Console_Output_Colors(ERROR_COLOR, CONSOLE_COLOR_DEFAULT);
                     printf("ERROR: VPD Page length is less than specified in SBC! Expected %" PRIX16
                            "h, but got %" PRIX16 "h\n",
                            0x003C, vpdPageLength);
-                    set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                    set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                 }
                 else
                 {
@@ -3648,11 +3648,11 @@ static void scsi_VPD_Pages(tDevice* device, ptrScsiDevInformation scsiDevInfo)
             {
                 if (vpdPageLength < 0x003C)
                 {
-                    set_Console_Colors(true, ERROR_COLOR);
+                    set_Console_Output_Colors(ERROR_COLOR, CONSOLE_COLOR_DEFAULT);
                     printf("ERROR: VPD Page length is less than specified in SBC! Expected %" PRIX16
                            "h, but got %" PRIX16 "h\n",
                            0x003C, vpdPageLength);
-                    set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                    set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                 }
                 else
                 {
@@ -3676,9 +3676,9 @@ static void scsi_VPD_Pages(tDevice* device, ptrScsiDevInformation scsiDevInfo)
                     }
                     else
                     {
-                        set_Console_Colors(true, ERROR_COLOR);
+                        set_Console_Output_Colors(ERROR_COLOR, CONSOLE_COLOR_DEFAULT);
                         print_str("ERROR: Reserved value\n");
-                        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                     }
                     print_str("\tProduct Type: ");
                     scsiDevInfo->vpdData.blockCharacteristicsData.productType = pageToRead[6];
@@ -3791,11 +3791,11 @@ static void scsi_VPD_Pages(tDevice* device, ptrScsiDevInformation scsiDevInfo)
             {
                 if (vpdPageLength < 0x0004)
                 {
-                    set_Console_Colors(true, ERROR_COLOR);
+                    set_Console_Output_Colors(ERROR_COLOR, CONSOLE_COLOR_DEFAULT);
                     printf("ERROR: VPD Page length is less than specified in SBC! Expected %" PRIX16
                            "h, but got %" PRIX16 "h\n",
                            0x0004, vpdPageLength);
-                    set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                    set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                 }
                 else
                 {
@@ -3921,27 +3921,27 @@ static void scsi_VPD_Pages(tDevice* device, ptrScsiDevInformation scsiDevInfo)
         }
         if (genericVPDPageReadOutput && readVPDPage)
         {
-            print_Data_Buffer(pageToRead, vpdPageLength, true);
+            print_Data_Buffer_Fast(pageToRead, vpdPageLength, true);
         }
         safe_free_aligned_core(C_CAST(void**, &pageToRead));
     }
     if (pagesread <= dummiedPageCount && dummiedPages) // less than or equal to 1 because it is possible that the only
                                                        // suppored page is the unit serial number!
     {
-        set_Console_Colors(true, HACK_COLOR);
+        set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
         print_str("HACK FOUND: NVPD\n");
-        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
         device->drive_info.passThroughHacks.scsiHacks.noVPDPages = true;
     }
 }
 
 static eReturnValues scsi_Information(tDevice* device, ptrScsiDevInformation scsiDevInfo)
 {
-    set_Console_Colors(true, HEADING_COLOR);
+    set_Console_Output_Colors(HEADING_COLOR, CONSOLE_COLOR_DEFAULT);
     print_str("\n====================\n");
     print_str("Reading Inquiry Data\n");
     print_str("====================\n");
-    set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+    set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
 
     if (SUCCESS == scsi_Inquiry(device, (uint8_t*)&device->drive_info.scsiVpdData.inquiryData, 96, 0, false, false))
     {
@@ -4130,19 +4130,19 @@ static eReturnValues scsi_Information(tDevice* device, ptrScsiDevInformation scs
         uint8_t totalInqLength                  = inqPtr[4] + 4;
         if (scsiDevInfo->inquiryData.responseFormat < 2)
         {
-            set_Console_Colors(true, WARNING_COLOR);
+            set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
             printf("WARNING: Response data format is set to %" PRIu8 "!\n", scsiDevInfo->inquiryData.responseFormat);
             print_str("         This means that all product identification is in a vendor specific\n");
             print_str("         format and cannot be parsed correctly!\n");
             print_str("         This is only expected for OLD SCSI devices. Nothing else should\n");
             print_str("         report in this format. Raw output is provided which may be usable\n");
             print_str("         if needed for better legacy device support.\n");
-            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
-            set_Console_Colors(true, HACK_COLOR);
+            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
+            set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
             print_str("HACK FOUND: PRESCSI2\n");
-            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
             device->drive_info.passThroughHacks.scsiHacks.preSCSI2InqData = true;
-            print_Data_Buffer(inqPtr, totalInqLength, true);
+            print_Data_Buffer_Fast(inqPtr, totalInqLength, true);
         }
         else
         {
@@ -4155,18 +4155,18 @@ static eReturnValues scsi_Information(tDevice* device, ptrScsiDevInformation scs
                     !safe_isprint(scsiDevInfo->inquiryData.vendorId[iter]))
                 {
                     scsiDevInfo->inquiryData.vendorId[iter] = ' ';
-                    set_Console_Colors(true, WARNING_COLOR);
+                    set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
                     print_str("WARNING: Vendor ID contains non-ASCII or non-Printable Characters!\n");
-                    set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                    set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                 }
             }
             safe_memcpy(device->drive_info.T10_vendor_ident, T10_VENDOR_ID_LEN + 1, scsiDevInfo->inquiryData.vendorId,
                         T10_VENDOR_ID_LEN);
             if (safe_strlen(scsiDevInfo->inquiryData.vendorId) == 0)
             {
-                set_Console_Colors(true, WARNING_COLOR);
+                set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
                 print_str("WARNING: Vendor ID is empty!\n");
-                set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
             }
             else
             {
@@ -4182,18 +4182,18 @@ static eReturnValues scsi_Information(tDevice* device, ptrScsiDevInformation scs
                     !safe_isprint(scsiDevInfo->inquiryData.productId[iter]))
                 {
                     scsiDevInfo->inquiryData.productId[iter] = ' ';
-                    set_Console_Colors(true, WARNING_COLOR);
+                    set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
                     print_str("WARNING: Product ID contains non-ASCII or non-Printable Characters!\n");
-                    set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                    set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                 }
             }
             safe_memcpy(device->drive_info.product_identification, MODEL_NUM_LEN + 1,
                         scsiDevInfo->inquiryData.productId, INQ_DATA_PRODUCT_ID_LEN);
             if (safe_strlen(scsiDevInfo->inquiryData.productId) == 0)
             {
-                set_Console_Colors(true, WARNING_COLOR);
+                set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
                 print_str("WARNING: Product ID is empty!\n");
-                set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
             }
             else
             {
@@ -4209,18 +4209,18 @@ static eReturnValues scsi_Information(tDevice* device, ptrScsiDevInformation scs
                     !safe_isprint(scsiDevInfo->inquiryData.productRev[iter]))
                 {
                     scsiDevInfo->inquiryData.productRev[iter] = ' ';
-                    set_Console_Colors(true, WARNING_COLOR);
+                    set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
                     print_str("WARNING: Product Revision contains non-ASCII or non-Printable Characters!\n");
-                    set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                    set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                 }
             }
             safe_memcpy(device->drive_info.product_revision, FW_REV_LEN + 1, scsiDevInfo->inquiryData.productRev,
                         INQ_DATA_PRODUCT_REV_LEN);
             if (safe_strlen(scsiDevInfo->inquiryData.productRev) == 0)
             {
-                set_Console_Colors(true, WARNING_COLOR);
+                set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
                 print_str("WARNING: Product Revision is empty!\n");
-                set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
             }
             else
             {
@@ -4292,11 +4292,11 @@ static eReturnValues scsi_Information(tDevice* device, ptrScsiDevInformation scs
             }
             else
             {
-                set_Console_Colors(true, NOTE_COLOR);
+                set_Console_Output_Colors(NOTE_COLOR, CONSOLE_COLOR_DEFAULT);
                 print_str("NOTE: Inquiry data is 36 bytes or less but reports format 2 which should be 96\n");
                 print_str("      bytes. In these bytes version descriptors will be reported and can be used\n");
                 print_str("      to help better understand device capabilities (starting with SPC2)\n\n");
-                set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
             }
         }
 
@@ -4307,9 +4307,9 @@ static eReturnValues scsi_Information(tDevice* device, ptrScsiDevInformation scs
     }
     else
     {
-        set_Console_Colors(true, ERROR_COLOR);
+        set_Console_Output_Colors(ERROR_COLOR, CONSOLE_COLOR_DEFAULT);
         print_str("Fatal Error: Unable to get standard inquiry data. Unable to proceed with any more testing!\n");
-        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
         return FAILURE;
     }
     return SUCCESS;
@@ -4320,11 +4320,11 @@ static eReturnValues scsi_Capacity_Information(tDevice* device, ptrScsiDevInform
     // Read capacity. Start with 10, then do 16. Emit warnings when 16 doesn't work and the scsi versions is greater
     // than SPC2 If read capacity 10 comes back saying UINT32_MAX for capacity, warn that this mismatches the SCSI
     // version reported.
-    set_Console_Colors(true, HEADING_COLOR);
+    set_Console_Output_Colors(HEADING_COLOR, CONSOLE_COLOR_DEFAULT);
     print_str("\n========================================\n");
     print_str("Getting Read Capacity data. 10 & 16 byte\n");
     print_str("========================================\n");
-    set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+    set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
     DECLARE_ZERO_INIT_ARRAY(uint8_t, readCapacityData, 32);
     eReturnValues readCap10Result = SUCCESS, readCap16Result = SUCCESS;
     if (SUCCESS == (readCap10Result = scsi_Read_Capacity_10(device, readCapacityData, 8)))
@@ -4342,11 +4342,11 @@ static eReturnValues scsi_Capacity_Information(tDevice* device, ptrScsiDevInform
     }
     else
     {
-        set_Console_Colors(true, WARNING_COLOR);
+        set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
         print_str("WARNING: Failed read capacity 10. While this command is superceeded by read capacity 16,\n");
         print_str("         supporting it helps legacy system support and software. If not supported, it should\n");
         print_str("         at least fail gracefully and report \"Invalid Operation Code\"\n");
-        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
     }
     safe_memset(readCapacityData, 32, 0, 32);
     if (SUCCESS == (readCap16Result = scsi_Read_Capacity_16(device, readCapacityData, 32)))
@@ -4368,7 +4368,7 @@ static eReturnValues scsi_Capacity_Information(tDevice* device, ptrScsiDevInform
     }
     else
     {
-        set_Console_Colors(true, WARNING_COLOR);
+        set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
         print_str("WARNING: Failed read capacity 16. This should only happen on old legacy SPC & earlier devices.\n");
         print_str("         All new devices SHOULD support this command to report PI type (if any) and logical\n");
         print_str(
@@ -4376,23 +4376,23 @@ static eReturnValues scsi_Capacity_Information(tDevice* device, ptrScsiDevInform
         print_str(
             "         this command also reports if logical block provisioning management is enabled and whether\n");
         print_str("         or not zeros are reported when reading an unmapped LBA.\n");
-        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
     }
 
     if (readCap16Result == SUCCESS && readCap10Result == SUCCESS)
     {
         if (scsiDevInfo->readCapData.rc16blockSize != scsiDevInfo->readCapData.rc10blockSize)
         {
-            set_Console_Colors(true, ERROR_COLOR);
+            set_Console_Output_Colors(ERROR_COLOR, CONSOLE_COLOR_DEFAULT);
             print_str("ERROR: Block length does not match between read capacity commands!\n");
-            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
         }
         if (scsiDevInfo->readCapData.rc10MaxLBA != UINT32_MAX &&
             scsiDevInfo->readCapData.rc10MaxLBA != scsiDevInfo->readCapData.rc16MaxLBA)
         {
-            set_Console_Colors(true, ERROR_COLOR);
+            set_Console_Output_Colors(ERROR_COLOR, CONSOLE_COLOR_DEFAULT);
             print_str("ERROR: Max LBA does not match between read capacity commands!\n");
-            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
         }
     }
     return SUCCESS;
@@ -4422,9 +4422,9 @@ static eReturnValues use_Mode_Sense_6(tDevice* device, uint8_t pageCode, bool* u
             {
                 if (is_Invalid_Opcode(device->drive_info.lastCommandSenseData, SPC3_SENSE_LEN))
                 {
-                    set_Console_Colors(true, ERROR_COLOR);
+                    set_Console_Output_Colors(ERROR_COLOR, CONSOLE_COLOR_DEFAULT);
                     print_str("ERROR: This device does not appear to support either mode sense 10 or mode sense 6!\n");
-                    set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                    set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                     return FAILURE;
                 }
                 else
@@ -4488,29 +4488,29 @@ static eReturnValues get_SCSI_Mode_Page_Data(
             }
             if (readpageCode != pageCode)
             {
-                set_Console_Colors(true, ERROR_COLOR);
+                set_Console_Output_Colors(ERROR_COLOR, CONSOLE_COLOR_DEFAULT);
                 printf("ERROR: Incorrect page returned from mode sense 6. Expected %02" PRIX8 "h, but got %02" PRIX8
                        "h\n",
                        pageCode, readpageCode);
-                set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                 ret = FAILURE;
             }
             else if (subpageFormat && subPageCode != readsubpage)
             {
-                set_Console_Colors(true, ERROR_COLOR);
+                set_Console_Output_Colors(ERROR_COLOR, CONSOLE_COLOR_DEFAULT);
                 printf("ERROR: Incorrect subpage returned from mode sense 6. Expected %02" PRIX8 "h, but got %02" PRIX8
                        "h\n",
                        subPageCode, readsubpage);
-                set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                 ret = FAILURE;
             }
             else if (subPageCode != 0 && !subpageFormat)
             {
-                set_Console_Colors(true, HACK_COLOR);
+                set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
                 print_str("HACK FOUND: NMSP\n"); // mode page subpages are not supported by this device and it does not
                                                  // properly validate all fields of the CDB
                 device->drive_info.passThroughHacks.scsiHacks.noModeSubPages = true;
-                set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
             }
             else
             {
@@ -4560,29 +4560,29 @@ static eReturnValues get_SCSI_Mode_Page_Data(
             }
             if (readpageCode != pageCode)
             {
-                set_Console_Colors(true, ERROR_COLOR);
+                set_Console_Output_Colors(ERROR_COLOR, CONSOLE_COLOR_DEFAULT);
                 printf("ERROR: Incorrect page returned from mode sense 6. Expected %02" PRIX8 "h, but got %02" PRIX8
                        "h\n",
                        pageCode, readpageCode);
-                set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                 ret = FAILURE;
             }
             else if (subpageFormat && subPageCode != readsubpage)
             {
-                set_Console_Colors(true, ERROR_COLOR);
+                set_Console_Output_Colors(ERROR_COLOR, CONSOLE_COLOR_DEFAULT);
                 printf("ERROR: Incorrect subpage returned from mode sense 6. Expected %02" PRIX8 "h, but got %02" PRIX8
                        "h\n",
                        subPageCode, readsubpage);
-                set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                 ret = FAILURE;
             }
             else if (subPageCode != 0 && !subpageFormat)
             {
-                set_Console_Colors(true, HACK_COLOR);
+                set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
                 print_str("HACK FOUND: NMSP\n"); // mode page subpages are not supported by this device and it does not
                                                  // properly validate all fields of the CDB
                 device->drive_info.passThroughHacks.scsiHacks.noModeSubPages = true;
-                set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
             }
             else
             {
@@ -4618,46 +4618,46 @@ static eReturnValues scsi_Mode_Information(tDevice* device, ptrScsiDevInformatio
 {
     bool successfullyReadAtLeastOnePage = false;
     bool use6Byte                       = false;
-    set_Console_Colors(true, HEADING_COLOR);
+    set_Console_Output_Colors(HEADING_COLOR, CONSOLE_COLOR_DEFAULT);
     print_str("\n==========================\n");
     print_str("Checking Mode Page Support\n");
     print_str("==========================\n");
-    set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+    set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
     // Attempting mode sense 10 since nearly EVERYTHING should support it. The only exception is REALLY old SCSI drives.
     eReturnValues sixTest = use_Mode_Sense_6(device, MP_CONTROL, &use6Byte);
     if (SUCCESS != sixTest)
     {
         if (use6Byte)
         {
-            set_Console_Colors(true, HACK_COLOR);
+            set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
             print_str("HACK FOUND: MP6\n");
             device->drive_info.passThroughHacks.scsiHacks.mode6bytes = true;
-            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
             // TODO: add this to the passthrough hacks structure.
         }
         if (sixTest == NOT_SUPPORTED)
         {
-            set_Console_Colors(true, WARNING_COLOR);
+            set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
             print_str("WARNING: This device does not seem to support any standard mode pages. Skipping all mode page "
                       "checks\n");
             print_str("       This should only happen on SCSI (1) and earlier (SASI) devices!\n");
-            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
             return NOT_SUPPORTED;
         }
         else
         {
-            set_Console_Colors(true, HACK_COLOR);
+            set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
             print_str("HACK FOUND: NMP\n");
             device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
-            set_Console_Colors(true, ERROR_COLOR);
+            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
+            set_Console_Output_Colors(ERROR_COLOR, CONSOLE_COLOR_DEFAULT);
             print_str(
                 "ERROR: This device doesn't support ANY mode sense commands. Mode sense commands can convey device "
                 "support and change\n");
             print_str(
                 "       device settings/capabilties. This can be especially important for disabling write caching "
                 "for backups.\n");
-            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
         }
         return sixTest;
     }
@@ -4665,9 +4665,9 @@ static eReturnValues scsi_Mode_Information(tDevice* device, ptrScsiDevInformatio
     if (use6Byte)
     {
         modeHeaderLength = MODE_PARAMETER_HEADER_6_LEN;
-        set_Console_Colors(true, HACK_COLOR);
+        set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
         print_str("HACK FOUND: MP6\n");
-        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
         device->drive_info.passThroughHacks.scsiHacks.mode6bytes = true;
     }
 
@@ -5210,15 +5210,15 @@ static eReturnValues scsi_Mode_Information(tDevice* device, ptrScsiDevInformatio
     }
     if (!successfullyReadAtLeastOnePage)
     {
-        set_Console_Colors(true, HACK_COLOR);
+        set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
         print_str("HACK FOUND: NMP\n");
         device->drive_info.passThroughHacks.scsiHacks.noModePages = true;
-        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
-        set_Console_Colors(true, WARNING_COLOR);
+        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
         print_str(
             "WARNING: This device does not seem to support any standard mode pages. Multiple pages were attempted, "
             "but none were read successfully.\n");
-        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
         return NOT_SUPPORTED;
     }
     safe_free_aligned_core(C_CAST(void**, &modeData));
@@ -5229,11 +5229,11 @@ static eReturnValues scsi_Mode_Information(tDevice* device, ptrScsiDevInformatio
 // method to save the data fields we care about...-TJE
 static eReturnValues scsi_Log_Information(tDevice* device, ptrScsiDevInformation scsiDevInfo)
 {
-    set_Console_Colors(true, HEADING_COLOR);
+    set_Console_Output_Colors(HEADING_COLOR, CONSOLE_COLOR_DEFAULT);
     print_str("\n==========================\n");
     print_str("Testing for SCSI Log Pages\n");
     print_str("==========================\n");
-    set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+    set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
     // Make sure on the first log sense, if it fails, we check for invalid operation code. If invalid code, test is over
     // since the command isn't supported. Let the user know about this though!
     DECLARE_ZERO_INIT_ARRAY(uint8_t, supportPages, 255);
@@ -5251,9 +5251,9 @@ static eReturnValues scsi_Log_Information(tDevice* device, ptrScsiDevInformation
             // While we got successful status for subpages, we need to validate the data!!!
             if (memcmp(supportPages, supportedPagesAndSubpages, 255) == 0)
             {
-                set_Console_Colors(true, HACK_COLOR);
+                set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
                 print_str("HACK FOUND: NLPS\n");
-                set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                 device->drive_info.passThroughHacks.scsiHacks.noLogSubPages = true;
                 print_str(
                     "This device does NOT report log page subpages properly! Do not attempt to read ANY subpages as "
@@ -5284,11 +5284,11 @@ static eReturnValues scsi_Log_Information(tDevice* device, ptrScsiDevInformation
                         }
                         else
                         {
-                            set_Console_Colors(true, WARNING_COLOR);
+                            set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
                             print_str(
                                 "WARNING: Length of subpages does not appear to make sense. It should be AT LEAST "
                                 "twice as long as without reporting subpages.\n");
-                            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                             // printf("         One more level analysis is allowed before this is considered a buggy
                             // device that reports incorrectly when asking for subpages.\n");
                             // TODO: final level of analysis...looping and checking to see if a single page is missing
@@ -5303,9 +5303,9 @@ static eReturnValues scsi_Log_Information(tDevice* device, ptrScsiDevInformation
                     }
                     else
                     {
-                        set_Console_Colors(true, HACK_COLOR);
+                        set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
                         print_str("HACK FOUND: NLPS\n");
-                        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                         printf(
                             "This device reports success from asking for subpage list, BUT doesn't report properly\n");
                         hasSubpages                                                 = false;
@@ -5318,9 +5318,9 @@ static eReturnValues scsi_Log_Information(tDevice* device, ptrScsiDevInformation
                 }
                 else
                 {
-                    set_Console_Colors(true, ERROR_COLOR);
+                    set_Console_Output_Colors(ERROR_COLOR, CONSOLE_COLOR_DEFAULT);
                     print_str("ERROR: Data looks completely invalid! Cancelling SCSI log page test!\n");
-                    set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                    set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                     return FAILURE;
                 }
             }
@@ -5379,17 +5379,17 @@ static eReturnValues scsi_Log_Information(tDevice* device, ptrScsiDevInformation
                             // subpage format
                             if (M_GETBITRANGE(pageToRead[0], 5, 0) != pageCode)
                             {
-                                set_Console_Colors(true, ERROR_COLOR);
+                                set_Console_Output_Colors(ERROR_COLOR, CONSOLE_COLOR_DEFAULT);
                                 printf("ERROR: Expected page %" PRIX8 "h, but got %" PRIX8 "h\n", pageCode,
                                        C_CAST(uint8_t, M_GETBITRANGE(pageToRead[0], 5, 0)));
-                                set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                                set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                             }
                             else if (pageToRead[1] != subPageCode)
                             {
-                                set_Console_Colors(true, ERROR_COLOR);
+                                set_Console_Output_Colors(ERROR_COLOR, CONSOLE_COLOR_DEFAULT);
                                 printf("ERROR: Expected subpage %" PRIX8 "h, but got %" PRIX8 "h\n", subPageCode,
                                        pageToRead[1]);
-                                set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                                set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                             }
                             else
                             {
@@ -5400,10 +5400,10 @@ static eReturnValues scsi_Log_Information(tDevice* device, ptrScsiDevInformation
                         {
                             if (M_GETBITRANGE(pageToRead[0], 5, 0) != pageCode)
                             {
-                                set_Console_Colors(true, ERROR_COLOR);
+                                set_Console_Output_Colors(ERROR_COLOR, CONSOLE_COLOR_DEFAULT);
                                 printf("ERROR: Expected page %" PRIX8 "h, but got %" PRIX8 "h\n", pageCode,
                                        C_CAST(uint8_t, M_GETBITRANGE(pageToRead[0], 5, 0)));
-                                set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                                set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                             }
                             else
                             {
@@ -5413,21 +5413,21 @@ static eReturnValues scsi_Log_Information(tDevice* device, ptrScsiDevInformation
                     }
                     else
                     {
-                        set_Console_Colors(true, ERROR_COLOR);
+                        set_Console_Output_Colors(ERROR_COLOR, CONSOLE_COLOR_DEFAULT);
                         printf("ERROR: Failed to read page %02" PRIX8 "h-%02" PRIX8
                                "h. Was reported as supported, but cannot be read.\n",
                                pageCode, subPageCode);
                         printf("       Attempted to read %02" PRIu16 " bytes as reported by device.\n", logPageLength);
-                        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                     }
                 }
                 else
                 {
-                    set_Console_Colors(true, ERROR_COLOR);
+                    set_Console_Output_Colors(ERROR_COLOR, CONSOLE_COLOR_DEFAULT);
                     printf("ERROR: Unable to allocate memory to read %" PRIu16 "B of page  %02" PRIX8 "h-%02" PRIX8
                            "h\n",
                            logPageLength, pageCode, subPageCode);
-                    set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                    set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                 }
             }
 
@@ -6661,7 +6661,7 @@ static eReturnValues scsi_Log_Information(tDevice* device, ptrScsiDevInformation
             }
             if (genericLogPagePrintout && readLogPage)
             {
-                print_Data_Buffer(pageToRead, logPageLength, true);
+                print_Data_Buffer_Fast(pageToRead, logPageLength, true);
             }
             safe_free_aligned_core(C_CAST(void**, &pageToRead));
         }
@@ -6671,9 +6671,9 @@ static eReturnValues scsi_Log_Information(tDevice* device, ptrScsiDevInformation
         if (is_Invalid_Opcode(device->drive_info.lastCommandSenseData, SPC3_SENSE_LEN))
         {
             // Invalid operation code, so this device does not support log sense commands.
-            set_Console_Colors(true, NOTE_COLOR);
+            set_Console_Output_Colors(NOTE_COLOR, CONSOLE_COLOR_DEFAULT);
             print_str("NOTE: Skipping SCSI Log test since device reported invalid operation code.\n");
-            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
         }
         else
         {
@@ -6686,9 +6686,9 @@ static eReturnValues scsi_Log_Information(tDevice* device, ptrScsiDevInformation
             print_str("\n");
         }
         device->drive_info.passThroughHacks.scsiHacks.noLogPages = true;
-        set_Console_Colors(true, HACK_COLOR);
+        set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
         print_str("HACK FOUND: NLP\n");
-        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
     }
     return SUCCESS;
 }
@@ -6712,7 +6712,7 @@ static eReturnValues scsi_Read_Check(tDevice*         device,
         return BAD_PARAMETER;
     }
 
-    set_Console_Colors(true, HEADING_COLOR);
+    set_Console_Output_Colors(HEADING_COLOR, CONSOLE_COLOR_DEFAULT);
     if (zeroLengthTransfers)
     {
         print_str("\n======================================================\n");
@@ -6725,7 +6725,7 @@ static eReturnValues scsi_Read_Check(tDevice*         device,
         print_str("Checking SCSI Read/Write Command Support\n");
         print_str("========================================\n");
     }
-    set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+    set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
 
     uint8_t* ptrData             = M_NULLPTR;
     uint32_t transferLength      = UINT32_C(0);
@@ -6744,18 +6744,18 @@ static eReturnValues scsi_Read_Check(tDevice*         device,
         if (SUCCESS == scsi_Read_6(device, 0, C_CAST(uint8_t, transferLength), ptrData, transferLengthBytes))
         {
             rwSupport->sixBytes = true;
-            set_Console_Colors(true, HACK_COLOR);
+            set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
             print_str("HACK FOUND: RW6\n");
-            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
             device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
             device->drive_info.passThroughHacks.scsiHacks.readWrite.rw6       = true;
         }
     }
     else
     {
-        set_Console_Colors(true, NOTE_COLOR);
+        set_Console_Output_Colors(NOTE_COLOR, CONSOLE_COLOR_DEFAULT);
         print_str("NOTE: Skipping R6 since zero length has a different meaning than other commands\n");
-        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
     }
 
     // read 10
@@ -6763,9 +6763,9 @@ static eReturnValues scsi_Read_Check(tDevice*         device,
                                 transferLengthBytes))
     {
         rwSupport->tenBytes = true;
-        set_Console_Colors(true, HACK_COLOR);
+        set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
         print_str("HACK FOUND: RW10\n");
-        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
         device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
         device->drive_info.passThroughHacks.scsiHacks.readWrite.rw10      = true;
     }
@@ -6774,9 +6774,9 @@ static eReturnValues scsi_Read_Check(tDevice*         device,
     if (SUCCESS == scsi_Read_12(device, 0, false, false, false, 0, 0, transferLength, ptrData, transferLengthBytes))
     {
         rwSupport->twelveBytes = true;
-        set_Console_Colors(true, HACK_COLOR);
+        set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
         print_str("HACK FOUND: RW12\n");
-        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
         device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
         device->drive_info.passThroughHacks.scsiHacks.readWrite.rw12      = true;
     }
@@ -6785,9 +6785,9 @@ static eReturnValues scsi_Read_Check(tDevice*         device,
     if (SUCCESS == scsi_Read_16(device, 0, false, false, false, 0, 0, transferLength, ptrData, transferLengthBytes))
     {
         rwSupport->sixteenBytes = true;
-        set_Console_Colors(true, HACK_COLOR);
+        set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
         print_str("HACK FOUND: RW16\n");
-        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
         device->drive_info.passThroughHacks.scsiHacks.readWrite.available = true;
         device->drive_info.passThroughHacks.scsiHacks.readWrite.rw16      = true;
     }
@@ -6800,22 +6800,22 @@ static eReturnValues scsi_Read_Check(tDevice*         device,
     }
     else if (!zeroLengthTransfers)
     {
-        set_Console_Colors(true, NOTE_COLOR);
+        set_Console_Output_Colors(NOTE_COLOR, CONSOLE_COLOR_DEFAULT);
         print_str(
             "NOTE: Skipping testing for zero length transfers. This test should be done for highest compatibility "
             "testing!\n");
-        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
     }
 
     if (zeroLengthTransfers && !rwSupport->tenBytes && !rwSupport->twelveBytes && !rwSupport->sixteenBytes)
     {
-        set_Console_Colors(true, ERROR_COLOR);
+        set_Console_Output_Colors(ERROR_COLOR, CONSOLE_COLOR_DEFAULT);
         print_str("ERROR: Failed to find any support read commands by the device!\n");
-        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
         rwSupport->nonZeroSectorCountRequired = true;
-        set_Console_Colors(true, HACK_COLOR);
+        set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
         print_str("HACK FOUND: NZTL\n"); // non-zero transfer length
-        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
         scsi_Test_Unit_Ready(device, M_NULLPTR); // try to clear errors before leaving this test
         return FAILURE;
     }
@@ -6855,11 +6855,11 @@ static eReturnValues other_SCSI_Cmd_Support(tDevice* device, ptrOtherSCSICmdSupp
         return BAD_PARAMETER;
     }
 
-    set_Console_Colors(true, HEADING_COLOR);
+    set_Console_Output_Colors(HEADING_COLOR, CONSOLE_COLOR_DEFAULT);
     print_str("\n===========================\n");
     print_str("Testing Other SCSI Commands\n");
     print_str("===========================\n");
-    set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+    set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
 
     DECLARE_ZERO_INIT_ARRAY(uint8_t, scsiDataBytes, 512); // used by each command
 
@@ -6871,9 +6871,9 @@ static eReturnValues other_SCSI_Cmd_Support(tDevice* device, ptrOtherSCSICmdSupp
     }
     else
     {
-        set_Console_Colors(true, ERROR_COLOR);
+        set_Console_Output_Colors(ERROR_COLOR, CONSOLE_COLOR_DEFAULT);
         print_str("ERROR: Test unit ready command total failure. This is a critical command!\n");
-        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
     }
 
     if (SUCCESS == scsi_Report_Luns(device, 0, 256, scsiDataBytes))
@@ -6882,18 +6882,18 @@ static eReturnValues other_SCSI_Cmd_Support(tDevice* device, ptrOtherSCSICmdSupp
     }
     else
     {
-        set_Console_Colors(true, ERROR_COLOR);
+        set_Console_Output_Colors(ERROR_COLOR, CONSOLE_COLOR_DEFAULT);
         print_str("ERROR: Report LUNS failed. This is a critical command!\n");
-        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
     }
 
     if (SUCCESS == scsi_SecurityProtocol_In(device, 0, 0, false, 512, scsiDataBytes))
     {
         scsiCmds->securityProtocol                                              = true;
         device->drive_info.passThroughHacks.scsiHacks.securityProtocolSupported = true;
-        set_Console_Colors(true, HACK_COLOR);
+        set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
         print_str("HACK FOUND: SECPROT\n");
-        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
     }
     else
     {
@@ -6908,58 +6908,58 @@ static eReturnValues other_SCSI_Cmd_Support(tDevice* device, ptrOtherSCSICmdSupp
                 scsiCmds->secProtI512                                                    = true;
                 device->drive_info.passThroughHacks.scsiHacks.securityProtocolWithInc512 = true;
                 device->drive_info.passThroughHacks.scsiHacks.securityProtocolSupported  = true;
-                set_Console_Colors(true, HACK_COLOR);
+                set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
                 print_str("HACK FOUND: SECPROTI512\n");
-                set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
             }
             else
             {
-                set_Console_Colors(true, WARNING_COLOR);
+                set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
                 print_str(
                     "WARNING: Device reported in a way that suggests that security protocol commands work, but no "
                     "security protocol commands were successful\n");
-                set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
-                set_Console_Colors(true, LIKELY_HACK_COLOR);
+                set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
+                set_Console_Output_Colors(LIKELY_HACK_COLOR, CONSOLE_COLOR_DEFAULT);
                 print_str("Likely HACK FOUND: SECPROTI512\n");
-                set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                 device->drive_info.passThroughHacks.scsiHacks.securityProtocolWithInc512 = true;
                 device->drive_info.passThroughHacks.scsiHacks.securityProtocolSupported  = true;
             }
         }
         else if (does_Sense_Data_Show_Invalid_OP(device))
         {
-            set_Console_Colors(true, WARNING_COLOR);
+            set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
             print_str(
                 "WARNING: Security protocol in failed. Access to device security subsystems may be inaccessible or "
                 "limited!\n");
-            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
         }
     }
 
     if (SUCCESS == scsi_Report_Supported_Operation_Codes(device, false, 0, 0, 0, 512, scsiDataBytes))
     {
         scsiCmds->reportAllSupportedOperationCodes = true;
-        set_Console_Colors(true, HACK_COLOR);
+        set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
         print_str("HACK FOUND: REPALLOP\n");
-        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
         device->drive_info.passThroughHacks.scsiHacks.reportAllOpCodes = true;
     }
     else
     {
         if (does_Sense_Data_Show_Invalid_OP(device))
         {
-            set_Console_Colors(true, WARNING_COLOR);
+            set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
             print_str(
                 "WARNING: Reporting supported operation codes failed! This command does not appear to be known by "
                 "the device.\n");
-            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
         }
         else if (does_Sense_Data_Show_Invalid_Field_In_CDB(device))
         {
-            set_Console_Colors(true, WARNING_COLOR);
+            set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
             print_str("WARNING: Reporting all supported operation codes is not supported! Will attempt requesting a "
                       "single operation code.\n");
-            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
         }
     }
     if (!does_Sense_Data_Show_Invalid_OP(device))
@@ -6968,26 +6968,26 @@ static eReturnValues other_SCSI_Cmd_Support(tDevice* device, ptrOtherSCSICmdSupp
         if (SUCCESS == scsi_Report_Supported_Operation_Codes(device, false, 1, INQUIRY_CMD, 0, 512, scsiDataBytes))
         {
             scsiCmds->reportSingleSupportedOperationCode = true;
-            set_Console_Colors(true, HACK_COLOR);
+            set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
             print_str("HACK FOUND: SUPSOP\n");
-            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
             device->drive_info.passThroughHacks.scsiHacks.reportSingleOpCodes = true;
         }
         else
         {
-            set_Console_Colors(true, WARNING_COLOR);
+            set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
             print_str(
                 "WARNING: Reporting support for single requested operation codes failed! Unable to request command "
                 "support from the device!\n");
-            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
         }
     }
 
     if (!scsiCmds->reportAllSupportedOperationCodes && !scsiCmds->reportSingleSupportedOperationCode)
     {
-        set_Console_Colors(true, HACK_COLOR);
+        set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
         print_str("HACK FOUND: NRSUPOP\n");
-        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
         device->drive_info.passThroughHacks.scsiHacks.noReportSupportedOperations = true;
     }
 
@@ -7004,9 +7004,9 @@ static eReturnValues other_SCSI_Cmd_Support(tDevice* device, ptrOtherSCSICmdSupp
     }
     else
     {
-        set_Console_Colors(true, WARNING_COLOR);
+        set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
         print_str("WARNING: Default self-test is not available.\n");
-        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
     }
 
     // TODO: add testing for diagnostic pages (try to get a list of pages)
@@ -7022,11 +7022,11 @@ static eReturnValues scsi_Error_Handling_Test(tDevice* device, double* badComman
         return BAD_PARAMETER;
     }
     scsi_Test_Unit_Ready(device, M_NULLPTR);
-    set_Console_Colors(true, HEADING_COLOR);
+    set_Console_Output_Colors(HEADING_COLOR, CONSOLE_COLOR_DEFAULT);
     print_str("\n==============================================\n");
     print_str("Testing Error Handling Of Unsupported Commands\n");
     print_str("==============================================\n");
-    set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+    set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
 
 // need to figure out commands to try, and time each and everyone.
 // Start with determining a baseline from a 3-4 commands (TUR after each)
@@ -7111,27 +7111,27 @@ static eReturnValues scsi_Error_Handling_Test(tDevice* device, double* badComman
         // Checking the last one because it is the most important. For this test, it should get much MUCH longer quickly
         // and stay that way.
         device->drive_info.passThroughHacks.turfValue = C_CAST(uint8_t, round(xTimesHigher));
-        set_Console_Colors(true, HACK_COLOR);
+        set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
         printf("HACK FOUND: TURF%" PRIu8 "\n", device->drive_info.passThroughHacks.turfValue);
-        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
         device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
         scsi_Test_Unit_Ready(device, M_NULLPTR);
     }
     else if (ret == OS_PASSTHROUGH_FAILURE)
     {
-        set_Console_Colors(true, LIKELY_HACK_COLOR);
+        set_Console_Output_Colors(LIKELY_HACK_COLOR, CONSOLE_COLOR_DEFAULT);
         printf("Likely HACK FOUND: TURF%" PRIu8 "\n", 33); // setting 33...this should be sooo much higher and worse
                                                            // that this should remain true for a long long time.
-        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
         device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
         device->drive_info.passThroughHacks.turfValue                           = 33;
         scsi_Test_Unit_Ready(device, M_NULLPTR);
     }
     else if (averageFromBadCommands == 0)
     {
-        set_Console_Colors(true, LIKELY_HACK_COLOR);
+        set_Console_Output_Colors(LIKELY_HACK_COLOR, CONSOLE_COLOR_DEFAULT);
         printf("Likely HACK FOUND: TURF%" PRIu8 "\n", 34); // setting 34...this helps differentiate from the issue above
-        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
         device->drive_info.passThroughHacks.testUnitReadyAfterAnyCommandFailure = true;
         device->drive_info.passThroughHacks.turfValue                           = 34;
         scsi_Test_Unit_Ready(device, M_NULLPTR);
@@ -7146,11 +7146,11 @@ static eReturnValues sct_GPL_Test(tDevice* device, bool smartSupported, bool gpl
     {
         return BAD_PARAMETER;
     }
-    set_Console_Colors(true, HEADING_COLOR);
+    set_Console_Output_Colors(HEADING_COLOR, CONSOLE_COLOR_DEFAULT);
     print_str("\n============\n");
     print_str("SCT-GPL Test\n");
     print_str("============\n");
-    set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+    set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
     if (sctSupported && smartSupported && gplSupported)
     {
         bool smartWorked = false;
@@ -7171,9 +7171,9 @@ static eReturnValues sct_GPL_Test(tDevice* device, bool smartSupported, bool gpl
         }
         else
         {
-            set_Console_Colors(true, ERROR_COLOR);
+            set_Console_Output_Colors(ERROR_COLOR, CONSOLE_COLOR_DEFAULT);
             print_str("ERROR: Something went wrong trying to read the SCT status log!!!\n");
-            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
         }
         // now GPL
         print_str("\tTesting with read log ext\n");
@@ -7190,17 +7190,17 @@ static eReturnValues sct_GPL_Test(tDevice* device, bool smartSupported, bool gpl
         {
             if (smartWorked)
             {
-                set_Console_Colors(true, HACK_COLOR);
+                set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
                 print_str("HACK FOUND: SCTSM\n");
-                set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                 print_str("\t\tA retest is recommended with this test turned off. Devices with this hack\n");
                 print_str("\t\toften do not recover properly and need a full power cycle once this issue is\n");
                 print_str("\t\ttested and identified.\n");
                 device->drive_info.passThroughHacks.ataPTHacks.smartCommandTransportWithSMARTLogCommandsOnly = true;
             }
-            set_Console_Colors(true, ERROR_COLOR);
+            set_Console_Output_Colors(ERROR_COLOR, CONSOLE_COLOR_DEFAULT);
             print_str("ERROR: Something went wrong trying to read the SCT status log!!!\n");
-            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
         }
         return SUCCESS;
     }
@@ -7585,9 +7585,9 @@ static eReturnValues sat_Ext_Cmd_With_A1_When_Possible_Test(tDevice* device)
         if (SUCCESS == ata_Read_Log_Ext(device, ATA_LOG_DIRECTORY, 0, log, 512, false, 0))
         {
             // TODO: Validate the return data???
-            set_Console_Colors(true, HACK_COLOR);
+            set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
             print_str("HACK FOUND: A1EXT\n");
-            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
             ret = SUCCESS;
         }
         else
@@ -7601,11 +7601,11 @@ static eReturnValues sat_Ext_Cmd_With_A1_When_Possible_Test(tDevice* device)
 
 static bool test_SAT_Capabilities(ptrPassthroughTestParams inputs, ptrScsiDevInformation scsiInformation)
 {
-    set_Console_Colors(true, HEADING_COLOR);
+    set_Console_Output_Colors(HEADING_COLOR, CONSOLE_COLOR_DEFAULT);
     print_str("\n=====================================\n");
     print_str("Checking SAT ATA-passthrough commands\n");
     print_str("=====================================\n");
-    set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+    set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
     bool satSupported         = false;
     bool twelveByteSupported  = false;
     bool sixteenByteSupported = false;
@@ -7649,16 +7649,16 @@ static bool test_SAT_Capabilities(ptrPassthroughTestParams inputs, ptrScsiDevInf
     {
         if (twelveByteSupported)
         {
-            set_Console_Colors(true, HACK_COLOR);
+            set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
             print_str("HACK FOUND: A1\n"); // useA1SATPassthroughWheneverPossible
-            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
             // inputs->device->drive_info.passThroughHacks.ataPTHacks.useA1SATPassthroughWheneverPossible = true;
         }
         else if (!twelveByteSupported && sixteenByteSupported)
         {
-            set_Console_Colors(true, HACK_COLOR);
+            set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
             print_str("HACK FOUND: NA1\n"); // a1NeverSupported
-            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
             inputs->device->drive_info.passThroughHacks.ataPTHacks.a1NeverSupported = true;
         }
 
@@ -7732,16 +7732,16 @@ static bool test_SAT_Capabilities(ptrPassthroughTestParams inputs, ptrScsiDevInf
         else if (!sixteenByteSupported &&
                  inputs->device->drive_info.ata_Options.fourtyEightBitAddressFeatureSetSupported)
         {
-            set_Console_Colors(true, WARNING_COLOR);
+            set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
             print_str("WARNING: This device is not able to pass-through 48 bit (extended) commands!\n");
-            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
         }
 
         if (twelveByteSupported && !sixteenByteSupported)
         {
-            set_Console_Colors(true, HACK_COLOR);
+            set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
             print_str("HACK FOUND: ATA28\n");
-            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
             inputs->device->drive_info.passThroughHacks.ataPTHacks.ata28BitOnly = true;
         }
 
@@ -7768,15 +7768,15 @@ static bool test_SAT_Capabilities(ptrPassthroughTestParams inputs, ptrScsiDevInf
                     ata_Read_Sectors(inputs->device, 0, data, 1, inputs->device->drive_info.deviceBlockSize * 1, use48);
                 if (SUCCESS == tpsiuRet && !does_Sense_Data_Show_Invalid_Field_In_CDB(inputs->device))
                 {
-                    set_Console_Colors(true, HACK_COLOR);
+                    set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
                     print_str("HACK FOUND: TPSIU\n"); // alwaysUseTPSIUForSATPassthrough
-                    set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                    set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                 }
                 else
                 {
-                    set_Console_Colors(true, HACK_COLOR);
+                    set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
                     print_str("HACK FOUND: TPID\n");
-                    set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                    set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                     inputs->device->drive_info.passThroughHacks.ataPTHacks.limitedUseTPSIU                 = true;
                     inputs->device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough = false;
                 }
@@ -7784,9 +7784,9 @@ static bool test_SAT_Capabilities(ptrPassthroughTestParams inputs, ptrScsiDevInf
             }
             else
             {
-                set_Console_Colors(true, WARNING_COLOR);
+                set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
                 print_str("WARNING: Unable to allocate memory and fully test TPSIU capability.\n");
-                set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                 inputs->device->drive_info.passThroughHacks.ataPTHacks.alwaysUseTPSIUForSATPassthrough = false;
             }
         }
@@ -7812,22 +7812,22 @@ static bool test_SAT_Capabilities(ptrPassthroughTestParams inputs, ptrScsiDevInf
             }
             else if (inputs->device->drive_info.passThroughHacks.ataPTHacks.multiSectorPIOWithMultipleMode)
             {
-                set_Console_Colors(true, HACK_COLOR);
+                set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
                 print_str("HACK FOUND: MMPIO\n");
-                set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
             }
             else if (inputs->device->drive_info.passThroughHacks.ataPTHacks.singleSectorPIOOnly)
             {
-                set_Console_Colors(true, HACK_COLOR);
+                set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
                 print_str("HACK FOUND: SPIO\n");
-                set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
             }
         }
         else
         {
-            set_Console_Colors(true, LIKELY_HACK_COLOR);
+            set_Console_Output_Colors(LIKELY_HACK_COLOR, CONSOLE_COLOR_DEFAULT);
             print_str("HACK FOUND: SPIO\n");
-            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
             inputs->device->drive_info.passThroughHacks.ataPTHacks.singleSectorPIOOnly = true;
         }
 
@@ -7855,11 +7855,11 @@ static bool test_SAT_Capabilities(ptrPassthroughTestParams inputs, ptrScsiDevInf
                          inputs->device->drive_info.ata_Options.generalPurposeLoggingSupported, sctSupported);
         }
 
-        set_Console_Colors(true, HEADING_COLOR);
+        set_Console_Output_Colors(HEADING_COLOR, CONSOLE_COLOR_DEFAULT);
         print_str("\n====================================\n");
         print_str("Comparing ATA and SCSI reported data\n");
         print_str("====================================\n");
-        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
         // Here we will compare the reported information by the bridge from SCSI commands to what the ATA Identify data
         // reports. For MN, SN, FW, check for commonly broken reporting methods.
 #define PASSTHROUGH_TEST_SCSI_PROD_ID_LEN 17
@@ -7874,10 +7874,10 @@ static bool test_SAT_Capabilities(ptrPassthroughTestParams inputs, ptrScsiDevInf
         }
         else
         {
-            set_Console_Colors(true, WARNING_COLOR);
+            set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
             printf("\tWARNING: Non-SAT Compliant product ID reported. This may be a \"branded\" product or "
                    "non-compliant translator.\n");
-            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
             print_str("\t  Checking common non-compliant reporting.\n");
             if (strstr(inputs->device->drive_info.bridge_info.childDriveMN, scsiInformation->inquiryData.productId) &&
                 strstr(inputs->device->drive_info.bridge_info.childDriveMN, scsiInformation->inquiryData.vendorId))
@@ -7927,25 +7927,25 @@ static bool test_SAT_Capabilities(ptrPassthroughTestParams inputs, ptrScsiDevInf
                 le16_to_host(inputs->device->drive_info.IdentifyData.ata.Word217) !=
                     scsiInformation->vpdData.blockCharacteristicsData.rotationRate)
             {
-                set_Console_Colors(true, WARNING_COLOR);
+                set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
                 printf("WARNING: Rotation rate doesn't Match! Got %" PRIu16 ", expected %" PRIu16 "\n",
                        scsiInformation->vpdData.blockCharacteristicsData.rotationRate,
                        inputs->device->drive_info.IdentifyData.ata.Word217);
-                set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                 byte_Swap_16(&scsiInformation->vpdData.blockCharacteristicsData.rotationRate);
                 if (le16_to_host(inputs->device->drive_info.IdentifyData.ata.Word217) !=
                     scsiInformation->vpdData.blockCharacteristicsData.rotationRate)
                 {
-                    set_Console_Colors(true, ERROR_COLOR);
+                    set_Console_Output_Colors(ERROR_COLOR, CONSOLE_COLOR_DEFAULT);
                     print_str("ERROR: Even after byteswapping, the rotation rate still doesn't match!!!\n");
-                    set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                    set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                 }
                 else
                 {
-                    set_Console_Colors(true, WARNING_COLOR);
+                    set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
                     print_str("It seems like the RPM was reported without byteswapping it first! Fix this in the "
                               "translator firmware!\n");
-                    set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                    set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                 }
             }
 
@@ -7955,11 +7955,11 @@ static bool test_SAT_Capabilities(ptrPassthroughTestParams inputs, ptrScsiDevInf
                 M_Nibble0(inputs->device->drive_info.IdentifyData.ata.Word168) !=
                     scsiInformation->vpdData.blockCharacteristicsData.formFactor)
             {
-                set_Console_Colors(true, ERROR_COLOR);
+                set_Console_Output_Colors(ERROR_COLOR, CONSOLE_COLOR_DEFAULT);
                 printf("ERROR: Formfactor doesn't match! Got %" PRIu8 ", expected %" PRIu8 "\n",
                        scsiInformation->vpdData.blockCharacteristicsData.formFactor,
                        M_Nibble0(inputs->device->drive_info.IdentifyData.ata.Word168));
-                set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
             }
         }
 
@@ -8004,16 +8004,16 @@ static bool test_SAT_Capabilities(ptrPassthroughTestParams inputs, ptrScsiDevInf
                 }
                 if (!foundMatch)
                 {
-                    set_Console_Colors(true, ERROR_COLOR);
+                    set_Console_Output_Colors(ERROR_COLOR, CONSOLE_COLOR_DEFAULT);
                     print_str("ERROR: WWN was not found in device identification VPD page!\n");
-                    set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                    set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                 }
             }
             else
             {
-                set_Console_Colors(true, WARNING_COLOR);
+                set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
                 print_str("WARNING: Device didn't report device ID VPD page, cannot check for WWN translation!\n");
-                set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
             }
         }
 
@@ -8032,12 +8032,12 @@ static bool test_SAT_Capabilities(ptrPassthroughTestParams inputs, ptrScsiDevInf
 static bool test_Legacy_ATA_Passthrough(ptrPassthroughTestParams inputs, ptrScsiDevInformation scsiInformation)
 {
     bool legacyATAPassthroughSupported = false;
-    set_Console_Colors(true, HEADING_COLOR);
+    set_Console_Output_Colors(HEADING_COLOR, CONSOLE_COLOR_DEFAULT);
     print_str("\n====================================================================\n");
     print_str("Testing For Legacy ATA Passthrough Support With Known Legacy Methods\n");
     print_str("====================================================================\n");
-    set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
-    set_Console_Colors(true, WARNING_COLOR);
+    set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
+    set_Console_Output_Colors(WARNING_COLOR, CONSOLE_COLOR_DEFAULT);
     print_str("WARNING! Legacy ATA Passthrough methods use vendor unique operation codes!\n");
     print_str("         Sometimes these operation code will cause problems on devices where\n");
     print_str("         these operation codes have different meanings!\n");
@@ -8054,7 +8054,7 @@ static bool test_Legacy_ATA_Passthrough(ptrPassthroughTestParams inputs, ptrScsi
         delay_Seconds(1);
     }
     print_str("\n");
-    set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+    set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
 
     // Now that the users have been warned, it's time to try the different legacy methods until we get a successful
     // identify command through to the device.
@@ -8095,16 +8095,16 @@ static bool test_Legacy_ATA_Passthrough(ptrPassthroughTestParams inputs, ptrScsi
     }
     if (inputs->device->drive_info.passThroughHacks.passthroughType != ATA_PASSTHROUGH_UNKNOWN)
     {
-        set_Console_Colors(true, HACK_COLOR);
+        set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
         print_str("HACK FOUND: passthrough type seems to be \n"); // no passthrough available at all
         switch (inputs->device->drive_info.passThroughHacks.passthroughType)
         {
         case ATA_PASSTHROUGH_CYPRESS:
             print_str("Cypress\n");
             inputs->device->drive_info.passThroughHacks.ataPTHacks.ata28BitOnly = true;
-            set_Console_Colors(true, HACK_COLOR);
+            set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
             print_str("HACK FOUND: ATA28\n");
-            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
             break;
         case ATA_PASSTHROUGH_PROLIFIC:
             print_str("Prolific\n");
@@ -8113,9 +8113,9 @@ static bool test_Legacy_ATA_Passthrough(ptrPassthroughTestParams inputs, ptrScsi
             print_str("TI\n");
             inputs->device->drive_info.passThroughHacks.ataPTHacks.ata28BitOnly           = true;
             inputs->device->drive_info.passThroughHacks.ataPTHacks.noMultipleModeCommands = true;
-            set_Console_Colors(true, HACK_COLOR);
+            set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
             print_str("HACK FOUND: ATA28\n");
-            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
             break;
         case ATA_PASSTHROUGH_NEC:
             print_str("NEC\n");
@@ -8127,7 +8127,7 @@ static bool test_Legacy_ATA_Passthrough(ptrPassthroughTestParams inputs, ptrScsi
             print_str("Unknown legacy device type! This means the passthrough test code needs updating!\n");
             break;
         }
-        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
         legacyATAPassthroughSupported = true;
         bool smartSupported           = false;
         bool smartLoggingSupported    = false;
@@ -8154,24 +8154,24 @@ static bool test_Legacy_ATA_Passthrough(ptrPassthroughTestParams inputs, ptrScsi
             }
             else if (inputs->device->drive_info.passThroughHacks.ataPTHacks.multiSectorPIOWithMultipleMode)
             {
-                set_Console_Colors(true, HACK_COLOR);
+                set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
                 print_str("HACK FOUND: MMPIO\n");
-                set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
             }
             else if (inputs->device->drive_info.passThroughHacks.ataPTHacks.singleSectorPIOOnly)
             {
-                set_Console_Colors(true, HACK_COLOR);
+                set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
                 print_str("HACK FOUND: SPIO\n");
-                set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
             }
         }
         // TODO: additional testing here for legacy capabilities!
     }
     else
     {
-        set_Console_Colors(true, HACK_COLOR);
+        set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
         print_str("HACK FOUND: NOPT\n"); // no passthrough available at all
-        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
         inputs->device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_UNKNOWN;
     }
     return legacyATAPassthroughSupported;
@@ -8193,20 +8193,20 @@ static eReturnValues scsi_Max_Transfer_Length_Test(tDevice* device, uint32_t rep
     size_t   dataBufSize = uint32_to_sizet(maxTestSizeBlocks) * uint32_to_sizet(device->drive_info.deviceBlockSize);
     uint8_t* data        = M_REINTERPRET_CAST(
         uint8_t*, safe_calloc_aligned(dataBufSize, sizeof(uint8_t), device->os_info.minimumAlignment));
-    set_Console_Colors(true, HEADING_COLOR);
+    set_Console_Output_Colors(HEADING_COLOR, CONSOLE_COLOR_DEFAULT);
     print_str("\n==================================\n");
     print_str("Testing SCSI Maximum Transfer Size\n");
     print_str("==================================\n");
-    set_Console_Colors(true, NOTE_COLOR);
+    set_Console_Output_Colors(NOTE_COLOR, CONSOLE_COLOR_DEFAULT);
     printf("NOTE: This is currently limited to %" PRIu32 " sectors for now\n", maxTestSizeBlocks);
-    set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+    set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
     if (!data)
     {
-        set_Console_Colors(true, ERROR_COLOR);
+        set_Console_Output_Colors(ERROR_COLOR, CONSOLE_COLOR_DEFAULT);
         printf("Fatal error, unable to allocate %" PRIu32
                " sectors worth of memory to perform SCSI pass-through test.\n",
                maxTestSizeBlocks);
-        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
         return MEMORY_FAILURE;
     }
     // start at 1 sector, then double until 32k. From here, increment one sector at a time since most USB devices only
@@ -8535,20 +8535,20 @@ static eReturnValues ata_Passthrough_Max_Transfer_Length_Test(tDevice* device,
         uint32_to_sizet(maxTestSizeBlocks) * uint32_to_sizet(device->drive_info.bridge_info.childDeviceBlockSize);
     uint8_t* data = M_REINTERPRET_CAST(
         uint8_t*, safe_calloc_aligned(dataBufSize, sizeof(uint8_t), device->os_info.minimumAlignment));
-    set_Console_Colors(true, HEADING_COLOR);
+    set_Console_Output_Colors(HEADING_COLOR, CONSOLE_COLOR_DEFAULT);
     print_str("\n=============================================\n");
     print_str("Testing ATA Pass-through Maximum transfer size\n");
     print_str("=============================================\n");
-    set_Console_Colors(true, NOTE_COLOR);
+    set_Console_Output_Colors(NOTE_COLOR, CONSOLE_COLOR_DEFAULT);
     printf("NOTE: This is currently limited to %" PRIu32 " sectors for now\n", maxTestSizeBlocks);
-    set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+    set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
     if (!data)
     {
-        set_Console_Colors(true, ERROR_COLOR);
+        set_Console_Output_Colors(ERROR_COLOR, CONSOLE_COLOR_DEFAULT);
         printf("Fatal error, unable to allocate %" PRIu32
                " sectors worth of memory to perform ATA pass-through test.\n",
                maxTestSizeBlocks);
-        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
         return MEMORY_FAILURE;
     }
     // start at 1 sector, then double until 32k. From here, increment one sector at a time since most USB devices only
@@ -8666,11 +8666,11 @@ eReturnValues perform_Passthrough_Test(ptrPassthroughTestParams inputs)
             if (strncmp(scsiInformation.inquiryData.vendorId, "NVMe", 4) == 0 ||
                 inputs->suspectedDriveType == NVME_DRIVE) // NVMe
             {
-                set_Console_Colors(true, HEADING_COLOR);
+                set_Console_Output_Colors(HEADING_COLOR, CONSOLE_COLOR_DEFAULT);
                 print_str("\n==================================================\n");
                 print_str("Checking Vendor Specific NVMe-passthrough commands\n");
                 print_str("==================================================\n");
-                set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                 // TODO: If given a specific NVMe passthrough type, only test that
                 inputs->device->drive_info.passThroughHacks.passthroughType = NVME_PASSTHROUGH_UNKNOWN;
                 if (inputs->device->drive_info.interface_type != NVME_INTERFACE)
@@ -8693,15 +8693,15 @@ eReturnValues perform_Passthrough_Test(ptrPassthroughTestParams inputs)
                     switch (inputs->device->drive_info.passThroughHacks.passthroughType)
                     {
                     case NVME_PASSTHROUGH_JMICRON:
-                        set_Console_Colors(true, HACK_COLOR);
+                        set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
                         print_str("HACK FOUND: JMNVME\n");
-                        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                         break;
                     case NVME_PASSTHROUGH_ASMEDIA_BASIC:
-                        set_Console_Colors(true, HACK_COLOR);
+                        set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
                         print_str("HACK FOUND: ASMNVMEBASIC\n");
                         print_str("HACK FOUND: IDGLP\n");
-                        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                         inputs->device->drive_info.passThroughHacks.nvmePTHacks.limitedPassthroughCapabilities = true;
                         inputs->device->drive_info.passThroughHacks.nvmePTHacks.limitedCommandsSupported
                             .identifyController = true;
@@ -8711,9 +8711,9 @@ eReturnValues perform_Passthrough_Test(ptrPassthroughTestParams inputs)
                             true;
                         break;
                     case NVME_PASSTHROUGH_ASMEDIA:
-                        set_Console_Colors(true, HACK_COLOR);
+                        set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
                         print_str("HACK FOUND: ASMNVME\n");
-                        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                         break;
                     default:
                         print_str("No NVMe pass-through detected for this device!\n");
@@ -8728,18 +8728,18 @@ eReturnValues perform_Passthrough_Test(ptrPassthroughTestParams inputs)
                 // TODO: need to move this SAT testing to another function.
                 if (!test_SAT_Capabilities(inputs, &scsiInformation))
                 {
-                    set_Console_Colors(true, ERROR_COLOR);
+                    set_Console_Output_Colors(ERROR_COLOR, CONSOLE_COLOR_DEFAULT);
                     print_str("ERROR: SAT Pass-through failed both 12B and 16B CDBs.\n");
-                    set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                    set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                     if (inputs->allowLegacyATAPTTest)
                     {
                         test_Legacy_ATA_Passthrough(inputs, &scsiInformation);
                     }
                     else
                     {
-                        set_Console_Colors(true, HACK_COLOR);
+                        set_Console_Output_Colors(HACK_COLOR, CONSOLE_COLOR_DEFAULT);
                         print_str("HACK FOUND: NOPT\n"); // no passthrough available at all
-                        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                         inputs->device->drive_info.passThroughHacks.passthroughType = ATA_PASSTHROUGH_UNKNOWN;
                     }
                 }
@@ -8753,19 +8753,19 @@ eReturnValues perform_Passthrough_Test(ptrPassthroughTestParams inputs)
         }
         else
         {
-            set_Console_Colors(true, NOTE_COLOR);
+            set_Console_Output_Colors(NOTE_COLOR, CONSOLE_COLOR_DEFAULT);
             print_str("NOTE: Attempting passthrough CDBs for SAT or a vendor unique methods has been disabled and is "
                       "being skipped.\n");
-            set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+            set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
         }
 
         // Finally. Display the results and which hacks were found while testing the device.
 
-        set_Console_Colors(true, HEADING_COLOR);
+        set_Console_Output_Colors(HEADING_COLOR, CONSOLE_COLOR_DEFAULT);
         print_str("\n\n==================\n");
         print_str("Final Test Results\n");
         print_str("==================\n");
-        set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+        set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
         print_str("SEND THIS INFO BELOW TO seaboard@seagate.com:\n");
         // low-level OS device VID/PID/REV as available
         if (inputs->device->drive_info.adapter_info.infoType != ADAPTER_INFO_UNKNOWN)
@@ -8960,9 +8960,9 @@ eReturnValues perform_Passthrough_Test(ptrPassthroughTestParams inputs)
         {
             if (!inputs->hangCommandsToTest.zeroLengthReads)
             {
-                set_Console_Colors(true, LIKELY_HACK_COLOR);
+                set_Console_Output_Colors(LIKELY_HACK_COLOR, CONSOLE_COLOR_DEFAULT);
                 print_str(" NORWZ,");
-                set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
             }
         }
         if (inputs->device->drive_info.passThroughHacks.scsiHacks.maxTransferLength <
@@ -9098,10 +9098,10 @@ eReturnValues perform_Passthrough_Test(ptrPassthroughTestParams inputs)
             {
                 if (!inputs->hangCommandsToTest.sctLogWithGPL)
                 {
-                    set_Console_Colors(true, LIKELY_HACK_COLOR);
+                    set_Console_Output_Colors(LIKELY_HACK_COLOR, CONSOLE_COLOR_DEFAULT);
                     print_str(" SCTSM,"); // -please retest to ensure that reading the SCT status log with GPL commands
                                           // is indeed a necessary hack");
-                    set_Console_Colors(true, CONSOLE_COLOR_DEFAULT);
+                    set_Console_Output_Colors(CONSOLE_COLOR_DEFAULT, CONSOLE_COLOR_DEFAULT);
                 }
             }
             if (inputs->device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength <
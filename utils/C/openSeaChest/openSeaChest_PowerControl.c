@@ -18,15 +18,19 @@
 #include "common_types.h"
 #include "io_utils.h"
 #include "memory_safety.h"
+#include "precision_timer.h"
 #include "string_utils.h"
 #include "time_utils.h"
 #include "type_conversion.h"
 #include "unit_conversion.h"
 
 #include "EULA.h"
+#include "cmds.h" //for verify_LBA
 #include "drive_info.h"
 #include "getopt.h"
+#include "openseachest_json.h"
 #include "openseachest_util_options.h"
+#include "openseachest_util_threads.h"
 #include "operations.h"
 #include "power_control.h"
 #include "seagate_operations.h"                  //for power telemetry
@@ -36,11 +40,975 @@
 ////////////////////////
 const char* util_name    = "openSeaChest_PowerControl";
 #define buildVersion UTIL_BUILD_VERSION
+// options that have a section in the --jsonOutput document
+#define JSON_OUTPUT_OPTIONS "-i, --showEPCSettings"
 
 ////////////////////////////
 //  functions to declare  //
 ////////////////////////////
 static void utility_Usage(bool shortUsage);
+
+#define POWER_SAMPLE_RING_SAMPLES   UINT32_C(8192)
+#define POWER_SAMPLE_FLUSH_SECONDS  UINT64_C(300)
+#define POWER_SAMPLE_WINDOW_SECONDS UINT32_C(60)
+#define POWER_SAMPLE_MINIMUM_WINDOW UINT32_C(22) // the drive measures for at least 22 seconds
+#define POWER_SAMPLE_SETTLE_SECONDS UINT32_C(2)  // time for the drive to close the window before it is read
+#define POWER_SAMPLE_VERSION        UINT16_C(1)
+#define POWER_SAMPLE_HEADER_SIZE    SIZE_T_C(64)
+#define POWER_SAMPLE_RECORD_SIZE    SIZE_T_C(8)
+#define POWER_SAMPLE_SERIAL_LENGTH  SIZE_T_C(32)
+#define POWER_SAMPLE_EXTENSION      "ospw"
+#define POWER_SAMPLE_TIME_LENGTH    SIZE_T_C(32)
+
+#if defined(_WIN32)
+#    define POWER_SAMPLE_PATH_SEPARATOR '\\'
+#else
+#    define POWER_SAMPLE_PATH_SEPARATOR '/'
+#endif
+
+// Power sample files are little endian. The file starts with a 64 byte header:
+//   0  "OSCPOWER"     8 byte signature
+//   8  version        uint16, 1
+//   10 header size    uint16, 64
+//   12 record size    uint16, 8
+//   14 mode           uint8, 0 = 5v and 12v, 5 = 5v only, 12 = 12v only
+//   15 reserved       uint8
+//   16 serial number  32 bytes, zero padded
+//   48 started        uint64, seconds since the epoch
+//   56 reserved       8 bytes
+// Each record is a uint32 of milliseconds since started, then uint16 5v milliwatts and uint16 12v milliwatts.
+typedef struct s_powerSampleDrive
+{
+    tDevice*        device;
+    secureFileInfo* file;
+    uint8_t*        ring;    // POWER_SAMPLE_RING_SAMPLES records, encoded as they are written to the file
+    uint32_t        head;    // oldest record not written to the file yet
+    uint32_t        pending; // records waiting to be written
+    bool            active;
+    uint64_t        count;
+    uint64_t        fiveVoltTotal;
+    uint64_t        twelveVoltTotal;
+    uint16_t        fiveVoltMinimum;
+    uint16_t        fiveVoltMaximum;
+    uint16_t        twelveVoltMinimum;
+    uint16_t        twelveVoltMaximum;
+} powerSampleDrive;
+
+static void set_Power_Sample_Little_Endian_Value(uint8_t* data, uint8_t length, uint64_t value)
+{
+    for (uint8_t byteIter = UINT8_C(0); byteIter < length; ++byteIter)
+    {
+        data[byteIter] = M_Byte0(value >> (byteIter * 8));
+    }
+}
+
+static eReturnValues open_Power_Sample_File(powerSampleDrive* drive,
+                                            const char*       directory,
+                                            uint8_t           mode,
+                                            uint64_t          started)
+{
+    size_t serialLen = safe_strlen(drive->device->drive_info.serialNumber);
+    size_t nameLen   = SIZE_T_C(0);
+    time_t    startTime = C_CAST(time_t, started);
+    struct tm startedTM;
+    DECLARE_ZERO_INIT_ARRAY(char, serialNumber, POWER_SAMPLE_SERIAL_LENGTH + 1);
+    DECLARE_ZERO_INIT_ARRAY(char, timeString, POWER_SAMPLE_TIME_LENGTH);
+    DECLARE_ZERO_INIT_ARRAY(char, fileName, OPENSEA_PATH_MAX);
+    DECLARE_ZERO_INIT_ARRAY(uint8_t, header, POWER_SAMPLE_HEADER_SIZE);
+    for (size_t iter = SIZE_T_C(0); iter < serialLen && nameLen < POWER_SAMPLE_SERIAL_LENGTH; ++iter)
+    {
+        char character = drive->device->drive_info.serialNumber[iter];
+        if (safe_isalnum(character) || character == '-' || character == '_')
+        {
+            serialNumber[nameLen++] = character;
+        }
+    }
+    if (nameLen == SIZE_T_C(0))
+    {
+        return BAD_PARAMETER;
+    }
+    // the start time is part of the name so a new capture never replaces an earlier one
+    safe_memset(&startedTM, sizeof(struct tm), 0, sizeof(struct tm));
+    if (safe_localtime(&startTime, &startedTM) == M_NULLPTR ||
+        strftime(timeString, POWER_SAMPLE_TIME_LENGTH, "%Y-%m-%d__%H_%M_%S", &startedTM) == SIZE_T_C(0))
+    {
+        snprintf_err_handle(timeString, POWER_SAMPLE_TIME_LENGTH, "%" PRIu64, started);
+    }
+    if (directory != M_NULLPTR && safe_strlen(directory) > SIZE_T_C(0))
+    {
+        snprintf_err_handle(fileName, OPENSEA_PATH_MAX, "%s%c%s_%s.%s", directory, POWER_SAMPLE_PATH_SEPARATOR,
+                            serialNumber, timeString, POWER_SAMPLE_EXTENSION);
+    }
+    else
+    {
+        snprintf_err_handle(fileName, OPENSEA_PATH_MAX, "%s_%s.%s", serialNumber, timeString, POWER_SAMPLE_EXTENSION);
+    }
+    drive->ring = C_CAST(uint8_t*, safe_calloc(POWER_SAMPLE_RING_SAMPLES * POWER_SAMPLE_RECORD_SIZE, sizeof(uint8_t)));
+    if (drive->ring == M_NULLPTR)
+    {
+        return MEMORY_FAILURE;
+    }
+    drive->file = secure_Open_File(fileName, "wb", M_NULLPTR, M_NULLPTR, M_NULLPTR);
+    if (drive->file == M_NULLPTR || drive->file->error != SEC_FILE_SUCCESS)
+    {
+        eReturnValues ret = FILE_OPEN_ERROR;
+        if (drive->file != M_NULLPTR && drive->file->error == SEC_FILE_INSECURE_PATH)
+        {
+            ret = INSECURE_PATH;
+        }
+        free_Secure_File_Info(&drive->file);
+        return ret;
+    }
+    safe_memcpy(header, POWER_SAMPLE_HEADER_SIZE, "OSCPOWER", 8);
+    set_Power_Sample_Little_Endian_Value(&header[8], UINT8_C(2), POWER_SAMPLE_VERSION);
+    set_Power_Sample_Little_Endian_Value(&header[10], UINT8_C(2), POWER_SAMPLE_HEADER_SIZE);
+    set_Power_Sample_Little_Endian_Value(&header[12], UINT8_C(2), POWER_SAMPLE_RECORD_SIZE);
+    header[14] = mode;
+    safe_memcpy(&header[16], POWER_SAMPLE_SERIAL_LENGTH, serialNumber, nameLen);
+    set_Power_Sample_Little_Endian_Value(&header[48], UINT8_C(8), started);
+    if (SEC_FILE_SUCCESS != secure_Write_File(drive->file, header, POWER_SAMPLE_HEADER_SIZE, sizeof(uint8_t),
+                                              POWER_SAMPLE_HEADER_SIZE, M_NULLPTR))
+    {
+        return ERROR_WRITING_FILE;
+    }
+    drive->active = true;
+    return SUCCESS;
+}
+
+// Writes every pending record, the part up to the end of the ring first, then the part that wrapped around.
+static eReturnValues flush_Power_Samples(powerSampleDrive* drive)
+{
+    uint32_t first  = M_Min(drive->pending, POWER_SAMPLE_RING_SAMPLES - drive->head);
+    uint32_t second = drive->pending - first;
+    if (drive->pending == UINT32_C(0))
+    {
+        return SUCCESS;
+    }
+    if (SEC_FILE_SUCCESS != secure_Write_File(drive->file, &drive->ring[drive->head * POWER_SAMPLE_RECORD_SIZE],
+                                              POWER_SAMPLE_RING_SAMPLES * POWER_SAMPLE_RECORD_SIZE, sizeof(uint8_t),
+                                              first * POWER_SAMPLE_RECORD_SIZE, M_NULLPTR) ||
+        (second > UINT32_C(0) &&
+         SEC_FILE_SUCCESS != secure_Write_File(drive->file, drive->ring,
+                                               POWER_SAMPLE_RING_SAMPLES * POWER_SAMPLE_RECORD_SIZE, sizeof(uint8_t),
+                                               second * POWER_SAMPLE_RECORD_SIZE, M_NULLPTR)) ||
+        SEC_FILE_SUCCESS != secure_Flush_File(drive->file))
+    {
+        return ERROR_WRITING_FILE;
+    }
+    drive->head    = (drive->head + drive->pending) % POWER_SAMPLE_RING_SAMPLES;
+    drive->pending = UINT32_C(0);
+    return SUCCESS;
+}
+
+// The ring is only written out early when it fills, so no sample is dropped between flushes.
+static eReturnValues add_Power_Sample(powerSampleDrive* drive,
+                                      uint64_t          milliseconds,
+                                      uint16_t          fiveVoltMilliWatts,
+                                      uint16_t          twelveVoltMilliWatts)
+{
+    uint8_t* record = M_NULLPTR;
+    if (drive->pending == POWER_SAMPLE_RING_SAMPLES)
+    {
+        eReturnValues ret = flush_Power_Samples(drive);
+        if (ret != SUCCESS)
+        {
+            return ret;
+        }
+    }
+    record = &drive->ring[((drive->head + drive->pending) % POWER_SAMPLE_RING_SAMPLES) * POWER_SAMPLE_RECORD_SIZE];
+    set_Power_Sample_Little_Endian_Value(&record[0], UINT8_C(4), M_Min(milliseconds, UINT32_MAX));
+    set_Power_Sample_Little_Endian_Value(&record[4], UINT8_C(2), fiveVoltMilliWatts);
+    set_Power_Sample_Little_Endian_Value(&record[6], UINT8_C(2), twelveVoltMilliWatts);
+    ++drive->pending;
+    if (drive->count == UINT64_C(0))
+    {
+        drive->fiveVoltMinimum   = fiveVoltMilliWatts;
+        drive->fiveVoltMaximum   = fiveVoltMilliWatts;
+        drive->twelveVoltMinimum = twelveVoltMilliWatts;
+        drive->twelveVoltMaximum = twelveVoltMilliWatts;
+    }
+    drive->fiveVoltMinimum   = M_Min(drive->fiveVoltMinimum, fiveVoltMilliWatts);
+    drive->fiveVoltMaximum   = M_Max(drive->fiveVoltMaximum, fiveVoltMilliWatts);
+    drive->twelveVoltMinimum = M_Min(drive->twelveVoltMinimum, twelveVoltMilliWatts);
+    drive->twelveVoltMaximum = M_Max(drive->twelveVoltMaximum, twelveVoltMilliWatts);
+    drive->fiveVoltTotal += fiveVoltMilliWatts;
+    drive->twelveVoltTotal += twelveVoltMilliWatts;
+    ++drive->count;
+    return SUCCESS;
+}
+
+static void close_Power_Sample_File(powerSampleDrive* drive)
+{
+    if (drive->file != M_NULLPTR)
+    {
+        secure_Close_File(drive->file);
+        free_Secure_File_Info(&drive->file);
+    }
+    safe_free(&drive->ring);
+    drive->active = false;
+}
+
+static void print_Power_Sample_Summary(const powerSampleDrive* drives, uint32_t deviceCount)
+{
+    print_str("\nPower Sampling Summary (W)\n");
+    printf("%-20s %-20s %10s %8s %8s %8s %8s %8s %8s\n", "Device", "Serial Number", "Samples", "5V Mean", "5V Min",
+           "5V Max", "12V Mean", "12V Min", "12V Max");
+    for (uint32_t driveIter = UINT32_C(0); driveIter < deviceCount; ++driveIter)
+    {
+        const powerSampleDrive* drive = &drives[driveIter];
+        printf("%-20s %-20s %10" PRIu64, drive->device->os_info.name, drive->device->drive_info.serialNumber,
+               drive->count);
+        if (drive->count > UINT64_C(0))
+        {
+            printf(" %8.3f %8.3f %8.3f %8.3f %8.3f %8.3f\n",
+                   C_CAST(double, drive->fiveVoltTotal) / C_CAST(double, drive->count) / 1000.0,
+                   C_CAST(double, drive->fiveVoltMinimum) / 1000.0, C_CAST(double, drive->fiveVoltMaximum) / 1000.0,
+                   C_CAST(double, drive->twelveVoltTotal) / C_CAST(double, drive->count) / 1000.0,
+                   C_CAST(double, drive->twelveVoltMinimum) / 1000.0,
+                   C_CAST(double, drive->twelveVoltMaximum) / 1000.0);
+        }
+        else
+        {
+            print_str("\n");
+        }
+    }
+}
+
+// Requests measurement windows back to back on every drive until seconds have passed. Each window is read once it
+// completes and its samples go into the ring of the drive, which is written to the sample file every
+// POWER_SAMPLE_FLUSH_SECONDS. Returns the error of the last drive that failed to open or write its file, or FAILURE
+// when no drive accepted a measurement request.
+static eReturnValues run_Power_Sampling(tDevice**        devices,
+                                        uint32_t         deviceCount,
+                                        uint32_t         seconds,
+                                        int              mode,
+                                        const char*      directory,
+                                        eVerbosityLevels toolVerbosity)
+{
+    eReturnValues        ret       = SUCCESS;
+    uint64_t             started   = C_CAST(uint64_t, time(M_NULLPTR));
+    uint64_t             elapsed   = UINT64_C(0);
+    uint64_t             lastFlush = UINT64_C(0);
+    uint32_t             opened    = UINT32_C(0);
+    powerSampleDrive*    drives    = C_CAST(powerSampleDrive*, safe_calloc(deviceCount, sizeof(powerSampleDrive)));
+    seagatePwrTelemetry* telemetry = C_CAST(seagatePwrTelemetry*, safe_calloc(1, sizeof(seagatePwrTelemetry)));
+    if (drives == M_NULLPTR || telemetry == M_NULLPTR)
+    {
+        safe_free(&drives);
+        safe_free(&telemetry);
+        return MEMORY_FAILURE;
+    }
+    for (uint32_t driveIter = UINT32_C(0); driveIter < deviceCount; ++driveIter)
+    {
+        eReturnValues openRet    = SUCCESS;
+        drives[driveIter].device = devices[driveIter];
+        openRet = open_Power_Sample_File(&drives[driveIter], directory, C_CAST(uint8_t, mode), started);
+        if (openRet == SUCCESS)
+        {
+            ++opened;
+            continue;
+        }
+        if (VERBOSITY_QUIET < toolVerbosity)
+        {
+            printf("Unable to open the power sample file for %s. It will not be sampled.\n",
+                   devices[driveIter]->os_info.name);
+        }
+        close_Power_Sample_File(&drives[driveIter]);
+        ret = openRet;
+    }
+    if (opened > UINT32_C(0) && VERBOSITY_QUIET < toolVerbosity)
+    {
+        printf("Sampling power on %" PRIu32 " drive(s) for %" PRIu32 " second(s)\n", opened, seconds);
+    }
+    for (uint32_t windowNumber = UINT32_C(1); opened > UINT32_C(0) && elapsed < seconds; ++windowNumber)
+    {
+        uint32_t window      = M_Max(M_Min(C_CAST(uint32_t, seconds - elapsed), POWER_SAMPLE_WINDOW_SECONDS),
+                                     POWER_SAMPLE_MINIMUM_WINDOW);
+        uint64_t windowStart = elapsed;
+        uint32_t requested   = UINT32_C(0);
+        uint32_t read        = UINT32_C(0);
+        for (uint32_t driveIter = UINT32_C(0); driveIter < deviceCount; ++driveIter)
+        {
+            if (drives[driveIter].active)
+            {
+                if (SUCCESS == request_Power_Measurement(drives[driveIter].device, C_CAST(uint16_t, window),
+                                                         C_CAST(ePowerTelemetryMeasurementOptions, mode)))
+                {
+                    ++requested;
+                }
+                else if (VERBOSITY_QUIET < toolVerbosity)
+                {
+                    printf("Failed to request a power measurement on %s\n", drives[driveIter].device->os_info.name);
+                }
+            }
+        }
+        if (requested == UINT32_C(0))
+        {
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                print_str("No drive accepted a power measurement request.\n");
+            }
+            ret = FAILURE;
+            break;
+        }
+        delay_Seconds(window + POWER_SAMPLE_SETTLE_SECONDS);
+        for (uint32_t driveIter = UINT32_C(0); driveIter < deviceCount; ++driveIter)
+        {
+            powerSampleDrive* drive    = &drives[driveIter];
+            eReturnValues     writeRet = SUCCESS;
+            if (!drive->active)
+            {
+                continue;
+            }
+            safe_memset(telemetry, sizeof(seagatePwrTelemetry), 0, sizeof(seagatePwrTelemetry));
+            if (SUCCESS != get_Power_Telemetry_Data(drive->device, telemetry))
+            {
+                if (VERBOSITY_QUIET < toolVerbosity)
+                {
+                    printf("Failed to read the power telemetry data from %s\n", drive->device->os_info.name);
+                }
+                continue;
+            }
+            ++read;
+            for (uint16_t measurementIter = UINT16_C(0);
+                 measurementIter < telemetry->numberOfMeasurements &&
+                 measurementIter < POWER_TELEMETRY_MAXIMUM_MEASUREMENTS && writeRet == SUCCESS;
+                 ++measurementIter)
+            {
+                writeRet = add_Power_Sample(
+                    drive,
+                    (windowStart * UINT64_C(1000)) +
+                        (C_CAST(uint64_t, measurementIter) * telemetry->measurementWindowTimeMilliseconds),
+                    telemetry->measurement[measurementIter].fiveVoltMilliWatts,
+                    telemetry->measurement[measurementIter].twelveVoltMilliWatts);
+            }
+            if (writeRet != SUCCESS)
+            {
+                if (VERBOSITY_QUIET < toolVerbosity)
+                {
+                    printf("Error writing the power sample file for %s. It will not be sampled again.\n",
+                           drive->device->os_info.name);
+                }
+                close_Power_Sample_File(drive);
+                --opened;
+                ret = writeRet;
+            }
+        }
+        elapsed = C_CAST(uint64_t, time(M_NULLPTR)) - started;
+        if (elapsed - lastFlush >= POWER_SAMPLE_FLUSH_SECONDS)
+        {
+            for (uint32_t driveIter = UINT32_C(0); driveIter < deviceCount; ++driveIter)
+            {
+                if (drives[driveIter].active && SUCCESS != flush_Power_Samples(&drives[driveIter]))
+                {
+                    if (VERBOSITY_QUIET < toolVerbosity)
+                    {
+                        printf("Error writing the power sample file for %s. It will not be sampled again.\n",
+                               drives[driveIter].device->os_info.name);
+                    }
+                    close_Power_Sample_File(&drives[driveIter]);
+                    --opened;
+                    ret = ERROR_WRITING_FILE;
+                }
+            }
+            lastFlush = elapsed;
+        }
+        if (VERBOSITY_QUIET < toolVerbosity)
+        {
+            printf("Window %" PRIu32 ": %" PRIu32 " of %" PRIu32 " drive(s) read, %" PRIu64 " of %" PRIu32
+                   " second(s)\n",
+                   windowNumber, read, requested, M_Min(elapsed, C_CAST(uint64_t, seconds)), seconds);
+        }
+    }
+    for (uint32_t driveIter = UINT32_C(0); driveIter < deviceCount; ++driveIter)
+    {
+        if (drives[driveIter].active && SUCCESS != flush_Power_Samples(&drives[driveIter]))
+        {
+            ret = ERROR_WRITING_FILE;
+        }
+        close_Power_Sample_File(&drives[driveIter]);
+    }
+    if (VERBOSITY_QUIET < toolVerbosity)
+    {
+        print_Power_Sample_Summary(drives, deviceCount);
+    }
+    safe_free(&telemetry);
+    safe_free(&drives);
+    return ret;
+}
+
+#define SPINUP_DEFAULT_CONCURRENCY     UINT32_C(4)
+#define SPINUP_MAX_WORKERS             UINT32_C(64)
+#define SPINUP_POLL_MILLISECONDS       UINT32_C(250)
+#define SPINUP_MINIMUM_TIMEOUT_SECONDS UINT32_C(60)
+
+typedef struct s_spinupJob
+{
+    tDevice*      device;
+    uint32_t      milliamps;
+    uint32_t      seconds;
+    bool          started;
+    bool          finished;
+    bool          timedOut;
+    eReturnValues status;
+    uint64_t      startNanoSeconds; // since the first drive was started
+    uint64_t      readyNanoSeconds; // from this drive being started until it reported ready
+} spinupJob;
+
+typedef struct s_spinupQueue
+{
+    spinupJob*       jobs;
+    uint32_t         jobCount;
+    uint32_t         concurrency;     // 0 for no limit
+    uint32_t         budgetMilliamps; // 0 for no limit
+    uint32_t         active;
+    uint32_t         activeMilliamps;
+    seatimer_t       scheduleTimer;
+    eVerbosityLevels verbosity;
+    utilLock*        lock;
+    utilSignal*      signal;
+} spinupQueue;
+
+static uint64_t get_Spinup_Elapsed_Nano_Seconds(const spinupQueue* queue)
+{
+    seatimer_t now = queue->scheduleTimer;
+    stop_Timer(&now);
+    return get_Nano_Seconds(now);
+}
+
+// A drive larger than the whole budget can still start once nothing else is spinning up
+static bool can_Start_Spinup_Job(const spinupQueue* queue, const spinupJob* job)
+{
+    return (queue->concurrency == UINT32_C(0) || queue->active < queue->concurrency) &&
+           (queue->budgetMilliamps == UINT32_C(0) || queue->active == UINT32_C(0) ||
+            queue->activeMilliamps + job->milliamps <= queue->budgetMilliamps);
+}
+
+static bool is_Drive_Ready_After_Spinup(tDevice* device)
+{
+    if (device->drive_info.drive_type == ATA_DRIVE)
+    {
+        uint8_t powerMode = UINT8_C(0);
+        // 80h is idle, FFh is active or idle. Anything lower is still standby or spinning up.
+        return SUCCESS == ata_Check_Power_Mode(device, &powerMode) && powerMode >= UINT8_C(0x80);
+    }
+    else
+    {
+        scsiStatus status;
+        safe_memset(&status, sizeof(scsiStatus), 0, sizeof(scsiStatus));
+        return SUCCESS == scsi_Test_Unit_Ready(device, &status) && status.senseKey == SENSE_KEY_NO_ERROR;
+    }
+}
+
+// Sends the command that makes the drive start its spindle, then polls until it reports ready or the timeout for its
+// profile passes. NVMe drives have no spindle so they only get the readiness check.
+static void spin_Up_Drive(spinupJob* job)
+{
+    tDevice* device  = job->device;
+    uint64_t timeout = C_CAST(uint64_t, M_Max(job->seconds * UINT32_C(3), SPINUP_MINIMUM_TIMEOUT_SECONDS)) *
+                       UINT64_C(1000000000);
+    DECLARE_SEATIMER(readyTimer);
+    start_Timer(&readyTimer);
+    job->status = SUCCESS;
+    if (device->drive_info.drive_type == ATA_DRIVE)
+    {
+        puisInfo info;
+        safe_memset(&info, sizeof(puisInfo), 0, sizeof(puisInfo));
+        if (SUCCESS == get_PUIS_Info(device, &info) && info.spinupCommandRequired)
+        {
+            job->status = puis_Spinup(device);
+        }
+        else
+        {
+            // any media access spins up a drive in standby
+            job->status = verify_LBA(device, UINT64_C(0), UINT32_C(1));
+        }
+    }
+    else if (device->drive_info.drive_type != NVME_DRIVE)
+    {
+        job->status = transition_Power_State(device, PWR_CND_ACTIVE);
+        if (job->status != SUCCESS)
+        {
+            job->status = verify_LBA(device, UINT64_C(0), UINT32_C(1));
+        }
+    }
+    if (job->status == SUCCESS || job->status == NOT_SUPPORTED)
+    {
+        // a command can complete before the drive is ready, so always wait for it to say so
+        while (!is_Drive_Ready_After_Spinup(device))
+        {
+            seatimer_t now = readyTimer;
+            stop_Timer(&now);
+            if (get_Nano_Seconds(now) >= timeout)
+            {
+                job->timedOut = true;
+                break;
+            }
+            delay_Milliseconds(SPINUP_POLL_MILLISECONDS);
+        }
+        job->status = job->timedOut ? COMMAND_TIMEOUT : SUCCESS;
+    }
+    stop_Timer(&readyTimer);
+    job->readyNanoSeconds = get_Nano_Seconds(readyTimer);
+}
+
+static void spinup_Worker(void* param)
+{
+    spinupQueue* queue = C_CAST(spinupQueue*, param);
+    lock_Util_Lock(queue->lock);
+    while (true)
+    {
+        spinupJob* job = M_NULLPTR;
+        // drives are started in the order they were given so a large drive is not held back by smaller ones
+        for (uint32_t iter = UINT32_C(0); iter < queue->jobCount && job == M_NULLPTR; ++iter)
+        {
+            if (!queue->jobs[iter].started)
+            {
+                job = &queue->jobs[iter];
+            }
+        }
+        if (job == M_NULLPTR)
+        {
+            break;
+        }
+        if (!can_Start_Spinup_Job(queue, job))
+        {
+            // wait for a drive that is spinning up to become ready
+            wait_Util_Signal(queue->signal, queue->lock);
+            continue;
+        }
+        job->started          = true;
+        job->startNanoSeconds = get_Spinup_Elapsed_Nano_Seconds(queue);
+        ++queue->active;
+        queue->activeMilliamps += job->milliamps;
+        if (VERBOSITY_QUIET < queue->verbosity)
+        {
+            printf("Spinning up %s (%" PRIu32 "mA), %" PRIu32 " drive(s) / %" PRIu32 "mA spinning up\n",
+                   job->device->os_info.name, job->milliamps, queue->active, queue->activeMilliamps);
+            flush_stdout();
+        }
+        unlock_Util_Lock(queue->lock);
+        spin_Up_Drive(job);
+        lock_Util_Lock(queue->lock);
+        job->finished = true;
+        --queue->active;
+        queue->activeMilliamps -= job->milliamps;
+        broadcast_Util_Signal(queue->signal);
+    }
+    unlock_Util_Lock(queue->lock);
+}
+
+static const char* get_Spinup_Status_String(const spinupJob* job)
+{
+    if (job->timedOut)
+    {
+        return "Timed out";
+    }
+    switch (job->status)
+    {
+    case SUCCESS:
+        return "Ready";
+    case NOT_SUPPORTED:
+        return "Not supported";
+    default:
+        return "Failed";
+    }
+}
+
+static void print_Spinup_Summary(const spinupQueue* queue)
+{
+    print_str("\nStaggered Spin Up Summary\n");
+    printf("%-20s %-20s %8s %10s %10s  %s\n", "Device", "Serial Number", "mA", "Start (s)", "Ready (s)", "Status");
+    for (uint32_t iter = UINT32_C(0); iter < queue->jobCount; ++iter)
+    {
+        const spinupJob* job = &queue->jobs[iter];
+        printf("%-20s %-20s %8" PRIu32 " %10.2f %10.2f  %s\n", job->device->os_info.name,
+               job->device->drive_info.serialNumber, job->milliamps,
+               C_CAST(double, job->startNanoSeconds) / 1000000000.0,
+               C_CAST(double, job->readyNanoSeconds) / 1000000000.0, get_Spinup_Status_String(job));
+    }
+}
+
+// Spins up the drives in waves. A drive is started when it fits within the concurrency and current budget and the
+// next one is started as soon as a drive reports ready, so waves overlap instead of waiting for the slowest drive.
+// The calling thread is one of the workers so this still spins up one drive at a time if no threads can be started.
+// Returns SUCCESS, COMMAND_TIMEOUT if a drive never reported ready or FAILURE if a drive could not be spun up.
+static eReturnValues run_Staggered_Spinup(tDevice**                 devices,
+                                          uint32_t                  deviceCount,
+                                          uint32_t                  concurrency,
+                                          uint32_t                  budgetMilliamps,
+                                          const spinupProfileTable* profiles,
+                                          eVerbosityLevels          toolVerbosity)
+{
+    eReturnValues ret         = SUCCESS;
+    uint32_t      workerCount = UINT32_C(0);
+    utilThread**  workers     = M_NULLPTR;
+    spinupQueue   queue;
+    safe_memset(&queue, sizeof(spinupQueue), 0, sizeof(spinupQueue));
+    queue.jobs = C_CAST(spinupJob*, safe_calloc(deviceCount, sizeof(spinupJob)));
+    if (queue.jobs == M_NULLPTR)
+    {
+        return MEMORY_FAILURE;
+    }
+    queue.jobCount        = deviceCount;
+    queue.budgetMilliamps = budgetMilliamps;
+    queue.concurrency     = concurrency;
+    if (concurrency == UINT32_C(0) && budgetMilliamps == UINT32_C(0))
+    {
+        queue.concurrency = SPINUP_DEFAULT_CONCURRENCY;
+    }
+    queue.verbosity = toolVerbosity;
+    for (uint32_t iter = UINT32_C(0); iter < deviceCount; ++iter)
+    {
+        spinupProfile profile      = get_Spinup_Profile(profiles, devices[iter]);
+        queue.jobs[iter].device    = devices[iter];
+        queue.jobs[iter].milliamps = profile.milliamps;
+        queue.jobs[iter].seconds   = profile.seconds;
+    }
+    workerCount = M_Min(queue.concurrency == UINT32_C(0) ? deviceCount : M_Min(queue.concurrency, deviceCount),
+                        SPINUP_MAX_WORKERS);
+    if (VERBOSITY_QUIET < toolVerbosity)
+    {
+        printf("Staggered spin up of %" PRIu32 " drive(s)", deviceCount);
+        if (queue.concurrency > UINT32_C(0))
+        {
+            printf(", up to %" PRIu32 " at a time", queue.concurrency);
+        }
+        if (budgetMilliamps > UINT32_C(0))
+        {
+            printf(", within %" PRIu32 "mA", budgetMilliamps);
+        }
+        print_str("\n");
+    }
+    queue.lock   = create_Util_Lock();
+    queue.signal = create_Util_Signal();
+    start_Timer(&queue.scheduleTimer);
+    if (workerCount > UINT32_C(1) && queue.lock != M_NULLPTR && queue.signal != M_NULLPTR)
+    {
+        workers = C_CAST(utilThread**, safe_calloc(workerCount - UINT32_C(1), sizeof(utilThread*)));
+        if (workers != M_NULLPTR)
+        {
+            for (uint32_t iter = UINT32_C(0); iter < workerCount - UINT32_C(1); ++iter)
+            {
+                workers[iter] = start_Util_Thread(spinup_Worker, &queue);
+            }
+        }
+    }
+    spinup_Worker(&queue);
+    if (workers != M_NULLPTR)
+    {
+        for (uint32_t iter = UINT32_C(0); iter < workerCount - UINT32_C(1); ++iter)
+        {
+            join_Util_Thread(&workers[iter]);
+        }
+        safe_free(&workers);
+    }
+    destroy_Util_Signal(&queue.signal);
+    destroy_Util_Lock(&queue.lock);
+    for (uint32_t iter = UINT32_C(0); iter < deviceCount; ++iter)
+    {
+        if (queue.jobs[iter].timedOut && ret == SUCCESS)
+        {
+            ret = COMMAND_TIMEOUT;
+        }
+        else if (queue.jobs[iter].status != SUCCESS && !queue.jobs[iter].timedOut)
+        {
+            ret = FAILURE;
+        }
+    }
+    if (VERBOSITY_QUIET < toolVerbosity)
+    {
+        print_Spinup_Summary(&queue);
+    }
+    safe_free(&queue.jobs);
+    return ret;
+}
+
+#define WAKE_LATENCY_MAX_ITERATIONS    UINT32_C(1000)
+#define WAKE_LATENCY_ENTRY_SECONDS     UINT32_C(30) // time allowed for the drive to report the power condition
+#define WAKE_LATENCY_POLL_MILLISECONDS UINT32_C(250)
+#define WAKE_LATENCY_TIMEOUT_SECONDS   UINT32_C(60) // long enough for a spin up from standby
+
+// PWR_CND_ACTIVE is the baseline. The drive is left active and the same command is timed.
+static const struct
+{
+    const char*       name;
+    ePowerConditionID condition;
+} wakeLatencyConditions[] = {
+    {"active", PWR_CND_ACTIVE},       {"idle", PWR_CND_IDLE},           {"standby", PWR_CND_STANDBY},
+    {"idle_a", PWR_CND_IDLE_A},       {"idle_b", PWR_CND_IDLE_B},       {"idle_c", PWR_CND_IDLE_C},
+    {"standby_y", PWR_CND_STANDBY_Y}, {"standby_z", PWR_CND_STANDBY_Z},
+};
+
+#define WAKE_LATENCY_CONDITION_COUNT (sizeof(wakeLatencyConditions) / sizeof(wakeLatencyConditions[0]))
+
+typedef struct s_wakeLatencyResult
+{
+    eReturnValues status;
+    uint32_t      samples;
+    uint32_t      failed;
+    uint32_t      missed; // iterations where the drive never reported the power condition, not timed
+    uint64_t*     latencies;
+} wakeLatencyResult;
+
+static int compare_Uint64(const void* a, const void* b)
+{
+    uint64_t first  = *C_CAST(const uint64_t*, a);
+    uint64_t second = *C_CAST(const uint64_t*, b);
+    return (first > second) - (first < second);
+}
+
+static void print_Wake_Latency_Table(const wakeLatencyResult* results, uint32_t iterations)
+{
+    printf("\nWake Latency (ms), %" PRIu32 " iteration(s)\n", iterations);
+    printf("%-16s %7s %7s %7s %10s %10s %10s %10s %10s\n", "Power Condition", "Samples", "Failed", "Missed", "Min",
+           "Avg", "p50", "p99", "Max");
+    for (size_t conditionIter = SIZE_T_C(0); conditionIter < WAKE_LATENCY_CONDITION_COUNT; ++conditionIter)
+    {
+        const wakeLatencyResult* result  = &results[conditionIter];
+        uint64_t                 sum     = UINT64_C(0);
+        uint32_t                 samples = result->samples;
+        printf("%-16s ", wakeLatencyConditions[conditionIter].name);
+        if (result->status == NOT_SUPPORTED)
+        {
+            print_str("Not supported\n");
+            continue;
+        }
+        printf("%7" PRIu32 " %7" PRIu32 " %7" PRIu32, samples, result->failed, result->missed);
+        if (samples == UINT32_C(0))
+        {
+            print_str("\n");
+            continue;
+        }
+        for (uint32_t iter = UINT32_C(0); iter < samples; ++iter)
+        {
+            sum += result->latencies[iter];
+        }
+        printf(" %10.03f %10.03f %10.03f %10.03f %10.03f\n", C_CAST(double, result->latencies[0]) / 1000000.0,
+               C_CAST(double, sum) / C_CAST(double, samples) / 1000000.0,
+               C_CAST(double, result->latencies[(samples - UINT32_C(1)) / UINT32_C(2)]) / 1000000.0,
+               C_CAST(double, result->latencies[(C_CAST(uint64_t, samples - UINT32_C(1)) * UINT64_C(99)) /
+                                                UINT64_C(100)]) /
+                   1000000.0,
+               C_CAST(double, result->latencies[samples - UINT32_C(1)]) / 1000000.0);
+    }
+}
+
+// Asks the drive which power condition it is in without waking it. ATA drives are asked with check power mode, which
+// reports 00h for standby_z, 01h for standby_y and 80h-83h for idle, idle_a, idle_b and idle_c. SCSI drives report
+// the condition in the additional sense code 5Eh of request sense, set either by a timer or by a command.
+static bool is_Wake_Latency_Condition_Reported(tDevice* device, ePowerConditionID condition)
+{
+    if (device->drive_info.drive_type == ATA_DRIVE)
+    {
+        uint8_t powerMode = UINT8_C(0);
+        if (SUCCESS != ata_Check_Power_Mode(device, &powerMode))
+        {
+            return false;
+        }
+        switch (condition)
+        {
+        case PWR_CND_STANDBY:
+        case PWR_CND_STANDBY_Z:
+            return powerMode == UINT8_C(0x00);
+        case PWR_CND_STANDBY_Y:
+            return powerMode == UINT8_C(0x01);
+        case PWR_CND_IDLE:
+            return powerMode >= UINT8_C(0x80) && powerMode <= UINT8_C(0x83);
+        case PWR_CND_IDLE_A:
+            return powerMode == UINT8_C(0x81);
+        case PWR_CND_IDLE_B:
+            return powerMode == UINT8_C(0x82);
+        case PWR_CND_IDLE_C:
+            return powerMode == UINT8_C(0x83);
+        default:
+            return true;
+        }
+    }
+    else
+    {
+        uint8_t senseKey = UINT8_C(0);
+        uint8_t asc      = UINT8_C(0);
+        uint8_t ascq     = UINT8_C(0);
+        uint8_t fru      = UINT8_C(0);
+        DECLARE_ZERO_INIT_ARRAY(uint8_t, senseData, SPC3_SENSE_LEN);
+        if (SUCCESS != scsi_Request_Sense_Cmd(device, false, senseData, SPC3_SENSE_LEN))
+        {
+            return false;
+        }
+        get_Sense_Key_ASC_ASCQ_FRU(senseData, SPC3_SENSE_LEN, &senseKey, &asc, &ascq, &fru);
+        if (asc != UINT8_C(0x5E))
+        {
+            return false;
+        }
+        switch (condition)
+        {
+        case PWR_CND_STANDBY:
+        case PWR_CND_STANDBY_Z:
+            return ascq == UINT8_C(0x02) || ascq == UINT8_C(0x04);
+        case PWR_CND_STANDBY_Y:
+            return ascq == UINT8_C(0x09) || ascq == UINT8_C(0x0A);
+        case PWR_CND_IDLE:
+            return ascq == UINT8_C(0x01) || ascq == UINT8_C(0x03) || (ascq >= UINT8_C(0x05) && ascq <= UINT8_C(0x08));
+        case PWR_CND_IDLE_A:
+            return ascq == UINT8_C(0x01) || ascq == UINT8_C(0x03);
+        case PWR_CND_IDLE_B:
+            return ascq == UINT8_C(0x05) || ascq == UINT8_C(0x06);
+        case PWR_CND_IDLE_C:
+            return ascq == UINT8_C(0x07) || ascq == UINT8_C(0x08);
+        default:
+            return true;
+        }
+    }
+}
+
+// Polls until the drive reports the power condition or WAKE_LATENCY_ENTRY_SECONDS pass
+static bool wait_For_Wake_Latency_Condition(tDevice* device, ePowerConditionID condition)
+{
+    uint64_t timeout = C_CAST(uint64_t, WAKE_LATENCY_ENTRY_SECONDS) * UINT64_C(1000000000);
+    DECLARE_SEATIMER(entryTimer);
+    start_Timer(&entryTimer);
+    while (!is_Wake_Latency_Condition_Reported(device, condition))
+    {
+        seatimer_t now = entryTimer;
+        stop_Timer(&now);
+        if (get_Nano_Seconds(now) >= timeout)
+        {
+            return false;
+        }
+        delay_Milliseconds(WAKE_LATENCY_POLL_MILLISECONDS);
+    }
+    return true;
+}
+
+// For each power condition, transitions the drive to it, polls until the drive reports it is in that condition, then
+// times a single sector verify, which has to wait for the drive to return to active. An iteration where the drive
+// never reports the condition is counted as missed and not timed, since it would measure a drive that was still
+// active. A condition the drive rejects as not supported is skipped on the first try. The LBA moves every iteration so
+// nothing can be answered from cache. The command timeout is raised for the benchmark so a spin up from standby does
+// not time out. Returns SUCCESS, NOT_SUPPORTED when only the active baseline could be measured, MEMORY_FAILURE or
+// FAILURE if any transition or command failed.
+static eReturnValues run_Wake_Latency_Benchmark(tDevice* device, uint32_t iterations, eVerbosityLevels toolVerbosity)
+{
+    eReturnValues     ret           = SUCCESS;
+    uint32_t          measured      = UINT32_C(0);
+    uint32_t          savedTimeout  = device->drive_info.defaultTimeoutSeconds;
+    uint64_t          lbaStep       = device->drive_info.deviceMaxLba / iterations;
+    wakeLatencyResult results[WAKE_LATENCY_CONDITION_COUNT];
+    safe_memset(results, sizeof(results), 0, sizeof(results));
+    for (size_t conditionIter = SIZE_T_C(0); conditionIter < WAKE_LATENCY_CONDITION_COUNT; ++conditionIter)
+    {
+        results[conditionIter].latencies = C_CAST(uint64_t*, safe_calloc(iterations, sizeof(uint64_t)));
+        if (results[conditionIter].latencies == M_NULLPTR)
+        {
+            ret = MEMORY_FAILURE;
+        }
+    }
+    if (savedTimeout < WAKE_LATENCY_TIMEOUT_SECONDS)
+    {
+        device->drive_info.defaultTimeoutSeconds = WAKE_LATENCY_TIMEOUT_SECONDS;
+    }
+    if (ret != MEMORY_FAILURE && VERBOSITY_QUIET < toolVerbosity)
+    {
+        // every condition waits the whole entry time and every command takes the whole timeout
+        uint64_t conditions = C_CAST(uint64_t, WAKE_LATENCY_CONDITION_COUNT);
+        uint64_t worstCase  = C_CAST(uint64_t, iterations) *
+                             (conditions * WAKE_LATENCY_TIMEOUT_SECONDS +
+                              (conditions - UINT64_C(1)) * WAKE_LATENCY_ENTRY_SECONDS);
+        uint16_t days       = UINT16_C(0);
+        uint8_t  hours      = UINT8_C(0);
+        uint8_t  minutes    = UINT8_C(0);
+        uint8_t  seconds    = UINT8_C(0);
+        convert_Seconds_To_Displayable_Time(worstCase, M_NULLPTR, &days, &hours, &minutes, &seconds);
+        print_str("The wake latency benchmark can take up to");
+        print_Time_To_Screen(M_NULLPTR, &days, &hours, &minutes, &seconds);
+        print_str(" if the drive is slow to enter or leave each power condition.\n");
+    }
+    for (size_t conditionIter = SIZE_T_C(0); ret != MEMORY_FAILURE && conditionIter < WAKE_LATENCY_CONDITION_COUNT;
+         ++conditionIter)
+    {
+        wakeLatencyResult* result    = &results[conditionIter];
+        ePowerConditionID  condition = wakeLatencyConditions[conditionIter].condition;
+        result->status               = SUCCESS;
+        for (uint32_t iteration = UINT32_C(0); iteration < iterations; ++iteration)
+        {
+            eReturnValues commandRet = SUCCESS;
+            bool          reached    = true;
+            DECLARE_SEATIMER(commandTimer);
+            if (condition != PWR_CND_ACTIVE)
+            {
+                commandRet = transition_Power_State(device, condition);
+                if (commandRet == NOT_SUPPORTED && result->samples == UINT32_C(0) && result->failed == UINT32_C(0) &&
+                    result->missed == UINT32_C(0))
+                {
+                    result->status = NOT_SUPPORTED;
+                    break;
+                }
+                else if (commandRet == SUCCESS)
+                {
+                    reached = wait_For_Wake_Latency_Condition(device, condition);
+                }
+            }
+            if (commandRet == SUCCESS && reached)
+            {
+                start_Timer(&commandTimer);
+                commandRet = verify_LBA(device, lbaStep * iteration, UINT32_C(1));
+                stop_Timer(&commandTimer);
+            }
+            if (commandRet == SUCCESS && !reached)
+            {
+                ++result->missed;
+            }
+            else if (commandRet == SUCCESS)
+            {
+                result->latencies[result->samples] = get_Nano_Seconds(commandTimer);
+                ++result->samples;
+            }
+            else
+            {
+                ++result->failed;
+                result->status = FAILURE;
+            }
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                printf("\r%-16s %" PRIu32 " of %" PRIu32, wakeLatencyConditions[conditionIter].name, iteration + 1,
+                       iterations);
+                flush_stdout();
+            }
+        }
+        if (VERBOSITY_QUIET < toolVerbosity && result->status != NOT_SUPPORTED)
+        {
+            print_str("\n");
+        }
+        qsort(result->latencies, result->samples, sizeof(uint64_t), compare_Uint64);
+        if (result->status == FAILURE)
+        {
+            ret = FAILURE;
+        }
+        else if (result->status == SUCCESS && condition != PWR_CND_ACTIVE)
+        {
+            ++measured;
+        }
+    }
+    device->drive_info.defaultTimeoutSeconds = savedTimeout;
+    if (ret != MEMORY_FAILURE)
+    {
+        if (VERBOSITY_QUIET < toolVerbosity)
+        {
+            print_Wake_Latency_Table(results, iterations);
+        }
+        if (ret == SUCCESS && measured == UINT32_C(0))
+        {
+            ret = NOT_SUPPORTED;
+        }
+    }
+    for (size_t conditionIter = SIZE_T_C(0); conditionIter < WAKE_LATENCY_CONDITION_COUNT; ++conditionIter)
+    {
+        safe_free(&results[conditionIter].latencies);
+    }
+    return ret;
+}
+
 //-----------------------------------------------------------------------------
 //
 //  main()
@@ -112,8 +1080,15 @@ int main(int argc, char* argv[])
     LEGACY_STANDBY_POWER_MODE_VARS
     SHOW_POWER_TELEMETRY_VAR
     REQUEST_POWER_TELEMETRY_MEASUREMENT_VARS
+    POWER_SAMPLING_VAR
+    POWER_SAMPLE_DIR_VAR
     SHOW_NVM_POWER_STATES_VAR
     PUIS_FEATURE_VARS
+    STAGGERED_SPINUP_VAR
+    SPINUP_CONCURRENCY_VAR
+    SPINUP_CURRENT_BUDGET_VAR
+    SPINUP_PROFILE_VAR
+    WAKE_LATENCY_VAR
 
 #if defined(ENABLE_CSMI)
     CSMI_FORCE_VARS
@@ -121,6 +1096,7 @@ int main(int argc, char* argv[])
 #endif
     LOWLEVEL_INFO_VAR
     VOLATILE_VAR
+    JSON_OUTPUT_VAR
 
     int args        = 0;
     int argIndex    = 0;
@@ -185,8 +1161,13 @@ int main(int argc, char* argv[])
         TRANSITION_POWER_STATE_LONG_OPT,
         SHOW_POWER_TELEMETRY_LONG_OPT,
         REQUEST_POWER_TELEMETRY_MEASUREMENT_OPTIONS,
+        POWER_SAMPLING_LONG_OPT,
+        POWER_SAMPLE_DIR_LONG_OPT,
         PUIS_FEATURE_LONG_OPT,
+        STAGGERED_SPINUP_LONG_OPTS,
+        WAKE_LATENCY_LONG_OPT,
         VOLATILE_LONG_OPT,
+        JSON_OUTPUT_LONG_OPT,
         LONG_OPT_TERMINATOR
     };
     // clang-format on
@@ -916,6 +1897,52 @@ int main(int argc, char* argv[])
                     exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
                 }
             }
+            else if (strcmp(longopts[optionIndex].name, POWER_SAMPLING_LONG_OPT_STRING) == 0)
+            {
+                if (!get_And_Validate_Integer_Input_Uint32(optarg, M_NULLPTR, ALLOW_UNIT_NONE, &POWER_SAMPLING_FLAG) ||
+                    POWER_SAMPLING_FLAG == UINT32_C(0))
+                {
+                    print_Error_In_Cmd_Line_Args(POWER_SAMPLING_LONG_OPT_STRING, optarg);
+                    exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
+                }
+            }
+            else if (strcmp(longopts[optionIndex].name, POWER_SAMPLE_DIR_LONG_OPT_STRING) == 0)
+            {
+                POWER_SAMPLE_DIR_FLAG = optarg;
+            }
+            else if (strcmp(longopts[optionIndex].name, SPINUP_CONCURRENCY_LONG_OPT_STRING) == 0)
+            {
+                if (!get_And_Validate_Integer_Input_Uint32(optarg, M_NULLPTR, ALLOW_UNIT_NONE,
+                                                           &SPINUP_CONCURRENCY_FLAG) ||
+                    SPINUP_CONCURRENCY_FLAG == UINT32_C(0))
+                {
+                    print_Error_In_Cmd_Line_Args(SPINUP_CONCURRENCY_LONG_OPT_STRING, optarg);
+                    exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
+                }
+            }
+            else if (strcmp(longopts[optionIndex].name, SPINUP_CURRENT_BUDGET_LONG_OPT_STRING) == 0)
+            {
+                if (!get_And_Validate_Integer_Input_Uint32(optarg, M_NULLPTR, ALLOW_UNIT_NONE,
+                                                           &SPINUP_CURRENT_BUDGET_FLAG) ||
+                    SPINUP_CURRENT_BUDGET_FLAG == UINT32_C(0))
+                {
+                    print_Error_In_Cmd_Line_Args(SPINUP_CURRENT_BUDGET_LONG_OPT_STRING, optarg);
+                    exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
+                }
+            }
+            else if (strcmp(longopts[optionIndex].name, SPINUP_PROFILE_LONG_OPT_STRING) == 0)
+            {
+                SPINUP_PROFILE_FLAG = optarg;
+            }
+            else if (strcmp(longopts[optionIndex].name, WAKE_LATENCY_LONG_OPT_STRING) == 0)
+            {
+                if (!get_And_Validate_Integer_Input_Uint32(optarg, M_NULLPTR, ALLOW_UNIT_NONE, &WAKE_LATENCY_FLAG) ||
+                    WAKE_LATENCY_FLAG == UINT32_C(0) || WAKE_LATENCY_FLAG > WAKE_LATENCY_MAX_ITERATIONS)
+                {
+                    print_Error_In_Cmd_Line_Args(WAKE_LATENCY_LONG_OPT_STRING, optarg);
+                    exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
+                }
+            }
             else if (strcmp(longopts[optionIndex].name, PUIS_FEATURE_LONG_OPT_STRING) == 0)
             {
                 PUIS_FEATURE_FLAG = true;
@@ -1062,6 +2089,12 @@ int main(int argc, char* argv[])
         }
     }
 
+    if (JSON_OUTPUT_FLAG)
+    {
+        // nothing but the JSON document is written to stdout. Messages go to stderr.
+        move_Messages_To_Stderr();
+    }
+
     if (0 != atexit(atexit_Print_Final_newline))
     {
         perror("Registering final newline print");
@@ -1259,13 +2292,87 @@ int main(int argc, char* argv[])
           IDLE_A_POWER_MODE_FLAG || IDLE_B_POWER_MODE_FLAG || IDLE_C_POWER_MODE_FLAG || STANDBY_Z_POWER_MODE_FLAG ||
           STANDBY_Y_POWER_MODE_FLAG || LEGACY_IDLE_POWER_MODE_FLAG || LEGACY_STANDBY_POWER_MODE_FLAG ||
           (TRANSITION_POWER_STATE_TO >= 0) || SHOW_POWER_TELEMETRY_FLAG || REQUEST_POWER_TELEMETRY_MEASUREMENT_FLAG ||
-          SHOW_NVM_POWER_STATES || PUIS_FEATURE_FLAG))
+          SHOW_NVM_POWER_STATES || PUIS_FEATURE_FLAG || POWER_SAMPLING_FLAG > UINT32_C(0) || STAGGERED_SPINUP_FLAG ||
+          WAKE_LATENCY_FLAG > UINT32_C(0)))
     {
         utility_Usage(true);
         free_Handle_List(&HANDLE_LIST, DEVICE_LIST_COUNT);
         exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
     }
 
+    if (JSON_OUTPUT_FLAG)
+    {
+        const textOnlyOption textOnlyOptions[] = {
+            {M_ToBool(TEST_UNIT_READY_FLAG), "--" TEST_UNIT_READY_LONG_OPT_STRING},
+            {M_ToBool(LOWLEVEL_INFO_FLAG), "--" LOWLEVEL_INFO_LONG_OPT_STRING},
+            {M_ToBool(CHECK_POWER_FLAG), "--" CHECK_POWER_LONG_OPT_STRING},
+            {M_ToBool(SHOW_POWER_CONSUMPTION_FLAG), "--" SHOW_POWER_CONSUMPTION_LONG_OPT_STRING},
+            {M_ToBool(SHOW_APM_LEVEL_FLAG), "--" SHOW_APM_LEVEL_LONG_OPT_STRING},
+            {M_ToBool(SEAGATE_POWER_BALANCE_INFO_FLAG), "--" SEAGATE_POWER_BALANCE_LONG_OPT_STRING " info"},
+            {M_ToBool(SATA_DIPM_INFO_FLAG), "--" SATA_DIPM_LONG_OPT_STRING " info"},
+            {M_ToBool(SATA_DAPS_INFO_FLAG), "--" SATA_DAPS_LONG_OPT_STRING " info"},
+            {M_ToBool(SAS_PARTIAL_INFO_FLAG), "--" SAS_PARTIAL_LONG_OPT_STRING " info"},
+            {M_ToBool(SAS_SLUMBER_INFO_FLAG), "--" SAS_SLUMBER_LONG_OPT_STRING " info"},
+            {M_ToBool(SHOW_POWER_TELEMETRY_FLAG), "--" SHOW_POWER_TELEMETRY_LONG_OPT_STRING},
+            {M_ToBool(SHOW_NVM_POWER_STATES), "--" SHOW_NVM_POWER_STATES_LONG_OPT_STRING},
+            {POWER_SAMPLING_FLAG > UINT32_C(0), "--" POWER_SAMPLING_LONG_OPT_STRING},
+            {WAKE_LATENCY_FLAG > UINT32_C(0), "--" WAKE_LATENCY_LONG_OPT_STRING},
+        };
+        if (!check_JSON_Output_Options(textOnlyOptions, sizeof(textOnlyOptions) / sizeof(textOnlyOptions[0]),
+                                       JSON_OUTPUT_OPTIONS))
+        {
+            free_Handle_List(&HANDLE_LIST, DEVICE_LIST_COUNT);
+            exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
+        }
+    }
+
+    spinupProfileTable spinupProfiles;
+    safe_memset(&spinupProfiles, sizeof(spinupProfileTable), 0, sizeof(spinupProfileTable));
+    if (STAGGERED_SPINUP_FLAG)
+    {
+        uint32_t      errorLine = UINT32_C(0);
+        eReturnValues tableRet  = init_Spinup_Profile_Table(&spinupProfiles, SPINUP_PROFILE_FLAG, &errorLine);
+        switch (tableRet)
+        {
+        case SUCCESS:
+            break;
+        case INSECURE_PATH:
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                print_str("The spin up profile path is not secure. Choose a different location.\n");
+            }
+            exitCode = UTIL_EXIT_INSECURE_PATH;
+            break;
+        case FILE_OPEN_ERROR:
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                printf("Unable to open %s\n", SPINUP_PROFILE_FLAG);
+            }
+            exitCode = UTIL_EXIT_CANNOT_OPEN_FILE;
+            break;
+        case VALIDATION_FAILURE:
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                printf("Line %" PRIu32 " of %s is not model prefix,milliamps,seconds\n", errorLine,
+                       SPINUP_PROFILE_FLAG);
+            }
+            exitCode = UTIL_EXIT_ERROR_IN_COMMAND_LINE;
+            break;
+        default:
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                print_str("Failed to read the spin up profile file.\n");
+            }
+            exitCode = UTIL_EXIT_OPERATION_FAILURE;
+            break;
+        }
+        if (tableRet != SUCCESS)
+        {
+            free_Handle_List(&HANDLE_LIST, DEVICE_LIST_COUNT);
+            exit(exitCode);
+        }
+    }
+
     uint64_t flags = UINT64_C(0);
     DEVICE_LIST    = M_REINTERPRET_CAST(tDevice*, safe_calloc(DEVICE_LIST_COUNT, sizeof(tDevice)));
     if (!DEVICE_LIST)
@@ -1283,7 +2390,7 @@ int main(int argc, char* argv[])
     version.size    = sizeof(tDevice);
 
     if (TEST_UNIT_READY_FLAG || CHECK_POWER_FLAG || TRANSITION_POWER_MODE_FLAG || SPIN_DOWN_FLAG ||
-        (TRANSITION_POWER_STATE_TO >= 0))
+        (TRANSITION_POWER_STATE_TO >= 0) || STAGGERED_SPINUP_FLAG)
     {
         flags = DO_NOT_WAKE_DRIVE;
     }
@@ -1424,7 +2531,22 @@ int main(int argc, char* argv[])
     }
     free_Handle_List(&HANDLE_LIST, DEVICE_LIST_COUNT);
 
-    uint32_t skippedDevices = UINT32_C(0);
+    uint32_t  skippedDevices      = UINT32_C(0);
+    tDevice** samplingDevices     = M_NULLPTR;
+    uint32_t  samplingDeviceCount = UINT32_C(0);
+    tDevice** spinupDevices       = M_NULLPTR;
+    uint32_t  spinupDeviceCount   = UINT32_C(0);
+    // With --jsonOutput, each device is an entry in the "devices" array of one document
+    jsonStream json;
+    safe_memset(&json, sizeof(jsonStream), 0, sizeof(jsonStream));
+    if (JSON_OUTPUT_FLAG)
+    {
+        open_JSON_Stream(&json, M_NULLPTR);
+        begin_JSON_Object(&json, M_NULLPTR);
+        write_JSON_String(&json, "tool", util_name);
+        write_JSON_String(&json, "version", buildVersion);
+        begin_JSON_Array(&json, "devices");
+    }
     for (uint32_t deviceIter = UINT32_C(0); deviceIter < DEVICE_LIST_COUNT; ++deviceIter)
     {
         deviceList[deviceIter].deviceVerbosity = toolVerbosity;
@@ -1579,8 +2701,14 @@ int main(int argc, char* argv[])
                    print_drive_type(&deviceList[deviceIter]));
         }
 
+        if (JSON_OUTPUT_FLAG)
+        {
+            begin_JSON_Object(&json, M_NULLPTR);
+            write_JSON_Drive_Identity(&json, "identity", &deviceList[deviceIter]);
+        }
+
         // now start looking at what operations are going to be performed and kick them off
-        if (DEVICE_INFO_FLAG)
+        if (DEVICE_INFO_FLAG && !JSON_OUTPUT_FLAG)
         {
             if (SUCCESS != print_Drive_Information(&deviceList[deviceIter], SAT_INFO_FLAG))
             {
@@ -2458,12 +3586,24 @@ int main(int argc, char* argv[])
 
         if (SHOW_EPC_SETTINGS_FLAG)
         {
-            epcSettings deviceEPCSettings;
-            safe_memset(&deviceEPCSettings, sizeof(epcSettings), 0, sizeof(epcSettings));
-            switch (get_EPC_Settings(&deviceList[deviceIter], &deviceEPCSettings))
+            eReturnValues epcRet = UNKNOWN;
+            if (JSON_OUTPUT_FLAG)
+            {
+                epcRet = write_JSON_EPC_Settings(&json, "epcSettings", &deviceList[deviceIter]);
+            }
+            else
+            {
+                epcSettings deviceEPCSettings;
+                safe_memset(&deviceEPCSettings, sizeof(epcSettings), 0, sizeof(epcSettings));
+                epcRet = get_EPC_Settings(&deviceList[deviceIter], &deviceEPCSettings);
+                if (epcRet == SUCCESS)
+                {
+                    print_EPC_Settings(&deviceList[deviceIter], &deviceEPCSettings);
+                }
+            }
+            switch (epcRet)
             {
             case SUCCESS:
-                print_EPC_Settings(&deviceList[deviceIter], &deviceEPCSettings);
                 break;
             case NOT_SUPPORTED:
                 if (VERBOSITY_QUIET < toolVerbosity)
@@ -3162,8 +4302,183 @@ int main(int argc, char* argv[])
             }
         }
 
-        // At this point, close the device handle since it is no longer needed. Do not put any further IO below this.
-        close_Device(&deviceList[deviceIter]);
+        if (WAKE_LATENCY_FLAG > UINT32_C(0))
+        {
+            switch (run_Wake_Latency_Benchmark(&deviceList[deviceIter], WAKE_LATENCY_FLAG, toolVerbosity))
+            {
+            case SUCCESS:
+                break;
+            case NOT_SUPPORTED:
+                if (VERBOSITY_QUIET < toolVerbosity)
+                {
+                    print_str("Transitioning to low power conditions is not supported on this device.\n");
+                }
+                exitCode = UTIL_EXIT_OPERATION_NOT_SUPPORTED;
+                break;
+            case MEMORY_FAILURE:
+                if (VERBOSITY_QUIET < toolVerbosity)
+                {
+                    print_str("Unable to allocate memory\n");
+                }
+                exitCode = UTIL_EXIT_OPERATION_FAILURE;
+                break;
+            default:
+                if (VERBOSITY_QUIET < toolVerbosity)
+                {
+                    print_str("One or more power transitions or wake up commands failed.\n");
+                }
+                exitCode = UTIL_EXIT_OPERATION_FAILURE;
+                break;
+            }
+        }
+
+        bool addedToSampling = false;
+        if (POWER_SAMPLING_FLAG > UINT32_C(0))
+        {
+            if (is_Seagate_Family(&deviceList[deviceIter]) == NON_SEAGATE ||
+                !is_Seagate_Power_Telemetry_Feature_Supported(&deviceList[deviceIter]))
+            {
+                if (VERBOSITY_QUIET < toolVerbosity)
+                {
+                    print_str("Seagate Power Telemetry is not supported on this device.\n");
+                }
+                exitCode = UTIL_EXIT_OPERATION_NOT_SUPPORTED;
+            }
+            else
+            {
+                size_t newSize = (C_CAST(size_t, samplingDeviceCount) + SIZE_T_C(1)) * sizeof(tDevice*);
+                tDevice** newSamplingDevices = C_CAST(tDevice**, safe_realloc(samplingDevices, newSize));
+                if (newSamplingDevices != M_NULLPTR)
+                {
+                    samplingDevices                      = newSamplingDevices;
+                    samplingDevices[samplingDeviceCount] = &deviceList[deviceIter];
+                    ++samplingDeviceCount;
+                    addedToSampling = true;
+                }
+                else if (VERBOSITY_QUIET < toolVerbosity)
+                {
+                    print_str("Unable to add this drive to the power sampling list.\n");
+                }
+            }
+        }
+
+        bool addedToSpinup = false;
+        if (STAGGERED_SPINUP_FLAG)
+        {
+            size_t    newSize          = (C_CAST(size_t, spinupDeviceCount) + SIZE_T_C(1)) * sizeof(tDevice*);
+            tDevice** newSpinupDevices = C_CAST(tDevice**, safe_realloc(spinupDevices, newSize));
+            if (newSpinupDevices != M_NULLPTR)
+            {
+                spinupDevices                    = newSpinupDevices;
+                spinupDevices[spinupDeviceCount] = &deviceList[deviceIter];
+                ++spinupDeviceCount;
+                addedToSpinup = true;
+            }
+            else if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                print_str("Unable to add this drive to the staggered spin up list.\n");
+            }
+        }
+
+        if (JSON_OUTPUT_FLAG)
+        {
+            end_JSON_Object(&json);
+        }
+        if (!addedToSampling && !addedToSpinup)
+        {
+            // At this point, close the device handle since it is no longer needed. Do not put any further IO below
+            // this.
+            close_Device(&deviceList[deviceIter]);
+        }
+    }
+    if (JSON_OUTPUT_FLAG)
+    {
+        end_JSON_Array(&json);
+        end_JSON_Object(&json);
+        close_JSON_Stream(&json);
+    }
+    // spin up runs first so that power sampling of the same drives starts once they are all ready
+    if (spinupDeviceCount > UINT32_C(0))
+    {
+        switch (run_Staggered_Spinup(spinupDevices, spinupDeviceCount, SPINUP_CONCURRENCY_FLAG,
+                                     SPINUP_CURRENT_BUDGET_FLAG, &spinupProfiles, toolVerbosity))
+        {
+        case SUCCESS:
+            break;
+        case COMMAND_TIMEOUT:
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                print_str("One or more drives did not report ready after being spun up.\n");
+            }
+            exitCode = UTIL_EXIT_OPERATION_FAILURE;
+            break;
+        case MEMORY_FAILURE:
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                print_str("Unable to allocate memory\n");
+            }
+            exitCode = UTIL_EXIT_OPERATION_FAILURE;
+            break;
+        default:
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                print_str("Failed to spin up one or more drives.\n");
+            }
+            exitCode = UTIL_EXIT_OPERATION_FAILURE;
+            break;
+        }
+        for (uint32_t spinupIter = UINT32_C(0); spinupIter < spinupDeviceCount; ++spinupIter)
+        {
+            bool sampling = false;
+            for (uint32_t samplingIter = UINT32_C(0); samplingIter < samplingDeviceCount && !sampling; ++samplingIter)
+            {
+                sampling = samplingDevices[samplingIter] == spinupDevices[spinupIter];
+            }
+            if (!sampling)
+            {
+                close_Device(spinupDevices[spinupIter]);
+            }
+        }
+        safe_free(&spinupDevices);
+    }
+    free_Spinup_Profile_Table(&spinupProfiles);
+    if (samplingDeviceCount > UINT32_C(0))
+    {
+        switch (run_Power_Sampling(samplingDevices, samplingDeviceCount, POWER_SAMPLING_FLAG,
+                                   REQUEST_POWER_TELEMETRY_MEASUREMENT_MODE, POWER_SAMPLE_DIR_FLAG, toolVerbosity))
+        {
+        case SUCCESS:
+            break;
+        case INSECURE_PATH:
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                print_str("The power sample directory is not secure. Choose a different location.\n");
+            }
+            exitCode = UTIL_EXIT_INSECURE_PATH;
+            break;
+        case FILE_OPEN_ERROR:
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                print_str("Unable to open a power sample file.\n");
+            }
+            exitCode = UTIL_EXIT_CANNOT_OPEN_FILE;
+            break;
+        case ERROR_WRITING_FILE:
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                print_str("Error writing to a power sample file.\n");
+            }
+            exitCode = UTIL_EXIT_ERROR_WRITING_FILE;
+            break;
+        default:
+            exitCode = UTIL_EXIT_OPERATION_FAILURE;
+            break;
+        }
+        for (uint32_t samplingIter = UINT32_C(0); samplingIter < samplingDeviceCount; ++samplingIter)
+        {
+            close_Device(samplingDevices[samplingIter]);
+        }
+        safe_free(&samplingDevices);
     }
     free_device_list(&DEVICE_LIST);
     if (getDevsRet != SUCCESS && skippedDevices == DEVICE_LIST_COUNT)
@@ -3258,6 +4573,7 @@ void utility_Usage(bool shortUsage)
     print_Force_ATA_UDMA_Help(shortUsage);
     print_Force_SCSI_Help(shortUsage);
     print_Help_Help(shortUsage);
+    print_JSON_Output_Help(shortUsage, JSON_OUTPUT_OPTIONS);
     print_License_Help(shortUsage);
     print_Model_Match_Help(shortUsage);
     print_No_Banner_Help(shortUsage);
@@ -3286,16 +4602,23 @@ void utility_Usage(bool shortUsage)
     print_Idle_A_Help(shortUsage);
     print_Idle_B_Help(shortUsage);
     print_Idle_C_Help(shortUsage);
+    print_Power_Sample_Dir_Help(shortUsage);
+    print_Power_Sampling_Help(shortUsage);
     print_Request_Power_Measurement_Mode_Help(shortUsage);
     print_Request_Power_Measurement_Help(shortUsage);
     print_Seagate_Power_Balance_Help(shortUsage);
     print_Show_EPC_Settings_Help(shortUsage);
     print_Show_Power_Telemetry_Help(shortUsage);
     print_Spindown_Help(shortUsage);
+    print_Spinup_Concurrency_Help(shortUsage);
+    print_Spinup_Current_Budget_Help(shortUsage);
+    print_Spinup_Profile_Help(shortUsage);
+    print_Staggered_Spinup_Help(shortUsage);
     print_Legacy_Standby_Help(shortUsage);
     print_Standby_Y_Help(shortUsage);
     print_Standby_Z_Help(shortUsage);
     print_Transition_Power_Help(shortUsage);
+    print_Wake_Latency_Help(shortUsage);
 
     // SATA Only Options
     print_str("\n\tSATA Only:\n\t=========\n");
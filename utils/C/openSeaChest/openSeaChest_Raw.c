@@ -20,8 +20,10 @@
 #include "getopt.h"
 #include "io_utils.h"
 #include "memory_safety.h"
+#include "openseachest_async_writer.h"
 #include "openseachest_util_options.h"
 #include "operations.h"
+#include "precision_timer.h"
 #include "string_utils.h"
 #include "type_conversion.h"
 #include "unit_conversion.h"
@@ -35,6 +37,502 @@ const char* util_name    = "openSeaChest_Raw";
 //  functions to declare  //
 ////////////////////////////
 static void utility_Usage(bool shortUsage);
+
+// Used when splitting a large data in transfer and the low-level driver has not reported a maximum transfer length.
+// 64KiB is accepted by just about every HBA and USB bridge.
+#define RAW_DEFAULT_STREAM_CHUNK_BYTES UINT32_C(65536)
+// Buffers the stream rotates through so the next command runs while the previous piece is written to the file
+#define RAW_STREAM_BUFFER_COUNT        UINT32_C(3)
+
+// Describes a data in command that can be split into multiple smaller commands because it addresses the data it
+// returns by LBA or by log page offset. Each split piece can then be written to the output file as it is received so
+// that the full transfer never needs to fit into memory.
+typedef struct s_rawStreamInfo
+{
+    uint64_t startAddress; // first LBA or first log page to read
+    uint32_t totalUnits;   // number of LBAs or log pages the user requested
+    uint32_t unitSize;     // bytes per LBA or per log page
+} rawStreamInfo;
+
+static bool get_Raw_SCSI_Read_Stream_Info(const uint8_t* cdb,
+                                          uint8_t        cdbLen,
+                                          uint32_t       blockSize,
+                                          uint32_t       dataLength,
+                                          rawStreamInfo* info)
+{
+    bool     splittable     = false;
+    uint64_t lba            = UINT64_C(0);
+    uint32_t transferLength = UINT32_C(0);
+    if (cdb == M_NULLPTR || info == M_NULLPTR || blockSize == UINT32_C(0))
+    {
+        return false;
+    }
+    switch (cdb[0])
+    {
+    case READ10:
+        if (cdbLen == CDB_LEN_10)
+        {
+            lba            = M_BytesTo4ByteValue(cdb[2], cdb[3], cdb[4], cdb[5]);
+            transferLength = M_BytesTo2ByteValue(cdb[7], cdb[8]);
+            splittable     = true;
+        }
+        break;
+    case READ12:
+        if (cdbLen == CDB_LEN_12)
+        {
+            lba            = M_BytesTo4ByteValue(cdb[2], cdb[3], cdb[4], cdb[5]);
+            transferLength = M_BytesTo4ByteValue(cdb[6], cdb[7], cdb[8], cdb[9]);
+            splittable     = true;
+        }
+        break;
+    case READ16:
+        if (cdbLen == CDB_LEN_16)
+        {
+            lba = M_BytesTo8ByteValue(cdb[2], cdb[3], cdb[4], cdb[5], cdb[6], cdb[7], cdb[8], cdb[9]);
+            transferLength = M_BytesTo4ByteValue(cdb[10], cdb[11], cdb[12], cdb[13]);
+            splittable     = true;
+        }
+        break;
+    default:
+        break;
+    }
+    // Only split when the requested data length matches what the CDB asks for. Anything else is a deliberate
+    // mismatch by the user and must be sent exactly as given.
+    if (splittable && transferLength > UINT32_C(0) &&
+        C_CAST(uint64_t, transferLength) * C_CAST(uint64_t, blockSize) == C_CAST(uint64_t, dataLength))
+    {
+        info->startAddress = lba;
+        info->totalUnits   = transferLength;
+        info->unitSize     = blockSize;
+        return true;
+    }
+    return false;
+}
+
+static void set_Raw_SCSI_Read_Chunk(uint8_t* cdb, uint64_t lba, uint32_t transferLength)
+{
+    switch (cdb[0])
+    {
+    case READ10:
+        cdb[2] = M_Byte3(lba);
+        cdb[3] = M_Byte2(lba);
+        cdb[4] = M_Byte1(lba);
+        cdb[5] = M_Byte0(lba);
+        cdb[7] = M_Byte1(transferLength);
+        cdb[8] = M_Byte0(transferLength);
+        break;
+    case READ12:
+        cdb[2] = M_Byte3(lba);
+        cdb[3] = M_Byte2(lba);
+        cdb[4] = M_Byte1(lba);
+        cdb[5] = M_Byte0(lba);
+        cdb[6] = M_Byte3(transferLength);
+        cdb[7] = M_Byte2(transferLength);
+        cdb[8] = M_Byte1(transferLength);
+        cdb[9] = M_Byte0(transferLength);
+        break;
+    case READ16:
+        cdb[2]  = M_Byte7(lba);
+        cdb[3]  = M_Byte6(lba);
+        cdb[4]  = M_Byte5(lba);
+        cdb[5]  = M_Byte4(lba);
+        cdb[6]  = M_Byte3(lba);
+        cdb[7]  = M_Byte2(lba);
+        cdb[8]  = M_Byte1(lba);
+        cdb[9]  = M_Byte0(lba);
+        cdb[10] = M_Byte3(transferLength);
+        cdb[11] = M_Byte2(transferLength);
+        cdb[12] = M_Byte1(transferLength);
+        cdb[13] = M_Byte0(transferLength);
+        break;
+    default:
+        break;
+    }
+}
+
+static bool is_Raw_ATA_Read_Log_Command(uint8_t command)
+{
+    return (command == ATA_READ_LOG_EXT || command == ATA_READ_LOG_EXT_DMA);
+}
+
+static bool get_Raw_ATA_Read_Stream_Info(const ataPassthroughCommand* ataCmd,
+                                         uint32_t                     blockSize,
+                                         uint32_t                     dataLength,
+                                         rawStreamInfo*               info)
+{
+    uint32_t count = UINT32_C(0);
+    if (ataCmd == M_NULLPTR || info == M_NULLPTR || ataCmd->commandType == ATA_CMD_TYPE_TASKFILE ||
+        ataCmd->ataCommandLengthLocation != ATA_PT_LEN_SECTOR_COUNT)
+    {
+        return false;
+    }
+    count = M_BytesTo2ByteValue(ataCmd->tfr.SectorCount48, ataCmd->tfr.SectorCount);
+    if (count == UINT32_C(0))
+    {
+        // zero in a 48bit command means 65536
+        count = UINT32_C(65536);
+    }
+    if (is_Raw_ATA_Read_Log_Command(ataCmd->tfr.CommandStatus))
+    {
+        // log address is in LBA 7:0, page number in LBA 15:8 and 39:32. Logs are always 512B pages.
+        info->startAddress = M_BytesTo2ByteValue(ataCmd->tfr.LbaMid48, ataCmd->tfr.LbaMid);
+        info->unitSize     = LEGACY_DRIVE_SEC_SIZE;
+    }
+    else if ((ataCmd->tfr.CommandStatus == ATA_READ_SECT_EXT || ataCmd->tfr.CommandStatus == ATA_READ_DMA_EXT) &&
+             blockSize > UINT32_C(0))
+    {
+        info->startAddress =
+            M_BytesTo8ByteValue(0, 0, ataCmd->tfr.LbaHi48, ataCmd->tfr.LbaMid48, ataCmd->tfr.LbaLow48,
+                                ataCmd->tfr.LbaHi, ataCmd->tfr.LbaMid, ataCmd->tfr.LbaLow);
+        info->unitSize = blockSize;
+    }
+    else
+    {
+        return false;
+    }
+    if (C_CAST(uint64_t, count) * C_CAST(uint64_t, info->unitSize) != C_CAST(uint64_t, dataLength))
+    {
+        return false;
+    }
+    info->totalUnits = count;
+    return true;
+}
+
+static void set_Raw_ATA_Read_Chunk(ataPassthroughCommand* ataCmd, uint64_t address, uint32_t count)
+{
+    if (is_Raw_ATA_Read_Log_Command(ataCmd->tfr.CommandStatus))
+    {
+        ataCmd->tfr.LbaMid   = M_Byte0(address);
+        ataCmd->tfr.LbaMid48 = M_Byte1(address);
+    }
+    else
+    {
+        ataCmd->tfr.LbaLow   = M_Byte0(address);
+        ataCmd->tfr.LbaMid   = M_Byte1(address);
+        ataCmd->tfr.LbaHi    = M_Byte2(address);
+        ataCmd->tfr.LbaLow48 = M_Byte3(address);
+        ataCmd->tfr.LbaMid48 = M_Byte4(address);
+        ataCmd->tfr.LbaHi48  = M_Byte5(address);
+    }
+    // 65536 wraps to zero which is what the drive expects
+    ataCmd->tfr.SectorCount   = M_Byte0(count);
+    ataCmd->tfr.SectorCount48 = M_Byte1(count);
+}
+
+// Returns the number of bytes to transfer per command when streaming. This is the max transfer length the low-level
+// driver reported, rounded down to a whole number of units.
+static uint32_t get_Raw_Stream_Chunk_Length(tDevice* device, bool ataPassthrough, uint32_t unitSize)
+{
+    uint32_t chunkLength = ataPassthrough ? device->drive_info.passThroughHacks.ataPTHacks.maxTransferLength
+                                          : device->drive_info.passThroughHacks.scsiHacks.maxTransferLength;
+    if (chunkLength == UINT32_C(0))
+    {
+        chunkLength = RAW_DEFAULT_STREAM_CHUNK_BYTES;
+    }
+    if (ataPassthrough && chunkLength > (UINT32_C(65536) * unitSize))
+    {
+        chunkLength = UINT32_C(65536) * unitSize;
+    }
+    chunkLength -= chunkLength % unitSize;
+    if (chunkLength == UINT32_C(0))
+    {
+        chunkLength = unitSize;
+    }
+    return chunkLength;
+}
+
+// Converts --dataLen to bytes. In blocks the product is computed in 64 bits so a large block count cannot wrap into a
+// short buffer. Lengths that do not fit in 32 bits are rejected before anything is allocated.
+static bool get_Raw_Data_Length_Bytes(tDevice*         device,
+                                      uint32_t         dataLength,
+                                      bool             inBlocks,
+                                      uint32_t*        bytes,
+                                      eVerbosityLevels toolVerbosity)
+{
+    uint64_t length = inBlocks ? C_CAST(uint64_t, device->drive_info.deviceBlockSize) * dataLength
+                               : C_CAST(uint64_t, dataLength);
+    if (length > UINT64_C(0xFFFFFFFF))
+    {
+        if (VERBOSITY_QUIET < toolVerbosity)
+        {
+            printf("ERROR: The requested data length of %" PRIu64 " bytes is larger than the %" PRIu32
+                   " bytes that can be transferred.\n",
+                   length, UINT32_MAX);
+        }
+        return false;
+    }
+    *bytes = C_CAST(uint32_t, length);
+    return true;
+}
+
+static eUtilExitCodes open_Raw_Stream_Output_File(const char*      fileName,
+                                                  secureFileInfo** outputFile,
+                                                  eVerbosityLevels toolVerbosity)
+{
+    *outputFile = secure_Open_File(fileName, "ab", M_NULLPTR, M_NULLPTR, M_NULLPTR);
+    if (*outputFile == M_NULLPTR)
+    {
+        if (VERBOSITY_QUIET < toolVerbosity)
+        {
+            print_str("ERROR: Failed to open/create file for saving returned data!\n");
+        }
+        return UTIL_EXIT_OPERATION_FAILURE;
+    }
+    else if ((*outputFile)->error == SEC_FILE_INSECURE_PATH)
+    {
+        if (VERBOSITY_QUIET < toolVerbosity)
+        {
+            print_Insecure_Path_Utility_Message();
+        }
+        free_Secure_File_Info(outputFile);
+        return UTIL_EXIT_INSECURE_PATH;
+    }
+    else if ((*outputFile)->error != SEC_FILE_SUCCESS)
+    {
+        if (VERBOSITY_QUIET < toolVerbosity)
+        {
+            printf("Couldn't open file %s\n", fileName);
+        }
+        free_Secure_File_Info(outputFile);
+        return UTIL_EXIT_CANNOT_OPEN_FILE;
+    }
+    return UTIL_EXIT_NO_ERROR;
+}
+
+//-----------------------------------------------------------------------------
+//
+//  stream_Raw_Data_In_To_File()
+//
+//! \brief   Description:  Issues a large LBA or log page addressed data in command as a series of commands no larger
+//!                        than the max transfer length, appending each piece to the output file as it is received.
+//!                        This keeps memory use constant no matter how large the requested transfer is. Pieces are
+//!                        written by an asyncFileWriter, so the next command is issued while the last one is saved.
+//
+//  Entry:
+//!   \param[in] device = pointer to the device to issue the commands to
+//!   \param[in] info = describes the addressing of the full transfer
+//!   \param[in] cdb = CDB to split when sending a SCSI command. M_NULLPTR when sending an ATA command
+//!   \param[in] cdbLen = length of the CDB
+//!   \param[in] ataCmd = ATA command to split. M_NULLPTR when sending a SCSI command
+//!   \param[in] timeout = timeout for each SCSI command. ATA commands use the timeout already set in ataCmd
+//!   \param[in] fileName = output file to append the data to
+//!   \param[in] toolVerbosity = verbosity to use for status messages
+//!
+//  Exit:
+//!   \return exit code for the utility
+//
+//-----------------------------------------------------------------------------
+static eUtilExitCodes stream_Raw_Data_In_To_File(tDevice*               device,
+                                                 const rawStreamInfo*   info,
+                                                 const uint8_t*         cdb,
+                                                 eCDBLen                cdbLen,
+                                                 ataPassthroughCommand* ataCmd,
+                                                 uint32_t               timeout,
+                                                 const char*            fileName,
+                                                 eVerbosityLevels       toolVerbosity)
+{
+    eUtilExitCodes   exitCode      = UTIL_EXIT_NO_ERROR;
+    secureFileInfo*  outputFile    = M_NULLPTR;
+    asyncFileWriter* writer        = M_NULLPTR;
+    uint32_t         chunkLength   = get_Raw_Stream_Chunk_Length(device, ataCmd != M_NULLPTR, info->unitSize);
+    uint32_t         unitsPerChunk = chunkLength / info->unitSize;
+    uint32_t         unitsDone     = UINT32_C(0);
+    uint64_t         totalBytes    = C_CAST(uint64_t, info->totalUnits) * C_CAST(uint64_t, info->unitSize);
+    DECLARE_ZERO_INIT_ARRAY(uint8_t, splitCDB, UINT8_MAX);
+    DECLARE_SEATIMER(streamTimer);
+
+    if (cdb != M_NULLPTR)
+    {
+        safe_memcpy(splitCDB, UINT8_MAX, cdb, C_CAST(size_t, cdbLen));
+    }
+    exitCode = open_Raw_Stream_Output_File(fileName, &outputFile, toolVerbosity);
+    if (exitCode != UTIL_EXIT_NO_ERROR)
+    {
+        return exitCode;
+    }
+    writer = create_Async_File_Writer(outputFile, RAW_STREAM_BUFFER_COUNT, C_CAST(size_t, chunkLength),
+                                      device->os_info.minimumAlignment);
+    if (writer == M_NULLPTR)
+    {
+        if (VERBOSITY_QUIET < toolVerbosity)
+        {
+            print_str("ERROR: Failed to allocate memory for data in command!\n");
+        }
+        secure_Close_File(outputFile);
+        free_Secure_File_Info(&outputFile);
+        return UTIL_EXIT_NOT_ENOUGH_RESOURCES;
+    }
+    if (VERBOSITY_QUIET < toolVerbosity)
+    {
+        printf("Streaming %" PRIu64 " bytes to %s in %" PRIu32 " byte transfers\n", totalBytes, fileName,
+               chunkLength);
+    }
+    start_Timer(&streamTimer);
+    while (unitsDone < info->totalUnits && exitCode == UTIL_EXIT_NO_ERROR)
+    {
+        uint32_t      units       = M_Min(unitsPerChunk, info->totalUnits - unitsDone);
+        uint32_t      chunkBytes  = units * info->unitSize;
+        eReturnValues cmdRet      = SUCCESS;
+        uint8_t*      chunkBuffer = get_Async_Write_Buffer(writer);
+        if (chunkBuffer == M_NULLPTR)
+        {
+            // an earlier piece could not be written
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                print_str("\nError writing data to a file!\n");
+            }
+            exitCode = UTIL_EXIT_ERROR_WRITING_FILE;
+            break;
+        }
+        if (ataCmd != M_NULLPTR)
+        {
+            set_Raw_ATA_Read_Chunk(ataCmd, info->startAddress + unitsDone, units);
+            ataCmd->ptrData  = chunkBuffer;
+            ataCmd->dataSize = chunkBytes;
+            cmdRet           = ata_Passthrough_Command(device, ataCmd);
+        }
+        else
+        {
+            set_Raw_SCSI_Read_Chunk(splitCDB, info->startAddress + unitsDone, units);
+            cmdRet = scsi_Send_Cdb(device, splitCDB, cdbLen, chunkBuffer, chunkBytes, XFER_DATA_IN,
+                                   device->drive_info.lastCommandSenseData, SPC3_SENSE_LEN, timeout);
+        }
+        switch (cmdRet)
+        {
+        case SUCCESS:
+            if (SEC_FILE_SUCCESS != queue_Async_Write_Buffer(writer, chunkBuffer, C_CAST(size_t, chunkBytes)))
+            {
+                if (VERBOSITY_QUIET < toolVerbosity)
+                {
+                    print_str("\nError writing data to a file!\n");
+                }
+                exitCode = UTIL_EXIT_ERROR_WRITING_FILE;
+            }
+            break;
+        case NOT_SUPPORTED:
+        case OS_PASSTHROUGH_FAILURE:
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                print_str("\nOperation not supported by low level driver or HBA.\n");
+            }
+            exitCode = UTIL_EXIT_OPERATION_NOT_SUPPORTED;
+            break;
+        default:
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                printf("\nCommand completed with a failing status at %s %" PRIu64 ". See sense data.\n",
+                       (ataCmd != M_NULLPTR && is_Raw_ATA_Read_Log_Command(ataCmd->tfr.CommandStatus)) ? "page"
+                                                                                                        : "LBA",
+                       info->startAddress + unitsDone);
+            }
+            if (toolVerbosity < VERBOSITY_BUFFERS)
+            {
+                print_str("\nSense Data:\n");
+                print_Data_Buffer(device->drive_info.lastCommandSenseData, SPC3_SENSE_LEN, true);
+            }
+            exitCode = UTIL_EXIT_OPERATION_FAILURE;
+            break;
+        }
+        if (exitCode == UTIL_EXIT_NO_ERROR)
+        {
+            unitsDone += units;
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                printf("\r%" PRIu64 " of %" PRIu64 " bytes saved",
+                       C_CAST(uint64_t, unitsDone) * C_CAST(uint64_t, info->unitSize), totalBytes);
+                flush_stdout();
+            }
+        }
+    }
+    // waits for the last pieces to be written and flushes the file
+    if (SEC_FILE_SUCCESS != finish_Async_File_Writer(&writer) && exitCode == UTIL_EXIT_NO_ERROR)
+    {
+        if (VERBOSITY_QUIET < toolVerbosity)
+        {
+            print_str("\nError writing data to a file!\n");
+        }
+        exitCode = UTIL_EXIT_ERROR_WRITING_FILE;
+    }
+    stop_Timer(&streamTimer);
+    if (SEC_FILE_SUCCESS != secure_Close_File(outputFile))
+    {
+        if (VERBOSITY_QUIET < toolVerbosity)
+        {
+            print_str("\nERROR: Unable to close handle to output file!\n");
+        }
+    }
+    free_Secure_File_Info(&outputFile);
+    if (VERBOSITY_QUIET < toolVerbosity && exitCode == UTIL_EXIT_NO_ERROR)
+    {
+        double seconds = C_CAST(double, get_Nano_Seconds(streamTimer)) / 1000000000.0;
+        print_str("\nCommand completed with good status\n");
+        if (seconds > 0.0)
+        {
+            printf("Average throughput: %0.02f MB/s\n", (C_CAST(double, totalBytes) / 1000000.0) / seconds);
+        }
+    }
+    return exitCode;
+}
+
+// Formats a buffer of random data with both hex dump formatters and reports the throughput of each on stderr so
+// that stdout can be sent to a file or null device while timing.
+static eUtilExitCodes run_Hex_Dump_Benchmark(uint32_t mebibytes)
+{
+    uint64_t benchmarkBytes = C_CAST(uint64_t, mebibytes) * UINT64_C(1048576);
+    uint8_t* data           = M_NULLPTR;
+    uint64_t outputBytes    = UINT64_C(0);
+    uint32_t state          = UINT32_C(0x2545F491);
+    DECLARE_SEATIMER(perByteTimer);
+    DECLARE_SEATIMER(blockTimer);
+    if (mebibytes == UINT32_C(0) || benchmarkBytes > UINT32_MAX)
+    {
+        return UTIL_EXIT_ERROR_IN_COMMAND_LINE;
+    }
+    data = C_CAST(uint8_t*, safe_malloc(C_CAST(size_t, benchmarkBytes)));
+    if (data == M_NULLPTR)
+    {
+        fprintf(stderr, "Unable to allocate %" PRIu32 "MiB for the hex dump benchmark\n", mebibytes);
+        return UTIL_EXIT_NOT_ENOUGH_RESOURCES;
+    }
+    // xorshift32 so every byte value, printable or not, shows up in the dump
+    for (uint64_t iter = UINT64_C(0); iter < benchmarkBytes; ++iter)
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        data[iter] = M_Byte0(state);
+    }
+    flush_stdout();
+    start_Timer(&perByteTimer);
+    print_Data_Buffer(data, C_CAST(uint32_t, benchmarkBytes), true);
+    flush_stdout();
+    stop_Timer(&perByteTimer);
+    start_Timer(&blockTimer);
+    outputBytes = print_Data_Buffer_Fast(data, C_CAST(uint32_t, benchmarkBytes), true);
+    flush_stdout();
+    stop_Timer(&blockTimer);
+    safe_free(&data);
+    fprintf(stderr, "\nHex dump benchmark: %" PRIu32 "MiB of input, %" PRIu64 " bytes of formatted output\n",
+            mebibytes, outputBytes);
+    double perByteSeconds = C_CAST(double, get_Nano_Seconds(perByteTimer)) / 1000000000.0;
+    double blockSeconds   = C_CAST(double, get_Nano_Seconds(blockTimer)) / 1000000000.0;
+    if (perByteSeconds > 0.0)
+    {
+        fprintf(stderr, "\tprint_Data_Buffer:      %0.03f s, %0.02f MB/s of output\n", perByteSeconds,
+                (C_CAST(double, outputBytes) / 1000000.0) / perByteSeconds);
+    }
+    if (blockSeconds > 0.0)
+    {
+        fprintf(stderr, "\tprint_Data_Buffer_Fast: %0.03f s, %0.02f MB/s of output\n", blockSeconds,
+                (C_CAST(double, outputBytes) / 1000000.0) / blockSeconds);
+    }
+    if (perByteSeconds > 0.0 && blockSeconds > 0.0)
+    {
+        fprintf(stderr, "\tspeedup: %0.02fx\n", perByteSeconds / blockSeconds);
+    }
+    return UTIL_EXIT_NO_ERROR;
+}
+
 //-----------------------------------------------------------------------------
 //
 //  main()
@@ -91,6 +589,7 @@ int main(int argc, char* argv[])
     RAW_OUTPUT_FILE_VARS
     RAW_INPUT_FILE_VARS
     RAW_INPUT_FILE_OFFSET_VAR
+    RAW_HEX_DUMP_BENCHMARK_VARS
     RAW_TFR_BYTE_BLOCK_VAR
     RAW_CDB_LEN_VAR
     RAW_CDB_ARRAY_VAR
@@ -147,6 +646,7 @@ int main(int argc, char* argv[])
         RAW_TIMEOUT_LONG_OPT,
         RAW_OUTPUT_FILE_LONG_OPT,
         RAW_INPUT_FILE_LONG_OPT,
+        RAW_HEX_DUMP_BENCHMARK_LONG_OPT,
         LONG_OPT_TERMINATOR
     };
     // clang-format on
@@ -594,6 +1094,11 @@ int main(int argc, char* argv[])
                             exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
                         }
                     }
+                    if (RAW_DATA_LEN_FLAG > UINT32_MAX / multiplier)
+                    {
+                        print_Error_In_Cmd_Line_Args(RAW_DATA_LEN_LONG_OPT_STRING, optarg);
+                        exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
+                    }
                     RAW_DATA_LEN_FLAG *= multiplier;
                     printf("Raw data len = %" PRIu32 "\n", RAW_DATA_LEN_FLAG);
                 }
@@ -694,6 +1199,22 @@ int main(int argc, char* argv[])
                     exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
                 }
             }
+            else if (strcmp(longopts[optionIndex].name, RAW_HEX_DUMP_BENCHMARK_LONG_OPT_STRING) == 0)
+            {
+                RAW_HEX_DUMP_BENCHMARK_FLAG = true;
+                if (optarg == M_NULLPTR && optind < argc && argv[optind][0] != '-')
+                {
+                    optarg = argv[optind++];
+                }
+                if (optarg != M_NULLPTR &&
+                    (!get_And_Validate_Integer_Input_Uint32(optarg, M_NULLPTR, ALLOW_UNIT_NONE,
+                                                            &RAW_HEX_DUMP_BENCHMARK_MIB) ||
+                     RAW_HEX_DUMP_BENCHMARK_MIB == UINT32_C(0) || RAW_HEX_DUMP_BENCHMARK_MIB > UINT32_C(4095)))
+                {
+                    print_Error_In_Cmd_Line_Args(RAW_HEX_DUMP_BENCHMARK_LONG_OPT_STRING, optarg);
+                    exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
+                }
+            }
             else if (strcmp(longopts[optionIndex].name, MODEL_MATCH_LONG_OPT_STRING) == 0)
             {
                 MODEL_MATCH_FLAG = true;
@@ -928,6 +1449,12 @@ int main(int argc, char* argv[])
     // Add to this if list anything that is suppose to be independent.
     // e.g. you can't say enumerate & then pull logs in the same command line.
     // SIMPLE IS BEAUTIFUL
+    if (RAW_HEX_DUMP_BENCHMARK_FLAG)
+    {
+        exitCode = run_Hex_Dump_Benchmark(RAW_HEX_DUMP_BENCHMARK_MIB);
+        free_Handle_List(&HANDLE_LIST, DEVICE_LIST_COUNT);
+        exit(exitCode);
+    }
     if (SCAN_FLAG || AGRESSIVE_SCAN_FLAG || SHOW_BANNER_FLAG || LICENSE_FLAG || SHOW_HELP_FLAG)
     {
         free_Handle_List(&HANDLE_LIST, DEVICE_LIST_COUNT);
@@ -1312,7 +1839,48 @@ int main(int argc, char* argv[])
                     {
                         dataLenValidForTransferDir = false;
                     }
-                    if (dataLenValidForTransferDir)
+                    // Large LBA addressed reads being saved to a file are split at the max transfer length and
+                    // streamed to the file so that the whole transfer does not need to fit in memory.
+                    bool          streamToFile = false;
+                    rawStreamInfo streamInfo;
+                    safe_memset(&streamInfo, sizeof(rawStreamInfo), 0, sizeof(rawStreamInfo));
+                    if (dataLenValidForTransferDir && RAW_DATA_DIRECTION_FLAG == XFER_DATA_IN &&
+                        RAW_OUTPUT_FILE_NAME_FLAG)
+                    {
+                        if (deviceList[deviceIter].drive_info.deviceBlockSize == 0)
+                        {
+                            // get the blocksize from read capacity first
+                            readCapacityData readCapData;
+                            safe_memset(&readCapData, sizeof(readCapacityData), 0, sizeof(readCapacityData));
+                            if (SUCCESS == scsi_Read_Capacity_Cmd_Helper(&deviceList[deviceIter], &readCapData))
+                            {
+                                deviceList[deviceIter].drive_info.deviceBlockSize = readCapData.logicalBlockLength;
+                            }
+                        }
+                        uint32_t requestedLength = UINT32_C(0);
+                        if (!get_Raw_Data_Length_Bytes(&deviceList[deviceIter], RAW_DATA_LEN_FLAG,
+                                                       RAW_DATA_LEN_ADJUST_BY_BLOCKS_FLAG,
+                                                       &requestedLength, toolVerbosity))
+                        {
+                            exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
+                        }
+                        if (get_Raw_SCSI_Read_Stream_Info(RAW_CDB_ARRAY, RAW_CDB_LEN_FLAG,
+                                                          deviceList[deviceIter].drive_info.deviceBlockSize,
+                                                          requestedLength, &streamInfo) &&
+                            requestedLength > get_Raw_Stream_Chunk_Length(&deviceList[deviceIter], false,
+                                                                          streamInfo.unitSize))
+                        {
+                            streamToFile = true;
+                        }
+                    }
+                    if (streamToFile)
+                    {
+                        exitCode = stream_Raw_Data_In_To_File(&deviceList[deviceIter], &streamInfo, RAW_CDB_ARRAY,
+                                                              C_CAST(eCDBLen, RAW_CDB_LEN_FLAG), M_NULLPTR,
+                                                              RAW_TIMEOUT_FLAG, RAW_OUTPUT_FILE_NAME_FLAG,
+                                                              toolVerbosity);
+                    }
+                    else if (dataLenValidForTransferDir)
                     {
                         bool        showSenseData       = true;      // set to false upon successful completion only
                         uint8_t*    dataBuffer          = M_NULLPTR; // will be allocated shortly
@@ -1352,13 +1920,12 @@ int main(int argc, char* argv[])
                                             readCapData.logicalBlockLength;
                                     }
                                 }
-                                allocatedDataLength =
-                                    deviceList[deviceIter].drive_info.deviceBlockSize * RAW_DATA_LEN_FLAG;
                             }
-                            else
+                            if (!get_Raw_Data_Length_Bytes(&deviceList[deviceIter], RAW_DATA_LEN_FLAG,
+                                                           RAW_DATA_LEN_ADJUST_BY_BLOCKS_FLAG,
+                                                           &allocatedDataLength, toolVerbosity))
                             {
-                                // allocate based on the data size the user entered
-                                allocatedDataLength = RAW_DATA_LEN_FLAG;
+                                exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
                             }
                             dataBuffer = M_REINTERPRET_CAST(
                                 uint8_t*, safe_calloc_aligned(allocatedDataLength, sizeof(uint8_t),
@@ -1419,14 +1986,12 @@ int main(int argc, char* argv[])
                                                 readCapData.logicalBlockLength;
                                         }
                                     }
-                                    // allocate based on logical block size
-                                    allocatedDataLength =
-                                        deviceList[deviceIter].drive_info.deviceBlockSize * RAW_DATA_LEN_FLAG;
                                 }
-                                else
+                                if (!get_Raw_Data_Length_Bytes(
+                                        &deviceList[deviceIter], RAW_DATA_LEN_FLAG, RAW_DATA_LEN_ADJUST_BY_BLOCKS_FLAG,
+                                        &allocatedDataLength, toolVerbosity))
                                 {
-                                    // allocate based on the data size the user entered
-                                    allocatedDataLength = RAW_DATA_LEN_FLAG;
+                                    exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
                                 }
                                 dataBuffer = C_CAST(
                                     uint8_t*, safe_calloc_aligned(allocatedDataLength, sizeof(uint8_t),
@@ -1728,7 +2293,7 @@ int main(int argc, char* argv[])
                         if (RAW_DATA_DIRECTION_FLAG == XFER_DATA_IN && toolVerbosity < VERBOSITY_BUFFERS)
                         {
                             print_str("\nReturned Data:\n");
-                            print_Data_Buffer(dataBuffer, allocatedDataLength, true);
+                            print_Data_Buffer_Fast(dataBuffer, allocatedDataLength, true);
                         }
 
                         // show the sense data if the flag is set and verbosity is less than 3
@@ -1857,7 +2422,36 @@ int main(int argc, char* argv[])
                 {
                     dataLenValidForTransferDir = false;
                 }
-                if (dataLenValidForTransferDir)
+                // Large LBA or log page addressed reads being saved to a file are split at the max transfer length
+                // and streamed to the file so that the whole transfer does not need to fit in memory.
+                bool          streamToFile = false;
+                rawStreamInfo streamInfo;
+                safe_memset(&streamInfo, sizeof(rawStreamInfo), 0, sizeof(rawStreamInfo));
+                if (dataLenValidForTransferDir && RAW_DATA_DIRECTION_FLAG == XFER_DATA_IN && RAW_OUTPUT_FILE_NAME_FLAG)
+                {
+                    uint32_t requestedLength = UINT32_C(0);
+                    if (!get_Raw_Data_Length_Bytes(&deviceList[deviceIter], RAW_DATA_LEN_FLAG,
+                                                   RAW_DATA_LEN_ADJUST_BY_BLOCKS_FLAG, &requestedLength,
+                                                   toolVerbosity))
+                    {
+                        exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
+                    }
+                    if (get_Raw_ATA_Read_Stream_Info(&passthroughCommand,
+                                                     deviceList[deviceIter].drive_info.deviceBlockSize,
+                                                     requestedLength, &streamInfo) &&
+                        requestedLength >
+                            get_Raw_Stream_Chunk_Length(&deviceList[deviceIter], true, streamInfo.unitSize))
+                    {
+                        streamToFile = true;
+                    }
+                }
+                if (streamToFile)
+                {
+                    exitCode = stream_Raw_Data_In_To_File(&deviceList[deviceIter], &streamInfo, M_NULLPTR,
+                                                          C_CAST(eCDBLen, 0), &passthroughCommand, RAW_TIMEOUT_FLAG,
+                                                          RAW_OUTPUT_FILE_NAME_FLAG, toolVerbosity);
+                }
+                else if (dataLenValidForTransferDir)
                 {
                     bool        showSenseData       = true;      // set to false upon successfil completion only
                     uint8_t*    dataBuffer          = M_NULLPTR; // will be allocated shortly
@@ -1883,15 +2477,11 @@ int main(int argc, char* argv[])
                             }
                         }
                         // no "else" needed
-                        if (RAW_DATA_LEN_ADJUST_BY_BLOCKS_FLAG)
-                        {
-                            // allocate based on logical block size
-                            allocatedDataLength = deviceList[deviceIter].drive_info.deviceBlockSize * RAW_DATA_LEN_FLAG;
-                        }
-                        else
+                        if (!get_Raw_Data_Length_Bytes(&deviceList[deviceIter], RAW_DATA_LEN_FLAG,
+                                                       RAW_DATA_LEN_ADJUST_BY_BLOCKS_FLAG,
+                                                       &allocatedDataLength, toolVerbosity))
                         {
-                            // allocate based on the data size the user entered
-                            allocatedDataLength = RAW_DATA_LEN_FLAG;
+                            exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
                         }
                         dataBuffer = M_REINTERPRET_CAST(
                             uint8_t*, safe_calloc_aligned(allocatedDataLength, sizeof(uint8_t),
@@ -1924,16 +2514,11 @@ int main(int argc, char* argv[])
                                 fileOffset =
                                     deviceList[deviceIter].drive_info.deviceBlockSize * RAW_INPUT_FILE_OFFSET_FLAG;
                             }
-                            if (RAW_DATA_LEN_ADJUST_BY_BLOCKS_FLAG)
-                            {
-                                // allocate based on logical block size
-                                allocatedDataLength =
-                                    deviceList[deviceIter].drive_info.deviceBlockSize * RAW_DATA_LEN_FLAG;
-                            }
-                            else
+                            if (!get_Raw_Data_Length_Bytes(&deviceList[deviceIter], RAW_DATA_LEN_FLAG,
+                                                           RAW_DATA_LEN_ADJUST_BY_BLOCKS_FLAG,
+                                                           &allocatedDataLength, toolVerbosity))
                             {
-                                // allocate based on the data size the user entered
-                                allocatedDataLength = RAW_DATA_LEN_FLAG;
+                                exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
                             }
                             dataBuffer = M_REINTERPRET_CAST(
                                 uint8_t*, safe_calloc_aligned(allocatedDataLength, sizeof(uint8_t),
@@ -2232,7 +2817,7 @@ int main(int argc, char* argv[])
                     if (RAW_DATA_DIRECTION_FLAG == XFER_DATA_IN && toolVerbosity < VERBOSITY_BUFFERS)
                     {
                         print_str("\nReturned Data:\n");
-                        print_Data_Buffer(dataBuffer, allocatedDataLength, true);
+                        print_Data_Buffer_Fast(dataBuffer, allocatedDataLength, true);
                     }
 
                     // show the sense data if the flag is set and verbosity is less than 3
@@ -2417,6 +3002,7 @@ void utility_Usage(bool shortUsage)
     print_Fast_Discovery_Help(shortUsage);
     print_Raw_Data_Direction_Help(shortUsage);
     print_Raw_Data_Length_Help(shortUsage);
+    print_Raw_Hex_Dump_Benchmark_Help(shortUsage);
     print_Raw_Input_File_Help(shortUsage);
     print_Raw_Input_File_Offset_Help(shortUsage);
     print_Raw_Output_File_Help(shortUsage);
@@ -31,6 +31,11 @@
 #include "dst.h"
 #include "farm_log.h"
 #include "getopt.h"
+#include "openseachest_farm.h"
+#include "openseachest_fleet_dst.h"
+#include "openseachest_health.h"
+#include "openseachest_json.h"
+#include "openseachest_prometheus.h"
 #include "openseachest_util_options.h"
 #include "operations.h"
 #include "seagate_operations.h"
@@ -40,11 +45,295 @@
 ////////////////////////
 const char* util_name    = "openSeaChest_SMART";
 #define buildVersion UTIL_BUILD_VERSION
+// options that have a section in the --jsonOutput document
+#define JSON_OUTPUT_OPTIONS "-i, --smartAttributes, --deviceStatistics, --showDSTLog, --showNvmeHealth, --showFARM"
 
 ////////////////////////////
 //  functions to declare  //
 ////////////////////////////
 static void utility_Usage(bool shortUsage);
+
+#define WATCH_DEFAULT_FILE_NAME  "openSeaChest_SMART_watch.csv"
+#define WATCH_FILE_ROTATE_BYTES  UINT64_C(67108864)
+#define WATCH_FILE_ROTATIONS     UINT32_C(4)
+#define WATCH_LINE_LENGTH        SIZE_T_C(512)
+
+typedef struct s_watchDrive
+{
+    tDevice*     device;
+    healthSample previous;
+    healthSample current;
+    bool         havePrevious;
+    healthStore  store;
+    bool         storeOpen;
+} watchDrive;
+
+typedef struct s_watchFile
+{
+    const char*     fileName;
+    secureFileInfo* file;
+    uint64_t        fileSize;
+} watchFile;
+
+static eReturnValues write_Watch_Line(watchFile* watch, const char* line)
+{
+    size_t length = safe_strlen(line);
+    if (SEC_FILE_SUCCESS != secure_Write_File(watch->file, line, length, sizeof(char), length, M_NULLPTR))
+    {
+        return ERROR_WRITING_FILE;
+    }
+    watch->fileSize += length;
+    return SUCCESS;
+}
+
+static eReturnValues open_Watch_File(watchFile* watch)
+{
+    watch->file = secure_Open_File(watch->fileName, "a", M_NULLPTR, M_NULLPTR, M_NULLPTR);
+    if (watch->file == M_NULLPTR || watch->file->error != SEC_FILE_SUCCESS)
+    {
+        eReturnValues ret = FILE_OPEN_ERROR;
+        if (watch->file != M_NULLPTR && watch->file->error == SEC_FILE_INSECURE_PATH)
+        {
+            ret = INSECURE_PATH;
+        }
+        free_Secure_File_Info(&watch->file);
+        return ret;
+    }
+    watch->fileSize = watch->file->fileSize;
+    if (watch->fileSize == UINT64_C(0))
+    {
+        return write_Watch_Line(watch,
+                                "Time,Device,Serial Number,Metric,Page,Index,Type,Value,Delta,Rate (per second)\n");
+    }
+    return SUCCESS;
+}
+
+static void close_Watch_File(watchFile* watch)
+{
+    if (watch->file != M_NULLPTR)
+    {
+        secure_Close_File(watch->file);
+        free_Secure_File_Info(&watch->file);
+    }
+}
+
+// Renames the file to <file>.1, <file>.1 to <file>.2 and so on, dropping the oldest, then starts a new file.
+static eReturnValues rotate_Watch_File(watchFile* watch)
+{
+    DECLARE_ZERO_INIT_ARRAY(char, olderName, OPENSEA_PATH_MAX);
+    DECLARE_ZERO_INIT_ARRAY(char, newerName, OPENSEA_PATH_MAX);
+    close_Watch_File(watch);
+    snprintf_err_handle(olderName, OPENSEA_PATH_MAX, "%s.%" PRIu32, watch->fileName, WATCH_FILE_ROTATIONS);
+    remove(olderName);
+    for (uint32_t rotation = WATCH_FILE_ROTATIONS; rotation > UINT32_C(1); --rotation)
+    {
+        snprintf_err_handle(newerName, OPENSEA_PATH_MAX, "%s.%" PRIu32, watch->fileName, rotation - UINT32_C(1));
+        snprintf_err_handle(olderName, OPENSEA_PATH_MAX, "%s.%" PRIu32, watch->fileName, rotation);
+        rename(newerName, olderName);
+    }
+    snprintf_err_handle(olderName, OPENSEA_PATH_MAX, "%s.1", watch->fileName);
+    rename(watch->fileName, olderName);
+    return open_Watch_File(watch);
+}
+
+// Writes every metric for the first sample of a drive, then only the metrics that changed since the last sample.
+static eReturnValues write_Watch_Sample(watchFile* watch, const watchDrive* drive, uint32_t* rows)
+{
+    eReturnValues       ret     = SUCCESS;
+    const healthSample* current = &drive->current;
+    uint64_t            elapsed = UINT64_C(0);
+    DECLARE_ZERO_INIT_ARRAY(char, line, WATCH_LINE_LENGTH);
+    if (drive->havePrevious && current->timestamp > drive->previous.timestamp)
+    {
+        elapsed = current->timestamp - drive->previous.timestamp;
+    }
+    for (uint32_t metricIter = UINT32_C(0); metricIter < current->count && ret == SUCCESS; ++metricIter)
+    {
+        const healthMetric* metric   = &current->metrics[metricIter];
+        const healthMetric* previous = M_NULLPTR;
+        DECLARE_ZERO_INIT_ARRAY(char, delta, 32);
+        DECLARE_ZERO_INIT_ARRAY(char, rate, 32);
+        if (drive->havePrevious)
+        {
+            previous = find_Health_Metric(&drive->previous, metric, metricIter);
+        }
+        if (previous != M_NULLPTR)
+        {
+            int64_t change = C_CAST(int64_t, metric->value - previous->value);
+            if (change == INT64_C(0))
+            {
+                continue;
+            }
+            snprintf_err_handle(delta, 32, "%" PRId64, change);
+            if (metric->type == HEALTH_METRIC_COUNTER && change > INT64_C(0) && elapsed > UINT64_C(0))
+            {
+                snprintf_err_handle(rate, 32, "%.3f", C_CAST(double, change) / C_CAST(double, elapsed));
+            }
+        }
+        snprintf_err_handle(line, WATCH_LINE_LENGTH,
+                            "%" PRIu64 ",%s,%s,%s,%" PRIu16 ",%" PRIu16 ",%s,%" PRIu64 ",%s,%s\n", current->timestamp,
+                            drive->device->os_info.name, drive->device->drive_info.serialNumber,
+                            get_Health_Metric_Name(metric), metric->page, metric->index,
+                            metric->type == HEALTH_METRIC_COUNTER ? "counter" : "gauge", metric->value, delta, rate);
+        ret = write_Watch_Line(watch, line);
+        ++(*rows);
+    }
+    return ret;
+}
+
+// Samples every drive each interval until interrupted. Only returns when the file cannot be written or no drive
+// could be sampled. When storeDirectory is set, every sample is also appended to the health store of the drive.
+static eReturnValues run_SMART_Watch(tDevice**        devices,
+                                     uint32_t         deviceCount,
+                                     uint32_t         interval,
+                                     const char*      fileName,
+                                     const char*      storeDirectory,
+                                     eVerbosityLevels toolVerbosity)
+{
+    eReturnValues ret    = SUCCESS;
+    watchFile     watch  = {fileName != M_NULLPTR ? fileName : WATCH_DEFAULT_FILE_NAME, M_NULLPTR, UINT64_C(0)};
+    watchDrive*   drives = C_CAST(watchDrive*, safe_calloc(deviceCount, sizeof(watchDrive)));
+    if (drives == M_NULLPTR)
+    {
+        return MEMORY_FAILURE;
+    }
+    ret = open_Watch_File(&watch);
+    if (ret != SUCCESS)
+    {
+        safe_free(&drives);
+        return ret;
+    }
+    for (uint32_t driveIter = UINT32_C(0); driveIter < deviceCount; ++driveIter)
+    {
+        drives[driveIter].device = devices[driveIter];
+        if (storeDirectory != M_NULLPTR)
+        {
+            drives[driveIter].storeOpen =
+                SUCCESS == open_Health_Store(devices[driveIter], storeDirectory, &drives[driveIter].store);
+            if (!drives[driveIter].storeOpen && VERBOSITY_QUIET < toolVerbosity)
+            {
+                printf("Unable to open the health store for %s. Samples are only written to %s\n",
+                       devices[driveIter]->os_info.name, watch.fileName);
+            }
+        }
+    }
+    if (VERBOSITY_QUIET < toolVerbosity)
+    {
+        printf("Sampling %" PRIu32 " drive(s) every %" PRIu32 " second(s) into %s\n", deviceCount, interval,
+               watch.fileName);
+        print_str("Press Ctrl+C to stop.\n");
+    }
+    for (uint64_t sampleNumber = UINT64_C(1); ret == SUCCESS; ++sampleNumber)
+    {
+        uint32_t sampled = UINT32_C(0);
+        uint32_t rows    = UINT32_C(0);
+        DECLARE_SEATIMER(sampleTimer);
+        start_Timer(&sampleTimer);
+        for (uint32_t driveIter = UINT32_C(0); driveIter < deviceCount && ret == SUCCESS; ++driveIter)
+        {
+            watchDrive*  drive = &drives[driveIter];
+            healthSample swap;
+            if (SUCCESS != read_Health_Sample(drive->device, &drive->current))
+            {
+                continue;
+            }
+            ++sampled;
+            ret = write_Watch_Sample(&watch, drive, &rows);
+            if (drive->storeOpen && SUCCESS != append_Health_Store_Sample(&drive->store, &drive->current))
+            {
+                if (VERBOSITY_QUIET < toolVerbosity)
+                {
+                    printf("Error writing the health store for %s. It will not be updated again.\n",
+                           drive->device->os_info.name);
+                }
+                close_Health_Store(&drive->store);
+                drive->storeOpen = false;
+            }
+            // keep both buffers so later samples do not allocate
+            swap                = drive->previous;
+            drive->previous     = drive->current;
+            drive->current      = swap;
+            drive->havePrevious = true;
+        }
+        if (ret == SUCCESS && sampled == UINT32_C(0))
+        {
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                print_str("No drive could be sampled.\n");
+            }
+            ret = FAILURE;
+        }
+        if (ret == SUCCESS && SEC_FILE_SUCCESS != secure_Flush_File(watch.file))
+        {
+            ret = ERROR_WRITING_FILE;
+        }
+        if (ret == SUCCESS && watch.fileSize >= WATCH_FILE_ROTATE_BYTES)
+        {
+            ret = rotate_Watch_File(&watch);
+        }
+        if (ret == SUCCESS)
+        {
+            uint64_t sampleSeconds = UINT64_C(0);
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                printf("Sample %" PRIu64 ": %" PRIu32 " of %" PRIu32 " drive(s), %" PRIu32 " value(s) written\n",
+                       sampleNumber, sampled, deviceCount, rows);
+            }
+            stop_Timer(&sampleTimer);
+            sampleSeconds = C_CAST(uint64_t, get_Seconds(sampleTimer));
+            if (sampleSeconds < interval)
+            {
+                delay_Seconds(C_CAST(uint32_t, interval - sampleSeconds));
+            }
+        }
+    }
+    close_Watch_File(&watch);
+    for (uint32_t driveIter = UINT32_C(0); driveIter < deviceCount; ++driveIter)
+    {
+        free_Health_Sample(&drives[driveIter].previous);
+        free_Health_Sample(&drives[driveIter].current);
+        close_Health_Store(&drives[driveIter].store);
+    }
+    safe_free(&drives);
+    return ret;
+}
+
+// Prints every series in a health store file as CSV. The drive information is skipped in quiet mode so the output
+// can be used as-is.
+static eReturnValues print_Health_Store(const char* fileName, eVerbosityLevels toolVerbosity)
+{
+    healthStoreContents contents;
+    eReturnValues       ret = read_Health_Store(fileName, &contents);
+    if (ret != SUCCESS)
+    {
+        return ret;
+    }
+    if (VERBOSITY_QUIET < toolVerbosity)
+    {
+        printf("Serial Number: %s\n", contents.serialNumber);
+        printf("Model Number: %s\n", contents.modelNumber);
+        printf("Firmware Revision: %s\n", contents.firmwareRevision);
+        if (contents.worldWideName != UINT64_C(0))
+        {
+            printf("World Wide Name: %016" PRIX64 "\n", contents.worldWideName);
+        }
+        printf("Samples: %" PRIu32 "\n\n", contents.sampleCount);
+    }
+    print_str("Metric,Page,Index,Type,Time,Value\n");
+    for (uint32_t seriesIter = UINT32_C(0); seriesIter < contents.seriesCount; ++seriesIter)
+    {
+        const healthSeries* series = &contents.series[seriesIter];
+        const char*         name   = get_Health_Metric_Name(&series->metric);
+        const char*         type   = series->metric.type == HEALTH_METRIC_COUNTER ? "counter" : "gauge";
+        for (uint32_t valueIter = UINT32_C(0); valueIter < series->count; ++valueIter)
+        {
+            printf("%s,%" PRIu16 ",%" PRIu16 ",%s,%" PRIu64 ",%" PRIu64 "\n", name, series->metric.page,
+                   series->metric.index, type, series->times[valueIter], series->values[valueIter]);
+        }
+    }
+    free_Health_Store_Contents(&contents);
+    return SUCCESS;
+}
 //-----------------------------------------------------------------------------
 //
 //  main()
@@ -105,6 +394,13 @@ int main(int argc, char* argv[])
     ABORT_IDD_VAR
     IDD_TEST_VARS
     DST_AND_CLEAN_VAR
+    FLEET_DST_VAR
+    WATCH_VAR
+    WATCH_FILE_VAR
+    HEALTH_STORE_VAR
+    READ_HEALTH_STORE_VAR
+    PROMETHEUS_FILE_VAR
+    JSON_OUTPUT_VAR
     SMART_FEATURE_VARS
     SMART_ATTR_AUTOSAVE_FEATURE_VARS
     SMART_INFO_VAR
@@ -125,6 +421,10 @@ int main(int argc, char* argv[])
     LOWLEVEL_INFO_VAR
     SMART_OFFLINE_SCAN_VAR
     SHOW_FARM_VAR
+    DECODE_FARM_VAR
+    FARM_BASELINE_VAR
+    FARM_FIELD_TABLE_VAR
+    FARM_FORMAT_VAR
 
     int args        = 0;
     int argIndex    = 0;
@@ -172,6 +472,13 @@ int main(int argc, char* argv[])
         IDD_TEST_LONG_OPT,
         ERROR_LIMIT_LONG_OPT,
         DST_AND_CLEAN_LONG_OPT,
+        FLEET_DST_LONG_OPT,
+        WATCH_LONG_OPT,
+        WATCH_FILE_LONG_OPT,
+        HEALTH_STORE_LONG_OPT,
+        READ_HEALTH_STORE_LONG_OPT,
+        PROMETHEUS_FILE_LONG_OPT,
+        JSON_OUTPUT_LONG_OPT,
         SMART_FEATURE_LONG_OPT,
         SMART_ATTR_AUTOSAVE_FEATURE_LONG_OPT,
         SMART_INFO_LONG_OPT,
@@ -190,6 +497,10 @@ int main(int argc, char* argv[])
         NVME_HEALTH_LONG_OPT,
         SMART_OFFLINE_SCAN_LONG_OPT,
         SHOW_FARM_LONG_OPT,
+        DECODE_FARM_LONG_OPT,
+        FARM_BASELINE_LONG_OPT,
+        FARM_FIELD_TABLE_LONG_OPT,
+        FARM_FORMAT_LONG_OPT,
         LONG_OPT_TERMINATOR
     };
     // clang-format on
@@ -284,6 +595,63 @@ int main(int argc, char* argv[])
                     }
                 }
             }
+            else if (strcmp(longopts[optionIndex].name, WATCH_LONG_OPT_STRING) == 0)
+            {
+                if (!get_And_Validate_Integer_Input_Uint32(optarg, M_NULLPTR, ALLOW_UNIT_NONE, &WATCH_FLAG) ||
+                    WATCH_FLAG == UINT32_C(0))
+                {
+                    print_Error_In_Cmd_Line_Args(WATCH_LONG_OPT_STRING, optarg);
+                    exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
+                }
+            }
+            else if (strcmp(longopts[optionIndex].name, WATCH_FILE_LONG_OPT_STRING) == 0)
+            {
+                WATCH_FILE_FLAG = optarg;
+            }
+            else if (strcmp(longopts[optionIndex].name, HEALTH_STORE_LONG_OPT_STRING) == 0)
+            {
+                HEALTH_STORE_FLAG = optarg;
+            }
+            else if (strcmp(longopts[optionIndex].name, READ_HEALTH_STORE_LONG_OPT_STRING) == 0)
+            {
+                READ_HEALTH_STORE_FLAG = optarg;
+            }
+            else if (strcmp(longopts[optionIndex].name, PROMETHEUS_FILE_LONG_OPT_STRING) == 0)
+            {
+                PROMETHEUS_FILE_FLAG = optarg;
+            }
+            else if (strcmp(longopts[optionIndex].name, DECODE_FARM_LONG_OPT_STRING) == 0)
+            {
+                DECODE_FARM_FLAG = optarg;
+            }
+            else if (strcmp(longopts[optionIndex].name, FARM_BASELINE_LONG_OPT_STRING) == 0)
+            {
+                FARM_BASELINE_FLAG = optarg;
+            }
+            else if (strcmp(longopts[optionIndex].name, FARM_FIELD_TABLE_LONG_OPT_STRING) == 0)
+            {
+                FARM_FIELD_TABLE_FLAG = optarg;
+            }
+            else if (strcmp(longopts[optionIndex].name, FARM_FORMAT_LONG_OPT_STRING) == 0)
+            {
+                if (strcmp(optarg, "text") == 0)
+                {
+                    FARM_FORMAT_FLAG = FARM_OUTPUT_TEXT;
+                }
+                else if (strcmp(optarg, "csv") == 0)
+                {
+                    FARM_FORMAT_FLAG = FARM_OUTPUT_CSV;
+                }
+                else if (strcmp(optarg, "json") == 0)
+                {
+                    FARM_FORMAT_FLAG = FARM_OUTPUT_JSON;
+                }
+                else
+                {
+                    print_Error_In_Cmd_Line_Args(FARM_FORMAT_LONG_OPT_STRING, optarg);
+                    exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
+                }
+            }
             else if (strcmp(longopts[optionIndex].name, ERROR_LIMIT_LONG_OPT_STRING) == 0)
             {
                 char* unit = M_NULLPTR;
@@ -638,6 +1006,17 @@ int main(int argc, char* argv[])
         }
     }
 
+    if (SHOW_FARM_FLAG && FARM_FORMAT_FLAG == FARM_OUTPUT_JSON)
+    {
+        JSON_OUTPUT_FLAG = goTrue;
+    }
+
+    if (JSON_OUTPUT_FLAG || FARM_FORMAT_FLAG != FARM_OUTPUT_TEXT)
+    {
+        // nothing but the JSON document (or CSV rows) is written to stdout. Messages go to stderr.
+        move_Messages_To_Stderr();
+    }
+
     if (0 != atexit(atexit_Print_Final_newline))
     {
         perror("Registering final newline print");
@@ -750,6 +1129,161 @@ int main(int argc, char* argv[])
         }
         scan_And_Print_Devs(scanControl, toolVerbosity);
     }
+
+    if (READ_HEALTH_STORE_FLAG != M_NULLPTR)
+    {
+        switch (print_Health_Store(READ_HEALTH_STORE_FLAG, toolVerbosity))
+        {
+        case SUCCESS:
+            break;
+        case INSECURE_PATH:
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                print_str("The health store path is not secure. Choose a different location.\n");
+            }
+            exitCode = UTIL_EXIT_INSECURE_PATH;
+            break;
+        case FILE_OPEN_ERROR:
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                printf("Unable to open %s\n", READ_HEALTH_STORE_FLAG);
+            }
+            exitCode = UTIL_EXIT_CANNOT_OPEN_FILE;
+            break;
+        case VALIDATION_FAILURE:
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                printf("%s is not a valid health store file\n", READ_HEALTH_STORE_FLAG);
+            }
+            exitCode = UTIL_EXIT_OPERATION_FAILURE;
+            break;
+        default:
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                print_str("Failed to read the health store.\n");
+            }
+            exitCode = UTIL_EXIT_OPERATION_FAILURE;
+            break;
+        }
+        free_Handle_List(&HANDLE_LIST, DEVICE_LIST_COUNT);
+        exit(exitCode);
+    }
+
+    // The FARM decoder is used by --decodeFARM and by --showFARM with CSV or JSON output
+    farmFieldTable farmTable;
+    safe_memset(&farmTable, sizeof(farmFieldTable), 0, sizeof(farmFieldTable));
+    if (DECODE_FARM_FLAG != M_NULLPTR || (SHOW_FARM_FLAG && (JSON_OUTPUT_FLAG || FARM_FORMAT_FLAG != FARM_OUTPUT_TEXT)))
+    {
+        uint32_t      errorLine = UINT32_C(0);
+        eReturnValues tableRet  = init_FARM_Field_Table(&farmTable, FARM_FIELD_TABLE_FLAG, &errorLine);
+        switch (tableRet)
+        {
+        case SUCCESS:
+            break;
+        case INSECURE_PATH:
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                print_str("The FARM field table path is not secure. Choose a different location.\n");
+            }
+            exitCode = UTIL_EXIT_INSECURE_PATH;
+            break;
+        case FILE_OPEN_ERROR:
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                printf("Unable to open %s\n", FARM_FIELD_TABLE_FLAG);
+            }
+            exitCode = UTIL_EXIT_CANNOT_OPEN_FILE;
+            break;
+        case VALIDATION_FAILURE:
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                printf("Line %" PRIu32 " of %s is not name,page,field,count,type\n", errorLine, FARM_FIELD_TABLE_FLAG);
+            }
+            exitCode = UTIL_EXIT_ERROR_IN_COMMAND_LINE;
+            break;
+        default:
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                print_str("Failed to read the FARM field table.\n");
+            }
+            exitCode = UTIL_EXIT_OPERATION_FAILURE;
+            break;
+        }
+        if (tableRet != SUCCESS)
+        {
+            free_Handle_List(&HANDLE_LIST, DEVICE_LIST_COUNT);
+            exit(exitCode);
+        }
+    }
+
+    if (DECODE_FARM_FLAG != M_NULLPTR)
+    {
+        farmDecode    decoded;
+        farmDecode    baseline;
+        const char*   farmFile = DECODE_FARM_FLAG;
+        eReturnValues farmRet  = read_FARM_Log_File(DECODE_FARM_FLAG, &farmTable, &decoded);
+        safe_memset(&baseline, sizeof(farmDecode), 0, sizeof(farmDecode));
+        if (farmRet == SUCCESS && FARM_BASELINE_FLAG != M_NULLPTR)
+        {
+            farmFile = FARM_BASELINE_FLAG;
+            farmRet  = read_FARM_Log_File(FARM_BASELINE_FLAG, &farmTable, &baseline);
+        }
+        switch (farmRet)
+        {
+        case SUCCESS:
+            if (FARM_FORMAT_FLAG == FARM_OUTPUT_JSON)
+            {
+                jsonStream farmJSON;
+                open_JSON_Stream(&farmJSON, M_NULLPTR);
+                begin_JSON_Object(&farmJSON, M_NULLPTR);
+                write_JSON_String(&farmJSON, "tool", util_name);
+                write_JSON_String(&farmJSON, "version", buildVersion);
+                write_JSON_FARM_Decode(&farmJSON, "farm", &farmTable, &decoded,
+                                       FARM_BASELINE_FLAG != M_NULLPTR ? &baseline : M_NULLPTR, DECODE_FARM_FLAG);
+                end_JSON_Object(&farmJSON);
+                close_JSON_Stream(&farmJSON);
+            }
+            else
+            {
+                print_FARM_Decode(&farmTable, &decoded, FARM_BASELINE_FLAG != M_NULLPTR ? &baseline : M_NULLPTR,
+                                  DECODE_FARM_FLAG, FARM_FORMAT_FLAG, true);
+            }
+            break;
+        case INSECURE_PATH:
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                print_str("The FARM log path is not secure. Choose a different location.\n");
+            }
+            exitCode = UTIL_EXIT_INSECURE_PATH;
+            break;
+        case FILE_OPEN_ERROR:
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                printf("Unable to open %s\n", farmFile);
+            }
+            exitCode = UTIL_EXIT_CANNOT_OPEN_FILE;
+            break;
+        case VALIDATION_FAILURE:
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                printf("%s is not a SATA FARM log\n", farmFile);
+            }
+            exitCode = UTIL_EXIT_OPERATION_FAILURE;
+            break;
+        default:
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                print_str("Failed to decode the FARM log.\n");
+            }
+            exitCode = UTIL_EXIT_OPERATION_FAILURE;
+            break;
+        }
+        free_FARM_Decode(&baseline);
+        free_FARM_Decode(&decoded);
+        free_FARM_Field_Table(&farmTable);
+        free_Handle_List(&HANDLE_LIST, DEVICE_LIST_COUNT);
+        exit(exitCode);
+    }
     // Add to this if list anything that is suppose to be independent.
     // e.g. you can't say enumerate & then pull logs in the same command line.
     // SIMPLE IS BEAUTIFUL
@@ -829,7 +1363,8 @@ int main(int argc, char* argv[])
           RUN_IDD_FLAG || DST_AND_CLEAN_FLAG || SMART_FEATURE_FLAG || SMART_ATTR_AUTOSAVE_FEATURE_FLAG ||
           SMART_INFO_FLAG || SMART_AUTO_OFFLINE_FEATURE_FLAG || SHOW_DST_LOG_FLAG || CONVEYANCE_DST_FLAG ||
           SET_MRIE_MODE_FLAG || SCSI_DEFECTS_FLAG || SHOW_SMART_ERROR_LOG_FLAG || DEVICE_STATISTICS_FLAG ||
-          NVME_HEALTH_FLAG || SMART_OFFLINE_SCAN_FLAG || SHOW_FARM_FLAG
+          NVME_HEALTH_FLAG || SMART_OFFLINE_SCAN_FLAG || SHOW_FARM_FLAG || WATCH_FLAG > UINT32_C(0) ||
+          HEALTH_STORE_FLAG != M_NULLPTR || PROMETHEUS_FILE_FLAG != M_NULLPTR
           // check for other tool specific options here
           ))
     {
@@ -838,6 +1373,26 @@ int main(int argc, char* argv[])
         exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
     }
 
+    if (JSON_OUTPUT_FLAG)
+    {
+        const textOnlyOption textOnlyOptions[] = {
+            {M_ToBool(TEST_UNIT_READY_FLAG), "--" TEST_UNIT_READY_LONG_OPT_STRING},
+            {M_ToBool(LOWLEVEL_INFO_FLAG), "--" LOWLEVEL_INFO_LONG_OPT_STRING},
+            {M_ToBool(SMART_CHECK_FLAG), "--" SMART_CHECK_LONG_OPT_STRING},
+            {M_ToBool(SMART_INFO_FLAG), "--" SMART_INFO_LONG_OPT_STRING},
+            {M_ToBool(SCSI_DEFECTS_FLAG), "--" SCSI_DEFECTS_LONG_OPT_STRING},
+            {M_ToBool(SHOW_SMART_ERROR_LOG_FLAG), "--" SHOW_SMART_ERROR_LOG_LONG_OPT_STRING},
+            {PROGRESS_CHAR != M_NULLPTR, "--" PROGRESS_LONG_OPT_STRING},
+            {WATCH_FLAG > UINT32_C(0), "--" WATCH_LONG_OPT_STRING},
+        };
+        if (!check_JSON_Output_Options(textOnlyOptions, sizeof(textOnlyOptions) / sizeof(textOnlyOptions[0]),
+                                       JSON_OUTPUT_OPTIONS))
+        {
+            free_Handle_List(&HANDLE_LIST, DEVICE_LIST_COUNT);
+            exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
+        }
+    }
+
     uint64_t flags = UINT64_C(0);
     DEVICE_LIST    = M_REINTERPRET_CAST(tDevice*, safe_calloc(DEVICE_LIST_COUNT, sizeof(tDevice)));
     if (!DEVICE_LIST)
@@ -1001,6 +1556,31 @@ int main(int argc, char* argv[])
     }
     free_Handle_List(&HANDLE_LIST, DEVICE_LIST_COUNT);
     uint32_t skippedDevices = UINT32_C(0);
+    // With --fleetDST, self-tests are collected here and run on all drives together once every drive has been checked
+    fleetDST fleet;
+    bool     fleetShortDST    = FLEET_DST_FLAG && SHORT_DST_FLAG;
+    bool     fleetLongDST     = FLEET_DST_FLAG && LONG_DST_FLAG && LONG_TEST_FLAG;
+    bool     fleetDSTAndClean = FLEET_DST_FLAG && DST_AND_CLEAN_FLAG && SINGLE_SECTOR_DATA_ERASE_FLAG;
+    safe_memset(&fleet, sizeof(fleetDST), 0, sizeof(fleetDST));
+    // With --watch, drives stay open and are sampled together once every drive has been checked
+    tDevice** watchDevices     = M_NULLPTR;
+    uint32_t  watchDeviceCount = UINT32_C(0);
+    // With --prometheusFile, every drive is sampled in the loop and the file is written once after it
+    healthExport healthExporter;
+    safe_memset(&healthExporter, sizeof(healthExport), 0, sizeof(healthExport));
+    // With --jsonOutput, each device is an entry in the "devices" array of one document
+    jsonStream json;
+    safe_memset(&json, sizeof(jsonStream), 0, sizeof(jsonStream));
+    // With --showFARM --farmFormat csv, the column names are only printed before the first drive
+    bool farmCSVHeader = true;
+    if (JSON_OUTPUT_FLAG)
+    {
+        open_JSON_Stream(&json, M_NULLPTR);
+        begin_JSON_Object(&json, M_NULLPTR);
+        write_JSON_String(&json, "tool", util_name);
+        write_JSON_String(&json, "version", buildVersion);
+        begin_JSON_Array(&json, "devices");
+    }
     for (uint32_t deviceIter = UINT32_C(0); deviceIter < DEVICE_LIST_COUNT; ++deviceIter)
     {
         deviceList[deviceIter].deviceVerbosity = toolVerbosity;
@@ -1155,8 +1735,16 @@ int main(int argc, char* argv[])
                    print_drive_type(&deviceList[deviceIter]));
         }
 
+        healthSample jsonSample;
+        safe_memset(&jsonSample, sizeof(healthSample), 0, sizeof(healthSample));
+        if (JSON_OUTPUT_FLAG)
+        {
+            begin_JSON_Object(&json, M_NULLPTR);
+            write_JSON_Drive_Identity(&json, "identity", &deviceList[deviceIter]);
+        }
+
         // now start looking at what operations are going to be performed and kick them off
-        if (DEVICE_INFO_FLAG)
+        if (DEVICE_INFO_FLAG && !JSON_OUTPUT_FLAG)
         {
             if (SUCCESS != print_Drive_Information(&deviceList[deviceIter], SAT_INFO_FLAG))
             {
@@ -1170,16 +1758,34 @@ int main(int argc, char* argv[])
 
         if (SHOW_FARM_FLAG)
         {
-            farmLogData farmdata;
-            safe_memset(&farmdata, sizeof(farmLogData), 0, sizeof(farmLogData));
-            switch (read_FARM_Data(&deviceList[deviceIter], &farmdata))
+            if (JSON_OUTPUT_FLAG)
             {
-            case SUCCESS:
-                print_FARM_Data(&farmdata);
-                break;
-            default:
-                print_str("Unable to read FARM data\n");
-                break;
+                write_JSON_FARM_Log(&json, "farm", &deviceList[deviceIter], &farmTable);
+            }
+            else if (FARM_FORMAT_FLAG == FARM_OUTPUT_CSV)
+            {
+                farmDecode decoded;
+                if (SUCCESS == read_FARM_Log_Device(&deviceList[deviceIter], &farmTable, &decoded))
+                {
+                    print_FARM_Decode(&farmTable, &decoded, M_NULLPTR, deviceList[deviceIter].drive_info.serialNumber,
+                                      FARM_OUTPUT_CSV, farmCSVHeader);
+                    farmCSVHeader = false;
+                }
+                free_FARM_Decode(&decoded);
+            }
+            else
+            {
+                farmLogData farmdata;
+                safe_memset(&farmdata, sizeof(farmLogData), 0, sizeof(farmLogData));
+                switch (read_FARM_Data(&deviceList[deviceIter], &farmdata))
+                {
+                case SUCCESS:
+                    print_FARM_Data(&farmdata);
+                    break;
+                default:
+                    print_str("Unable to read FARM data\n");
+                    break;
+                }
             }
         }
 
@@ -1292,8 +1898,20 @@ int main(int argc, char* argv[])
 
         if (SMART_ATTRIBUTES_FLAG)
         {
-            switch (
-                print_SMART_Attributes(&deviceList[deviceIter], C_CAST(eSMARTAttrOutMode, SMART_ATTRIBUTES_MODE_FLAG)))
+            eReturnValues attributesRet = UNKNOWN;
+            if (JSON_OUTPUT_FLAG)
+            {
+                attributesRet = write_JSON_Health_Sample(
+                    &json, "smartAttributes", &deviceList[deviceIter], &jsonSample,
+                    HEALTH_METRIC_SOURCE_BIT(HEALTH_METRIC_ATA_SMART_RAW) |
+                        HEALTH_METRIC_SOURCE_BIT(HEALTH_METRIC_ATA_SMART_NORMALIZED));
+            }
+            else
+            {
+                attributesRet = print_SMART_Attributes(&deviceList[deviceIter],
+                                                       C_CAST(eSMARTAttrOutMode, SMART_ATTRIBUTES_MODE_FLAG));
+            }
+            switch (attributesRet)
             {
             case SUCCESS:
                 // nothing to print here since if it was successful, the attributes will be printed to the screen
@@ -1317,7 +1935,17 @@ int main(int argc, char* argv[])
 
         if (NVME_HEALTH_FLAG)
         {
-            switch (show_NVMe_Health(&deviceList[deviceIter]))
+            eReturnValues nvmeHealthRet = UNKNOWN;
+            if (JSON_OUTPUT_FLAG)
+            {
+                nvmeHealthRet = write_JSON_Health_Sample(&json, "nvmeHealth", &deviceList[deviceIter], &jsonSample,
+                                                         HEALTH_METRIC_SOURCE_BIT(HEALTH_METRIC_NVME_HEALTH));
+            }
+            else
+            {
+                nvmeHealthRet = show_NVMe_Health(&deviceList[deviceIter]);
+            }
+            switch (nvmeHealthRet)
             {
             case SUCCESS:
                 // nothing to print here since if it was successful, the attributes will be printed to the screen
@@ -1530,7 +2158,113 @@ int main(int argc, char* argv[])
             }
         }
 
-        if (SHORT_DST_FLAG)
+        // With --watch every sample is appended instead
+        if (HEALTH_STORE_FLAG != M_NULLPTR && WATCH_FLAG == UINT32_C(0))
+        {
+            switch (save_Health_Store_Sample(&deviceList[deviceIter], HEALTH_STORE_FLAG))
+            {
+            case SUCCESS:
+                if (VERBOSITY_QUIET < toolVerbosity)
+                {
+                    print_str("Health sample saved to the health store.\n");
+                }
+                break;
+            case NOT_SUPPORTED:
+                if (VERBOSITY_QUIET < toolVerbosity)
+                {
+                    print_str("No health information could be read from this device.\n");
+                }
+                exitCode = UTIL_EXIT_OPERATION_NOT_SUPPORTED;
+                break;
+            case INSECURE_PATH:
+                if (VERBOSITY_QUIET < toolVerbosity)
+                {
+                    print_str("The health store path is not secure. Choose a different location.\n");
+                }
+                exitCode = UTIL_EXIT_INSECURE_PATH;
+                break;
+            case FILE_OPEN_ERROR:
+                if (VERBOSITY_QUIET < toolVerbosity)
+                {
+                    print_str("Unable to open the health store file.\n");
+                }
+                exitCode = UTIL_EXIT_CANNOT_OPEN_FILE;
+                break;
+            case VALIDATION_FAILURE:
+                if (VERBOSITY_QUIET < toolVerbosity)
+                {
+                    print_str("The health store file belongs to another drive or is not a health store.\n");
+                }
+                exitCode = UTIL_EXIT_OPERATION_FAILURE;
+                break;
+            case ERROR_WRITING_FILE:
+                if (VERBOSITY_QUIET < toolVerbosity)
+                {
+                    print_str("Error writing to the health store file.\n");
+                }
+                exitCode = UTIL_EXIT_ERROR_WRITING_FILE;
+                break;
+            default:
+                if (VERBOSITY_QUIET < toolVerbosity)
+                {
+                    print_str("Failed to save a health sample.\n");
+                }
+                exitCode = UTIL_EXIT_OPERATION_FAILURE;
+                break;
+            }
+        }
+
+        if (PROMETHEUS_FILE_FLAG != M_NULLPTR &&
+            MEMORY_FAILURE == add_Health_Export_Drive(&healthExporter, &deviceList[deviceIter]))
+        {
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                print_str("Unable to add this drive to the Prometheus file.\n");
+            }
+            exitCode = UTIL_EXIT_OPERATION_FAILURE;
+        }
+
+        bool addedToWatch = false;
+        if (WATCH_FLAG > UINT32_C(0))
+        {
+            size_t    newSize         = (C_CAST(size_t, watchDeviceCount) + SIZE_T_C(1)) * sizeof(tDevice*);
+            tDevice** newWatchDevices = C_CAST(tDevice**, safe_realloc(watchDevices, newSize));
+            if (newWatchDevices != M_NULLPTR)
+            {
+                watchDevices                   = newWatchDevices;
+                watchDevices[watchDeviceCount] = &deviceList[deviceIter];
+                ++watchDeviceCount;
+                addedToWatch = true;
+            }
+            else if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                print_str("Unable to add this drive to the watch list.\n");
+            }
+        }
+
+        bool addedToFleet = false;
+        if (fleetShortDST || fleetLongDST || fleetDSTAndClean)
+        {
+            uint64_t fleetErrorLimit = ERROR_LIMIT_FLAG;
+            if (!ERROR_LIMIT_LOGICAL_COUNT && deviceList[deviceIter].drive_info.deviceBlockSize > UINT32_C(0) &&
+                deviceList[deviceIter].drive_info.devicePhyBlockSize >
+                    deviceList[deviceIter].drive_info.deviceBlockSize)
+            {
+                // the limit was given in physical sectors and repairs are counted in logical blocks
+                fleetErrorLimit *= deviceList[deviceIter].drive_info.devicePhyBlockSize /
+                                   deviceList[deviceIter].drive_info.deviceBlockSize;
+            }
+            if (SUCCESS == add_Fleet_DST_Drive(&fleet, &deviceList[deviceIter], fleetErrorLimit))
+            {
+                addedToFleet = true;
+            }
+            else if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                print_str("Unable to add this drive to the fleet DST. Running DST on this drive by itself.\n");
+            }
+        }
+
+        if (SHORT_DST_FLAG && !addedToFleet)
         {
             eReturnValues DSTResult = UNKNOWN;
             if (VERBOSITY_QUIET < toolVerbosity)
@@ -1658,7 +2392,7 @@ int main(int argc, char* argv[])
             }
         }
 
-        if (LONG_DST_FLAG)
+        if (LONG_DST_FLAG && !(addedToFleet && fleetLongDST))
         {
             eReturnValues DSTResult = UNKNOWN;
             if (VERBOSITY_QUIET < toolVerbosity)
@@ -1907,7 +2641,7 @@ int main(int argc, char* argv[])
             }
         }
 
-        if (DST_AND_CLEAN_FLAG)
+        if (DST_AND_CLEAN_FLAG && !(addedToFleet && fleetDSTAndClean))
         {
             if (SINGLE_SECTOR_DATA_ERASE_FLAG)
             {
@@ -1981,12 +2715,24 @@ int main(int argc, char* argv[])
 
         if (SHOW_DST_LOG_FLAG)
         {
-            dstLogEntries dstEntries;
-            safe_memset(&dstEntries, sizeof(dstLogEntries), 0, sizeof(dstLogEntries));
-            switch (get_DST_Log_Entries(&deviceList[deviceIter], &dstEntries))
+            eReturnValues dstLogRet = UNKNOWN;
+            if (JSON_OUTPUT_FLAG)
+            {
+                dstLogRet = write_JSON_DST_Log(&json, "dstLog", &deviceList[deviceIter]);
+            }
+            else
+            {
+                dstLogEntries dstEntries;
+                safe_memset(&dstEntries, sizeof(dstLogEntries), 0, sizeof(dstLogEntries));
+                dstLogRet = get_DST_Log_Entries(&deviceList[deviceIter], &dstEntries);
+                if (dstLogRet == SUCCESS)
+                {
+                    print_DST_Log_Entries(&dstEntries);
+                }
+            }
+            switch (dstLogRet)
             {
             case SUCCESS:
-                print_DST_Log_Entries(&dstEntries);
                 break;
             case NOT_SUPPORTED:
                 if (VERBOSITY_QUIET < toolVerbosity)
@@ -2147,11 +2893,27 @@ int main(int argc, char* argv[])
 
         if (DEVICE_STATISTICS_FLAG)
         {
+            eReturnValues    deviceStatsRet = UNKNOWN;
             deviceStatistics deviceStats;
             safe_memset(&deviceStats, sizeof(deviceStatistics), 0, sizeof(deviceStatistics));
-            switch (get_DeviceStatistics(&deviceList[deviceIter], &deviceStats))
+            if (JSON_OUTPUT_FLAG)
+            {
+                deviceStatsRet =
+                    write_JSON_Health_Sample(&json, "deviceStatistics", &deviceList[deviceIter], &jsonSample,
+                                             HEALTH_METRIC_SOURCE_BIT(HEALTH_METRIC_ATA_DEVICE_STATISTIC) |
+                                                 HEALTH_METRIC_SOURCE_BIT(HEALTH_METRIC_SCSI_LOG_PARAMETER));
+            }
+            else
+            {
+                deviceStatsRet = get_DeviceStatistics(&deviceList[deviceIter], &deviceStats);
+            }
+            switch (deviceStatsRet)
             {
             case SUCCESS:
+                if (JSON_OUTPUT_FLAG)
+                {
+                    break;
+                }
                 print_DeviceStatistics(&deviceList[deviceIter], &deviceStats);
                 // if supported then print Seagate Device Statistics also
                 if (is_Seagate_DeviceStatistics_Supported(&deviceList[deviceIter]))
@@ -2236,8 +2998,145 @@ int main(int argc, char* argv[])
                 break;
             }
         }
+        if (JSON_OUTPUT_FLAG)
+        {
+            end_JSON_Object(&json);
+        }
+        free_Health_Sample(&jsonSample);
         // At this point, close the device handle since it is no longer needed. Do not put any further IO below this.
-        close_Device(&deviceList[deviceIter]);
+        // Drives in the fleet DST or watch list stay open until those finish.
+        if (!addedToFleet && !addedToWatch)
+        {
+            close_Device(&deviceList[deviceIter]);
+        }
+    }
+    if (JSON_OUTPUT_FLAG)
+    {
+        end_JSON_Array(&json);
+        end_JSON_Object(&json);
+        close_JSON_Stream(&json);
+    }
+    free_FARM_Field_Table(&farmTable);
+    if (PROMETHEUS_FILE_FLAG != M_NULLPTR && healthExporter.count > UINT32_C(0))
+    {
+        switch (write_Prometheus_Health_File(&healthExporter, PROMETHEUS_FILE_FLAG))
+        {
+        case SUCCESS:
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                printf("Wrote metrics for %" PRIu32 " drive(s) to %s\n", healthExporter.count, PROMETHEUS_FILE_FLAG);
+            }
+            break;
+        case INSECURE_PATH:
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                print_str("The Prometheus file path is not secure. Choose a different location.\n");
+            }
+            exitCode = UTIL_EXIT_INSECURE_PATH;
+            break;
+        case FILE_OPEN_ERROR:
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                print_str("Unable to open the Prometheus file.\n");
+            }
+            exitCode = UTIL_EXIT_CANNOT_OPEN_FILE;
+            break;
+        case ERROR_WRITING_FILE:
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                print_str("Error writing the Prometheus file.\n");
+            }
+            exitCode = UTIL_EXIT_ERROR_WRITING_FILE;
+            break;
+        default:
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                print_str("Failed to write the Prometheus file.\n");
+            }
+            exitCode = UTIL_EXIT_OPERATION_FAILURE;
+            break;
+        }
+    }
+    free_Health_Export(&healthExporter);
+    if (fleet.count > UINT32_C(0))
+    {
+        switch (run_Fleet_DST(&fleet, fleetLongDST, fleetDSTAndClean, IGNORE_OPERATION_TIMEOUT, toolVerbosity))
+        {
+        case SUCCESS:
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                print_str("Fleet DST passed on all drives!\n");
+            }
+            break;
+        case ABORTED:
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                printf("Fleet DST was aborted on some drives! You can add the --%s flag to allow DST to continue\n",
+                       IGNORE_OPERATION_TIMEOUT_LONG_OPT_STRING);
+                print_str("running despite taking longer than expected.\n");
+            }
+            exitCode = UTIL_EXIT_OPERATION_ABORTED;
+            break;
+        case NOT_SUPPORTED:
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                print_str("DST is not supported on any of these drives\n");
+            }
+            exitCode = UTIL_EXIT_OPERATION_NOT_SUPPORTED;
+            break;
+        default:
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                print_str("Fleet DST Failed on some drives!\n");
+            }
+            exitCode = UTIL_EXIT_OPERATION_FAILURE;
+            break;
+        }
+        if (watchDeviceCount == UINT32_C(0))
+        {
+            // otherwise the watch list closes them
+            for (uint32_t fleetIter = UINT32_C(0); fleetIter < fleet.count; ++fleetIter)
+            {
+                close_Device(fleet.drives[fleetIter].device);
+            }
+        }
+        free_Fleet_DST(&fleet);
+    }
+    if (watchDeviceCount > UINT32_C(0))
+    {
+        switch (run_SMART_Watch(watchDevices, watchDeviceCount, WATCH_FLAG, WATCH_FILE_FLAG, HEALTH_STORE_FLAG,
+                                toolVerbosity))
+        {
+        case INSECURE_PATH:
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                print_str("The watch file path is not secure. Choose a different location.\n");
+            }
+            exitCode = UTIL_EXIT_INSECURE_PATH;
+            break;
+        case FILE_OPEN_ERROR:
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                print_str("Unable to open the watch file.\n");
+            }
+            exitCode = UTIL_EXIT_CANNOT_OPEN_FILE;
+            break;
+        case ERROR_WRITING_FILE:
+            if (VERBOSITY_QUIET < toolVerbosity)
+            {
+                print_str("Error writing to the watch file.\n");
+            }
+            exitCode = UTIL_EXIT_ERROR_WRITING_FILE;
+            break;
+        default:
+            exitCode = UTIL_EXIT_OPERATION_FAILURE;
+            break;
+        }
+        for (uint32_t watchIter = UINT32_C(0); watchIter < watchDeviceCount; ++watchIter)
+        {
+            close_Device(watchDevices[watchIter]);
+        }
+        safe_free(&watchDevices);
     }
     free_device_list(&DEVICE_LIST);
     if (getDevsRet != SUCCESS && skippedDevices == DEVICE_LIST_COUNT)
@@ -2337,6 +3236,7 @@ void utility_Usage(bool shortUsage)
     print_Force_ATA_UDMA_Help(shortUsage);
     print_Force_SCSI_Help(shortUsage);
     print_Help_Help(shortUsage);
+    print_JSON_Output_Help(shortUsage, JSON_OUTPUT_OPTIONS);
     print_License_Help(shortUsage);
     print_Model_Match_Help(shortUsage);
     print_Firmware_Revision_Match_Help(shortUsage);
@@ -2367,15 +3267,25 @@ void utility_Usage(bool shortUsage)
     print_Abort_IDD_Help(shortUsage);
     print_Captive_Foreground_Help(shortUsage);
     print_Conveyance_DST_Help(shortUsage);
+    print_Decode_FARM_Help(shortUsage);
     print_Device_Statistics_Help(shortUsage);
     print_Error_Limit_Help(shortUsage);
+    print_FARM_Baseline_Help(shortUsage);
+    print_FARM_Field_Table_Help(shortUsage);
+    print_FARM_Format_Help(shortUsage);
+    print_Fleet_DST_Help(shortUsage);
+    print_Health_Store_Help(shortUsage);
     print_IDD_Help(shortUsage);
     print_Long_DST_Help(shortUsage, commandWindowType);
+    print_Prometheus_File_Help(shortUsage);
+    print_Read_Health_Store_Help(shortUsage);
     print_Short_DST_Help(shortUsage);
     print_Show_DST_Log_Help(shortUsage);
     print_Show_FARM_Help(shortUsage);
     print_SMART_Check_Help(shortUsage);
     print_SMART_Feature_Help(shortUsage);
+    print_Watch_Help(shortUsage);
+    print_Watch_File_Help(shortUsage);
     // SATA Only
     print_str("\n\tSATA Only:\n\t=========\n");
     print_SMART_Attributes_Help(shortUsage);
@@ -19,11 +19,14 @@
 #include "io_utils.h"
 #include "math_utils.h"
 #include "memory_safety.h"
+#include "precision_timer.h"
+#include "secure_file.h"
 #include "string_utils.h"
 #include "type_conversion.h"
 #include "unit_conversion.h"
 
 #include "EULA.h"
+#include "cmds.h"
 #include "drive_info.h"
 #include "getopt.h"
 #include "openseachest_util_options.h"
@@ -39,6 +42,1245 @@ const char* util_name    = "openSeaChest_ZBD";
 //  functions to declare  //
 ////////////////////////////
 static void utility_Usage(bool shortUsage);
+
+// Zones are requested and printed this many at a time so memory use does not depend on the number of zones
+#define REPORT_ZONES_PAGE_ZONES UINT32_C(256)
+
+static const char* get_Zone_Type_String(const zoneDescriptor* zone)
+{
+    switch (C_CAST(int, zone->zoneType))
+    {
+    case 1:
+        return "Conventional";
+    case 2:
+        return "Seq. Write Required";
+    case 3:
+        return "Seq. Write Preferred";
+    case 4:
+        return "Seq. or Before Required";
+    case 5:
+        return "Gap";
+    default:
+        return "Reserved";
+    }
+}
+
+static const char* get_Zone_Condition_String(const zoneDescriptor* zone)
+{
+    switch (C_CAST(int, zone->zoneCondition))
+    {
+    case 0x0:
+        return "Not Write Pointer";
+    case 0x1:
+        return "Empty";
+    case 0x2:
+        return "Implicitly Opened";
+    case 0x3:
+        return "Explicitly Opened";
+    case 0x4:
+        return "Closed";
+    case 0x5:
+        return "Inactive";
+    case 0xD:
+        return "Read Only";
+    case 0xE:
+        return "Full";
+    case 0xF:
+        return "Offline";
+    default:
+        return "Reserved";
+    }
+}
+
+// Return false from the handler to stop reading further pages
+typedef bool (*zonePageHandler)(const zoneDescriptor* zones, uint32_t zoneCount, uint32_t firstZone, void* context);
+
+// Reads zones one page of REPORT ZONES data at a time and hands each page to handler as soon as it arrives. The next
+// page starts after the last zone returned so only a single page of descriptors is ever held in memory.
+static eReturnValues read_Zone_Pages(tDevice*              device,
+                                     eZoneReportingOptions reportingOptions,
+                                     uint64_t              startingLBA,
+                                     uint32_t              numberOfZones,
+                                     zonePageHandler       handler,
+                                     void*                 context)
+{
+    eReturnValues  ret      = SUCCESS;
+    uint32_t       reported = UINT32_C(0);
+    zoneDescriptor page[REPORT_ZONES_PAGE_ZONES];
+    while (reported < numberOfZones)
+    {
+        uint32_t pageZones  = M_Min(REPORT_ZONES_PAGE_ZONES, numberOfZones - reported);
+        uint32_t validZones = UINT32_C(0);
+        safe_memset(page, sizeof(page), 0, sizeof(page));
+        ret = get_Zone_Descriptors(device, reportingOptions, startingLBA, pageZones, page);
+        if (ret != SUCCESS)
+        {
+            break;
+        }
+        while (validZones < pageZones && page[validZones].descriptorValid)
+        {
+            ++validZones;
+        }
+        bool keepReading = true;
+        if (handler != M_NULLPTR && validZones > UINT32_C(0))
+        {
+            keepReading = handler(page, validZones, reported, context);
+        }
+        reported += validZones;
+        if (!keepReading || validZones < pageZones || validZones == UINT32_C(0))
+        {
+            break;
+        }
+        uint64_t nextLBA = page[validZones - UINT32_C(1)].zoneStartingLBA + page[validZones - UINT32_C(1)].zoneLength;
+        if (nextLBA <= startingLBA || nextLBA > device->drive_info.deviceMaxLba)
+        {
+            break;
+        }
+        startingLBA = nextLBA;
+    }
+    return ret;
+}
+
+// Rows are numbered from the first zone reported, so the numbering continues across pages
+static bool print_Zone_Page(const zoneDescriptor* zones, uint32_t zoneCount, uint32_t firstZone, void* context)
+{
+    M_USE_UNUSED(context);
+    for (uint32_t zoneIter = UINT32_C(0); zoneIter < zoneCount; ++zoneIter)
+    {
+        printf("%-10" PRIu32 " %-24s %-18s %20" PRIu64 " %20" PRIu64 " %20" PRIu64 "\n", firstZone + zoneIter,
+               get_Zone_Type_String(&zones[zoneIter]), get_Zone_Condition_String(&zones[zoneIter]),
+               zones[zoneIter].zoneStartingLBA, zones[zoneIter].zoneLength, zones[zoneIter].writePointerLBA);
+    }
+    flush_stdout();
+    return true;
+}
+
+static eReturnValues stream_Zone_Report(tDevice*              device,
+                                        eZoneReportingOptions reportingOptions,
+                                        uint64_t              startingLBA,
+                                        uint32_t              numberOfZones,
+                                        eVerbosityLevels      toolVerbosity)
+{
+    if (toolVerbosity > VERBOSITY_QUIET)
+    {
+        printf("\n%-10s %-24s %-18s %20s %20s %20s\n", "#", "Zone Type", "Zone Condition", "Start LBA", "Length",
+               "Write Pointer LBA");
+    }
+    return read_Zone_Pages(device, reportingOptions, startingLBA, numberOfZones,
+                           toolVerbosity > VERBOSITY_QUIET ? print_Zone_Page : M_NULLPTR, M_NULLPTR);
+}
+
+#define ZONE_CONDITION_COUNT            16
+#define ZONE_CONDITION_NOT_WRITE_POINTER 0x0
+#define ZONE_CONDITION_EMPTY_ZONE        0x1
+#define ZONE_CONDITION_IMPLICIT_OPEN     0x2
+#define ZONE_CONDITION_EXPLICIT_OPEN     0x3
+#define ZONE_CONDITION_CLOSED_ZONE       0x4
+#define ZONE_CONDITION_INACTIVE_ZONE     0x5
+#define ZONE_CONDITION_READ_ONLY_ZONE    0xD
+#define ZONE_CONDITION_FULL_ZONE         0xE
+#define ZONE_CONDITION_OFFLINE_ZONE      0xF
+#define ZONE_SNAPSHOT_SIGNATURE          "OSCZONES"
+#define ZONE_SNAPSHOT_SIGNATURE_LENGTH   SIZE_T_C(8)
+#define ZONE_SNAPSHOT_VERSION            UINT16_C(2)
+#define ZONE_SNAPSHOT_HEADER_LENGTH      SIZE_T_C(136)
+#define ZONE_SNAPSHOT_SERIAL_OFFSET      96
+#define ZONE_SNAPSHOT_SERIAL_LENGTH      SIZE_T_C(40)
+#define ZONE_SNAPSHOT_RECORD_LENGTH      SIZE_T_C(18)
+
+// One entry per zone in separate arrays so a large drive's index stays small and each statistic only walks the
+// columns it needs. The write pointer is kept as an offset into the zone.
+typedef struct s_zoneIndex
+{
+    uint32_t  zoneCount;
+    uint32_t  capacity;
+    uint64_t* startLBA;
+    uint32_t* length;
+    uint32_t* writePointerOffset;
+    uint8_t*  type;
+    uint8_t*  condition;
+} zoneIndex;
+
+static void free_Zone_Index(zoneIndex* index)
+{
+    safe_free(&index->startLBA);
+    safe_free(&index->length);
+    safe_free(&index->writePointerOffset);
+    safe_free(&index->type);
+    safe_free(&index->condition);
+    index->zoneCount = UINT32_C(0);
+    index->capacity  = UINT32_C(0);
+}
+
+static bool allocate_Zone_Index(zoneIndex* index, uint32_t zoneCount)
+{
+    free_Zone_Index(index);
+    index->startLBA           = C_CAST(uint64_t*, safe_calloc(zoneCount, sizeof(uint64_t)));
+    index->length             = C_CAST(uint32_t*, safe_calloc(zoneCount, sizeof(uint32_t)));
+    index->writePointerOffset = C_CAST(uint32_t*, safe_calloc(zoneCount, sizeof(uint32_t)));
+    index->type               = C_CAST(uint8_t*, safe_calloc(zoneCount, sizeof(uint8_t)));
+    index->condition          = C_CAST(uint8_t*, safe_calloc(zoneCount, sizeof(uint8_t)));
+    if (index->startLBA == M_NULLPTR || index->length == M_NULLPTR || index->writePointerOffset == M_NULLPTR ||
+        index->type == M_NULLPTR || index->condition == M_NULLPTR)
+    {
+        free_Zone_Index(index);
+        return false;
+    }
+    index->capacity = zoneCount;
+    return true;
+}
+
+static void set_Zone_Index_Entry(zoneIndex* index, uint32_t entry, const zoneDescriptor* zone)
+{
+    index->startLBA[entry]  = zone->zoneStartingLBA;
+    index->length[entry]    = C_CAST(uint32_t, zone->zoneLength);
+    index->type[entry]      = C_CAST(uint8_t, zone->zoneType);
+    index->condition[entry] = C_CAST(uint8_t, zone->zoneCondition);
+    // the write pointer is not valid in zones without one, or in full, read only and offline zones
+    switch (index->condition[entry])
+    {
+    case ZONE_CONDITION_EMPTY_ZONE:
+    case ZONE_CONDITION_IMPLICIT_OPEN:
+    case ZONE_CONDITION_EXPLICIT_OPEN:
+    case ZONE_CONDITION_CLOSED_ZONE:
+        index->writePointerOffset[entry] =
+            zone->writePointerLBA > zone->zoneStartingLBA
+                ? C_CAST(uint32_t, M_Min(zone->writePointerLBA - zone->zoneStartingLBA, zone->zoneLength))
+                : UINT32_C(0);
+        break;
+    case ZONE_CONDITION_FULL_ZONE:
+        index->writePointerOffset[entry] = index->length[entry];
+        break;
+    default:
+        index->writePointerOffset[entry] = UINT32_C(0);
+        break;
+    }
+}
+
+static bool add_Zone_Page_To_Index(const zoneDescriptor* zones, uint32_t zoneCount, uint32_t firstZone, void* context)
+{
+    zoneIndex* index = C_CAST(zoneIndex*, context);
+    for (uint32_t zoneIter = UINT32_C(0); zoneIter < zoneCount && firstZone + zoneIter < index->capacity; ++zoneIter)
+    {
+        set_Zone_Index_Entry(index, firstZone + zoneIter, &zones[zoneIter]);
+        index->zoneCount = firstZone + zoneIter + UINT32_C(1);
+    }
+    return true;
+}
+
+// Returns the position of the first entry in the sorted lbas array that is not less than lba
+static uint32_t find_Sorted_LBA(const uint64_t* lbas, uint32_t count, uint64_t lba)
+{
+    uint32_t low  = UINT32_C(0);
+    uint32_t high = count;
+    while (low < high)
+    {
+        uint32_t middle = low + (high - low) / UINT32_C(2);
+        if (lbas[middle] < lba)
+        {
+            low = middle + UINT32_C(1);
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+// Active zones are few (limited by the drive's open/active zone resources) so they are read again on every summary and
+// written over the matching cached entries.
+static bool update_Zone_Page_In_Index(const zoneDescriptor* zones,
+                                      uint32_t              zoneCount,
+                                      uint32_t              firstZone,
+                                      void*                 context)
+{
+    zoneIndex* index = C_CAST(zoneIndex*, context);
+    M_USE_UNUSED(firstZone);
+    for (uint32_t zoneIter = UINT32_C(0); zoneIter < zoneCount; ++zoneIter)
+    {
+        uint32_t entry = find_Sorted_LBA(index->startLBA, index->zoneCount, zones[zoneIter].zoneStartingLBA);
+        if (entry < index->zoneCount && index->startLBA[entry] == zones[zoneIter].zoneStartingLBA)
+        {
+            set_Zone_Index_Entry(index, entry, &zones[zoneIter]);
+        }
+    }
+    return true;
+}
+
+static void count_Zone_Conditions(const zoneIndex* index, uint32_t* conditionCounts)
+{
+    safe_memset(conditionCounts, sizeof(uint32_t) * ZONE_CONDITION_COUNT, 0, sizeof(uint32_t) * ZONE_CONDITION_COUNT);
+    for (uint32_t entry = UINT32_C(0); entry < index->zoneCount; ++entry)
+    {
+        conditionCounts[index->condition[entry] & 0x0F] += UINT32_C(1);
+    }
+}
+
+// The drive can report how many zones match each of these reporting options with a single small REPORT ZONES, so
+// these counts are always current and are used to check that a cached snapshot still describes the drive.
+static const struct
+{
+    eZoneReportingOptions option;
+    uint8_t               condition;
+} zoneConditionOptions[] = {
+    {ZONE_REPORT_LIST_ALL_ZONES_THAT_ARE_NOT_WRITE_POINTERS, ZONE_CONDITION_NOT_WRITE_POINTER},
+    {ZONE_REPORT_LIST_EMPTY_ZONES,                           ZONE_CONDITION_EMPTY_ZONE       },
+    {ZONE_REPORT_LIST_IMPLICIT_OPEN_ZONES,                   ZONE_CONDITION_IMPLICIT_OPEN    },
+    {ZONE_REPORT_LIST_EXPLICIT_OPEN_ZONES,                   ZONE_CONDITION_EXPLICIT_OPEN    },
+    {ZONE_REPORT_LIST_CLOSED_ZONES,                          ZONE_CONDITION_CLOSED_ZONE      },
+    {ZONE_REPORT_LIST_READ_ONLY_ZONES,                       ZONE_CONDITION_READ_ONLY_ZONE   },
+    {ZONE_REPORT_LIST_FULL_ZONES,                            ZONE_CONDITION_FULL_ZONE        },
+    {ZONE_REPORT_LIST_OFFLINE_ZONES,                         ZONE_CONDITION_OFFLINE_ZONE     },
+};
+
+static bool get_Zone_Condition_Counts(tDevice* device, uint32_t* conditionCounts)
+{
+    safe_memset(conditionCounts, sizeof(uint32_t) * ZONE_CONDITION_COUNT, 0, sizeof(uint32_t) * ZONE_CONDITION_COUNT);
+    for (size_t iter = SIZE_T_C(0); iter < sizeof(zoneConditionOptions) / sizeof(zoneConditionOptions[0]); ++iter)
+    {
+        if (SUCCESS != get_Number_Of_Zones(device, zoneConditionOptions[iter].option, UINT64_C(0),
+                                           &conditionCounts[zoneConditionOptions[iter].condition]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool zone_Condition_Counts_Match(const uint32_t* deviceCounts, const zoneIndex* index)
+{
+    DECLARE_ZERO_INIT_ARRAY(uint32_t, indexCounts, ZONE_CONDITION_COUNT);
+    count_Zone_Conditions(index, indexCounts);
+    for (size_t iter = SIZE_T_C(0); iter < sizeof(zoneConditionOptions) / sizeof(zoneConditionOptions[0]); ++iter)
+    {
+        if (deviceCounts[zoneConditionOptions[iter].condition] != indexCounts[zoneConditionOptions[iter].condition])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void set_Zone_Snapshot_Little_Endian_Value(uint8_t* data, size_t length, uint64_t value)
+{
+    for (size_t iter = SIZE_T_C(0); iter < length; ++iter)
+    {
+        data[iter] = M_Byte0(value >> (iter * SIZE_T_C(8)));
+    }
+}
+
+static uint64_t get_Zone_Snapshot_Little_Endian_Value(const uint8_t* data, size_t length)
+{
+    uint64_t value = UINT64_C(0);
+    for (size_t iter = length; iter > SIZE_T_C(0); --iter)
+    {
+        value = (value << 8) | data[iter - SIZE_T_C(1)];
+    }
+    return value;
+}
+
+// FNV-1a of the start LBA and write pointer of the first page of zones. A single REPORT ZONES from the device is
+// enough to tell that those zones were reset or rewritten since a snapshot was saved, even when the per condition
+// counts still match.
+static uint32_t get_Zone_Index_Fingerprint(const zoneIndex* index)
+{
+    uint32_t fingerprint = UINT32_C(2166136261);
+    uint32_t zones       = M_Min(index->zoneCount, REPORT_ZONES_PAGE_ZONES);
+    for (uint32_t entry = UINT32_C(0); entry < zones; ++entry)
+    {
+        uint64_t values[2] = {index->startLBA[entry], index->writePointerOffset[entry]};
+        for (size_t value = SIZE_T_C(0); value < SIZE_T_C(2); ++value)
+        {
+            for (size_t byte = SIZE_T_C(0); byte < sizeof(uint64_t); ++byte)
+            {
+                fingerprint ^= M_Byte0(values[value] >> (byte * SIZE_T_C(8)));
+                fingerprint *= UINT32_C(16777619);
+            }
+        }
+    }
+    return fingerprint;
+}
+
+static bool get_Device_Zone_Fingerprint(tDevice* device, uint32_t zoneCount, uint32_t* fingerprint)
+{
+    bool      read = false;
+    zoneIndex firstPage;
+    safe_memset(&firstPage, sizeof(zoneIndex), 0, sizeof(zoneIndex));
+    if (allocate_Zone_Index(&firstPage, M_Min(zoneCount, REPORT_ZONES_PAGE_ZONES)) &&
+        SUCCESS == read_Zone_Pages(device, ZONE_REPORT_LIST_ALL_ZONES, UINT64_C(0), firstPage.capacity,
+                                   add_Zone_Page_To_Index, &firstPage))
+    {
+        *fingerprint = get_Zone_Index_Fingerprint(&firstPage);
+        read         = true;
+    }
+    free_Zone_Index(&firstPage);
+    return read;
+}
+
+// Snapshot file layout, all values little endian:
+//   0   "OSCZONES"               8 byte signature
+//   8   version                  uint16, 2
+//   10  reserved                 2 bytes
+//   12  zone count               uint32
+//   16  max LBA                  uint64
+//   24  logical block size       uint32
+//   28  first page fingerprint   uint32, see get_Zone_Index_Fingerprint
+//   32  zone condition counts    16 uint32s
+//   96  serial number            40 bytes, zero padded
+//   136 one 18 byte record per zone: start LBA (8), length (4), write pointer offset (4), type (1), condition (1)
+static bool load_Zone_Snapshot(const char* fileName,
+                               tDevice*    device,
+                               uint32_t    zoneCount,
+                               uint32_t    fingerprint,
+                               zoneIndex*  index)
+{
+    bool            loaded   = false;
+    secureFileInfo* snapshot = secure_Open_File(fileName, "rb", M_NULLPTR, M_NULLPTR, M_NULLPTR);
+    DECLARE_ZERO_INIT_ARRAY(uint8_t, header, ZONE_SNAPSHOT_HEADER_LENGTH);
+    DECLARE_ZERO_INIT_ARRAY(char, serialNumber, ZONE_SNAPSHOT_SERIAL_LENGTH + 1);
+    if (snapshot == M_NULLPTR || snapshot->error != SEC_FILE_SUCCESS)
+    {
+        free_Secure_File_Info(&snapshot);
+        return false;
+    }
+    if (SEC_FILE_SUCCESS == secure_Read_File(snapshot, header, ZONE_SNAPSHOT_HEADER_LENGTH, sizeof(uint8_t),
+                                             ZONE_SNAPSHOT_HEADER_LENGTH, M_NULLPTR))
+    {
+        safe_memcpy(serialNumber, ZONE_SNAPSHOT_SERIAL_LENGTH + 1, &header[ZONE_SNAPSHOT_SERIAL_OFFSET],
+                    ZONE_SNAPSHOT_SERIAL_LENGTH);
+    }
+    if (memcmp(header, ZONE_SNAPSHOT_SIGNATURE, ZONE_SNAPSHOT_SIGNATURE_LENGTH) == 0 &&
+        get_Zone_Snapshot_Little_Endian_Value(&header[8], SIZE_T_C(2)) == ZONE_SNAPSHOT_VERSION &&
+        get_Zone_Snapshot_Little_Endian_Value(&header[12], SIZE_T_C(4)) == zoneCount &&
+        get_Zone_Snapshot_Little_Endian_Value(&header[16], SIZE_T_C(8)) == device->drive_info.deviceMaxLba &&
+        get_Zone_Snapshot_Little_Endian_Value(&header[28], SIZE_T_C(4)) == fingerprint &&
+        strncmp(serialNumber, device->drive_info.serialNumber, ZONE_SNAPSHOT_SERIAL_LENGTH) == 0 &&
+        allocate_Zone_Index(index, zoneCount))
+    {
+        DECLARE_ZERO_INIT_ARRAY(uint8_t, records, REPORT_ZONES_PAGE_ZONES * ZONE_SNAPSHOT_RECORD_LENGTH);
+        loaded = true;
+        for (uint32_t entry = UINT32_C(0); loaded && entry < zoneCount; entry += REPORT_ZONES_PAGE_ZONES)
+        {
+            uint32_t batch = M_Min(zoneCount - entry, REPORT_ZONES_PAGE_ZONES);
+            loaded         = SEC_FILE_SUCCESS ==
+                     secure_Read_File(snapshot, records, sizeof(records), ZONE_SNAPSHOT_RECORD_LENGTH, batch, M_NULLPTR);
+            for (uint32_t record = UINT32_C(0); loaded && record < batch; ++record)
+            {
+                const uint8_t* data = &records[record * ZONE_SNAPSHOT_RECORD_LENGTH];
+                index->startLBA[entry + record] = get_Zone_Snapshot_Little_Endian_Value(&data[0], SIZE_T_C(8));
+                index->length[entry + record] =
+                    C_CAST(uint32_t, get_Zone_Snapshot_Little_Endian_Value(&data[8], SIZE_T_C(4)));
+                index->writePointerOffset[entry + record] =
+                    C_CAST(uint32_t, get_Zone_Snapshot_Little_Endian_Value(&data[12], SIZE_T_C(4)));
+                index->type[entry + record]      = data[16];
+                index->condition[entry + record] = data[17];
+            }
+        }
+        if (loaded)
+        {
+            index->zoneCount = zoneCount;
+        }
+        else
+        {
+            free_Zone_Index(index);
+        }
+    }
+    secure_Close_File(snapshot);
+    free_Secure_File_Info(&snapshot);
+    return loaded;
+}
+
+static eReturnValues save_Zone_Snapshot(const char* fileName, tDevice* device, const zoneIndex* index)
+{
+    eReturnValues   ret      = SUCCESS;
+    secureFileInfo* snapshot = secure_Open_File(fileName, "wb", M_NULLPTR, M_NULLPTR, M_NULLPTR);
+    DECLARE_ZERO_INIT_ARRAY(uint8_t, header, ZONE_SNAPSHOT_HEADER_LENGTH);
+    DECLARE_ZERO_INIT_ARRAY(uint32_t, conditionCounts, ZONE_CONDITION_COUNT);
+    DECLARE_ZERO_INIT_ARRAY(uint8_t, records, REPORT_ZONES_PAGE_ZONES * ZONE_SNAPSHOT_RECORD_LENGTH);
+    if (snapshot == M_NULLPTR || snapshot->error != SEC_FILE_SUCCESS)
+    {
+        ret = (snapshot != M_NULLPTR && snapshot->error == SEC_FILE_INSECURE_PATH) ? INSECURE_PATH : FILE_OPEN_ERROR;
+        free_Secure_File_Info(&snapshot);
+        return ret;
+    }
+    safe_memcpy(header, ZONE_SNAPSHOT_HEADER_LENGTH, ZONE_SNAPSHOT_SIGNATURE, ZONE_SNAPSHOT_SIGNATURE_LENGTH);
+    set_Zone_Snapshot_Little_Endian_Value(&header[8], SIZE_T_C(2), ZONE_SNAPSHOT_VERSION);
+    set_Zone_Snapshot_Little_Endian_Value(&header[12], SIZE_T_C(4), index->zoneCount);
+    set_Zone_Snapshot_Little_Endian_Value(&header[16], SIZE_T_C(8), device->drive_info.deviceMaxLba);
+    set_Zone_Snapshot_Little_Endian_Value(&header[24], SIZE_T_C(4), device->drive_info.deviceBlockSize);
+    set_Zone_Snapshot_Little_Endian_Value(&header[28], SIZE_T_C(4), get_Zone_Index_Fingerprint(index));
+    count_Zone_Conditions(index, conditionCounts);
+    for (size_t condition = SIZE_T_C(0); condition < ZONE_CONDITION_COUNT; ++condition)
+    {
+        set_Zone_Snapshot_Little_Endian_Value(&header[SIZE_T_C(32) + condition * SIZE_T_C(4)], SIZE_T_C(4),
+                                              conditionCounts[condition]);
+    }
+    safe_memcpy(&header[ZONE_SNAPSHOT_SERIAL_OFFSET], ZONE_SNAPSHOT_SERIAL_LENGTH, device->drive_info.serialNumber,
+                M_Min(safe_strlen(device->drive_info.serialNumber), ZONE_SNAPSHOT_SERIAL_LENGTH));
+    if (SEC_FILE_SUCCESS != secure_Write_File(snapshot, header, ZONE_SNAPSHOT_HEADER_LENGTH, sizeof(uint8_t),
+                                              ZONE_SNAPSHOT_HEADER_LENGTH, M_NULLPTR))
+    {
+        ret = ERROR_WRITING_FILE;
+    }
+    for (uint32_t entry = UINT32_C(0); ret == SUCCESS && entry < index->zoneCount; entry += REPORT_ZONES_PAGE_ZONES)
+    {
+        uint32_t batch = M_Min(index->zoneCount - entry, REPORT_ZONES_PAGE_ZONES);
+        for (uint32_t record = UINT32_C(0); record < batch; ++record)
+        {
+            uint8_t* data = &records[record * ZONE_SNAPSHOT_RECORD_LENGTH];
+            set_Zone_Snapshot_Little_Endian_Value(&data[0], SIZE_T_C(8), index->startLBA[entry + record]);
+            set_Zone_Snapshot_Little_Endian_Value(&data[8], SIZE_T_C(4), index->length[entry + record]);
+            set_Zone_Snapshot_Little_Endian_Value(&data[12], SIZE_T_C(4), index->writePointerOffset[entry + record]);
+            data[16] = index->type[entry + record];
+            data[17] = index->condition[entry + record];
+        }
+        if (SEC_FILE_SUCCESS !=
+            secure_Write_File(snapshot, records, sizeof(records), ZONE_SNAPSHOT_RECORD_LENGTH, batch, M_NULLPTR))
+        {
+            ret = ERROR_WRITING_FILE;
+        }
+    }
+    if (ret == SUCCESS && SEC_FILE_SUCCESS != secure_Flush_File(snapshot))
+    {
+        ret = ERROR_WRITING_FILE;
+    }
+    if (SEC_FILE_SUCCESS != secure_Close_File(snapshot) && ret == SUCCESS)
+    {
+        ret = ERROR_WRITING_FILE;
+    }
+    free_Secure_File_Info(&snapshot);
+    return ret;
+}
+
+static void print_Zone_Capacity_Line(const char* label, uint64_t lbas, uint32_t logicalBlockSize)
+{
+    double capacity = C_CAST(double, lbas) * C_CAST(double, logicalBlockSize);
+    DECLARE_ZERO_INIT_ARRAY(char, unitBuffer, UNIT_STRING_LENGTH);
+    char* unit = &unitBuffer[0];
+    metric_Unit_Convert(&capacity, &unit);
+    printf("\t%-34s %" PRIu64 " LBAs (%0.02f %s)\n", label, lbas, capacity, unit);
+}
+
+static void print_Zone_Summary(tDevice* device, const zoneIndex* index, bool fromSnapshot)
+{
+    DECLARE_ZERO_INIT_ARRAY(uint32_t, conditionCounts, ZONE_CONDITION_COUNT);
+    uint64_t sequentialLBAs   = UINT64_C(0);
+    uint64_t writtenLBAs      = UINT64_C(0);
+    uint32_t partialZones     = UINT32_C(0);
+    uint64_t partialFill      = UINT64_C(0);
+    uint32_t emptyRuns        = UINT32_C(0);
+    uint32_t longestEmptyRun  = UINT32_C(0);
+    uint64_t longestEmptyLBAs = UINT64_C(0);
+    uint32_t currentRun       = UINT32_C(0);
+    uint64_t currentRunLBAs   = UINT64_C(0);
+    count_Zone_Conditions(index, conditionCounts);
+    for (uint32_t entry = UINT32_C(0); entry < index->zoneCount; ++entry)
+    {
+        if (index->condition[entry] != ZONE_CONDITION_NOT_WRITE_POINTER)
+        {
+            sequentialLBAs += index->length[entry];
+            writtenLBAs += index->writePointerOffset[entry];
+            if (index->writePointerOffset[entry] > UINT32_C(0) &&
+                index->writePointerOffset[entry] < index->length[entry])
+            {
+                ++partialZones;
+                partialFill += (C_CAST(uint64_t, index->writePointerOffset[entry]) * UINT64_C(100)) /
+                               index->length[entry];
+            }
+        }
+        // runs of consecutive empty zones show how fragmented the free space is
+        if (index->condition[entry] == ZONE_CONDITION_EMPTY_ZONE)
+        {
+            if (currentRun == UINT32_C(0))
+            {
+                ++emptyRuns;
+            }
+            ++currentRun;
+            currentRunLBAs += index->length[entry];
+            if (currentRun > longestEmptyRun)
+            {
+                longestEmptyRun  = currentRun;
+                longestEmptyLBAs = currentRunLBAs;
+            }
+        }
+        else
+        {
+            currentRun     = UINT32_C(0);
+            currentRunLBAs = UINT64_C(0);
+        }
+    }
+    printf("\nZone Summary (%s)\n", fromSnapshot ? "cached snapshot, active zones refreshed" : "read from device");
+    printf("\t%-34s %" PRIu32 "\n", "Zones:", index->zoneCount);
+    printf("\t%-34s %" PRIu32 "\n", "Not write pointer (conventional):",
+           conditionCounts[ZONE_CONDITION_NOT_WRITE_POINTER]);
+    printf("\t%-34s %" PRIu32 "\n", "Empty:", conditionCounts[ZONE_CONDITION_EMPTY_ZONE]);
+    printf("\t%-34s %" PRIu32 "\n", "Implicitly opened:", conditionCounts[ZONE_CONDITION_IMPLICIT_OPEN]);
+    printf("\t%-34s %" PRIu32 "\n", "Explicitly opened:", conditionCounts[ZONE_CONDITION_EXPLICIT_OPEN]);
+    printf("\t%-34s %" PRIu32 "\n", "Closed:", conditionCounts[ZONE_CONDITION_CLOSED_ZONE]);
+    printf("\t%-34s %" PRIu32 "\n", "Full:", conditionCounts[ZONE_CONDITION_FULL_ZONE]);
+    printf("\t%-34s %" PRIu32 "\n", "Inactive:", conditionCounts[ZONE_CONDITION_INACTIVE_ZONE]);
+    printf("\t%-34s %" PRIu32 "\n", "Read only:", conditionCounts[ZONE_CONDITION_READ_ONLY_ZONE]);
+    printf("\t%-34s %" PRIu32 "\n", "Offline:", conditionCounts[ZONE_CONDITION_OFFLINE_ZONE]);
+    print_Zone_Capacity_Line("Write pointer zone capacity:", sequentialLBAs, device->drive_info.deviceBlockSize);
+    print_Zone_Capacity_Line("Written capacity:", writtenLBAs, device->drive_info.deviceBlockSize);
+    if (sequentialLBAs > UINT64_C(0))
+    {
+        printf("\t%-34s %0.02f%%\n", "Written:",
+               (C_CAST(double, writtenLBAs) * 100.0) / C_CAST(double, sequentialLBAs));
+    }
+    printf("\t%-34s %" PRIu32, "Partially written zones:", partialZones);
+    if (partialZones > UINT32_C(0))
+    {
+        printf(" (average %" PRIu64 "%% full)", partialFill / partialZones);
+    }
+    print_str("\n");
+    printf("\t%-34s %" PRIu32 "\n", "Runs of consecutive empty zones:", emptyRuns);
+    printf("\t%-34s %" PRIu32 " zones\n", "Longest run of empty zones:", longestEmptyRun);
+    print_Zone_Capacity_Line("Longest contiguous empty space:", longestEmptyLBAs, device->drive_info.deviceBlockSize);
+}
+
+// Builds the zone index in a single streaming pass, or from snapshotFile when the drive's zone condition counts still
+// match it. Active zones are always read again, so counts and written capacity are current either way. A reset zone
+// that was refilled between summaries is not seen through a snapshot, which only affects the empty zone run figures.
+static eReturnValues run_Zone_Summary(tDevice* device, const char* snapshotFile, eVerbosityLevels toolVerbosity)
+{
+    eReturnValues ret          = SUCCESS;
+    uint32_t      zoneCount    = UINT32_C(0);
+    uint32_t      fingerprint  = UINT32_C(0);
+    bool          fromSnapshot = false;
+    zoneIndex     index;
+    DECLARE_ZERO_INIT_ARRAY(uint32_t, deviceCounts, ZONE_CONDITION_COUNT);
+    safe_memset(&index, sizeof(zoneIndex), 0, sizeof(zoneIndex));
+    ret = get_Number_Of_Zones(device, ZONE_REPORT_LIST_ALL_ZONES, UINT64_C(0), &zoneCount);
+    if (ret != SUCCESS)
+    {
+        return ret;
+    }
+    if (snapshotFile != M_NULLPTR && get_Zone_Condition_Counts(device, deviceCounts) &&
+        get_Device_Zone_Fingerprint(device, zoneCount, &fingerprint) &&
+        load_Zone_Snapshot(snapshotFile, device, zoneCount, fingerprint, &index))
+    {
+        static const eZoneReportingOptions activeOptions[] = {ZONE_REPORT_LIST_IMPLICIT_OPEN_ZONES,
+                                                              ZONE_REPORT_LIST_EXPLICIT_OPEN_ZONES,
+                                                              ZONE_REPORT_LIST_CLOSED_ZONES};
+        fromSnapshot = true;
+        for (size_t iter = SIZE_T_C(0); iter < sizeof(activeOptions) / sizeof(activeOptions[0]); ++iter)
+        {
+            uint32_t activeZones = UINT32_C(0);
+            if (SUCCESS != get_Number_Of_Zones(device, activeOptions[iter], UINT64_C(0), &activeZones) ||
+                SUCCESS != read_Zone_Pages(device, activeOptions[iter], UINT64_C(0), activeZones,
+                                           update_Zone_Page_In_Index, &index))
+            {
+                fromSnapshot = false;
+                break;
+            }
+        }
+        fromSnapshot = fromSnapshot && zone_Condition_Counts_Match(deviceCounts, &index);
+    }
+    if (!fromSnapshot)
+    {
+        if (!allocate_Zone_Index(&index, zoneCount))
+        {
+            return MEMORY_FAILURE;
+        }
+        ret = read_Zone_Pages(device, ZONE_REPORT_LIST_ALL_ZONES, UINT64_C(0), zoneCount, add_Zone_Page_To_Index,
+                              &index);
+    }
+    if (ret == SUCCESS)
+    {
+        if (toolVerbosity > VERBOSITY_QUIET)
+        {
+            print_Zone_Summary(device, &index, fromSnapshot);
+        }
+        if (snapshotFile != M_NULLPTR)
+        {
+            ret = save_Zone_Snapshot(snapshotFile, device, &index);
+        }
+    }
+    free_Zone_Index(&index);
+    return ret;
+}
+
+static bool parse_Zone_Reporting_Mode(const char* mode, int* reportingMode)
+{
+    static const struct
+    {
+        const char*           name;
+        eZoneReportingOptions option;
+    } reportingModes[] = {
+        {"all",                     ZONE_REPORT_LIST_ALL_ZONES                            },
+        {"empty",                   ZONE_REPORT_LIST_EMPTY_ZONES                          },
+        {"implicitOpen",            ZONE_REPORT_LIST_IMPLICIT_OPEN_ZONES                  },
+        {"explicitOpen",            ZONE_REPORT_LIST_EXPLICIT_OPEN_ZONES                  },
+        {"closed",                  ZONE_REPORT_LIST_CLOSED_ZONES                         },
+        {"full",                    ZONE_REPORT_LIST_FULL_ZONES                           },
+        {"readOnly",                ZONE_REPORT_LIST_READ_ONLY_ZONES                      },
+        {"offline",                 ZONE_REPORT_LIST_OFFLINE_ZONES                        },
+        {"resetRecommended",        ZONE_REPORT_LIST_ZONES_WITH_RESET_SET_TO_ONE          },
+        {"nonSeqResourceAvailable", ZONE_REPORT_LIST_ZONES_WITH_NON_SEQ_SET_TO_ONE        },
+        {"allNonWP",                ZONE_REPORT_LIST_ALL_ZONES_THAT_ARE_NOT_WRITE_POINTERS},
+    };
+    for (size_t iter = SIZE_T_C(0); iter < sizeof(reportingModes) / sizeof(reportingModes[0]); ++iter)
+    {
+        if (strcmp(mode, reportingModes[iter].name) == 0)
+        {
+            *reportingMode = C_CAST(int, reportingModes[iter].option);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Largest ZONE COUNT field in the zone management commands
+#define BULK_ZONE_MAX_BATCH UINT32_C(0xFFFF)
+
+typedef eReturnValues (*zoneActionFunction)(tDevice* device, bool allZones, uint64_t zoneID, uint16_t zoneCount);
+
+// Which zones a bulk open/close/finish/reset acts on. Either a list of zone IDs, or zoneCount zones (0 for every
+// zone) from startZoneID, in both cases limited to the zones REPORT ZONES returns for filter.
+typedef struct s_bulkZoneOptions
+{
+    bool                  allZones;
+    uint64_t              startZoneID;
+    uint32_t              zoneCount;
+    const uint64_t*       zoneIDs;
+    uint32_t              zoneIDCount;
+    eZoneReportingOptions filter;
+    bool                  batch;
+} bulkZoneOptions;
+
+typedef struct s_zoneListSelection
+{
+    zoneIndex*      selection;
+    const uint64_t* zoneIDs;
+    uint32_t        zoneIDCount;
+} zoneListSelection;
+
+static bool select_Listed_Zones(const zoneDescriptor* zones, uint32_t zoneCount, uint32_t firstZone, void* context)
+{
+    zoneListSelection* list = C_CAST(zoneListSelection*, context);
+    M_USE_UNUSED(firstZone);
+    for (uint32_t zoneIter = UINT32_C(0); zoneIter < zoneCount; ++zoneIter)
+    {
+        uint64_t zoneStart = zones[zoneIter].zoneStartingLBA;
+        if (zoneStart > list->zoneIDs[list->zoneIDCount - UINT32_C(1)])
+        {
+            // past the last listed zone so no need to read any further
+            return false;
+        }
+        uint32_t entry = find_Sorted_LBA(list->zoneIDs, list->zoneIDCount, zoneStart);
+        if (entry < list->zoneIDCount && list->zoneIDs[entry] == zoneStart &&
+            list->selection->zoneCount < list->selection->capacity)
+        {
+            set_Zone_Index_Entry(list->selection, list->selection->zoneCount, &zones[zoneIter]);
+            list->selection->zoneCount += UINT32_C(1);
+        }
+    }
+    return true;
+}
+
+static int compare_Uint64(const void* a, const void* b)
+{
+    uint64_t first  = *C_CAST(const uint64_t*, a);
+    uint64_t second = *C_CAST(const uint64_t*, b);
+    return (first > second) - (first < second);
+}
+
+// Reads zone IDs (the LBA at the start of each zone) from a text file. IDs are separated by whitespace or commas and
+// anything after a # on a line is ignored. The list is returned sorted with duplicates removed.
+static eReturnValues read_Zone_List_File(const char* fileName, uint64_t** zoneIDs, uint32_t* zoneIDCount)
+{
+    eReturnValues   ret      = SUCCESS;
+    char*           fileData = M_NULLPTR;
+    secureFileInfo* zoneList = secure_Open_File(fileName, "r", M_NULLPTR, M_NULLPTR, M_NULLPTR);
+    *zoneIDs                 = M_NULLPTR;
+    *zoneIDCount             = UINT32_C(0);
+    if (zoneList == M_NULLPTR || zoneList->error != SEC_FILE_SUCCESS)
+    {
+        printf("Unable to open zone list %s\n", fileName);
+        free_Secure_File_Info(&zoneList);
+        return FILE_OPEN_ERROR;
+    }
+    size_t dataLength = C_CAST(size_t, zoneList->fileSize);
+    size_t bytesRead  = SIZE_T_C(0);
+    fileData          = C_CAST(char*, safe_calloc(dataLength + SIZE_T_C(1), sizeof(char)));
+    // every ID takes at least one character and one separator
+    *zoneIDs = C_CAST(uint64_t*, safe_calloc(dataLength / SIZE_T_C(2) + SIZE_T_C(1), sizeof(uint64_t)));
+    if (fileData == M_NULLPTR || *zoneIDs == M_NULLPTR)
+    {
+        ret = MEMORY_FAILURE;
+    }
+    else if (dataLength > SIZE_T_C(0) &&
+             SEC_FILE_SUCCESS != secure_Read_File(zoneList, fileData, dataLength + SIZE_T_C(1), sizeof(char),
+                                                  dataLength, &bytesRead) &&
+             bytesRead == SIZE_T_C(0))
+    {
+        printf("Unable to read zone list %s\n", fileName);
+        ret = FILE_READ_ERROR;
+    }
+    else
+    {
+        char* token = fileData;
+        for (size_t offset = SIZE_T_C(0); offset <= bytesRead && ret == SUCCESS; ++offset)
+        {
+            char current = offset < bytesRead ? fileData[offset] : '\0';
+            if (current == '#')
+            {
+                while (offset < bytesRead && fileData[offset] != '\n')
+                {
+                    fileData[offset] = '\0';
+                    ++offset;
+                }
+                current = '\0';
+            }
+            if (current == '\0' || current == ',' || current == '\n' || current == '\r' || current == ' ' ||
+                current == '\t')
+            {
+                fileData[offset < bytesRead ? offset : bytesRead] = '\0';
+                if (safe_strlen(token) > SIZE_T_C(0))
+                {
+                    if (get_And_Validate_Integer_Input_Uint64(token, M_NULLPTR, ALLOW_UNIT_NONE,
+                                                              &(*zoneIDs)[*zoneIDCount]))
+                    {
+                        *zoneIDCount += UINT32_C(1);
+                    }
+                    else
+                    {
+                        printf("Invalid zone ID \"%s\" in %s\n", token, fileName);
+                        ret = BAD_PARAMETER;
+                    }
+                }
+                token = &fileData[offset + SIZE_T_C(1)];
+            }
+        }
+    }
+    if (ret == SUCCESS && *zoneIDCount > UINT32_C(1))
+    {
+        uint32_t unique = UINT32_C(1);
+        qsort(*zoneIDs, *zoneIDCount, sizeof(uint64_t), compare_Uint64);
+        for (uint32_t iter = UINT32_C(1); iter < *zoneIDCount; ++iter)
+        {
+            if ((*zoneIDs)[iter] != (*zoneIDs)[unique - UINT32_C(1)])
+            {
+                (*zoneIDs)[unique] = (*zoneIDs)[iter];
+                ++unique;
+            }
+        }
+        *zoneIDCount = unique;
+    }
+    else if (ret == SUCCESS && *zoneIDCount == UINT32_C(0))
+    {
+        printf("No zone IDs found in %s\n", fileName);
+        ret = BAD_PARAMETER;
+    }
+    if (ret != SUCCESS)
+    {
+        safe_free(zoneIDs);
+        *zoneIDCount = UINT32_C(0);
+    }
+    safe_free(&fileData);
+    secure_Close_File(zoneList);
+    free_Secure_File_Info(&zoneList);
+    return ret;
+}
+
+static eReturnValues select_Bulk_Zones(tDevice* device, const bulkZoneOptions* options, zoneIndex* selection)
+{
+    uint64_t startLBA       = options->allZones ? UINT64_C(0) : options->startZoneID;
+    uint32_t availableZones = UINT32_C(0);
+    uint32_t wantedZones    = UINT32_C(0);
+    if (options->zoneIDs != M_NULLPTR)
+    {
+        startLBA = options->zoneIDs[0];
+    }
+    eReturnValues ret = get_Number_Of_Zones(device, options->filter, startLBA, &availableZones);
+    if (ret != SUCCESS || availableZones == UINT32_C(0))
+    {
+        return ret;
+    }
+    if (options->zoneIDs != M_NULLPTR)
+    {
+        wantedZones = M_Min(availableZones, options->zoneIDCount);
+    }
+    else
+    {
+        wantedZones = options->zoneCount > UINT32_C(0) ? M_Min(availableZones, options->zoneCount) : availableZones;
+    }
+    if (!allocate_Zone_Index(selection, wantedZones))
+    {
+        return MEMORY_FAILURE;
+    }
+    if (options->zoneIDs != M_NULLPTR)
+    {
+        zoneListSelection list = {selection, options->zoneIDs, options->zoneIDCount};
+        ret = read_Zone_Pages(device, options->filter, startLBA, availableZones, select_Listed_Zones, &list);
+    }
+    else
+    {
+        ret = read_Zone_Pages(device, options->filter, startLBA, wantedZones, add_Zone_Page_To_Index, selection);
+    }
+    return ret;
+}
+
+// Runs action over the selected zones back to back on the open handle, timing every command. With batch set,
+// consecutive zones are sent as one command using the ZONE COUNT field (ZBC-2/ZAC-2), which drives that predate it
+// will reject.
+static eReturnValues run_Bulk_Zone_Action(tDevice*               device,
+                                          const bulkZoneOptions* options,
+                                          zoneActionFunction     action,
+                                          const char*            actionName,
+                                          eVerbosityLevels       toolVerbosity)
+{
+    eReturnValues ret         = SUCCESS;
+    uint32_t      commands    = UINT32_C(0);
+    uint32_t      zonesDone   = UINT32_C(0);
+    uint32_t      failedZones = UINT32_C(0);
+    uint64_t*     latencies   = M_NULLPTR;
+    zoneIndex     selection;
+    DECLARE_SEATIMER(totalTimer);
+    safe_memset(&selection, sizeof(zoneIndex), 0, sizeof(zoneIndex));
+    ret = select_Bulk_Zones(device, options, &selection);
+    if (ret != SUCCESS || selection.zoneCount == UINT32_C(0))
+    {
+        if (ret == SUCCESS && toolVerbosity > VERBOSITY_QUIET)
+        {
+            printf("No zones matched, nothing to %s.\n", actionName);
+        }
+        free_Zone_Index(&selection);
+        return ret;
+    }
+    if (options->zoneIDs != M_NULLPTR && selection.zoneCount < options->zoneIDCount && toolVerbosity > VERBOSITY_QUIET)
+    {
+        printf("%" PRIu32 " of %" PRIu32 " listed zone IDs are not the start of a zone matching the filter, skipping "
+               "them.\n",
+               options->zoneIDCount - selection.zoneCount, options->zoneIDCount);
+    }
+    latencies = C_CAST(uint64_t*, safe_calloc(selection.zoneCount, sizeof(uint64_t)));
+    if (latencies == M_NULLPTR)
+    {
+        free_Zone_Index(&selection);
+        return MEMORY_FAILURE;
+    }
+    start_Timer(&totalTimer);
+    while (zonesDone < selection.zoneCount)
+    {
+        uint32_t batchZones = UINT32_C(1);
+        while (options->batch && batchZones < BULK_ZONE_MAX_BATCH && zonesDone + batchZones < selection.zoneCount &&
+               selection.startLBA[zonesDone + batchZones] ==
+                   selection.startLBA[zonesDone + batchZones - UINT32_C(1)] +
+                       selection.length[zonesDone + batchZones - UINT32_C(1)])
+        {
+            ++batchZones;
+        }
+        DECLARE_SEATIMER(commandTimer);
+        start_Timer(&commandTimer);
+        eReturnValues actionRet = action(device, false, selection.startLBA[zonesDone],
+                                         options->batch ? C_CAST(uint16_t, batchZones) : UINT16_C(0));
+        stop_Timer(&commandTimer);
+        latencies[commands] = get_Nano_Seconds(commandTimer);
+        ++commands;
+        if (actionRet == NOT_SUPPORTED)
+        {
+            ret = NOT_SUPPORTED;
+            break;
+        }
+        else if (actionRet != SUCCESS)
+        {
+            ret = FAILURE;
+            failedZones += batchZones;
+            if (toolVerbosity > VERBOSITY_QUIET)
+            {
+                printf("Failed to %s %" PRIu32 " zone(s) starting at zone %" PRIu64 "\n", actionName, batchZones,
+                       selection.startLBA[zonesDone]);
+            }
+        }
+        zonesDone += batchZones;
+    }
+    stop_Timer(&totalTimer);
+    if (toolVerbosity > VERBOSITY_QUIET && commands > UINT32_C(0))
+    {
+        uint64_t latencySum = UINT64_C(0);
+        double   seconds    = get_Seconds(totalTimer);
+        qsort(latencies, commands, sizeof(uint64_t), compare_Uint64);
+        for (uint32_t iter = UINT32_C(0); iter < commands; ++iter)
+        {
+            latencySum += latencies[iter];
+        }
+        printf("\n%s: %" PRIu32 " zone(s) in %" PRIu32 " command(s), %" PRIu32 " failed\n", actionName, zonesDone,
+               commands, failedZones);
+        printf("\tTotal time: %0.03f seconds", seconds);
+        if (seconds > 0.0)
+        {
+            printf(" (%0.01f zones/second)", C_CAST(double, zonesDone) / seconds);
+        }
+        print_str("\n");
+        printf("\tCommand latency (ms): min %0.03f, avg %0.03f, p50 %0.03f, p99 %0.03f, max %0.03f\n",
+               C_CAST(double, latencies[0]) / 1000000.0,
+               C_CAST(double, latencySum) / C_CAST(double, commands) / 1000000.0,
+               C_CAST(double, latencies[(commands - UINT32_C(1)) / UINT32_C(2)]) / 1000000.0,
+               C_CAST(double, latencies[(C_CAST(uint64_t, commands - UINT32_C(1)) * UINT64_C(99)) / UINT64_C(100)]) /
+                   1000000.0,
+               C_CAST(double, latencies[commands - UINT32_C(1)]) / 1000000.0);
+    }
+    safe_free(&latencies);
+    free_Zone_Index(&selection);
+    return ret;
+}
+
+static int bulk_Zone_Action_Exit_Code(eReturnValues ret)
+{
+    switch (ret)
+    {
+    case SUCCESS:
+        return UTIL_EXIT_NO_ERROR;
+    case NOT_SUPPORTED:
+        return UTIL_EXIT_OPERATION_NOT_SUPPORTED;
+    default:
+        return UTIL_EXIT_OPERATION_FAILURE;
+    }
+}
+
+#define ZONE_WRITE_BENCHMARK_MAX_ZONES       UINT32_C(256)
+#define ZONE_TYPE_SEQUENTIAL_WRITE_REQUIRED  0x2
+#define ZONE_TYPE_SEQUENTIAL_WRITE_PREFERRED 0x3
+
+typedef struct s_zoneWriteStats
+{
+    uint64_t writePointer;
+    uint64_t zoneEnd;
+    uint64_t bytesWritten;
+    uint64_t busyNanoSeconds;
+    uint64_t minLatency;
+    uint64_t maxLatency;
+    uint32_t commands;
+    bool     finished;
+    bool     failed;
+} zoneWriteStats;
+
+static bool select_Empty_Sequential_Zones(const zoneDescriptor* zones,
+                                          uint32_t              zoneCount,
+                                          uint32_t              firstZone,
+                                          void*                 context)
+{
+    zoneIndex* selection = C_CAST(zoneIndex*, context);
+    M_USE_UNUSED(firstZone);
+    for (uint32_t zoneIter = UINT32_C(0); zoneIter < zoneCount && selection->zoneCount < selection->capacity;
+         ++zoneIter)
+    {
+        if (zones[zoneIter].zoneType == ZONE_TYPE_SEQUENTIAL_WRITE_REQUIRED ||
+            zones[zoneIter].zoneType == ZONE_TYPE_SEQUENTIAL_WRITE_PREFERRED)
+        {
+            set_Zone_Index_Entry(selection, selection->zoneCount, &zones[zoneIter]);
+            selection->zoneCount += UINT32_C(1);
+        }
+    }
+    return selection->zoneCount < selection->capacity;
+}
+
+static void print_Zone_Write_Benchmark(const zoneIndex*      zones,
+                                       const zoneWriteStats* stats,
+                                       uint64_t              totalBytes,
+                                       double                elapsedSeconds)
+{
+    printf("\n%-20s %12s %12s %14s %14s %14s\n", "Zone Start LBA", "MiB Written", "MB/s", "Avg Lat (ms)",
+           "Min Lat (ms)", "Max Lat (ms)");
+    for (uint32_t zoneIter = UINT32_C(0); zoneIter < zones->zoneCount; ++zoneIter)
+    {
+        const zoneWriteStats* zone       = &stats[zoneIter];
+        double                throughput = 0.0;
+        double                average    = 0.0;
+        if (zone->busyNanoSeconds > UINT64_C(0))
+        {
+            throughput = (C_CAST(double, zone->bytesWritten) * 1000.0) / C_CAST(double, zone->busyNanoSeconds);
+        }
+        if (zone->commands > UINT32_C(0))
+        {
+            average = C_CAST(double, zone->busyNanoSeconds) / C_CAST(double, zone->commands) / 1000000.0;
+        }
+        printf("%-20" PRIu64 " %12.02f %12.02f %14.03f %14.03f %14.03f%s\n", zones->startLBA[zoneIter],
+               C_CAST(double, zone->bytesWritten) / 1048576.0, throughput, average,
+               C_CAST(double, zone->minLatency) / 1000000.0, C_CAST(double, zone->maxLatency) / 1000000.0,
+               zone->failed ? " (write failed)" : "");
+    }
+    printf("\nWrote %0.02f MiB to %" PRIu32 " open zone(s) in %0.03f seconds", C_CAST(double, totalBytes) / 1048576.0,
+           zones->zoneCount, elapsedSeconds);
+    if (elapsedSeconds > 0.0)
+    {
+        printf(" (%0.02f MB/s)", C_CAST(double, totalBytes) / elapsedSeconds / 1000000.0);
+    }
+    print_str("\n");
+}
+
+// Explicitly opens openZones empty sequential zones and writes them together, one transfer per zone in turn, always
+// writing at each zone's write pointer until zoneLimitBytes (0 fills the zone) is written. Only empty zones are used
+// and every zone is reset again afterwards, even if a write failed, so the zones are returned to the state they were
+// found in.
+static eReturnValues run_Zone_Write_Benchmark(tDevice*         device,
+                                              uint32_t         openZones,
+                                              uint32_t         transferBytes,
+                                              uint64_t         zoneLimitBytes,
+                                              eVerbosityLevels toolVerbosity)
+{
+    eReturnValues   ret          = SUCCESS;
+    uint32_t        emptyZones   = UINT32_C(0);
+    uint32_t        openedZones  = UINT32_C(0);
+    uint64_t        totalBytes   = UINT64_C(0);
+    uint64_t        plannedBytes = UINT64_C(0);
+    uint64_t        limitLBAs    = UINT64_C(0);
+    uint32_t        blockSize    = device->drive_info.deviceBlockSize;
+    uint32_t        blocksPerIO  = UINT32_C(0);
+    uint8_t*        pattern     = M_NULLPTR;
+    zoneWriteStats* stats       = M_NULLPTR;
+    zoneIndex       zones;
+    DECLARE_SEATIMER(benchmarkTimer);
+    safe_memset(&zones, sizeof(zoneIndex), 0, sizeof(zoneIndex));
+    if (blockSize == UINT32_C(0))
+    {
+        return BAD_PARAMETER;
+    }
+    blocksPerIO = M_Max(UINT32_C(1), transferBytes / blockSize);
+    if (zoneLimitBytes > UINT64_C(0))
+    {
+        limitLBAs = M_Max(UINT64_C(1), zoneLimitBytes / blockSize);
+    }
+    ret = get_Number_Of_Zones(device, ZONE_REPORT_LIST_EMPTY_ZONES, UINT64_C(0), &emptyZones);
+    if (ret != SUCCESS)
+    {
+        return ret;
+    }
+    if (emptyZones == UINT32_C(0) || !allocate_Zone_Index(&zones, openZones))
+    {
+        return emptyZones == UINT32_C(0) ? FAILURE : MEMORY_FAILURE;
+    }
+    ret = read_Zone_Pages(device, ZONE_REPORT_LIST_EMPTY_ZONES, UINT64_C(0), emptyZones, select_Empty_Sequential_Zones,
+                          &zones);
+    if (ret != SUCCESS || zones.zoneCount < openZones)
+    {
+        if (ret == SUCCESS && toolVerbosity > VERBOSITY_QUIET)
+        {
+            printf("Only %" PRIu32 " empty sequential zone(s) are available, %" PRIu32 " are needed.\n",
+                   zones.zoneCount, openZones);
+        }
+        free_Zone_Index(&zones);
+        return ret == SUCCESS ? FAILURE : ret;
+    }
+    stats   = C_CAST(zoneWriteStats*, safe_calloc(zones.zoneCount, sizeof(zoneWriteStats)));
+    pattern = C_CAST(uint8_t*, safe_calloc_aligned(C_CAST(size_t, blocksPerIO) * blockSize, sizeof(uint8_t),
+                                                   device->os_info.minimumAlignment));
+    if (stats == M_NULLPTR || pattern == M_NULLPTR)
+    {
+        safe_free(&stats);
+        safe_free_aligned(&pattern);
+        free_Zone_Index(&zones);
+        return MEMORY_FAILURE;
+    }
+    for (size_t offset = SIZE_T_C(0); offset < C_CAST(size_t, blocksPerIO) * blockSize; ++offset)
+    {
+        pattern[offset] = C_CAST(uint8_t, offset * SIZE_T_C(31) + SIZE_T_C(7));
+    }
+    for (uint32_t zoneIter = UINT32_C(0); zoneIter < zones.zoneCount; ++zoneIter)
+    {
+        stats[zoneIter].writePointer = zones.startLBA[zoneIter];
+        stats[zoneIter].zoneEnd      = zones.startLBA[zoneIter] + zones.length[zoneIter];
+        stats[zoneIter].minLatency   = UINT64_MAX;
+        if (limitLBAs > UINT64_C(0) && zones.length[zoneIter] > limitLBAs)
+        {
+            stats[zoneIter].zoneEnd = zones.startLBA[zoneIter] + limitLBAs;
+        }
+        plannedBytes += (stats[zoneIter].zoneEnd - zones.startLBA[zoneIter]) * blockSize;
+    }
+    // state the full volume before anything is opened or written since filling large zones can take a long time
+    if (toolVerbosity > VERBOSITY_QUIET)
+    {
+        printf("This will write %0.02f MiB to each of %" PRIu32 " zone(s), %0.02f MiB in total.\n",
+               C_CAST(double, plannedBytes) / C_CAST(double, zones.zoneCount) / 1048576.0, zones.zoneCount,
+               C_CAST(double, plannedBytes) / 1048576.0);
+        flush_stdout();
+    }
+    // explicitly open every zone first so the drive holds all of them open for the whole run
+    for (; openedZones < zones.zoneCount; ++openedZones)
+    {
+        ret = open_Zone(device, false, zones.startLBA[openedZones], UINT16_C(0));
+        if (ret != SUCCESS)
+        {
+            if (toolVerbosity > VERBOSITY_QUIET)
+            {
+                printf("Unable to open zone %" PRIu64 ". The drive may not support %" PRIu32 " open zones.\n",
+                       zones.startLBA[openedZones], zones.zoneCount);
+            }
+            break;
+        }
+    }
+    if (ret == SUCCESS)
+    {
+        bool zonesRemaining = true;
+        if (toolVerbosity > VERBOSITY_QUIET)
+        {
+            printf("Writing %" PRIu32 " open zone(s) at their write pointers, %" PRIu32 " bytes per write...\n",
+                   zones.zoneCount, blocksPerIO * blockSize);
+            flush_stdout();
+        }
+        start_Timer(&benchmarkTimer);
+        while (zonesRemaining)
+        {
+            zonesRemaining = false;
+            for (uint32_t zoneIter = UINT32_C(0); zoneIter < zones.zoneCount; ++zoneIter)
+            {
+                zoneWriteStats* zone = &stats[zoneIter];
+                if (zone->finished)
+                {
+                    continue;
+                }
+                uint32_t writeBlocks = C_CAST(uint32_t, M_Min(C_CAST(uint64_t, blocksPerIO),
+                                                              zone->zoneEnd - zone->writePointer));
+                DECLARE_SEATIMER(writeTimer);
+                start_Timer(&writeTimer);
+                eReturnValues writeRet = write_LBA(device, zone->writePointer, false, pattern, writeBlocks * blockSize);
+                stop_Timer(&writeTimer);
+                uint64_t latency = get_Nano_Seconds(writeTimer);
+                zone->commands += UINT32_C(1);
+                zone->busyNanoSeconds += latency;
+                zone->minLatency = M_Min(zone->minLatency, latency);
+                zone->maxLatency = M_Max(zone->maxLatency, latency);
+                if (writeRet != SUCCESS)
+                {
+                    zone->failed   = true;
+                    zone->finished = true;
+                    ret            = FAILURE;
+                    continue;
+                }
+                zone->writePointer += writeBlocks;
+                zone->bytesWritten += C_CAST(uint64_t, writeBlocks) * blockSize;
+                totalBytes += C_CAST(uint64_t, writeBlocks) * blockSize;
+                zone->finished = zone->writePointer >= zone->zoneEnd;
+                zonesRemaining = zonesRemaining || !zone->finished;
+            }
+        }
+        stop_Timer(&benchmarkTimer);
+        if (toolVerbosity > VERBOSITY_QUIET)
+        {
+            print_Zone_Write_Benchmark(&zones, stats, totalBytes, get_Seconds(benchmarkTimer));
+        }
+    }
+    // reset every zone that was opened, written or not, so none are left holding open zone resources or test data
+    for (uint32_t zoneIter = UINT32_C(0); zoneIter < openedZones; ++zoneIter)
+    {
+        if (SUCCESS != reset_Write_Pointer(device, false, zones.startLBA[zoneIter], UINT16_C(0)))
+        {
+            if (toolVerbosity > VERBOSITY_QUIET)
+            {
+                printf("Failed to reset the write pointer of zone %" PRIu64 "\n", zones.startLBA[zoneIter]);
+            }
+            ret = FAILURE;
+        }
+    }
+    safe_free(&stats);
+    safe_free_aligned(&pattern);
+    free_Zone_Index(&zones);
+    return ret;
+}
+
 //-----------------------------------------------------------------------------
 //
 //  main()
@@ -88,6 +1330,14 @@ int main(int argc, char* argv[])
     REPORT_ZONES_VARS
     ZONE_MANAGEMENT_VARS
     MAX_ZONES_VAR
+    ZONE_SUMMARY_VARS
+    ZONE_COUNT_VAR
+    ZONE_LIST_VAR
+    ZONE_FILTER_VARS
+    ZONE_BATCH_VAR
+    ZONE_WRITE_BENCHMARK_VARS
+    POSSIBLE_DATA_ERASE_VAR
+    DATA_ERASE_VAR
 
 #if defined(ENABLE_CSMI)
     CSMI_FORCE_VARS
@@ -134,6 +1384,15 @@ int main(int argc, char* argv[])
         OPEN_ZONE_LONG_OPT,
         RESET_WP_LONG_OPT,
         MAX_ZONES_LONG_OPT,
+        ZONE_SUMMARY_LONG_OPT,
+        ZONE_COUNT_LONG_OPT,
+        ZONE_LIST_LONG_OPT,
+        ZONE_FILTER_LONG_OPT,
+        ZONE_BATCH_LONG_OPT,
+        ZONE_WRITE_BENCHMARK_LONG_OPT,
+        ZONE_WRITE_TRANSFER_SIZE_LONG_OPT,
+        ZONE_WRITE_LIMIT_LONG_OPT,
+        CONFIRM_LONG_OPT,
 #if defined(ENABLE_CSMI)
         CSMI_VERBOSE_LONG_OPT,
         CSMI_FORCE_LONG_OPTS,
@@ -142,7 +1401,8 @@ int main(int argc, char* argv[])
     };
     // clang-format on
 
-    eVerbosityLevels toolVerbosity = VERBOSITY_DEFAULT;
+    eVerbosityLevels toolVerbosity      = VERBOSITY_DEFAULT;
+    const char*      zoneFilterArgument = M_NULLPTR;
 
 #if defined(UEFI_C_SOURCE)
     // NOTE: This is a BSD function used to ensure the program name is set correctly for warning or error functions.
@@ -203,54 +1463,177 @@ int main(int argc, char* argv[])
                     exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
                 }
             }
-            else if (strcmp(longopts[optionIndex].name, REPORT_ZONES_LONG_OPT_STRING) == 0)
+            else if (strcmp(longopts[optionIndex].name, ZONE_COUNT_LONG_OPT_STRING) == 0)
             {
-                REPORT_ZONES_FLAG = true;
-                if (strcmp(optarg, "all") == 0)
+                if (!get_And_Validate_Integer_Input_Uint32(C_CAST(const char*, optarg), M_NULLPTR, ALLOW_UNIT_NONE,
+                                                           &ZONE_COUNT_FLAG) ||
+                    ZONE_COUNT_FLAG == UINT32_C(0))
+                {
+                    print_Error_In_Cmd_Line_Args(ZONE_COUNT_LONG_OPT_STRING, optarg);
+                    exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
+                }
+            }
+            else if (strcmp(longopts[optionIndex].name, ZONE_LIST_LONG_OPT_STRING) == 0)
+            {
+                ZONE_LIST_FLAG = optarg;
+            }
+            else if (strcmp(longopts[optionIndex].name, ZONE_FILTER_LONG_OPT_STRING) == 0)
+            {
+                ZONE_FILTER_FLAG   = true;
+                zoneFilterArgument = optarg;
+                if (!parse_Zone_Reporting_Mode(optarg, &ZONE_FILTER_MODE_FLAG) ||
+                    ZONE_FILTER_MODE_FLAG == ZONE_REPORT_LIST_ALL_ZONES ||
+                    ZONE_FILTER_MODE_FLAG == ZONE_REPORT_LIST_ALL_ZONES_THAT_ARE_NOT_WRITE_POINTERS)
+                {
+                    print_Error_In_Cmd_Line_Args(ZONE_FILTER_LONG_OPT_STRING, optarg);
+                    exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
+                }
+            }
+            else if (strcmp(longopts[optionIndex].name, ZONE_WRITE_BENCHMARK_LONG_OPT_STRING) == 0)
+            {
+                ZONE_WRITE_BENCHMARK_FLAG = true;
+                if (optarg == M_NULLPTR && optind < argc && argv[optind][0] != '-')
+                {
+                    optarg = argv[optind++];
+                }
+                if (optarg != M_NULLPTR &&
+                    (!get_And_Validate_Integer_Input_Uint32(optarg, M_NULLPTR, ALLOW_UNIT_NONE,
+                                                            &ZONE_WRITE_BENCHMARK_ZONES) ||
+                     ZONE_WRITE_BENCHMARK_ZONES == UINT32_C(0) ||
+                     ZONE_WRITE_BENCHMARK_ZONES > ZONE_WRITE_BENCHMARK_MAX_ZONES))
+                {
+                    print_Error_In_Cmd_Line_Args(ZONE_WRITE_BENCHMARK_LONG_OPT_STRING, optarg);
+                    exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
+                }
+            }
+            else if (strcmp(longopts[optionIndex].name, ZONE_WRITE_TRANSFER_SIZE_LONG_OPT_STRING) == 0)
+            {
+                char*    unit       = M_NULLPTR;
+                uint32_t multiplier = UINT32_C(1);
+                if (!get_And_Validate_Integer_Input_Uint32(optarg, &unit, ALLOW_UNIT_DATASIZE,
+                                                           &ZONE_WRITE_BENCHMARK_TRANSFER))
+                {
+                    print_Error_In_Cmd_Line_Args(ZONE_WRITE_TRANSFER_SIZE_LONG_OPT_STRING, optarg);
+                    exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
+                }
+                if (unit == M_NULLPTR || strcmp(unit, "") == 0)
                 {
-                    REPORT_ZONES_REPORTING_MODE_FLAG = ZONE_REPORT_LIST_ALL_ZONES;
+                    multiplier = UINT32_C(1);
                 }
-                else if (strcmp(optarg, "empty") == 0)
+                else if (strcmp(unit, "KB") == 0)
                 {
-                    REPORT_ZONES_REPORTING_MODE_FLAG = ZONE_REPORT_LIST_EMPTY_ZONES;
+                    multiplier = UINT32_C(1000);
                 }
-                else if (strcmp(optarg, "implicitOpen") == 0)
+                else if (strcmp(unit, "KiB") == 0)
                 {
-                    REPORT_ZONES_REPORTING_MODE_FLAG = ZONE_REPORT_LIST_IMPLICIT_OPEN_ZONES;
+                    multiplier = UINT32_C(1024);
                 }
-                else if (strcmp(optarg, "explicitOpen") == 0)
+                else if (strcmp(unit, "MB") == 0)
                 {
-                    REPORT_ZONES_REPORTING_MODE_FLAG = ZONE_REPORT_LIST_EXPLICIT_OPEN_ZONES;
+                    multiplier = UINT32_C(1000000);
                 }
-                else if (strcmp(optarg, "closed") == 0)
+                else if (strcmp(unit, "MiB") == 0)
                 {
-                    REPORT_ZONES_REPORTING_MODE_FLAG = ZONE_REPORT_LIST_CLOSED_ZONES;
+                    multiplier = UINT32_C(1048576);
                 }
-                else if (strcmp(optarg, "full") == 0)
+                else
                 {
-                    REPORT_ZONES_REPORTING_MODE_FLAG = ZONE_REPORT_LIST_FULL_ZONES;
+                    multiplier = UINT32_C(0);
                 }
-                else if (strcmp(optarg, "readOnly") == 0)
+                if (multiplier == UINT32_C(0) || ZONE_WRITE_BENCHMARK_TRANSFER == UINT32_C(0) ||
+                    ZONE_WRITE_BENCHMARK_TRANSFER > UINT32_MAX / multiplier)
                 {
-                    REPORT_ZONES_REPORTING_MODE_FLAG = ZONE_REPORT_LIST_READ_ONLY_ZONES;
+                    print_Error_In_Cmd_Line_Args(ZONE_WRITE_TRANSFER_SIZE_LONG_OPT_STRING, optarg);
+                    exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
                 }
-                else if (strcmp(optarg, "offline") == 0)
+                ZONE_WRITE_BENCHMARK_TRANSFER *= multiplier;
+            }
+            else if (strcmp(longopts[optionIndex].name, ZONE_WRITE_LIMIT_LONG_OPT_STRING) == 0)
+            {
+                if (strcmp(optarg, "all") == 0)
                 {
-                    REPORT_ZONES_REPORTING_MODE_FLAG = ZONE_REPORT_LIST_OFFLINE_ZONES;
+                    ZONE_WRITE_BENCHMARK_LIMIT = UINT64_C(0);
                 }
-                else if (strcmp(optarg, "resetRecommended") == 0)
+                else
                 {
-                    REPORT_ZONES_REPORTING_MODE_FLAG = ZONE_REPORT_LIST_ZONES_WITH_RESET_SET_TO_ONE;
+                    char*    unit       = M_NULLPTR;
+                    uint64_t multiplier = UINT64_C(1);
+                    if (!get_And_Validate_Integer_Input_Uint64(optarg, &unit, ALLOW_UNIT_DATASIZE,
+                                                               &ZONE_WRITE_BENCHMARK_LIMIT))
+                    {
+                        print_Error_In_Cmd_Line_Args(ZONE_WRITE_LIMIT_LONG_OPT_STRING, optarg);
+                        exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
+                    }
+                    if (unit == M_NULLPTR || strcmp(unit, "") == 0)
+                    {
+                        multiplier = UINT64_C(1);
+                    }
+                    else if (strcmp(unit, "KB") == 0)
+                    {
+                        multiplier = UINT64_C(1000);
+                    }
+                    else if (strcmp(unit, "KiB") == 0)
+                    {
+                        multiplier = UINT64_C(1024);
+                    }
+                    else if (strcmp(unit, "MB") == 0)
+                    {
+                        multiplier = UINT64_C(1000000);
+                    }
+                    else if (strcmp(unit, "MiB") == 0)
+                    {
+                        multiplier = UINT64_C(1048576);
+                    }
+                    else if (strcmp(unit, "GB") == 0)
+                    {
+                        multiplier = UINT64_C(1000000000);
+                    }
+                    else if (strcmp(unit, "GiB") == 0)
+                    {
+                        multiplier = UINT64_C(1073741824);
+                    }
+                    else
+                    {
+                        multiplier = UINT64_C(0);
+                    }
+                    if (multiplier == UINT64_C(0) || ZONE_WRITE_BENCHMARK_LIMIT == UINT64_C(0) ||
+                        ZONE_WRITE_BENCHMARK_LIMIT > UINT64_MAX / multiplier)
+                    {
+                        print_Error_In_Cmd_Line_Args(ZONE_WRITE_LIMIT_LONG_OPT_STRING, optarg);
+                        exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
+                    }
+                    ZONE_WRITE_BENCHMARK_LIMIT *= multiplier;
                 }
-                else if (strcmp(optarg, "nonSeqResourceAvailable") == 0)
+            }
+            else if (strcmp(longopts[optionIndex].name, CONFIRM_LONG_OPT_STRING) == 0)
+            {
+                if (strcmp(optarg, DATA_ERASE_ACCEPT_STRING) == 0)
                 {
-                    REPORT_ZONES_REPORTING_MODE_FLAG = ZONE_REPORT_LIST_ZONES_WITH_NON_SEQ_SET_TO_ONE;
+                    DATA_ERASE_FLAG = true;
                 }
-                else if (strcmp(optarg, "allNonWP") == 0)
+                else if (strcmp(optarg, POSSIBLE_DATA_ERASE_ACCEPT_STRING) == 0)
                 {
-                    REPORT_ZONES_REPORTING_MODE_FLAG = ZONE_REPORT_LIST_ALL_ZONES_THAT_ARE_NOT_WRITE_POINTERS;
+                    POSSIBLE_DATA_ERASE_FLAG = true;
                 }
                 else
+                {
+                    print_Error_In_Cmd_Line_Args(CONFIRM_LONG_OPT_STRING, optarg);
+                    exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
+                }
+            }
+            else if (strcmp(longopts[optionIndex].name, ZONE_SUMMARY_LONG_OPT_STRING) == 0)
+            {
+                ZONE_SUMMARY_FLAG = true;
+                if (optarg == M_NULLPTR && optind < argc && argv[optind][0] != '-')
+                {
+                    optarg = argv[optind++];
+                }
+                ZONE_SUMMARY_SNAPSHOT_FLAG = optarg;
+            }
+            else if (strcmp(longopts[optionIndex].name, REPORT_ZONES_LONG_OPT_STRING) == 0)
+            {
+                REPORT_ZONES_FLAG = true;
+                if (!parse_Zone_Reporting_Mode(optarg, &REPORT_ZONES_REPORTING_MODE_FLAG))
                 {
                     print_Error_In_Cmd_Line_Args(REPORT_ZONES_LONG_OPT_STRING, optarg);
                     exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
@@ -564,13 +1947,44 @@ int main(int argc, char* argv[])
     if (!(DEVICE_INFO_FLAG || TEST_UNIT_READY_FLAG ||
           LOWLEVEL_INFO_FLAG
           // check for other tool specific options here
-          || REPORT_ZONES_FLAG || CLOSE_ZONE_FLAG || FINISH_ZONE_FLAG || OPEN_ZONE_FLAG || RESET_WP_FLAG))
+          || REPORT_ZONES_FLAG || CLOSE_ZONE_FLAG || FINISH_ZONE_FLAG || OPEN_ZONE_FLAG || RESET_WP_FLAG ||
+          ZONE_SUMMARY_FLAG || ZONE_WRITE_BENCHMARK_FLAG))
     {
         utility_Usage(true);
         free_Handle_List(&HANDLE_LIST, DEVICE_LIST_COUNT);
         exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
     }
 
+    // the zone selection options only choose the zones the zone management options act on
+    if (!(CLOSE_ZONE_FLAG || FINISH_ZONE_FLAG || OPEN_ZONE_FLAG || RESET_WP_FLAG) &&
+        (ZONE_COUNT_FLAG > UINT32_C(0) || ZONE_LIST_FLAG != M_NULLPTR || ZONE_FILTER_FLAG || ZONE_BATCH_FLAG))
+    {
+        DECLARE_ZERO_INIT_ARRAY(char, zoneCountArgument, 11);
+        if (ZONE_COUNT_FLAG > UINT32_C(0))
+        {
+            snprintf_err_handle(zoneCountArgument, 11, "%" PRIu32, ZONE_COUNT_FLAG);
+            print_Error_In_Cmd_Line_Args(ZONE_COUNT_LONG_OPT_STRING, zoneCountArgument);
+        }
+        else if (ZONE_LIST_FLAG != M_NULLPTR)
+        {
+            print_Error_In_Cmd_Line_Args(ZONE_LIST_LONG_OPT_STRING, ZONE_LIST_FLAG);
+        }
+        else if (ZONE_FILTER_FLAG)
+        {
+            print_Error_In_Cmd_Line_Args(ZONE_FILTER_LONG_OPT_STRING, zoneFilterArgument);
+        }
+        else
+        {
+            print_Error_In_Cmd_Line_Args(ZONE_BATCH_LONG_OPT_STRING, "");
+        }
+        printf("--%s, --%s, --%s and --%s can only be used with --%s, --%s, --%s or --%s.\n",
+               ZONE_COUNT_LONG_OPT_STRING, ZONE_LIST_LONG_OPT_STRING, ZONE_FILTER_LONG_OPT_STRING,
+               ZONE_BATCH_LONG_OPT_STRING, CLOSE_ZONE_LONG_OPT_STRING, FINISH_ZONE_LONG_OPT_STRING,
+               OPEN_ZONE_LONG_OPT_STRING, RESET_WP_LONG_OPT_STRING);
+        free_Handle_List(&HANDLE_LIST, DEVICE_LIST_COUNT);
+        exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
+    }
+
     uint64_t flags = UINT64_C(0);
     DEVICE_LIST    = M_REINTERPRET_CAST(tDevice*, safe_calloc(DEVICE_LIST_COUNT, sizeof(tDevice)));
     if (!DEVICE_LIST)
@@ -728,6 +2142,43 @@ int main(int argc, char* argv[])
     }
     free_Handle_List(&HANDLE_LIST, DEVICE_LIST_COUNT);
 
+    // --zoneCount, --zoneList and --zoneFilter make the zone management options act on each selected zone in turn
+    bool bulkZoneSelection = ZONE_COUNT_FLAG > UINT32_C(0) || ZONE_LIST_FLAG != M_NULLPTR || ZONE_FILTER_FLAG;
+    uint64_t*       bulkZoneIDs     = M_NULLPTR;
+    uint32_t        bulkZoneIDCount = UINT32_C(0);
+    bulkZoneOptions bulkZones;
+    safe_memset(&bulkZones, sizeof(bulkZoneOptions), 0, sizeof(bulkZoneOptions));
+    if (bulkZoneSelection)
+    {
+        if (ZONE_LIST_FLAG != M_NULLPTR)
+        {
+            eReturnValues listRet = read_Zone_List_File(ZONE_LIST_FLAG, &bulkZoneIDs, &bulkZoneIDCount);
+            if (listRet != SUCCESS)
+            {
+                free_device_list(&DEVICE_LIST);
+                exit(listRet == FILE_OPEN_ERROR ? UTIL_EXIT_CANNOT_OPEN_FILE : UTIL_EXIT_ERROR_IN_COMMAND_LINE);
+            }
+        }
+        else if (ZONE_ID_FLAG == UINT64_MAX && !ZONE_ID_ALL_FLAG)
+        {
+            if (toolVerbosity > VERBOSITY_QUIET)
+            {
+                printf("You must use the --%s or --%s option to specify the zones.\n", ZONE_ID_LONG_OPT_STRING,
+                       ZONE_LIST_LONG_OPT_STRING);
+            }
+            free_device_list(&DEVICE_LIST);
+            exit(UTIL_EXIT_ERROR_IN_COMMAND_LINE);
+        }
+        bulkZones.allZones    = ZONE_ID_ALL_FLAG;
+        bulkZones.startZoneID = ZONE_ID_ALL_FLAG ? UINT64_C(0) : ZONE_ID_FLAG;
+        bulkZones.zoneCount   = ZONE_COUNT_FLAG;
+        bulkZones.zoneIDs     = bulkZoneIDs;
+        bulkZones.zoneIDCount = bulkZoneIDCount;
+        bulkZones.filter =
+            ZONE_FILTER_FLAG ? C_CAST(eZoneReportingOptions, ZONE_FILTER_MODE_FLAG) : ZONE_REPORT_LIST_ALL_ZONES;
+        bulkZones.batch = ZONE_BATCH_FLAG;
+    }
+
     uint32_t skippedDevices = UINT32_C(0);
     for (uint32_t deviceIter = UINT32_C(0); deviceIter < DEVICE_LIST_COUNT; ++deviceIter)
     {
@@ -916,7 +2367,35 @@ int main(int argc, char* argv[])
             continue;
         }
 
-        if (CLOSE_ZONE_FLAG)
+        if (bulkZoneSelection)
+        {
+            const struct
+            {
+                bool               requested;
+                zoneActionFunction action;
+                const char*        actionName;
+            } bulkActions[] = {
+                {CLOSE_ZONE_FLAG,  close_Zone,          "close" },
+                {FINISH_ZONE_FLAG, finish_Zone,         "finish"},
+                {OPEN_ZONE_FLAG,   open_Zone,           "open"  },
+                {RESET_WP_FLAG,    reset_Write_Pointer, "reset" },
+            };
+            for (size_t actionIter = SIZE_T_C(0); actionIter < sizeof(bulkActions) / sizeof(bulkActions[0]);
+                 ++actionIter)
+            {
+                if (bulkActions[actionIter].requested)
+                {
+                    int actionExit = bulk_Zone_Action_Exit_Code(
+                        run_Bulk_Zone_Action(&deviceList[deviceIter], &bulkZones, bulkActions[actionIter].action,
+                                             bulkActions[actionIter].actionName, toolVerbosity));
+                    if (actionExit != UTIL_EXIT_NO_ERROR)
+                    {
+                        exitCode = actionExit;
+                    }
+                }
+            }
+        }
+        if (CLOSE_ZONE_FLAG && !bulkZoneSelection)
         {
             if (ZONE_ID_FLAG == UINT64_MAX && !ZONE_ID_ALL_FLAG)
             {
@@ -964,7 +2443,7 @@ int main(int argc, char* argv[])
                 }
             }
         }
-        if (FINISH_ZONE_FLAG)
+        if (FINISH_ZONE_FLAG && !bulkZoneSelection)
         {
             if (ZONE_ID_FLAG == UINT64_MAX && !ZONE_ID_ALL_FLAG)
             {
@@ -1012,7 +2491,7 @@ int main(int argc, char* argv[])
                 }
             }
         }
-        if (OPEN_ZONE_FLAG)
+        if (OPEN_ZONE_FLAG && !bulkZoneSelection)
         {
             if (ZONE_ID_FLAG == UINT64_MAX && !ZONE_ID_ALL_FLAG)
             {
@@ -1060,7 +2539,7 @@ int main(int argc, char* argv[])
                 }
             }
         }
-        if (RESET_WP_FLAG)
+        if (RESET_WP_FLAG && !bulkZoneSelection)
         {
             if (ZONE_ID_FLAG == UINT64_MAX && !ZONE_ID_ALL_FLAG)
             {
@@ -1120,21 +2599,13 @@ int main(int argc, char* argv[])
                                                ZONE_ID_FLAG, &numberOfZones))
             {
                 numberOfZones = M_Min(MAX_ZONES_FLAG, numberOfZones);
-                ptrZoneDescriptor zoneDescriptors =
-                    M_REINTERPRET_CAST(ptrZoneDescriptor, safe_calloc(numberOfZones, sizeof(zoneDescriptor)));
-                if (!zoneDescriptors)
-                {
-                    perror("cannot allocate memory for zone descriptors");
-                    exit(UTIL_EXIT_OPERATION_FAILURE);
-                }
-                eReturnValues reportRet = get_Zone_Descriptors(
-                    &deviceList[deviceIter], C_CAST(eZoneReportingOptions, REPORT_ZONES_REPORTING_MODE_FLAG),
-                    ZONE_ID_FLAG, numberOfZones, zoneDescriptors);
+                eReturnValues reportRet =
+                    stream_Zone_Report(&deviceList[deviceIter],
+                                       C_CAST(eZoneReportingOptions, REPORT_ZONES_REPORTING_MODE_FLAG), ZONE_ID_FLAG,
+                                       numberOfZones, toolVerbosity);
                 switch (reportRet)
                 {
                 case SUCCESS:
-                    print_Zone_Descriptors(C_CAST(eZoneReportingOptions, REPORT_ZONES_REPORTING_MODE_FLAG),
-                                           numberOfZones, zoneDescriptors);
                     break;
                 case NOT_SUPPORTED:
                     exitCode = UTIL_EXIT_OPERATION_NOT_SUPPORTED;
@@ -1145,7 +2616,6 @@ int main(int argc, char* argv[])
                     print_str("Failed to get zones to report!\n");
                     break;
                 }
-                safe_free_zone_descriptor(&zoneDescriptors);
             }
             else
             {
@@ -1153,10 +2623,76 @@ int main(int argc, char* argv[])
                 exitCode = UTIL_EXIT_OPERATION_FAILURE;
             }
         }
+        if (ZONE_SUMMARY_FLAG)
+        {
+            switch (run_Zone_Summary(&deviceList[deviceIter], ZONE_SUMMARY_SNAPSHOT_FLAG, toolVerbosity))
+            {
+            case SUCCESS:
+                break;
+            case NOT_SUPPORTED:
+                exitCode = UTIL_EXIT_OPERATION_NOT_SUPPORTED;
+                print_str("Reporting zones is not supported on this device.\n");
+                break;
+            case INSECURE_PATH:
+            case FILE_OPEN_ERROR:
+                exitCode = UTIL_EXIT_CANNOT_OPEN_FILE;
+                printf("Unable to open zone snapshot %s for writing\n", ZONE_SUMMARY_SNAPSHOT_FLAG);
+                break;
+            case ERROR_WRITING_FILE:
+                exitCode = UTIL_EXIT_ERROR_WRITING_FILE;
+                printf("Unable to save the zone snapshot to %s\n", ZONE_SUMMARY_SNAPSHOT_FLAG);
+                break;
+            default:
+                exitCode = UTIL_EXIT_OPERATION_FAILURE;
+                print_str("Failed to summarize zones!\n");
+                break;
+            }
+        }
+        if (ZONE_WRITE_BENCHMARK_FLAG)
+        {
+            if (POSSIBLE_DATA_ERASE_FLAG || DATA_ERASE_FLAG)
+            {
+                switch (run_Zone_Write_Benchmark(&deviceList[deviceIter], ZONE_WRITE_BENCHMARK_ZONES,
+                                                 ZONE_WRITE_BENCHMARK_TRANSFER, ZONE_WRITE_BENCHMARK_LIMIT,
+                                                 toolVerbosity))
+                {
+                case SUCCESS:
+                    break;
+                case NOT_SUPPORTED:
+                    exitCode = UTIL_EXIT_OPERATION_NOT_SUPPORTED;
+                    if (toolVerbosity > VERBOSITY_QUIET)
+                    {
+                        print_str("The zone write benchmark is not supported on this device.\n");
+                    }
+                    break;
+                default:
+                    exitCode = UTIL_EXIT_OPERATION_FAILURE;
+                    if (toolVerbosity > VERBOSITY_QUIET)
+                    {
+                        print_str("The zone write benchmark failed.\n");
+                    }
+                    break;
+                }
+            }
+            else
+            {
+                exitCode = UTIL_EXIT_ERROR_IN_COMMAND_LINE;
+                if (toolVerbosity > VERBOSITY_QUIET)
+                {
+                    print_str("\n");
+                    printf("You must add the flag:\n\"%s\" \n", POSSIBLE_DATA_ERASE_ACCEPT_STRING);
+                    print_str("to the command line arguments to run the zone write benchmark.\n\n");
+                    printf("e.g.: %s -d %s --%s 8 --%s %s\n\n", util_name, deviceHandleExample,
+                           ZONE_WRITE_BENCHMARK_LONG_OPT_STRING, CONFIRM_LONG_OPT_STRING,
+                           POSSIBLE_DATA_ERASE_ACCEPT_STRING);
+                }
+            }
+        }
         // At this point, close the device handle since it is no longer needed. Do not put any further IO below this.
         close_Device(&deviceList[deviceIter]);
     }
     free_device_list(&DEVICE_LIST);
+    safe_free(&bulkZoneIDs);
     if (getDevsRet != SUCCESS && skippedDevices == DEVICE_LIST_COUNT)
     {
         switch (getDevsRet)
@@ -1209,6 +2745,8 @@ void utility_Usage(bool shortUsage)
     printf("\t%s -d %s --%s all\n", util_name, deviceHandleExample, REPORT_ZONES_LONG_OPT_STRING);
     printf("\t%s -d %s --%s empty --%s 256\n", util_name, deviceHandleExample, REPORT_ZONES_LONG_OPT_STRING,
            MAX_ZONES_LONG_OPT_STRING);
+    printf("\t%s -d %s --%s\n", util_name, deviceHandleExample, ZONE_SUMMARY_LONG_OPT_STRING);
+    printf("\t%s -d %s --%s zones.bin\n", util_name, deviceHandleExample, ZONE_SUMMARY_LONG_OPT_STRING);
     printf("\t%s -d %s --%s --%s 16\n", util_name, deviceHandleExample, OPEN_ZONE_LONG_OPT_STRING,
            ZONE_ID_LONG_OPT_STRING);
     printf("\t%s -d %s --%s --%s 16\n", util_name, deviceHandleExample, FINISH_ZONE_LONG_OPT_STRING,
@@ -1219,6 +2757,13 @@ void utility_Usage(bool shortUsage)
            ZONE_ID_LONG_OPT_STRING);
     printf("\t%s -d %s --%s --%s all\n", util_name, deviceHandleExample, RESET_WP_LONG_OPT_STRING,
            ZONE_ID_LONG_OPT_STRING);
+    printf("\t%s -d %s --%s --%s 524288 --%s 1000 --%s\n", util_name, deviceHandleExample,
+           RESET_WP_LONG_OPT_STRING, ZONE_ID_LONG_OPT_STRING, ZONE_COUNT_LONG_OPT_STRING, ZONE_BATCH_LONG_OPT_STRING);
+    printf("\t%s -d %s --%s --%s zones.txt --%s full\n", util_name, deviceHandleExample, RESET_WP_LONG_OPT_STRING,
+           ZONE_LIST_LONG_OPT_STRING, ZONE_FILTER_LONG_OPT_STRING);
+    printf("\t%s -d %s --%s 8 --%s 256KiB --%s 1GiB --%s %s\n", util_name, deviceHandleExample,
+           ZONE_WRITE_BENCHMARK_LONG_OPT_STRING, ZONE_WRITE_TRANSFER_SIZE_LONG_OPT_STRING,
+           ZONE_WRITE_LIMIT_LONG_OPT_STRING, CONFIRM_LONG_OPT_STRING, POSSIBLE_DATA_ERASE_ACCEPT_STRING);
 
     // return codes
     print_str("\nReturn codes\n");
@@ -1269,6 +2814,19 @@ void utility_Usage(bool shortUsage)
     print_Open_Zone_Help(shortUsage);
     print_Report_Zones_Help(shortUsage);
     print_Reset_Write_Pointer_Zone_Help(shortUsage);
+    print_Zone_Batch_Help(shortUsage);
+    print_Zone_Count_Help(shortUsage);
+    print_Zone_Filter_Help(shortUsage);
     print_Zone_ID_Help(shortUsage);
+    print_Zone_List_Help(shortUsage);
+    print_Zone_Summary_Help(shortUsage);
+    print_Zone_Write_Transfer_Size_Help(shortUsage);
+    print_Zone_Write_Limit_Help(shortUsage);
+
+    // data destructive commands - alphabetized
+    print_str("\nData Destructive Commands\n");
+    print_str("=========================\n");
+    // utility data destructive tests/operations go here
+    print_Zone_Write_Benchmark_Help(shortUsage);
 }
 